@@ -80,8 +80,8 @@ LOG ( "+++++++++++++++++++++++++++++++++++++++++++++++++++++++++" )
 
 #######################################################################################
 
-  #LOG ( "+++++  Checking for restrict keyword" )
-  #INCLUDE(CheckRestrictKeyword)
+  LOG ( "+++++  Checking for restrict keyword" )
+  INCLUDE(CheckRestrictKeyword)
 
 #######################################################################################
 
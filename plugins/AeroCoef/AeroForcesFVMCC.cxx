@@ -47,6 +47,7 @@ void AeroForcesFVMCC::defineConfigOptions(Config::OptionList& options)
   options.addConfigOption< bool >("AppendTime","Append time to file name.");
   options.addConfigOption< bool >("AppendIter","Append Iteration# to file name."); 
   options.addConfigOption< bool >("ReorderWallData","Reorder the wall data to make the file structured.");
+  options.addConfigOption< bool >("WriteWallData","Write the wall data (if false, only the aerodynamic coefficients are written).");
   options.addConfigOption< CFuint >("TID","Position of T in the state vector");
   options.addConfigOption< CFuint >("UID","Position of u in the state vector");
   options.addConfigOption< CFuint >("VID","Position of v in the state vector");
@@ -148,6 +149,9 @@ AeroForcesFVMCC::AeroForcesFVMCC(const std::string& name) :
   m_reorderWallData = true;
   setParameter("ReorderWallData",&m_reorderWallData);
   
+  m_writeWallData = true;
+  setParameter("WriteWallData",&m_writeWallData);
+  
   m_TID = 0;
   setParameter("TID",&m_TID);
 
@@ -441,7 +445,7 @@ void AeroForcesFVMCC::executeOnTrs()
   
   if (m_valuesMatRes.size() == 0) {initSurfaceResiduals();}
   prepareOutputFileAero();
-  prepareOutputFileWall();
+  if (m_writeWallData) {prepareOutputFileWall();}
   
   // this needs to be updated with the latest values
   m_fvmccData->getPolyReconstructor()->computeGradients();
@@ -477,8 +481,10 @@ void AeroForcesFVMCC::executeOnTrs()
   
   // all data are written on file at once to ease the parallel writing
   updateOutputFileAero(); 
-  updateOutputFileWall();
-  reorderOutputFileWall();
+  if (m_writeWallData) {
+    updateOutputFileWall();
+    reorderOutputFileWall();
+  }
   computeSurfaceResiduals(); 
   
   if (PE::GetPE().GetRank(nsp) == 0) {
@@ -3,6 +3,7 @@
 
 //////////////////////////////////////////////////////////////////////////////
 
+#include "Common/PE.hh"
 #include "Environment/SingleBehaviorFactory.hh"
 #include "Environment/FileHandlerOutput.hh"
 #include "MathTools/FunctionParser.hh"
@@ -10,6 +11,7 @@
 #include "Framework/DynamicDataSocketSet.hh"
 #include "Framework/DataSocketSink.hh"
 #include "Framework/FaceTrsGeoBuilder.hh"
+#include "AeroCoef/GatherWallData.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -101,6 +103,15 @@ protected:
     m_valuesMat(iVar, index) = value;
   }
   
+  /// Gather the wall data packed by all the processors on the first one,
+  /// in the order of the ranks, with a single collective call
+  /// @param localData  data packed by this processor
+  /// @param globalData data of all the processors (only filled in on the first one)
+  template <typename T>
+  void gatherWallData(const std::vector<T>& localData, std::vector<T>& globalData)
+  {
+    AeroCoef::gatherWallData(this->getMethodData().getNamespace(), localData, globalData);
+  }
   
   /// Initialize the surface residuals
   virtual void initSurfaceResiduals();
@@ -352,6 +363,9 @@ protected:
   ///flag for reordering the wall data to produce a structured file
   bool m_reorderWallData;
   
+  ///flag for writing the wall data (if false, only the aerodynamic coefficients are written)
+  bool m_writeWallData;
+  
   /// ID of temperature in gradient vars
   CFuint m_TID;
 
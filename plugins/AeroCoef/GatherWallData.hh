@@ -0,0 +1,65 @@
+#ifndef COOLFluiD_AeroCoef_GatherWallData_hh
+#define COOLFluiD_AeroCoef_GatherWallData_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+
+#include "Common/PE.hh"
+#include "Common/MPI/MPIError.hh"
+#include "Common/MPI/MPIStructDef.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace AeroCoef {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// Gather the wall data packed by all the processors on the first one,
+/// in the order of the ranks, with a single collective call
+/// @param nsp        namespace of the processors
+/// @param localData  data packed by this processor
+/// @param globalData data of all the processors (only filled in on the first one)
+template <typename T>
+void gatherWallData(const std::string& nsp,
+		    const std::vector<T>& localData,
+		    std::vector<T>& globalData)
+{
+  const CFuint nbProc = Common::PE::GetPE().GetProcessorCount(nsp);
+  const bool isRoot = (Common::PE::GetPE().GetRank(nsp) == 0);
+  MPI_Comm comm = Common::PE::GetPE().GetCommunicator(nsp);
+
+  int localSize = localData.size();
+  std::vector<int> counts(nbProc, 0);
+  Common::MPIError::getInstance().check
+    ("MPI_Gather", "AeroCoef::gatherWallData()",
+     MPI_Gather(&localSize, 1, MPI_INT, &counts[0], 1, MPI_INT, 0, comm));
+
+  std::vector<int> displs(nbProc, 0);
+  for (CFuint p = 1; p < nbProc; ++p) {
+    displs[p] = displs[p-1] + counts[p-1];
+  }
+  globalData.resize(isRoot ? displs[nbProc-1] + counts[nbProc-1] : 0);
+
+  // the buffers must be valid even when they are empty
+  T dummy = T();
+  T* sendPtr = (localSize > 0) ? const_cast<T*>(&localData[0]) : &dummy;
+  T* recvPtr = (globalData.size() > 0) ? &globalData[0] : &dummy;
+  Common::MPIError::getInstance().check
+    ("MPI_Gatherv", "AeroCoef::gatherWallData()",
+     MPI_Gatherv(sendPtr, localSize, Common::MPIStructDef::getMPIType(sendPtr),
+		 recvPtr, &counts[0], &displs[0], Common::MPIStructDef::getMPIType(recvPtr),
+		 0, comm));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace AeroCoef
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_AeroCoef_GatherWallData_hh
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "Framework/SubSystemStatus.hh"
 #include "Environment/SingleBehaviorFactory.hh"
 #include "Environment/FileHandlerOutput.hh"
@@ -321,74 +323,104 @@ void NavierStokesSkinFrictionHeatFluxCC::prepareOutputFileWall()
 void NavierStokesSkinFrictionHeatFluxCC::updateOutputFileWall()
 {  
   const std::string nsp = getMethodData().getNamespace();
-  PE::GetPE().setBarrier(nsp);
-  
-  // all processors will write their own data one after the other 
-  for (CFuint i = 0; i < PE::GetPE().GetProcessorCount(nsp); ++i) {
-    if (i == PE::GetPE().GetRank (nsp)) {
-      if (getCurrentTRS()->getLocalNbGeoEnts() > 0) {
-	SafePtr<TopologicalRegionSet> currTrs = getCurrentTRS();
-	boost::filesystem::path file = Environment::DirPaths::getInstance().getResultsDir() /
-	  boost::filesystem::path(m_nameOutputFileWall + currTrs->getName());
-	file = Framework::PathAppender::getInstance().appendAllInfo  
-	  (file,this->m_appendIter,this->m_appendTime,false);   
-     
-	SelfRegistPtr<Environment::FileHandlerOutput> fhandle =
-	  Environment::SingleBehaviorFactory<Environment::FileHandlerOutput>::getInstance().create();
-	ofstream& fout = fhandle->open(file, ios::app);
-	
-	Common::SafePtr<GeometricEntityPool<FaceTrsGeoBuilder> >
-	  geoBuilder = m_fvmccData->getFaceTrsGeoBuilder();
+  SafePtr<TopologicalRegionSet> currTrs = getCurrentTRS();
+  const CFuint dim = PhysicalModelStack::getActive()->getDim();
+  const CFuint nbVars = m_valuesMat.nbRows(); 
+  const CFuint recordSize = dim + nbVars;
+  
+  // each processor packs the records (face mid point and values) of its
+  // faces, which are then gathered and written by the first processor
+  vector<CFreal> localData;
+  if (currTrs->getLocalNbGeoEnts() > 0) {
+    Common::SafePtr<GeometricEntityPool<FaceTrsGeoBuilder> >
+      geoBuilder = m_fvmccData->getFaceTrsGeoBuilder();
+    
+    SafePtr<FaceTrsGeoBuilder> geoBuilderPtr = geoBuilder->getGeoBuilder();
+    geoBuilderPtr->setDataSockets(socket_states, socket_gstates, socket_nodes);
+    
+    FaceTrsGeoBuilder::GeoData& geoData = geoBuilder->getDataGE();
+    geoData.trs = currTrs;
+    geoData.isBFace = true;
+    
+    const CFuint nbTrsFaces = currTrs->getLocalNbGeoEnts();
+    localData.reserve(nbTrsFaces*recordSize);
+    for (CFuint iFace = 0; iFace < nbTrsFaces; ++iFace) {
+      // build the GeometricEntity
+      geoData.idx = iFace;
+      m_currFace = geoBuilder->buildGE();
+      m_fvmccData->getCurrentFace() = m_currFace;
+      
+      // only faces whose internal State is parallel updatable will write
+      // their data to avoid redudance due to overlap 
+      if (m_currFace->getState(0)->isParUpdatable()) {
+	const vector<Node*>& faceNodes = *m_currFace->getNodes();
+	const CFuint nbFaceNodes = faceNodes.size();
 	
-	SafePtr<FaceTrsGeoBuilder> geoBuilderPtr = geoBuilder->getGeoBuilder();
-	geoBuilderPtr->setDataSockets(socket_states, socket_gstates, socket_nodes);
+	// compute the face mid point
+	m_coord = 0.0;
+	for (CFuint iNode = 0; iNode < nbFaceNodes; ++iNode) {
+	  m_coord += *faceNodes[iNode];
+	}
+	m_coord /= nbFaceNodes;
 	
-	FaceTrsGeoBuilder::GeoData& geoData = geoBuilder->getDataGE();
-	geoData.trs = currTrs;
-	geoData.isBFace = true;
+	for (CFuint iDim = 0; iDim < dim; ++iDim) {
+	  localData.push_back(m_coord[iDim]);
+	}
 	
-	const CFuint nbTrsFaces = currTrs->getLocalNbGeoEnts();
-	for (CFuint iFace = 0; iFace < nbTrsFaces; ++iFace) {
-	  // build the GeometricEntity
-	  geoData.idx = iFace;
-	  m_currFace = geoBuilder->buildGE();
-	  m_fvmccData->getCurrentFace() = m_currFace;
-	  
-	  // only faces whose internal State is parallel updatable will write
-	  // their data to avoid redudance due to overlap 
-	  if (m_currFace->getState(0)->isParUpdatable()) {
-	    // compute the face normal
-	    const vector<Node*>& faceNodes = *m_currFace->getNodes();
-	    const CFuint nbFaceNodes = faceNodes.size();
-	    
-	    // compute the face mid point
-	    m_coord = 0.0;
-	    for (CFuint iNode = 0; iNode < nbFaceNodes; ++iNode) {
-	      m_coord += *faceNodes[iNode];
-	    }
-	    m_coord /= nbFaceNodes;
-	    
-	    fout << m_coord << " ";
-	   
-	    const CFuint index = m_mapTrsFaceToID.find(m_currFace->getID());
-	    const CFuint nbVars = m_valuesMat.nbRows(); 
-	    for (CFuint iVar = 0; iVar < nbVars; ++iVar) {
-	      fout << m_valuesMat(iVar, index) << " ";
-	    }
-	   fout << "\n";
-	  }
-	  
-	  geoBuilder->releaseGE();
+	const CFuint index = m_mapTrsFaceToID.find(m_currFace->getID());
+	for (CFuint iVar = 0; iVar < nbVars; ++iVar) {
+	  localData.push_back(m_valuesMat(iVar, index));
 	}
       }
+      
+      geoBuilder->releaseGE();
     }
+  }
+  
+  vector<CFreal> globalData;
+  gatherWallData(localData, globalData);
+  
+  if (PE::GetPE().GetRank(nsp) == 0) {
+    const CFuint nbRecords = globalData.size()/recordSize;
     
-    PE::GetPE().setBarrier(nsp);
+    // in 2D the records can be sorted by x to make the file structured
+    vector<pair<CFreal, CFuint> > order(nbRecords);
+    for (CFuint i = 0; i < nbRecords; ++i) {
+      order[i] = pair<CFreal, CFuint>(globalData[i*recordSize], i);
+    }
+    if (m_reorderWallData && dim == DIM_2D) {
+      std::stable_sort(order.begin(), order.end());
+    }
+    
+    boost::filesystem::path file = Environment::DirPaths::getInstance().getResultsDir() /
+      boost::filesystem::path(m_nameOutputFileWall + currTrs->getName());
+    file = Framework::PathAppender::getInstance().appendAllInfo  
+      (file,this->m_appendIter,this->m_appendTime,false);   
+    
+    SelfRegistPtr<Environment::FileHandlerOutput> fhandle =
+      Environment::SingleBehaviorFactory<Environment::FileHandlerOutput>::getInstance().create();
+    ofstream& fout = fhandle->open(file, ios::app);
+    
+    for (CFuint i = 0; i < nbRecords; ++i) {
+      const CFreal *const record = &globalData[order[i].second*recordSize];
+      for (CFuint iv = 0; iv < recordSize; ++iv) {
+	fout << record[iv] << " ";
+      }
+      fout << "\n";
+    }
+    fout.close();
   }
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
+void NavierStokesSkinFrictionHeatFluxCC::reorderOutputFileWall()
+{
+  // the records are already sorted in updateOutputFileWall()
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 void NavierStokesSkinFrictionHeatFluxCC::updateWriteData()
 {  
   const CFreal refLength = PhysicalModelStack::getActive()->getImplementor()->getRefLength();
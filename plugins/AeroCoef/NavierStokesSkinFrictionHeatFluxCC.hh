@@ -83,6 +83,12 @@ protected:
    */
   virtual void updateOutputFileWall();
   
+  /**
+   * Reorder the file with the wall data (nothing to do, since the
+   * gathered records are sorted before being written)
+   */
+  virtual void reorderOutputFileWall();
+  
   /**
    * Compute the required values
    */
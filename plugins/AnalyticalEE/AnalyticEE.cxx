@@ -1,6 +1,7 @@
 #include "AnalyticEE.hh"
 #include "Environment/ObjectProvider.hh"
 #include "Framework/SubSystemStatus.hh"
+#include "Framework/Profiler.hh"
 #include "AnalyticalEE/AnalyticalEE.hh"
 
 //////////////////////////////////////////////////////////////////////////////
@@ -86,14 +87,14 @@ void AnalyticEE::setMethodImpl()
   ErrorEstimatorMethod::setMethodImpl();
 
   setupCommandsAndStrategies();
-  m_setup->execute();
+  profileExecute(m_setup);
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
 void AnalyticEE::unsetMethodImpl()
 {
-  m_unSetup->execute();
+  profileExecute(m_unSetup);
   unsetupCommandsAndStrategies();
 
   ErrorEstimatorMethod::unsetMethodImpl();
@@ -111,7 +112,7 @@ void AnalyticEE::estimateImpl()
     // set the nodal states at first
     getMethodData()->getCollaborator<SpaceMethod>()->extrapolateStatesToNodes();
 
-    m_compute->execute();
+    profileExecute(m_compute);
   }
 }
 
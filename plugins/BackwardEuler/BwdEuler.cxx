@@ -11,6 +11,7 @@
 #include "Framework/LinearSystemSolver.hh"
 #include "Framework/CFL.hh"
 #include "Framework/SubSystemStatus.hh"
+#include "Framework/Profiler.hh"
 
 #include "BackwardEuler/BackwardEuler.hh"
 #include "BackwardEuler/BwdEuler.hh"
@@ -110,14 +111,14 @@ void BwdEuler::setMethodImpl()
 
   m_data->setLinearSystemSolver(getLinearSystemSolver());
   setupCommandsAndStrategies();
-  m_setup->execute();
+  profileExecute(m_setup);
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
 void BwdEuler::unsetMethodImpl()
 {
-  m_unSetup->execute();
+  profileExecute(m_unSetup);
   unsetupCommandsAndStrategies();
 }
 
@@ -151,7 +152,7 @@ void BwdEuler::takeStepImpl()
   timer.stop();
   CFLog(INFO, "BwdEuler : solved linear system in " << timer << "s\n");
 
-  m_updateSol->execute();
+  profileExecute(m_updateSol);
 
   ConvergenceMethod::syncGlobalDataComputeResidual(true);
 
@@ -0,0 +1,429 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <fstream>
+#include <boost/bind.hpp>
+
+#include "Common/ChunkedThreads.hh"
+#include "Common/StringOps.hh"
+#include "Common/CFLog.hh"
+#include "Common/BadValueException.hh"
+#include "Common/NotImplementedException.hh"
+#include "Framework/BlockAccumulator.hh"
+
+#include "BlockLSS/BlockCSRMatrix.hh"
+#include "BlockLSS/BlockLSSVector.hh"
+#include "BlockLSS/BlockMatrixOps.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Common;
+using namespace COOLFluiD::Framework;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+BlockCSRMatrix::BlockCSRMatrix() :
+  Framework::LSSMatrix(),
+  m_nb(0),
+  m_nbCols(0),
+  m_rowPtr(1, 0),
+  m_colIdx(),
+  m_diagIdx(),
+  m_values()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+BlockCSRMatrix::~BlockCSRMatrix()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockCSRMatrix::createBlockCSR(const CFuint blockSize,
+                                    const CFuint nbCols,
+                                    const std::vector<CFuint>& rowPtr,
+                                    const std::vector<CFuint>& colIdx)
+{
+  CFAUTOTRACE;
+
+  cf_assert(blockSize > 0);
+  cf_assert(rowPtr.size() > 0);
+  cf_assert(rowPtr.back() == colIdx.size());
+
+  m_nb = blockSize;
+  m_nbCols = nbCols;
+  m_rowPtr = rowPtr;
+  m_colIdx = colIdx;
+
+  const CFuint nbRows = getNbBlockRows();
+  m_diagIdx.resize(nbRows);
+  for (CFuint iRow = 0; iRow < nbRows; ++iRow) {
+    const CFint pos = findBlock(iRow, iRow);
+    if (pos < 0) {
+      throw BadValueException
+        (FromHere(), "BlockCSRMatrix::createBlockCSR() => missing diagonal block in row " +
+         StringOps::to_str(iRow));
+    }
+    m_diagIdx[iRow] = pos;
+  }
+
+  m_values.assign(m_colIdx.size()*m_nb*m_nb, 0.);
+
+  CFLog(VERBOSE, "BlockCSRMatrix::createBlockCSR() => " << nbRows << " block rows, "
+        << m_colIdx.size() << " blocks of size " << m_nb << "\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockCSRMatrix::destroy()
+{
+  m_nb = 0;
+  m_nbCols = 0;
+  m_rowPtr.assign(1, 0);
+  vector<CFuint>().swap(m_colIdx);
+  vector<CFuint>().swap(m_diagIdx);
+  vector<CFreal>().swap(m_values);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockCSRMatrix::createSeqAIJ(const CFint m, const CFint n, const CFint nz,
+                                  const CFint* nnz, const char* name)
+{
+  throw NotImplementedException
+    (FromHere(), "BlockCSRMatrix::createSeqAIJ() => use createBlockCSR()");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockCSRMatrix::createSeqBAIJ(const CFuint blockSize, const CFint m, const CFint n,
+                                   const CFint nz, const CFint* nnz, const char* name)
+{
+  throw NotImplementedException
+    (FromHere(), "BlockCSRMatrix::createSeqBAIJ() => use createBlockCSR()");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+#ifdef CF_HAVE_MPI
+void BlockCSRMatrix::createParAIJ(MPI_Comm comm, const CFint m, const CFint n,
+                                  const CFint M, const CFint N,
+                                  const CFint dnz, const CFint* dnnz,
+                                  const CFint onz, const CFint* onnz,
+                                  const char* name)
+{
+  throw NotImplementedException
+    (FromHere(), "BlockCSRMatrix::createParAIJ() => use createBlockCSR()");
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+
+#ifdef CF_HAVE_MPI
+void BlockCSRMatrix::createParBAIJ(MPI_Comm comm, const CFuint blockSize,
+                                   const CFint m, const CFint n,
+                                   const CFint M, const CFint N,
+                                   const CFint dnz, const CFint* dnnz,
+                                   const CFint onz, const CFint* onnz,
+                                   const char* name)
+{
+  throw NotImplementedException
+    (FromHere(), "BlockCSRMatrix::createParBAIJ() => use createBlockCSR()");
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockCSRMatrix::printToScreen() const
+{
+  const CFuint nbRows = getNbBlockRows();
+  const CFuint nb2 = m_nb*m_nb;
+  for (CFuint iRow = 0; iRow < nbRows; ++iRow) {
+    for (CFuint pos = m_rowPtr[iRow]; pos < m_rowPtr[iRow+1]; ++pos) {
+      const CFreal *const block = &m_values[pos*nb2];
+      for (CFuint ib = 0; ib < m_nb; ++ib) {
+        for (CFuint jb = 0; jb < m_nb; ++jb) {
+          CFout << iRow*m_nb + ib << " " << m_colIdx[pos]*m_nb + jb << " "
+                << block[ib*m_nb + jb] << "\n";
+        }
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockCSRMatrix::printToFile(const char* fileName) const
+{
+  ofstream file(fileName);
+  file.precision(14);
+
+  const CFuint nbRows = getNbBlockRows();
+  const CFuint nb2 = m_nb*m_nb;
+  file << "% " << nbRows*m_nb << " " << m_nbCols*m_nb << " "
+       << m_colIdx.size()*nb2 << "\n";
+  for (CFuint iRow = 0; iRow < nbRows; ++iRow) {
+    for (CFuint pos = m_rowPtr[iRow]; pos < m_rowPtr[iRow+1]; ++pos) {
+      const CFreal *const block = &m_values[pos*nb2];
+      for (CFuint ib = 0; ib < m_nb; ++ib) {
+        for (CFuint jb = 0; jb < m_nb; ++jb) {
+          file << iRow*m_nb + ib << " " << m_colIdx[pos]*m_nb + jb << " "
+               << block[ib*m_nb + jb] << "\n";
+        }
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFint BlockCSRMatrix::findBlock(const CFuint row, const CFuint col) const
+{
+  cf_assert(row < getNbBlockRows());
+  const vector<CFuint>::const_iterator first = m_colIdx.begin() + m_rowPtr[row];
+  const vector<CFuint>::const_iterator last = m_colIdx.begin() + m_rowPtr[row+1];
+  const vector<CFuint>::const_iterator it = lower_bound(first, last, col);
+  return (it != last && *it == col) ? static_cast<CFint>(it - m_colIdx.begin()) : -1;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockCSRMatrix::notFoundIndex(const CFint im, const CFint in) const
+{
+  const string msg = "BlockCSRMatrix index (" + StringOps::to_str(im) + "," +
+    StringOps::to_str(in) + ") not allocated";
+  CFLog(ERROR, msg << "\n");
+  throw BadValueException (FromHere(), msg);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFreal& BlockCSRMatrix::getEntry(const CFint im, const CFint in)
+{
+  cf_assert(im >= 0 && in >= 0);
+  const CFint pos = findBlock(im/m_nb, in/m_nb);
+  if (pos < 0) notFoundIndex(im, in);
+  return m_values[(pos*m_nb + im%m_nb)*m_nb + in%m_nb];
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockCSRMatrix::setValue(const CFint im, const CFint in, const CFreal value)
+{
+  // ghost rows are owned and assembled by other processes
+  if (im >= 0 && in >= 0 && static_cast<CFuint>(im) < getNbBlockRows()*m_nb) {
+    getEntry(im, in) = value;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockCSRMatrix::setValues(const CFuint m, const CFint* im,
+                               const CFuint n, const CFint* in,
+                               const CFreal* values)
+{
+  for (CFuint i = 0; i < m; ++i) {
+    for (CFuint j = 0; j < n; ++j) {
+      setValue(im[i], in[j], values[i*n + j]);
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockCSRMatrix::addValue(const CFint im, const CFint in, const CFreal value)
+{
+  // ghost rows are owned and assembled by other processes
+  if (im >= 0 && in >= 0 && static_cast<CFuint>(im) < getNbBlockRows()*m_nb) {
+    getEntry(im, in) += value;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockCSRMatrix::addValues(const CFuint m, const CFint* im,
+                               const CFuint n, const CFint* in,
+                               const CFreal* values)
+{
+  for (CFuint i = 0; i < m; ++i) {
+    for (CFuint j = 0; j < n; ++j) {
+      addValue(im[i], in[j], values[i*n + j]);
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockCSRMatrix::getValue(const CFint im, const CFint in, CFreal& value)
+{
+  value = getEntry(im, in);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockCSRMatrix::getValues(const CFuint m, const CFint* im,
+                               const CFuint n, const CFint* in,
+                               CFreal* values)
+{
+  for (CFuint i = 0; i < m; ++i) {
+    for (CFuint j = 0; j < n; ++j) {
+      values[i*n + j] = getEntry(im[i], in[j]);
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockCSRMatrix::setRow(const CFuint row, CFreal diagval, CFreal offdiagval)
+{
+  const CFuint iRow = row/m_nb;
+  const CFuint ib = row%m_nb;
+  cf_assert(iRow < getNbBlockRows());
+
+  for (CFuint pos = m_rowPtr[iRow]; pos < m_rowPtr[iRow+1]; ++pos) {
+    CFreal *const blockRow = &m_values[(pos*m_nb + ib)*m_nb];
+    for (CFuint jb = 0; jb < m_nb; ++jb) {
+      blockRow[jb] = offdiagval;
+    }
+  }
+  m_values[(m_diagIdx[iRow]*m_nb + ib)*m_nb + ib] = diagval;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockCSRMatrix::setDiagonal(Framework::LSSVector& diag)
+{
+  const BlockLSSVector& d = dynamic_cast<BlockLSSVector&>(diag);
+  const CFuint nbRows = getNbBlockRows();
+  cf_assert(d.getLocalSize() >= nbRows*m_nb);
+
+  for (CFuint iRow = 0; iRow < nbRows; ++iRow) {
+    CFreal *const block = &m_values[m_diagIdx[iRow]*m_nb*m_nb];
+    for (CFuint ib = 0; ib < m_nb; ++ib) {
+      block[ib*m_nb + ib] = d[iRow*m_nb + ib];
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockCSRMatrix::addToDiagonal(Framework::LSSVector& diag)
+{
+  const BlockLSSVector& d = dynamic_cast<BlockLSSVector&>(diag);
+  const CFuint nbRows = getNbBlockRows();
+  cf_assert(d.getLocalSize() >= nbRows*m_nb);
+
+  for (CFuint iRow = 0; iRow < nbRows; ++iRow) {
+    CFreal *const block = &m_values[m_diagIdx[iRow]*m_nb*m_nb];
+    for (CFuint ib = 0; ib < m_nb; ++ib) {
+      block[ib*m_nb + ib] += d[iRow*m_nb + ib];
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockCSRMatrix::resetToZeroEntries()
+{
+  std::fill(m_values.begin(), m_values.end(), 0.);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockCSRMatrix::setValues(const Framework::BlockAccumulator& acc)
+{
+  cf_assert(acc.getNB() == m_nb);
+
+  const vector<CFint>& im = acc.getIM();
+  const vector<CFint>& in = acc.getIN();
+  const CFuint nbRows = acc.getM();
+  const CFuint nbCols = acc.getN();
+
+  for (CFuint i = 0; i < nbRows; ++i) {
+    // negative rows are ghost or dummy states, not assembled here
+    if (im[i] < 0) continue;
+    for (CFuint j = 0; j < nbCols; ++j) {
+      if (in[j] < 0) continue;
+      const CFint pos = findBlock(im[i], in[j]);
+      if (pos < 0) notFoundIndex(im[i]*m_nb, in[j]*m_nb);
+
+      CFreal *const block = &m_values[pos*m_nb*m_nb];
+      for (CFuint ib = 0; ib < m_nb; ++ib) {
+        for (CFuint jb = 0; jb < m_nb; ++jb) {
+          block[ib*m_nb + jb] = acc.getValue(i,j,ib,jb);
+        }
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockCSRMatrix::addValues(const Framework::BlockAccumulator& acc)
+{
+  cf_assert(acc.getNB() == m_nb);
+
+  const vector<CFint>& im = acc.getIM();
+  const vector<CFint>& in = acc.getIN();
+  const CFuint nbRows = acc.getM();
+  const CFuint nbCols = acc.getN();
+
+  for (CFuint i = 0; i < nbRows; ++i) {
+    // negative rows are ghost or dummy states, not assembled here
+    if (im[i] < 0) continue;
+    for (CFuint j = 0; j < nbCols; ++j) {
+      if (in[j] < 0) continue;
+      const CFint pos = findBlock(im[i], in[j]);
+      if (pos < 0) notFoundIndex(im[i]*m_nb, in[j]*m_nb);
+
+      CFreal *const block = &m_values[pos*m_nb*m_nb];
+      for (CFuint ib = 0; ib < m_nb; ++ib) {
+        for (CFuint jb = 0; jb < m_nb; ++jb) {
+          block[ib*m_nb + jb] += acc.getValue(i,j,ib,jb);
+        }
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockCSRMatrix::multiplyRows(const CFreal* x, CFreal* y,
+                                  const CFuint rowStart, const CFuint rowEnd) const
+{
+  const CFuint nb2 = m_nb*m_nb;
+  for (CFuint iRow = rowStart; iRow < rowEnd; ++iRow) {
+    CFreal *const yRow = &y[iRow*m_nb];
+    for (CFuint ib = 0; ib < m_nb; ++ib) {
+      yRow[ib] = 0.;
+    }
+    for (CFuint pos = m_rowPtr[iRow]; pos < m_rowPtr[iRow+1]; ++pos) {
+      BlockMatrixOps::addMult(m_nb, &m_values[pos*nb2], &x[m_colIdx[pos]*m_nb], yRow);
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockCSRMatrix::multiply(const CFreal* x, CFreal* y, const CFuint nbThreads) const
+{
+  // rows are split in contiguous chunks, each written by one thread only
+  runChunked(getNbBlockRows(), nbThreads,
+             boost::bind(&BlockCSRMatrix::multiplyRows, this, x, y, _1, _2));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+} // namespace COOLFluiD
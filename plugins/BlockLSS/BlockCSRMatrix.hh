@@ -0,0 +1,208 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_BlockLSS_BlockCSRMatrix_hh
+#define COOLFluiD_BlockLSS_BlockCSRMatrix_hh
+
+#include "Framework/LSSMatrix.hh"
+
+namespace COOLFluiD {
+
+  namespace Framework {
+    class BlockAccumulator;
+  }
+
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class represents a sparse matrix in block compressed row format,
+/// with square dense blocks of size nbEqs stored row by row.
+/// The rows are the locally updatable states, the columns are all the local
+/// states (updatable ones first, then ghosts), so that a BlockAccumulator
+/// can be added directly without any intermediate copy.
+/// The non zero pattern is fixed at creation.
+/// @author Andrea Lani
+class BlockCSRMatrix : public Framework::LSSMatrix {
+public:
+
+  /// Default constructor without arguments
+  BlockCSRMatrix();
+
+  /// Destructor
+  ~BlockCSRMatrix();
+
+  /**
+   * Create the matrix with the given pattern
+   * @param blockSize  size of the blocks (number of equations)
+   * @param nbCols     number of block columns
+   * @param rowPtr     start of each block row in colIdx (size nbRows+1)
+   * @param colIdx     sorted block column indices of each row
+   */
+  void createBlockCSR(const CFuint blockSize,
+                      const CFuint nbCols,
+                      const std::vector<CFuint>& rowPtr,
+                      const std::vector<CFuint>& colIdx);
+
+  /// Release the storage
+  void destroy();
+
+  /// Create a sequential sparse matrix (not supported, the pattern is needed)
+  void createSeqAIJ(const CFint m, const CFint n, const CFint nz,
+                    const CFint* nnz, const char* name = CFNULL);
+
+  /// Create a sequential block sparse matrix (not supported, the pattern is needed)
+  void createSeqBAIJ(const CFuint blockSize, const CFint m, const CFint n,
+                     const CFint nz, const CFint* nnz, const char* name = CFNULL);
+
+#ifdef CF_HAVE_MPI
+  /// Create a parallel sparse matrix (not supported, the pattern is needed)
+  void createParAIJ(MPI_Comm comm, const CFint m, const CFint n,
+                    const CFint M, const CFint N,
+                    const CFint dnz, const CFint* dnnz,
+                    const CFint onz, const CFint* onnz,
+                    const char* name = CFNULL);
+
+  /// Create a parallel block sparse matrix (not supported, the pattern is needed)
+  void createParBAIJ(MPI_Comm comm, const CFuint blockSize,
+                     const CFint m, const CFint n,
+                     const CFint M, const CFint N,
+                     const CFint dnz, const CFint* dnnz,
+                     const CFint onz, const CFint* onnz,
+                     const char* name = CFNULL);
+#endif
+
+  /// Start to assemble the matrix (nothing to do, values are stored in place)
+  void beginAssembly(LSSMatrixAssemblyType assemblyType) {}
+
+  /// Finish to assemble the matrix (nothing to do, values are stored in place)
+  void endAssembly(LSSMatrixAssemblyType assemblyType) {}
+
+  /// Print this matrix
+  void printToScreen() const;
+
+  /// Print this matrix to a file
+  void printToFile(const char* fileName) const;
+
+  /// Set one value
+  void setValue(const CFint im, const CFint in, const CFreal value);
+
+  /// Set a list of values
+  void setValues(const CFuint m, const CFint* im,
+                 const CFuint n, const CFint* in,
+                 const CFreal* values);
+
+  /// Add one value
+  void addValue(const CFint im, const CFint in, const CFreal value);
+
+  /// Add a list of values
+  void addValues(const CFuint m, const CFint* im,
+                 const CFuint n, const CFint* in,
+                 const CFreal* values);
+
+  /// Get one value
+  void getValue(const CFint im, const CFint in, CFreal& value);
+
+  /// Get a list of values
+  void getValues(const CFuint m, const CFint* im,
+                 const CFuint n, const CFint* in,
+                 CFreal* values);
+
+  /// Set a row, diagonal and off-diagonals
+  void setRow(const CFuint row, CFreal diagval, CFreal offdiagval);
+
+  /// Set the diagonal
+  void setDiagonal(Framework::LSSVector& diag);
+
+  /// Add to the diagonal
+  void addToDiagonal(Framework::LSSVector& diag);
+
+  /// Reset to 0 all the non-zero elements of the matrix
+  void resetToZeroEntries();
+
+  /// Set the values of a block accumulator
+  void setValues(const Framework::BlockAccumulator& acc);
+
+  /// Add the values of a block accumulator
+  void addValues(const Framework::BlockAccumulator& acc);
+
+  /// Freeze the matrix structure (it is always frozen)
+  void freezeNonZeroStructure() {}
+
+  /**
+   * Compute y = A*x on the block rows, splitting them among threads
+   * @param x  input vector, sized for all the block columns
+   * @param y  output vector, sized for all the block rows
+   */
+  void multiply(const CFreal* x, CFreal* y, const CFuint nbThreads) const;
+
+  /// Compute y = A*x on the block rows [rowStart, rowEnd)
+  void multiplyRows(const CFreal* x, CFreal* y,
+                    const CFuint rowStart, const CFuint rowEnd) const;
+
+  /// Get the position of the block (row,col) or -1 if it is not allocated
+  CFint findBlock(const CFuint row, const CFuint col) const;
+
+  /// Get the size of the blocks
+  CFuint getBlockSize() const {return m_nb;}
+
+  /// Get the number of block rows
+  CFuint getNbBlockRows() const {return m_rowPtr.size() - 1;}
+
+  /// Get the number of block columns
+  CFuint getNbBlockCols() const {return m_nbCols;}
+
+  /// Get the number of non zero blocks
+  CFuint getNbBlocks() const {return m_colIdx.size();}
+
+  /// Get the start of each block row in the column indices
+  const std::vector<CFuint>& getRowPtr() const {return m_rowPtr;}
+
+  /// Get the block column indices
+  const std::vector<CFuint>& getColIdx() const {return m_colIdx;}
+
+  /// Get the position of the diagonal block of each row
+  const std::vector<CFuint>& getDiagIdx() const {return m_diagIdx;}
+
+  /// Get the values of the block with the given position
+  const CFreal* getBlock(const CFuint pos) const {return &m_values[pos*m_nb*m_nb];}
+
+private:
+
+  /// Get the entry (im,in) or throw if it is not allocated
+  CFreal& getEntry(const CFint im, const CFint in);
+
+  /// Handle the access to a non allocated entry
+  void notFoundIndex(const CFint im, const CFint in) const;
+
+private:
+
+  /// size of the blocks
+  CFuint m_nb;
+
+  /// number of block columns
+  CFuint m_nbCols;
+
+  /// start of each block row in m_colIdx
+  std::vector<CFuint> m_rowPtr;
+
+  /// block column indices, sorted within each row
+  std::vector<CFuint> m_colIdx;
+
+  /// position of the diagonal block of each row
+  std::vector<CFuint> m_diagIdx;
+
+  /// block values
+  std::vector<CFreal> m_values;
+
+}; // end of class BlockCSRMatrix
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+} // namespace COOLFluiD
+
+#endif // COOLFluiD_BlockLSS_BlockCSRMatrix_hh
@@ -0,0 +1,231 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <algorithm>
+#include <cmath>
+
+#include "BlockLSS/BlockGMRES.hh"
+#include "BlockLSS/BlockPreconditioner.hh"
+#include "BlockLSS/BlockHaloExchange.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+BlockGMRES::BlockGMRES() :
+  m_nbKrylov(0),
+  m_flexible(false),
+  m_nbThreads(1),
+  m_nbOwned(0),
+  m_nbLocal(0),
+  m_V(),
+  m_Z(),
+  m_w(),
+  m_H(),
+  m_cs(),
+  m_sn(),
+  m_g()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+BlockGMRES::~BlockGMRES()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockGMRES::setup(const CFuint nbKrylov, const bool flexible,
+                       const CFuint nbOwned, const CFuint nbLocal)
+{
+  cf_assert(nbKrylov > 0);
+  cf_assert(nbOwned <= nbLocal);
+
+  m_nbKrylov = nbKrylov;
+  m_flexible = flexible;
+  m_nbOwned = nbOwned;
+  m_nbLocal = nbLocal;
+
+  m_V.assign((nbKrylov + 1)*nbLocal, 0.);
+  m_Z.assign((flexible ? nbKrylov : 1)*nbLocal, 0.);
+  m_w.assign(nbLocal, 0.);
+  m_H.assign((nbKrylov + 1)*nbKrylov, 0.);
+  m_cs.assign(nbKrylov, 0.);
+  m_sn.assign(nbKrylov, 0.);
+  m_g.assign(nbKrylov + 1, 0.);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFreal BlockGMRES::dot(BlockHaloExchange& halo, const CFreal* a, const CFreal* b) const
+{
+  CFreal sum = 0.;
+  for (CFuint i = 0; i < m_nbOwned; ++i) {
+    sum += a[i]*b[i];
+  }
+  return halo.sum(sum);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockGMRES::multiply(const BlockCSRMatrix& mat, BlockHaloExchange& halo,
+                          CFreal* x, CFreal* y) const
+{
+  halo.synchronize(x, mat.getBlockSize());
+  mat.multiply(x, y, m_nbThreads);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFuint BlockGMRES::solve(const BlockCSRMatrix& mat,
+                         const BlockPreconditioner& pc,
+                         BlockHaloExchange& halo,
+                         const CFreal* b, CFreal* x,
+                         const CFreal rTol, const CFreal aTol,
+                         const CFuint maxIter, CFreal& resNorm)
+{
+  const CFuint m = m_nbKrylov;
+  const CFuint ldH = m + 1;
+  CFreal *const w = &m_w[0];
+
+  for (CFuint i = 0; i < m_nbLocal; ++i) {
+    x[i] = 0.;
+  }
+
+  const CFreal bNorm = std::sqrt(dot(halo, b, b));
+  const CFreal tol = std::max(rTol*bNorm, aTol);
+  resNorm = bNorm;
+  if (bNorm <= tol) return 0;
+
+  // with a zero initial guess the first residual is b
+  CFreal beta = bNorm;
+  CFreal *const v0 = getV(0);
+  for (CFuint i = 0; i < m_nbOwned; ++i) {
+    v0[i] = b[i];
+  }
+
+  CFuint iter = 0;
+  for (;;) {
+    const CFreal invBeta = 1./beta;
+    for (CFuint i = 0; i < m_nbOwned; ++i) {
+      v0[i] *= invBeta;
+    }
+    std::fill(m_g.begin(), m_g.end(), 0.);
+    m_g[0] = beta;
+
+    CFuint j = 0;
+    while (j < m && iter < maxIter) {
+      CFreal *const z = getZ(j);
+      pc.apply(getV(j), z);
+      multiply(mat, halo, z, w);
+
+      // modified Gram-Schmidt
+      CFreal *const hj = &m_H[j*ldH];
+      for (CFuint i = 0; i <= j; ++i) {
+        const CFreal *const vi = getV(i);
+        hj[i] = dot(halo, w, vi);
+        for (CFuint k = 0; k < m_nbOwned; ++k) {
+          w[k] -= hj[i]*vi[k];
+        }
+      }
+      const CFreal wNorm = std::sqrt(dot(halo, w, w));
+      hj[j+1] = wNorm;
+
+      if (wNorm > 0.) {
+        CFreal *const vNext = getV(j+1);
+        const CFreal invNorm = 1./wNorm;
+        for (CFuint k = 0; k < m_nbOwned; ++k) {
+          vNext[k] = w[k]*invNorm;
+        }
+      }
+
+      // apply the previous Givens rotations to the new column
+      for (CFuint i = 0; i < j; ++i) {
+        const CFreal tmp = m_cs[i]*hj[i] + m_sn[i]*hj[i+1];
+        hj[i+1] = -m_sn[i]*hj[i] + m_cs[i]*hj[i+1];
+        hj[i] = tmp;
+      }
+
+      // new rotation eliminating the subdiagonal entry
+      const CFreal denom = std::sqrt(hj[j]*hj[j] + hj[j+1]*hj[j+1]);
+      m_cs[j] = (denom > 0.) ? hj[j]/denom : 1.;
+      m_sn[j] = (denom > 0.) ? hj[j+1]/denom : 0.;
+      hj[j] = denom;
+      hj[j+1] = 0.;
+      m_g[j+1] = -m_sn[j]*m_g[j];
+      m_g[j] *= m_cs[j];
+
+      resNorm = std::abs(m_g[j+1]);
+      ++iter;
+      ++j;
+
+      // converged or lucky breakdown
+      if (resNorm <= tol || wNorm == 0.) break;
+    }
+
+    // solve the upper triangular least squares system in place
+    for (CFuint ii = j; ii > 0; --ii) {
+      const CFuint i = ii - 1;
+      CFreal sum = m_g[i];
+      for (CFuint k = i+1; k < j; ++k) {
+        sum -= m_H[k*ldH + i]*m_g[k];
+      }
+      m_g[i] = (m_H[i*ldH + i] != 0.) ? sum/m_H[i*ldH + i] : 0.;
+    }
+
+    // update the solution
+    if (m_flexible) {
+      for (CFuint i = 0; i < j; ++i) {
+        const CFreal *const zi = getZ(i);
+        const CFreal yi = m_g[i];
+        for (CFuint k = 0; k < m_nbOwned; ++k) {
+          x[k] += yi*zi[k];
+        }
+      }
+    }
+    else {
+      std::fill(w, w + m_nbOwned, 0.);
+      for (CFuint i = 0; i < j; ++i) {
+        const CFreal *const vi = getV(i);
+        const CFreal yi = m_g[i];
+        for (CFuint k = 0; k < m_nbOwned; ++k) {
+          w[k] += yi*vi[k];
+        }
+      }
+      CFreal *const z = getZ(0);
+      pc.apply(w, z);
+      for (CFuint k = 0; k < m_nbOwned; ++k) {
+        x[k] += z[k];
+      }
+    }
+
+    if (resNorm <= tol || iter >= maxIter) break;
+
+    // restart from the true residual
+    multiply(mat, halo, x, w);
+    for (CFuint k = 0; k < m_nbOwned; ++k) {
+      v0[k] = b[k] - w[k];
+    }
+    beta = std::sqrt(dot(halo, v0, v0));
+    resNorm = beta;
+    if (beta <= tol) break;
+  }
+
+  return iter;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+} // namespace COOLFluiD
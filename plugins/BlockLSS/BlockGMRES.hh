@@ -0,0 +1,122 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_BlockLSS_BlockGMRES_hh
+#define COOLFluiD_BlockLSS_BlockGMRES_hh
+
+#include "BlockLSS/BlockCSRMatrix.hh"
+
+namespace COOLFluiD {
+  namespace BlockLSS {
+
+    class BlockPreconditioner;
+    class BlockHaloExchange;
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class implements the restarted GMRES method with right
+/// preconditioning, or its flexible variant FGMRES which stores the
+/// preconditioned directions and allows a preconditioner which changes
+/// from one iteration to the other.
+/// Vectors are sized for all the local states (updatable first, then ghosts):
+/// the ghost entries are only used as input of the matrix-vector product.
+/// @author Andrea Lani
+class BlockGMRES {
+public:
+
+  /// Constructor
+  BlockGMRES();
+
+  /// Destructor
+  ~BlockGMRES();
+
+  /**
+   * Allocate the Krylov basis
+   * @param nbKrylov   number of Krylov vectors before restart
+   * @param flexible   use FGMRES instead of GMRES
+   * @param nbOwned    number of locally updatable entries
+   * @param nbLocal    number of local entries (updatable and ghosts)
+   */
+  void setup(const CFuint nbKrylov, const bool flexible,
+             const CFuint nbOwned, const CFuint nbLocal);
+
+  /// Set the number of threads used in the matrix-vector products
+  void setNbThreads(const CFuint nbThreads) {m_nbThreads = nbThreads;}
+
+  /**
+   * Solve A x = b starting from x = 0
+   * @param rTol     relative tolerance on the residual norm
+   * @param aTol     absolute tolerance on the residual norm
+   * @param maxIter  maximum number of iterations
+   * @param resNorm  final residual norm
+   * @return the number of iterations
+   */
+  CFuint solve(const BlockCSRMatrix& mat,
+               const BlockPreconditioner& pc,
+               BlockHaloExchange& halo,
+               const CFreal* b, CFreal* x,
+               const CFreal rTol, const CFreal aTol,
+               const CFuint maxIter, CFreal& resNorm);
+
+private:
+
+  /// Global dot product over the updatable entries
+  CFreal dot(BlockHaloExchange& halo, const CFreal* a, const CFreal* b) const;
+
+  /// y = A*x, after updating the ghost entries of x
+  void multiply(const BlockCSRMatrix& mat, BlockHaloExchange& halo,
+                CFreal* x, CFreal* y) const;
+
+  /// Get the i-th Krylov vector
+  CFreal* getV(const CFuint i) {return &m_V[i*m_nbLocal];}
+
+  /// Get the i-th preconditioned direction
+  CFreal* getZ(const CFuint i) {return &m_Z[(m_flexible ? i : 0)*m_nbLocal];}
+
+private:
+
+  /// number of Krylov vectors before restart
+  CFuint m_nbKrylov;
+
+  /// use FGMRES
+  bool m_flexible;
+
+  /// number of threads
+  CFuint m_nbThreads;
+
+  /// number of locally updatable entries
+  CFuint m_nbOwned;
+
+  /// number of local entries
+  CFuint m_nbLocal;
+
+  /// Krylov basis
+  std::vector<CFreal> m_V;
+
+  /// preconditioned directions (only one if not flexible)
+  std::vector<CFreal> m_Z;
+
+  /// work vector
+  std::vector<CFreal> m_w;
+
+  /// Hessenberg matrix, stored by columns
+  std::vector<CFreal> m_H;
+
+  /// Givens rotations
+  std::vector<CFreal> m_cs;
+  std::vector<CFreal> m_sn;
+
+  /// rotated right hand side of the least squares problem
+  std::vector<CFreal> m_g;
+
+}; // end of class BlockGMRES
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+} // namespace COOLFluiD
+
+#endif // COOLFluiD_BlockLSS_BlockGMRES_hh
@@ -0,0 +1,335 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <algorithm>
+
+#include "Common/PE.hh"
+#include "Common/CFLog.hh"
+#include "Common/BadValueException.hh"
+
+#include "BlockLSS/BlockHaloExchange.hh"
+
+#ifdef CF_HAVE_MPI
+#  include "Common/MPI/MPIError.hh"
+#  include "Common/MPI/MPIStructDef.hh"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+BlockHaloExchange::BlockHaloExchange() :
+  m_nbOwned(0),
+  m_nbGhosts(0),
+  m_nbProc(1),
+#ifdef CF_HAVE_MPI
+  m_comm(MPI_COMM_NULL),
+#endif
+  m_sendRanks(),
+  m_sendPtr(1, 0),
+  m_sendIdx(),
+  m_recvRanks(),
+  m_recvPtr(1, 0),
+  m_recvIdx(),
+  m_sendBuf(),
+  m_recvBuf()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+BlockHaloExchange::~BlockHaloExchange()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockHaloExchange::setup(const std::string& nsp,
+                              const std::vector<CFuint>& ownedGlobalIDs,
+                              const std::vector<CFuint>& ghostGlobalIDs)
+{
+  CFAUTOTRACE;
+
+  unsetup();
+
+  m_nbOwned = ownedGlobalIDs.size();
+  m_nbGhosts = ghostGlobalIDs.size();
+  m_nbProc = PE::GetPE().GetProcessorCount(nsp);
+
+  if (m_nbProc == 1) {
+    cf_assert(m_nbGhosts == 0);
+    return;
+  }
+
+#ifdef CF_HAVE_MPI
+  m_comm = PE::GetPE().GetCommunicator(nsp);
+
+  // the global IDs are split in contiguous ranges, one per directory rank
+  CFuint nbGlobalIDs = 0;
+  for (CFuint i = 0; i < m_nbOwned; ++i) {
+    nbGlobalIDs = std::max(nbGlobalIDs, ownedGlobalIDs[i] + 1);
+  }
+  CFuint localNbGlobalIDs = nbGlobalIDs;
+  MPIError::getInstance().check
+    ("MPI_Allreduce", "BlockHaloExchange::setup()",
+     MPI_Allreduce(&localNbGlobalIDs, &nbGlobalIDs, 1,
+                   MPIStructDef::getMPIType(&nbGlobalIDs), MPI_MAX, m_comm));
+  const CFuint rangeSize = std::max(nbGlobalIDs/m_nbProc + ((nbGlobalIDs%m_nbProc > 0) ? 1 : 0), (CFuint)1);
+  const CFuint rangeStart = PE::GetPE().GetRank(nsp)*rangeSize;
+
+  // the owners register their states on the directory ranks,
+  // as pairs (global ID, local index)
+  vector<int> sendCount(m_nbProc, 0);
+  for (CFuint i = 0; i < m_nbOwned; ++i) {
+    sendCount[ownedGlobalIDs[i]/rangeSize] += 2;
+  }
+  vector<CFuint> sendPtr(m_nbProc, 0);
+  for (CFuint p = 1; p < m_nbProc; ++p) {
+    sendPtr[p] = sendPtr[p-1] + sendCount[p-1];
+  }
+  vector<CFuint> sendData(2*m_nbOwned);
+  for (CFuint i = 0; i < m_nbOwned; ++i) {
+    const CFuint pos = sendPtr[ownedGlobalIDs[i]/rangeSize];
+    sendData[pos] = ownedGlobalIDs[i];
+    sendData[pos+1] = i;
+    sendPtr[ownedGlobalIDs[i]/rangeSize] += 2;
+  }
+
+  vector<CFuint> recvData;
+  vector<int> recvCount;
+  exchange(sendData, sendCount, recvData, recvCount);
+
+  // owner rank and local index of each global ID of the directory range
+  vector<int> dirOwner(rangeSize, -1);
+  vector<CFuint> dirLocalIdx(rangeSize, 0);
+  for (CFuint p = 0, pos = 0; p < m_nbProc; ++p) {
+    for (int i = 0; i < recvCount[p]; i += 2, pos += 2) {
+      const CFuint dirID = recvData[pos] - rangeStart;
+      cf_assert(dirID < rangeSize);
+      dirOwner[dirID] = p;
+      dirLocalIdx[dirID] = recvData[pos+1];
+    }
+  }
+
+  // ask the directory ranks for the owners of the ghost states
+  fill(sendCount.begin(), sendCount.end(), 0);
+  for (CFuint iG = 0; iG < m_nbGhosts; ++iG) {
+    if (ghostGlobalIDs[iG] >= nbGlobalIDs) {
+      throw BadValueException
+        (FromHere(), "BlockHaloExchange::setup() => ghost states without owner");
+    }
+    sendCount[ghostGlobalIDs[iG]/rangeSize]++;
+  }
+  sendPtr[0] = 0;
+  for (CFuint p = 1; p < m_nbProc; ++p) {
+    sendPtr[p] = sendPtr[p-1] + sendCount[p-1];
+  }
+  vector<CFuint> ghostOrder(m_nbGhosts);
+  sendData.resize(m_nbGhosts);
+  for (CFuint iG = 0; iG < m_nbGhosts; ++iG) {
+    const CFuint pos = sendPtr[ghostGlobalIDs[iG]/rangeSize]++;
+    sendData[pos] = ghostGlobalIDs[iG];
+    ghostOrder[pos] = iG;
+  }
+  exchange(sendData, sendCount, recvData, recvCount);
+
+  // answer with the pairs (owner rank, local index in the owner)
+  vector<CFuint> replyData(2*recvData.size());
+  vector<int> replyCount(m_nbProc, 0);
+  for (CFuint i = 0; i < recvData.size(); ++i) {
+    const CFuint dirID = recvData[i] - rangeStart;
+    cf_assert(dirID < rangeSize);
+    if (dirOwner[dirID] < 0) {
+      throw BadValueException
+        (FromHere(), "BlockHaloExchange::setup() => ghost states without owner");
+    }
+    replyData[2*i] = dirOwner[dirID];
+    replyData[2*i+1] = dirLocalIdx[dirID];
+  }
+  for (CFuint p = 0; p < m_nbProc; ++p) {
+    replyCount[p] = 2*recvCount[p];
+  }
+  vector<CFuint> ghostOwners;
+  exchange(replyData, replyCount, ghostOwners, recvCount);
+  cf_assert(ghostOwners.size() == 2*m_nbGhosts);
+
+  // each ghost is received from its owner, ordered by owner rank and
+  // then by ghost position, and the owner is told which states to send
+  vector<vector<CFuint> > ghostsByOwner(m_nbProc);
+  vector<vector<CFuint> > idxByOwner(m_nbProc);
+  for (CFuint pos = 0; pos < m_nbGhosts; ++pos) {
+    const CFuint owner = ghostOwners[2*pos];
+    ghostsByOwner[owner].push_back(ghostOrder[pos]);
+    idxByOwner[owner].push_back(ghostOwners[2*pos+1]);
+  }
+
+  sendData.clear();
+  for (CFuint p = 0; p < m_nbProc; ++p) {
+    vector<CFuint>& ghosts = ghostsByOwner[p];
+    vector<CFuint>& idx = idxByOwner[p];
+
+    // sort by ghost position to make the pattern independent of the directory
+    vector<pair<CFuint, CFuint> > sorted(ghosts.size());
+    for (CFuint i = 0; i < ghosts.size(); ++i) {
+      sorted[i] = pair<CFuint, CFuint>(ghosts[i], idx[i]);
+    }
+    sort(sorted.begin(), sorted.end());
+
+    sendCount[p] = sorted.size();
+    for (CFuint i = 0; i < sorted.size(); ++i) {
+      m_recvIdx.push_back(m_nbOwned + sorted[i].first);
+      sendData.push_back(sorted[i].second);
+    }
+    if (sorted.size() > 0) {
+      m_recvRanks.push_back(p);
+      m_recvPtr.push_back(m_recvIdx.size());
+    }
+  }
+  exchange(sendData, sendCount, recvData, recvCount);
+
+  for (CFuint p = 0, pos = 0; p < m_nbProc; ++p) {
+    for (int i = 0; i < recvCount[p]; ++i, ++pos) {
+      cf_assert(recvData[pos] < m_nbOwned);
+      m_sendIdx.push_back(recvData[pos]);
+    }
+    if (recvCount[p] > 0) {
+      m_sendRanks.push_back(p);
+      m_sendPtr.push_back(m_sendIdx.size());
+    }
+  }
+
+  CFLog(VERBOSE, "BlockHaloExchange::setup() => sending to " << m_sendRanks.size()
+        << " and receiving from " << m_recvRanks.size() << " processes\n");
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockHaloExchange::unsetup()
+{
+  m_sendRanks.clear();
+  m_sendPtr.assign(1, 0);
+  m_sendIdx.clear();
+  m_recvRanks.clear();
+  m_recvPtr.assign(1, 0);
+  m_recvIdx.clear();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockHaloExchange::synchronize(CFreal* x, const CFuint blockSize)
+{
+  if (m_nbProc == 1) return;
+
+#ifdef CF_HAVE_MPI
+  m_sendBuf.resize(m_sendIdx.size()*blockSize);
+  m_recvBuf.resize(m_recvIdx.size()*blockSize);
+
+  const CFuint nbRecv = m_recvRanks.size();
+  const CFuint nbSend = m_sendRanks.size();
+  vector<MPI_Request> requests(nbRecv + nbSend);
+
+  for (CFuint r = 0; r < nbRecv; ++r) {
+    const CFuint start = m_recvPtr[r]*blockSize;
+    const int count = (m_recvPtr[r+1] - m_recvPtr[r])*blockSize;
+    MPI_Irecv(&m_recvBuf[start], count, MPIStructDef::getMPIType(x),
+              m_recvRanks[r], 0, m_comm, &requests[r]);
+  }
+
+  for (CFuint s = 0; s < nbSend; ++s) {
+    for (CFuint i = m_sendPtr[s]; i < m_sendPtr[s+1]; ++i) {
+      const CFreal *const xi = &x[m_sendIdx[i]*blockSize];
+      CFreal *const bi = &m_sendBuf[i*blockSize];
+      for (CFuint iEq = 0; iEq < blockSize; ++iEq) {
+        bi[iEq] = xi[iEq];
+      }
+    }
+    const CFuint start = m_sendPtr[s]*blockSize;
+    const int count = (m_sendPtr[s+1] - m_sendPtr[s])*blockSize;
+    MPI_Isend(&m_sendBuf[start], count, MPIStructDef::getMPIType(x),
+              m_sendRanks[s], 0, m_comm, &requests[nbRecv + s]);
+  }
+
+  if (!requests.empty()) {
+    MPIError::getInstance().check
+      ("MPI_Waitall", "BlockHaloExchange::synchronize()",
+       MPI_Waitall(requests.size(), &requests[0], MPI_STATUSES_IGNORE));
+  }
+
+  for (CFuint i = 0; i < m_recvIdx.size(); ++i) {
+    CFreal *const xi = &x[m_recvIdx[i]*blockSize];
+    const CFreal *const bi = &m_recvBuf[i*blockSize];
+    for (CFuint iEq = 0; iEq < blockSize; ++iEq) {
+      xi[iEq] = bi[iEq];
+    }
+  }
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFreal BlockHaloExchange::sum(const CFreal value) const
+{
+  if (m_nbProc == 1) return value;
+
+  CFreal result = value;
+#ifdef CF_HAVE_MPI
+  CFreal local = value;
+  MPIError::getInstance().check
+    ("MPI_Allreduce", "BlockHaloExchange::sum()",
+     MPI_Allreduce(&local, &result, 1, MPIStructDef::getMPIType(&local), MPI_SUM, m_comm));
+#endif
+  return result;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+#ifdef CF_HAVE_MPI
+void BlockHaloExchange::exchange(const std::vector<CFuint>& sendData,
+                                 const std::vector<int>& sendCount,
+                                 std::vector<CFuint>& recvData,
+                                 std::vector<int>& recvCount) const
+{
+  recvCount.resize(m_nbProc);
+  MPIError::getInstance().check
+    ("MPI_Alltoall", "BlockHaloExchange::exchange()",
+     MPI_Alltoall(const_cast<int*>(&sendCount[0]), 1, MPI_INT, &recvCount[0], 1, MPI_INT, m_comm));
+
+  vector<int> sendDispl(m_nbProc, 0);
+  vector<int> recvDispl(m_nbProc, 0);
+  for (CFuint p = 1; p < m_nbProc; ++p) {
+    sendDispl[p] = sendDispl[p-1] + sendCount[p-1];
+    recvDispl[p] = recvDispl[p-1] + recvCount[p-1];
+  }
+
+  const CFuint recvSize = recvDispl.back() + recvCount.back();
+  recvData.resize(recvSize);
+
+  // the buffers must be valid even when they are empty
+  CFuint dummy = 0;
+  CFuint* sendPtr = (sendData.size() > 0) ? const_cast<CFuint*>(&sendData[0]) : &dummy;
+  CFuint* recvPtr = (recvSize > 0) ? &recvData[0] : &dummy;
+
+  MPIError::getInstance().check
+    ("MPI_Alltoallv", "BlockHaloExchange::exchange()",
+     MPI_Alltoallv(sendPtr, const_cast<int*>(&sendCount[0]), &sendDispl[0],
+                   MPIStructDef::getMPIType(sendPtr), recvPtr, &recvCount[0], &recvDispl[0],
+                   MPIStructDef::getMPIType(recvPtr), m_comm));
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+} // namespace COOLFluiD
@@ -0,0 +1,121 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_BlockLSS_BlockHaloExchange_hh
+#define COOLFluiD_BlockLSS_BlockHaloExchange_hh
+
+#include "Common/COOLFluiD.hh"
+
+#ifdef CF_HAVE_MPI
+#  include <mpi.h>
+#endif
+
+namespace COOLFluiD {
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class exchanges the ghost entries of the BlockLSS vectors between
+/// processes and performs the global reductions needed by the Krylov solver.
+/// Vectors are stored with the locally updatable states first, followed by
+/// the ghost states, nbEqs entries per state.
+/// In serial runs all the operations are trivial.
+/// @author Andrea Lani
+class BlockHaloExchange {
+public:
+
+  /// Constructor
+  BlockHaloExchange();
+
+  /// Destructor
+  ~BlockHaloExchange();
+
+  /**
+   * Build the communication pattern. The owner of each ghost state is found
+   * through directory ranks, each one responsible for a contiguous range of
+   * global IDs, so that no process holds the ghost states of all the others
+   * @param nsp             namespace of the linear system solver
+   * @param ownedGlobalIDs  global IDs of the updatable states, in local order
+   * @param ghostGlobalIDs  global IDs of the ghost states, in local order
+   */
+  void setup(const std::string& nsp,
+             const std::vector<CFuint>& ownedGlobalIDs,
+             const std::vector<CFuint>& ghostGlobalIDs);
+
+  /// Release the communication pattern
+  void unsetup();
+
+  /// Fill the ghost entries of the given vector with the values of their owners
+  void synchronize(CFreal* x, const CFuint blockSize);
+
+  /// Sum a value over all the processes
+  CFreal sum(const CFreal value) const;
+
+  /// Get the number of updatable states
+  CFuint getNbOwned() const {return m_nbOwned;}
+
+  /// Get the number of ghost states
+  CFuint getNbGhosts() const {return m_nbGhosts;}
+
+private: // helper functions
+
+#ifdef CF_HAVE_MPI
+  /// Send sendCount[p] entries of sendData to each process p, in order,
+  /// and receive recvCount[p] entries in recvData from each process p
+  void exchange(const std::vector<CFuint>& sendData,
+                const std::vector<int>& sendCount,
+                std::vector<CFuint>& recvData,
+                std::vector<int>& recvCount) const;
+#endif
+
+private:
+
+  /// number of updatable states
+  CFuint m_nbOwned;
+
+  /// number of ghost states
+  CFuint m_nbGhosts;
+
+  /// number of processes
+  CFuint m_nbProc;
+
+#ifdef CF_HAVE_MPI
+  /// communicator
+  MPI_Comm m_comm;
+#endif
+
+  /// ranks of the processes to which values are sent
+  std::vector<int> m_sendRanks;
+
+  /// start of the states to send to each process in m_sendIdx
+  std::vector<CFuint> m_sendPtr;
+
+  /// local indices of the states to send
+  std::vector<CFuint> m_sendIdx;
+
+  /// ranks of the processes from which values are received
+  std::vector<int> m_recvRanks;
+
+  /// start of the states to receive from each process in m_recvIdx
+  std::vector<CFuint> m_recvPtr;
+
+  /// local indices of the states to receive
+  std::vector<CFuint> m_recvIdx;
+
+  /// send buffer
+  std::vector<CFreal> m_sendBuf;
+
+  /// receive buffer
+  std::vector<CFreal> m_recvBuf;
+
+}; // end of class BlockHaloExchange
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+} // namespace COOLFluiD
+
+#endif // COOLFluiD_BlockLSS_BlockHaloExchange_hh
@@ -0,0 +1,142 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include "Common/StringOps.hh"
+#include "Common/BadValueException.hh"
+
+#include "BlockLSS/BlockILUPreconditioner.hh"
+#include "BlockLSS/BlockMatrixOps.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+BlockILUPreconditioner::BlockILUPreconditioner() :
+  BlockPreconditioner(),
+  m_mat(CFNULL),
+  m_lu(),
+  m_work()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+BlockILUPreconditioner::~BlockILUPreconditioner()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockILUPreconditioner::compute(const BlockCSRMatrix& mat)
+{
+  m_mat = &mat;
+
+  const CFuint nb = mat.getBlockSize();
+  const CFuint nb2 = nb*nb;
+  const CFuint nbRows = mat.getNbBlockRows();
+  const vector<CFuint>& rowPtr = mat.getRowPtr();
+  const vector<CFuint>& colIdx = mat.getColIdx();
+  const vector<CFuint>& diagIdx = mat.getDiagIdx();
+
+  m_lu.resize(mat.getNbBlocks()*nb2);
+  if (mat.getNbBlocks() > 0) {
+    const CFreal *const values = mat.getBlock(0);
+    std::copy(values, values + m_lu.size(), m_lu.begin());
+  }
+  m_work.resize(2*nb2);
+  CFreal *const lik = &m_work[0];
+  CFreal *const work = &m_work[nb2];
+
+  // IKJ variant: row i is updated with the already factorized rows k < i,
+  // restricted to the existing blocks (no fill); the columns of the ghost
+  // states (>= nbRows) are skipped
+  for (CFuint i = 0; i < nbRows; ++i) {
+    for (CFuint pik = rowPtr[i]; pik < diagIdx[i]; ++pik) {
+      const CFuint k = colIdx[pik];
+      if (k >= nbRows) continue;
+
+      // L_ik = A_ik * (U_kk)^-1
+      BlockMatrixOps::multBlock(nb, &m_lu[pik*nb2], &m_lu[diagIdx[k]*nb2], lik);
+      std::copy(lik, lik + nb2, &m_lu[pik*nb2]);
+
+      // A_ij -= L_ik * U_kj for the blocks j > k present in both rows
+      CFuint pkj = diagIdx[k] + 1;
+      for (CFuint pij = pik + 1; pij < rowPtr[i+1]; ++pij) {
+        const CFuint j = colIdx[pij];
+        if (j >= nbRows) continue;
+        while (pkj < rowPtr[k+1] && colIdx[pkj] < j) ++pkj;
+        if (pkj == rowPtr[k+1]) break;
+        if (colIdx[pkj] == j) {
+          BlockMatrixOps::subMultBlock(nb, lik, &m_lu[pkj*nb2], &m_lu[pij*nb2]);
+        }
+      }
+    }
+
+    if (!BlockMatrixOps::invert(nb, &m_lu[diagIdx[i]*nb2], work)) {
+      throw BadValueException
+        (FromHere(), "BlockILUPreconditioner::compute() => zero pivot in row " +
+         StringOps::to_str(i));
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockILUPreconditioner::apply(const CFreal* r, CFreal* z) const
+{
+  cf_assert(m_mat != CFNULL);
+
+  const CFuint nb = m_mat->getBlockSize();
+  const CFuint nb2 = nb*nb;
+  const CFuint nbRows = m_mat->getNbBlockRows();
+  const vector<CFuint>& rowPtr = m_mat->getRowPtr();
+  const vector<CFuint>& colIdx = m_mat->getColIdx();
+  const vector<CFuint>& diagIdx = m_mat->getDiagIdx();
+
+  // forward substitution with the unit lower factor
+  for (CFuint i = 0; i < nbRows; ++i) {
+    CFreal *const zi = &z[i*nb];
+    for (CFuint ib = 0; ib < nb; ++ib) {
+      zi[ib] = r[i*nb + ib];
+    }
+    for (CFuint pik = rowPtr[i]; pik < diagIdx[i]; ++pik) {
+      const CFuint k = colIdx[pik];
+      if (k < nbRows) {
+        BlockMatrixOps::subMult(nb, &m_lu[pik*nb2], &z[k*nb], zi);
+      }
+    }
+  }
+
+  // backward substitution with the upper factor
+  CFreal *const tmp = &m_work[0];
+  for (CFuint ii = nbRows; ii > 0; --ii) {
+    const CFuint i = ii - 1;
+    CFreal *const zi = &z[i*nb];
+    for (CFuint pij = diagIdx[i] + 1; pij < rowPtr[i+1]; ++pij) {
+      const CFuint j = colIdx[pij];
+      if (j < nbRows) {
+        BlockMatrixOps::subMult(nb, &m_lu[pij*nb2], &z[j*nb], zi);
+      }
+    }
+    BlockMatrixOps::mult(nb, &m_lu[diagIdx[i]*nb2], zi, tmp);
+    for (CFuint ib = 0; ib < nb; ++ib) {
+      zi[ib] = tmp[ib];
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+} // namespace COOLFluiD
@@ -0,0 +1,57 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_BlockLSS_BlockILUPreconditioner_hh
+#define COOLFluiD_BlockLSS_BlockILUPreconditioner_hh
+
+#include "BlockLSS/BlockPreconditioner.hh"
+
+namespace COOLFluiD {
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class implements the block incomplete LU factorization with no fill
+/// (block ILU(0)) of the locally updatable part of the matrix.
+/// The factors share the pattern of the matrix: the strictly lower blocks
+/// store L (with identity diagonal), the upper ones store U and the diagonal
+/// blocks store the inverse of the diagonal of U.
+/// The factorization and the triangular solves are sequential.
+/// @author Andrea Lani
+class BlockILUPreconditioner : public BlockPreconditioner {
+public:
+
+  /// Constructor
+  BlockILUPreconditioner();
+
+  /// Destructor
+  ~BlockILUPreconditioner();
+
+  /// Compute the incomplete factorization
+  void compute(const BlockCSRMatrix& mat);
+
+  /// Apply the forward and backward substitutions
+  void apply(const CFreal* r, CFreal* z) const;
+
+private:
+
+  /// matrix whose pattern is shared by the factors
+  const BlockCSRMatrix* m_mat;
+
+  /// values of the factors
+  std::vector<CFreal> m_lu;
+
+  /// block workspace
+  mutable std::vector<CFreal> m_work;
+
+}; // end of class BlockILUPreconditioner
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+} // namespace COOLFluiD
+
+#endif // COOLFluiD_BlockLSS_BlockILUPreconditioner_hh
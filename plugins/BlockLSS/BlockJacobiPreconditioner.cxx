@@ -0,0 +1,105 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <boost/bind.hpp>
+
+#include "Common/ChunkedThreads.hh"
+#include "Common/StringOps.hh"
+#include "Common/BadValueException.hh"
+
+#include "BlockLSS/BlockJacobiPreconditioner.hh"
+#include "BlockLSS/BlockMatrixOps.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+BlockJacobiPreconditioner::BlockJacobiPreconditioner() :
+  BlockPreconditioner(),
+  m_nb(0),
+  m_nbRows(0),
+  m_invDiag(),
+  m_isSingular()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+BlockJacobiPreconditioner::~BlockJacobiPreconditioner()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockJacobiPreconditioner::compute(const BlockCSRMatrix& mat)
+{
+  m_nb = mat.getBlockSize();
+  m_nbRows = mat.getNbBlockRows();
+  m_invDiag.resize(m_nbRows*m_nb*m_nb);
+  m_isSingular.assign(m_nbRows, 0);
+
+  runChunked(m_nbRows, m_nbThreads,
+             boost::bind(&BlockJacobiPreconditioner::computeRows, this, &mat, _1, _2));
+
+  for (CFuint iRow = 0; iRow < m_nbRows; ++iRow) {
+    if (m_isSingular[iRow]) {
+      throw BadValueException
+        (FromHere(), "BlockJacobiPreconditioner::compute() => singular diagonal block in row " +
+         StringOps::to_str(iRow));
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockJacobiPreconditioner::computeRows(const BlockCSRMatrix* mat,
+                                            const CFuint rowStart, const CFuint rowEnd)
+{
+  const CFuint nb2 = m_nb*m_nb;
+  const vector<CFuint>& diagIdx = mat->getDiagIdx();
+  vector<CFreal> work(nb2);
+
+  for (CFuint iRow = rowStart; iRow < rowEnd; ++iRow) {
+    const CFreal *const diag = mat->getBlock(diagIdx[iRow]);
+    CFreal *const inv = &m_invDiag[iRow*nb2];
+    for (CFuint i = 0; i < nb2; ++i) {
+      inv[i] = diag[i];
+    }
+    m_isSingular[iRow] = !BlockMatrixOps::invert(m_nb, inv, &work[0]);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockJacobiPreconditioner::apply(const CFreal* r, CFreal* z) const
+{
+  runChunked(m_nbRows, m_nbThreads,
+             boost::bind(&BlockJacobiPreconditioner::applyRows, this, r, z, _1, _2));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockJacobiPreconditioner::applyRows(const CFreal* r, CFreal* z,
+                                          const CFuint rowStart, const CFuint rowEnd) const
+{
+  const CFuint nb2 = m_nb*m_nb;
+  for (CFuint iRow = rowStart; iRow < rowEnd; ++iRow) {
+    BlockMatrixOps::mult(m_nb, &m_invDiag[iRow*nb2], &r[iRow*m_nb], &z[iRow*m_nb]);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+} // namespace COOLFluiD
@@ -0,0 +1,65 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_BlockLSS_BlockJacobiPreconditioner_hh
+#define COOLFluiD_BlockLSS_BlockJacobiPreconditioner_hh
+
+#include "BlockLSS/BlockPreconditioner.hh"
+
+namespace COOLFluiD {
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class implements the point block Jacobi preconditioner, i.e. the
+/// inverse of the diagonal blocks. Both the setup and the application are
+/// split among threads.
+/// @author Andrea Lani
+class BlockJacobiPreconditioner : public BlockPreconditioner {
+public:
+
+  /// Constructor
+  BlockJacobiPreconditioner();
+
+  /// Destructor
+  ~BlockJacobiPreconditioner();
+
+  /// Invert the diagonal blocks of the matrix
+  void compute(const BlockCSRMatrix& mat);
+
+  /// Apply the inverse diagonal blocks
+  void apply(const CFreal* r, CFreal* z) const;
+
+private:
+
+  /// Invert the diagonal blocks of the rows [rowStart, rowEnd)
+  void computeRows(const BlockCSRMatrix* mat, const CFuint rowStart, const CFuint rowEnd);
+
+  /// Apply the inverse diagonal blocks of the rows [rowStart, rowEnd)
+  void applyRows(const CFreal* r, CFreal* z, const CFuint rowStart, const CFuint rowEnd) const;
+
+private:
+
+  /// size of the blocks
+  CFuint m_nb;
+
+  /// number of block rows
+  CFuint m_nbRows;
+
+  /// inverse diagonal blocks
+  std::vector<CFreal> m_invDiag;
+
+  /// flags telling if the diagonal block of each row is singular
+  std::vector<char> m_isSingular;
+
+}; // end of class BlockJacobiPreconditioner
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+} // namespace COOLFluiD
+
+#endif // COOLFluiD_BlockLSS_BlockJacobiPreconditioner_hh
@@ -0,0 +1,137 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include "Framework/BlockAccumulator.hh"
+#include "Framework/Profiler.hh"
+#include "Environment/ObjectProvider.hh"
+
+#include "BlockLSS/BlockLSS.hh"
+#include "BlockLSS/BlockLSSModule.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace COOLFluiD::Framework;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+Environment::ObjectProvider<BlockLSS, LinearSystemSolver, BlockLSSModule, 1>
+blockLSSMethodProvider("BlockLSS");
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSS::defineConfigOptions(Config::OptionList& options)
+{
+  options.addConfigOption< std::string >("SetupCom","Setup Command to run. This command seldomly needs overriding.");
+  options.addConfigOption< std::string >("UnSetupCom","UnSetup Command to run. This command seldomly needs overriding.");
+  options.addConfigOption< std::string >("SysSolver","Command that solves the linear system.");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+BlockLSS::BlockLSS(const std::string& name) :
+  LinearSystemSolver(name)
+{
+  m_data.reset(new BlockLSSData(getMaskArray(), getNbSysEquations(), this));
+  cf_assert(m_data.getPtr() != CFNULL);
+
+  addConfigOptionsTo(this);
+
+  m_setupStr = "StdSetup";
+  setParameter("SetupCom",&m_setupStr);
+
+  m_unSetupStr = "StdUnSetup";
+  setParameter("UnSetupCom",&m_unSetupStr);
+
+  m_solveSysStr = "StdSolveSys";
+  setParameter("SysSolver",&m_solveSysStr);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+BlockLSS::~BlockLSS()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSS::configure ( Config::ConfigArgs& args )
+{
+  LinearSystemSolver::configure(args);
+  configureNested ( m_data.getPtr(), args );
+
+  configureCommand<BlockLSSData,BlockLSSComProvider>(args, m_setup,m_setupStr,m_data);
+  configureCommand<BlockLSSData,BlockLSSComProvider>(args, m_unSetup,m_unSetupStr,m_data);
+  configureCommand<BlockLSSData,BlockLSSComProvider>(args, m_solveSys,m_solveSysStr,m_data);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSS::solveSysImpl()
+{
+  cf_assert(isSetup());
+  cf_assert(isConfigured());
+  profileExecute(m_solveSys);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+BlockAccumulator* BlockLSS::createBlockAccumulator(const CFuint nbRows,
+                                                   const CFuint nbCols,
+                                                   const CFuint subBlockSize,
+                                                   CFreal* ptr) const
+{
+  return new BlockAccumulator(nbRows, nbCols, subBlockSize,
+                              m_lssData->getLocalToGlobalMapping(), ptr);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSS::printToFile(const std::string prefix, const std::string suffix)
+{
+  cf_assert(isSetup());
+  cf_assert(isConfigured());
+  m_data->printToFile(prefix, suffix);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSS::setMethodImpl()
+{
+  LinearSystemSolver::setMethodImpl();
+
+  m_setup->setup();
+  profileExecute(m_setup);
+
+  m_solveSys->setup();
+  m_unSetup->setup();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSS::unsetMethodImpl()
+{
+  profileExecute(m_unSetup);
+  unsetupCommandsAndStrategies();
+
+  LinearSystemSolver::unsetMethodImpl();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+Common::SafePtr<MethodData> BlockLSS::getMethodData() const
+{
+  return m_data.getPtr();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+} // namespace COOLFluiD
@@ -0,0 +1,122 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_BlockLSS_BlockLSS_hh
+#define COOLFluiD_BlockLSS_BlockLSS_hh
+
+#include "BlockLSS/BlockLSSData.hh"
+#include "Framework/LinearSystemSolver.hh"
+
+namespace COOLFluiD {
+
+  namespace Framework {
+    class BlockAccumulator;
+  }
+
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class implements a linear system solver based on a native block CSR
+/// matrix and on restarted (F)GMRES with block ILU(0) or block Jacobi
+/// preconditioning, without external dependencies
+/// @author Andrea Lani
+class BlockLSS : public Framework::LinearSystemSolver {
+public:
+
+  /**
+   * Defines the Config Option's of this class
+   * @param options a OptionList where to add the options
+   */
+  static void defineConfigOptions(Config::OptionList& options);
+
+  /// Constructor
+  explicit BlockLSS(const std::string& name);
+
+  /// Destructor
+  ~BlockLSS();
+
+  /// Configures the method, by allocating its dynamic members
+  virtual void configure ( Config::ConfigArgs& args );
+
+  /// Solve the linear system
+  void solveSysImpl();
+
+  /// Prints the Linear System to a file
+  void printToFile(const std::string prefix, const std::string suffix);
+
+  /**
+   * Create a block accumulator with chosen internal storage
+   * @return a newly created block accumulator
+   * @post the block has to be deleted outside
+   */
+  Framework::BlockAccumulator* createBlockAccumulator
+  (const CFuint nbRows, const CFuint nbCols,
+   const CFuint subBlockSize, CFreal* ptr = CFNULL) const;
+
+  /// Get the LSS system matrix
+  Common::SafePtr<Framework::LSSMatrix> getMatrix() const
+  {
+    return &m_data->getMatrix();
+  }
+
+  /// Get the LSS solution vector
+  Common::SafePtr<Framework::LSSVector> getSolVector() const
+  {
+    return &m_data->getSolVector();
+  }
+
+  /// Get the LSS right hand side vector
+  Common::SafePtr<Framework::LSSVector> getRhsVector() const
+  {
+    return &m_data->getRhsVector();
+  }
+
+protected:
+
+  /// Sets up the data for the method commands to be applied
+  virtual void setMethodImpl();
+
+  /// UnSets the data of the method
+  virtual void unsetMethodImpl();
+
+  /**
+   * Get the Data aggregator of this method
+   * @return SafePtr to the MethodData
+   */
+  virtual Common::SafePtr<Framework::MethodData> getMethodData() const;
+
+private:
+
+  /// The Setup command to use
+  Common::SelfRegistPtr<BlockLSSCom> m_setup;
+
+  /// The UnSetup command to use
+  Common::SelfRegistPtr<BlockLSSCom> m_unSetup;
+
+  /// The command that solves the linear system
+  Common::SelfRegistPtr<BlockLSSCom> m_solveSys;
+
+  /// The Setup string for configuration
+  std::string m_setupStr;
+
+  /// The UnSetup string for configuration
+  std::string m_unSetupStr;
+
+  /// Name of the command that solves the linear system
+  std::string m_solveSysStr;
+
+  /// Data to share between BlockLSSCom commands
+  Common::SharedPtr<BlockLSSData> m_data;
+
+}; // class BlockLSS
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+} // namespace COOLFluiD
+
+#endif // COOLFluiD_BlockLSS_BlockLSS_hh
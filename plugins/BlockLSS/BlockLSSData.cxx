@@ -0,0 +1,144 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include "Common/BadValueException.hh"
+#include "Framework/MethodCommandProvider.hh"
+
+#include "BlockLSS/BlockLSSData.hh"
+#include "BlockLSS/BlockLSSModule.hh"
+#include "BlockLSS/BlockILUPreconditioner.hh"
+#include "BlockLSS/BlockJacobiPreconditioner.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+MethodCommandProvider<NullMethodCommand<BlockLSSData>, BlockLSSData,
+                      BlockLSSModule> nullBlockLSSComProvider("Null");
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSData::defineConfigOptions(Config::OptionList& options)
+{
+  options.addConfigOption< std::string >("KSPType","Krylov method (KSPGMRES, KSPFGMRES).");
+  options.addConfigOption< std::string >("PCType","Preconditioner (PCILU, PCBJACOBI, PCNONE).");
+  options.addConfigOption< CFreal >("RelativeTolerance","Relative tolerance for the Krylov solver.");
+  options.addConfigOption< CFreal >("AbsoluteTolerance","Absolute tolerance for the Krylov solver.");
+  options.addConfigOption< CFuint >("NbKrylovSpaces","Number of Krylov vectors before restart.");
+  options.addConfigOption< CFuint >("KSPShowRate","Rate at which the Krylov convergence is shown.");
+  options.addConfigOption< CFuint >("NbThreads","Number of threads for the matrix-vector products and the block Jacobi preconditioner.");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+BlockLSSData::BlockLSSData(SafePtr<std::valarray<bool> > maskArray,
+                           CFuint& nbSysEquations,
+                           SafePtr<Method> owner) :
+  LSSData(maskArray, nbSysEquations, owner),
+  m_mat(),
+  m_sol(),
+  m_rhs(),
+  m_halo(),
+  m_ksp(),
+  m_pc(),
+  m_upLocalIDs()
+{
+  addConfigOptionsTo(this);
+
+  m_kspTypeStr = "KSPGMRES";
+  setParameter("KSPType",&m_kspTypeStr);
+
+  m_pcTypeStr = "PCILU";
+  setParameter("PCType",&m_pcTypeStr);
+
+  m_rTol = 1e-5;
+  setParameter("RelativeTolerance",&m_rTol);
+
+  m_aTol = 1e-30;
+  setParameter("AbsoluteTolerance",&m_aTol);
+
+  m_nbKrylovSpaces = 30;
+  setParameter("NbKrylovSpaces",&m_nbKrylovSpaces);
+
+  m_kspShowRate = 1;
+  setParameter("KSPShowRate",&m_kspShowRate);
+
+  m_nbThreads = 1;
+  setParameter("NbThreads",&m_nbThreads);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+BlockLSSData::~BlockLSSData()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSData::configure ( Config::ConfigArgs& args )
+{
+  LSSData::configure(args);
+
+  if (m_kspTypeStr != "KSPGMRES" && m_kspTypeStr != "KSPFGMRES") {
+    throw BadValueException
+      (FromHere(), "BlockLSSData::configure() => KSPType " + m_kspTypeStr + " not supported");
+  }
+
+  if (m_pcTypeStr != "PCILU" && m_pcTypeStr != "PCBJACOBI" && m_pcTypeStr != "PCNONE") {
+    throw BadValueException
+      (FromHere(), "BlockLSSData::configure() => PCType " + m_pcTypeStr + " not supported");
+  }
+
+  if (m_nbKrylovSpaces == 0) {
+    throw BadValueException
+      (FromHere(), "BlockLSSData::configure() => NbKrylovSpaces must be > 0");
+  }
+
+  if (m_nbThreads == 0) m_nbThreads = 1;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSData::createPreconditioner()
+{
+  if (m_pcTypeStr == "PCILU") {
+    m_pc.reset(new BlockILUPreconditioner());
+  }
+  else if (m_pcTypeStr == "PCBJACOBI") {
+    m_pc.reset(new BlockJacobiPreconditioner());
+  }
+  else {
+    m_pc.reset(new NullBlockPreconditioner());
+  }
+  m_pc->setNbThreads(m_nbThreads);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSData::printToFile(const std::string& prefix, const std::string& suffix)
+{
+  const std::string matStr = prefix + "mat" + suffix;
+  const std::string rhsStr = prefix + "rhs" + suffix;
+  const std::string solStr = prefix + "sol" + suffix;
+
+  m_mat.printToFile(matStr.c_str());
+  m_rhs.printToFile(rhsStr.c_str());
+  m_sol.printToFile(solStr.c_str());
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+} // namespace COOLFluiD
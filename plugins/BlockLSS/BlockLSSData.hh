@@ -0,0 +1,157 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_BlockLSS_BlockLSSData_hh
+#define COOLFluiD_BlockLSS_BlockLSSData_hh
+
+#include <memory>
+
+#include "Framework/LSSData.hh"
+#include "BlockLSS/BlockCSRMatrix.hh"
+#include "BlockLSS/BlockLSSVector.hh"
+#include "BlockLSS/BlockHaloExchange.hh"
+#include "BlockLSS/BlockPreconditioner.hh"
+#include "BlockLSS/BlockGMRES.hh"
+
+namespace COOLFluiD {
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This is a data object accessed by BlockLSSComs
+/// @author Andrea Lani
+class BlockLSSData : public Framework::LSSData {
+public:
+
+  /**
+   * Defines the Config Option's of this class
+   * @param options a OptionList where to add the options
+   */
+  static void defineConfigOptions(Config::OptionList& options);
+
+  /// Default constructor without arguments
+  BlockLSSData(Common::SafePtr<std::valarray<bool> > maskArray,
+               CFuint& nbSysEquations,
+               Common::SafePtr<Framework::Method> owner);
+
+  /// Destructor
+  ~BlockLSSData();
+
+  /// Configure the data from the supplied arguments
+  virtual void configure ( Config::ConfigArgs& args );
+
+  /// Get the class name
+  static std::string getClassName() {return "BlockLSS";}
+
+  /// Get the system matrix
+  BlockCSRMatrix& getMatrix() {return m_mat;}
+
+  /// Get the solution vector
+  BlockLSSVector& getSolVector() {return m_sol;}
+
+  /// Get the right hand side vector
+  BlockLSSVector& getRhsVector() {return m_rhs;}
+
+  /// Get the halo exchange
+  BlockHaloExchange& getHaloExchange() {return m_halo;}
+
+  /// Get the Krylov solver
+  BlockGMRES& getKSP() {return m_ksp;}
+
+  /// Get the preconditioner
+  BlockPreconditioner& getPreconditioner()
+  {
+    cf_assert(m_pc.get() != CFNULL);
+    return *m_pc;
+  }
+
+  /// Create the preconditioner selected by the user
+  void createPreconditioner();
+
+  /// Get the local IDs of the updatable states, in the internal order
+  std::vector<CFuint>& getUpdatableLocalIDs() {return m_upLocalIDs;}
+
+  /// Use FGMRES instead of GMRES
+  bool isFlexible() const {return m_kspTypeStr == "KSPFGMRES";}
+
+  /// Get the relative tolerance
+  CFreal getRelativeTolerance() const {return m_rTol;}
+
+  /// Get the absolute tolerance
+  CFreal getAbsoluteTolerance() const {return m_aTol;}
+
+  /// Get the number of Krylov vectors before restart
+  CFuint getNbKrylovSpaces() const {return m_nbKrylovSpaces;}
+
+  /// Get the rate at which the convergence is shown
+  CFuint getKSPShowRate() const {return m_kspShowRate;}
+
+  /// Get the number of threads
+  CFuint getNbThreads() const {return m_nbThreads;}
+
+  /// Prints the Linear System to a file
+  void printToFile(const std::string& prefix, const std::string& suffix);
+
+private:
+
+  /// system matrix
+  BlockCSRMatrix m_mat;
+
+  /// system solution vector
+  BlockLSSVector m_sol;
+
+  /// system right hand side vector
+  BlockLSSVector m_rhs;
+
+  /// exchange of the ghost entries
+  BlockHaloExchange m_halo;
+
+  /// Krylov solver
+  BlockGMRES m_ksp;
+
+  /// preconditioner
+  std::auto_ptr<BlockPreconditioner> m_pc;
+
+  /// local IDs of the updatable states
+  std::vector<CFuint> m_upLocalIDs;
+
+  /// Krylov method
+  std::string m_kspTypeStr;
+
+  /// preconditioner type
+  std::string m_pcTypeStr;
+
+  /// relative tolerance
+  CFreal m_rTol;
+
+  /// absolute tolerance
+  CFreal m_aTol;
+
+  /// number of Krylov vectors before restart
+  CFuint m_nbKrylovSpaces;
+
+  /// rate at which the convergence is shown
+  CFuint m_kspShowRate;
+
+  /// number of threads
+  CFuint m_nbThreads;
+
+}; // end of class BlockLSSData
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// Definition of a command for BlockLSS
+typedef Framework::MethodCommand<BlockLSSData> BlockLSSCom;
+
+/// Definition of a command provider for BlockLSS
+typedef Framework::MethodCommand<BlockLSSData>::PROVIDER BlockLSSComProvider;
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+} // namespace COOLFluiD
+
+#endif // COOLFluiD_BlockLSS_BlockLSSData_hh
@@ -0,0 +1,42 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_BlockLSS_BlockLSSModule_hh
+#define COOLFluiD_BlockLSS_BlockLSSModule_hh
+
+#include "Environment/ModuleRegister.hh"
+
+namespace COOLFluiD {
+  namespace BlockLSS {
+
+/// This class defines the Module BlockLSS
+class BlockLSSModule : public Environment::ModuleRegister< BlockLSSModule > {
+public:
+
+  /**
+   * Static function that returns the module name.
+   * Must be implemented for the ModuleRegister template
+   * @return name of the module
+   */
+  static std::string getModuleName() {
+    return "BlockLSS";
+  }
+
+  /**
+   * Static function that returns the description of the module.
+   * Must be implemented for the ModuleRegister template
+   * @return descripton of the module
+   */
+  static std::string getModuleDescription() {
+    return "This module implements a native block sparse Krylov linear system solver.";
+  }
+
+}; // end BlockLSSModule
+
+  } // namespace BlockLSS
+} // namespace COOLFluiD
+
+#endif // COOLFluiD_BlockLSS_BlockLSSModule_hh
@@ -0,0 +1,140 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <algorithm>
+#include <fstream>
+
+#include "Common/CFLog.hh"
+
+#include "BlockLSS/BlockLSSVector.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+BlockLSSVector::BlockLSSVector() :
+  Framework::LSSVector(),
+  m_data(),
+  m_globalSize(0)
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+BlockLSSVector::~BlockLSSVector()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSVector::create(MPI_Comm comm, const CFint m, const CFint M, const char* name)
+{
+  cf_assert(m >= 0);
+  m_data.assign(m, 0.);
+  m_globalSize = M;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSVector::initialize(MPI_Comm comm, const CFreal value)
+{
+  setValue(value);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSVector::printToScreen() const
+{
+  for (CFuint i = 0; i < m_data.size(); ++i) {
+    CFout << i << " " << m_data[i] << "\n";
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSVector::printToFile(const char* fileName) const
+{
+  ofstream file(fileName);
+  file.precision(14);
+  for (CFuint i = 0; i < m_data.size(); ++i) {
+    file << i << " " << m_data[i] << "\n";
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSVector::destroy()
+{
+  vector<CFreal>().swap(m_data);
+  m_globalSize = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSVector::setValue(const CFreal value)
+{
+  std::fill(m_data.begin(), m_data.end(), value);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSVector::setValues(const CFuint nbValues, const CFint* idx, const CFreal* values)
+{
+  for (CFuint i = 0; i < nbValues; ++i) {
+    setValue(idx[i], values[i]);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSVector::addValues(const CFuint nbValues, const CFint* idx, const CFreal* values)
+{
+  for (CFuint i = 0; i < nbValues; ++i) {
+    addValue(idx[i], values[i]);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSVector::getValues(const CFuint m, const CFint* im, CFreal* values)
+{
+  for (CFuint i = 0; i < m; ++i) {
+    cf_assert(im[i] >= 0 && im[i] < (CFint)m_data.size());
+    values[i] = m_data[im[i]];
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSVector::copy(CFreal *const other, const CFuint size) const
+{
+  cf_assert(size <= m_data.size());
+  for (CFuint i = 0; i < size; ++i) {
+    other[i] = m_data[i];
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BlockLSSVector::copy(CFreal *const other, CFint *const localIDs, const CFuint size) const
+{
+  cf_assert(size <= m_data.size());
+  for (CFuint i = 0; i < size; ++i) {
+    other[localIDs[i]] = m_data[i];
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+} // namespace COOLFluiD
@@ -0,0 +1,123 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_BlockLSS_BlockLSSVector_hh
+#define COOLFluiD_BlockLSS_BlockLSSVector_hh
+
+#include "Framework/LSSVector.hh"
+
+namespace COOLFluiD {
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class represents a vector of the BlockLSS linear system solver,
+/// stored contiguously with the locally updatable entries first
+/// @author Andrea Lani
+class BlockLSSVector : public Framework::LSSVector {
+public:
+
+  /// Default constructor without arguments
+  BlockLSSVector();
+
+  /// Destructor
+  ~BlockLSSVector();
+
+  /// Create a vector with local size m and global size M
+  void create(MPI_Comm comm, const CFint m, const CFint M, const char* name);
+
+  /// Initialize a vector
+  void initialize(MPI_Comm comm, const CFreal value);
+
+  /// Start to assemble the vector (nothing to do, values are stored in place)
+  void beginAssembly() {}
+
+  /// Finish to assemble the vector (nothing to do, values are stored in place)
+  void endAssembly() {}
+
+  /// Print this vector
+  void printToScreen() const;
+
+  /// Print this vector to a file
+  void printToFile(const char* fileName) const;
+
+  /// Destroy this vector
+  void destroy();
+
+  /// Set a value at the specified position in the vector
+  void setValue(const CFint idx, const CFreal value)
+  {
+    cf_assert(idx >= 0 && idx < (CFint)m_data.size());
+    m_data[idx] = value;
+  }
+
+  /// Set all the entries equal to the given value
+  void setValue(const CFreal value);
+
+  /// Set a list of values
+  void setValues(const CFuint nbValues, const CFint* idx, const CFreal* values);
+
+  /// Add a value in the vector at the given location
+  void addValue(const CFint idx, const CFreal value)
+  {
+    cf_assert(idx >= 0 && idx < (CFint)m_data.size());
+    m_data[idx] += value;
+  }
+
+  /// Add a list of values at the given locations
+  void addValues(const CFuint nbValues, const CFint* idx, const CFreal* values);
+
+  /// Get one value (the value is passed by copy in the interface, nothing is returned)
+  void getValue(const CFint idx, CFreal value) {}
+
+  /// Get a list of values
+  void getValues(const CFuint m, const CFint* im, CFreal* values);
+
+  /// Gets the local size of the vector
+  CFuint getLocalSize() const {return m_data.size();}
+
+  /// Gets the global size of the vector
+  CFuint getGlobalSize() const {return m_globalSize;}
+
+  /// Copy the raw data of this vector to a given array
+  void copy(CFreal *const other, const CFuint size) const;
+
+  /// Copy the raw data of this vector to the given positions of an array
+  void copy(CFreal *const other, CFint *const localIDs, const CFuint size) const;
+
+  /// Access an entry
+  CFreal& operator[] (const CFuint idx)
+  {
+    cf_assert(idx < m_data.size());
+    return m_data[idx];
+  }
+
+  /// Access an entry
+  CFreal operator[] (const CFuint idx) const
+  {
+    cf_assert(idx < m_data.size());
+    return m_data[idx];
+  }
+
+  /// Get the raw array
+  CFreal* getArray() {return &m_data[0];}
+
+private:
+
+  /// entries of the vector
+  std::vector<CFreal> m_data;
+
+  /// global size
+  CFuint m_globalSize;
+
+}; // end of class BlockLSSVector
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+} // namespace COOLFluiD
+
+#endif // COOLFluiD_BlockLSS_BlockLSSVector_hh
@@ -0,0 +1,156 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_BlockLSS_BlockMatrixOps_hh
+#define COOLFluiD_BlockLSS_BlockMatrixOps_hh
+
+#include <algorithm>
+#include <cmath>
+
+#include "Common/COOLFluiD.hh"
+
+namespace COOLFluiD {
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// Small dense kernels on the nb x nb blocks of a BlockCSRMatrix.
+/// All the blocks are stored row by row.
+/// @author Andrea Lani
+struct BlockMatrixOps {
+
+  /// y += A*x
+  static void addMult(const CFuint nb, const CFreal* a, const CFreal* x, CFreal* y)
+  {
+    for (CFuint i = 0; i < nb; ++i) {
+      CFreal sum = 0.;
+      const CFreal *const row = &a[i*nb];
+      for (CFuint j = 0; j < nb; ++j) {
+        sum += row[j]*x[j];
+      }
+      y[i] += sum;
+    }
+  }
+
+  /// y -= A*x
+  static void subMult(const CFuint nb, const CFreal* a, const CFreal* x, CFreal* y)
+  {
+    for (CFuint i = 0; i < nb; ++i) {
+      CFreal sum = 0.;
+      const CFreal *const row = &a[i*nb];
+      for (CFuint j = 0; j < nb; ++j) {
+        sum += row[j]*x[j];
+      }
+      y[i] -= sum;
+    }
+  }
+
+  /// y = A*x
+  static void mult(const CFuint nb, const CFreal* a, const CFreal* x, CFreal* y)
+  {
+    for (CFuint i = 0; i < nb; ++i) {
+      CFreal sum = 0.;
+      const CFreal *const row = &a[i*nb];
+      for (CFuint j = 0; j < nb; ++j) {
+        sum += row[j]*x[j];
+      }
+      y[i] = sum;
+    }
+  }
+
+  /// C = A*B
+  static void multBlock(const CFuint nb, const CFreal* a, const CFreal* b, CFreal* c)
+  {
+    for (CFuint i = 0; i < nb; ++i) {
+      for (CFuint j = 0; j < nb; ++j) {
+        CFreal sum = 0.;
+        for (CFuint k = 0; k < nb; ++k) {
+          sum += a[i*nb + k]*b[k*nb + j];
+        }
+        c[i*nb + j] = sum;
+      }
+    }
+  }
+
+  /// C -= A*B
+  static void subMultBlock(const CFuint nb, const CFreal* a, const CFreal* b, CFreal* c)
+  {
+    for (CFuint i = 0; i < nb; ++i) {
+      for (CFuint k = 0; k < nb; ++k) {
+        const CFreal aik = a[i*nb + k];
+        const CFreal *const bk = &b[k*nb];
+        CFreal *const ci = &c[i*nb];
+        for (CFuint j = 0; j < nb; ++j) {
+          ci[j] -= aik*bk[j];
+        }
+      }
+    }
+  }
+
+  /**
+   * Invert a block in place by Gauss-Jordan elimination with partial pivoting
+   * @param work  workspace of size nb*nb
+   * @return false if the block is singular
+   */
+  static bool invert(const CFuint nb, CFreal* a, CFreal* work)
+  {
+    // work <- identity, a is reduced to the identity
+    for (CFuint i = 0; i < nb*nb; ++i) {
+      work[i] = 0.;
+    }
+    for (CFuint i = 0; i < nb; ++i) {
+      work[i*nb + i] = 1.;
+    }
+
+    for (CFuint k = 0; k < nb; ++k) {
+      CFuint pivot = k;
+      for (CFuint i = k+1; i < nb; ++i) {
+        if (std::abs(a[i*nb + k]) > std::abs(a[pivot*nb + k])) {
+          pivot = i;
+        }
+      }
+      if (a[pivot*nb + k] == 0.) return false;
+
+      if (pivot != k) {
+        for (CFuint j = 0; j < nb; ++j) {
+          std::swap(a[k*nb + j], a[pivot*nb + j]);
+          std::swap(work[k*nb + j], work[pivot*nb + j]);
+        }
+      }
+
+      const CFreal invPivot = 1./a[k*nb + k];
+      for (CFuint j = 0; j < nb; ++j) {
+        a[k*nb + j] *= invPivot;
+        work[k*nb + j] *= invPivot;
+      }
+
+      for (CFuint i = 0; i < nb; ++i) {
+        if (i != k) {
+          const CFreal f = a[i*nb + k];
+          if (f != 0.) {
+            for (CFuint j = 0; j < nb; ++j) {
+              a[i*nb + j] -= f*a[k*nb + j];
+              work[i*nb + j] -= f*work[k*nb + j];
+            }
+          }
+        }
+      }
+    }
+
+    for (CFuint i = 0; i < nb*nb; ++i) {
+      a[i] = work[i];
+    }
+    return true;
+  }
+
+}; // end of struct BlockMatrixOps
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+} // namespace COOLFluiD
+
+#endif // COOLFluiD_BlockLSS_BlockMatrixOps_hh
@@ -0,0 +1,86 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_BlockLSS_BlockPreconditioner_hh
+#define COOLFluiD_BlockLSS_BlockPreconditioner_hh
+
+#include "BlockLSS/BlockCSRMatrix.hh"
+
+namespace COOLFluiD {
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class represents a preconditioner of the BlockLSS Krylov solver.
+/// It acts on the locally updatable rows only: the couplings with the
+/// ghost states are ignored, which gives an additive Schwarz (block Jacobi
+/// among processes) preconditioner in parallel.
+/// @author Andrea Lani
+class BlockPreconditioner {
+public:
+
+  /// Constructor
+  BlockPreconditioner() : m_nbThreads(1) {}
+
+  /// Destructor
+  virtual ~BlockPreconditioner() {}
+
+  /// Set the number of threads to use, where the algorithm allows it
+  void setNbThreads(const CFuint nbThreads) {m_nbThreads = nbThreads;}
+
+  /// Compute the preconditioner from the current values of the matrix
+  virtual void compute(const BlockCSRMatrix& mat) = 0;
+
+  /// Apply the preconditioner z = M^-1 r on the locally updatable rows
+  virtual void apply(const CFreal* r, CFreal* z) const = 0;
+
+protected:
+
+  /// number of threads
+  CFuint m_nbThreads;
+
+}; // end of class BlockPreconditioner
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class represents the identity preconditioner
+/// @author Andrea Lani
+class NullBlockPreconditioner : public BlockPreconditioner {
+public:
+
+  /// Constructor
+  NullBlockPreconditioner() : BlockPreconditioner(), m_size(0) {}
+
+  /// Destructor
+  ~NullBlockPreconditioner() {}
+
+  /// Compute the preconditioner from the current values of the matrix
+  void compute(const BlockCSRMatrix& mat)
+  {
+    m_size = mat.getNbBlockRows()*mat.getBlockSize();
+  }
+
+  /// Apply the preconditioner z = r
+  void apply(const CFreal* r, CFreal* z) const
+  {
+    for (CFuint i = 0; i < m_size; ++i) {
+      z[i] = r[i];
+    }
+  }
+
+private:
+
+  /// number of locally updatable entries
+  CFuint m_size;
+
+}; // end of class NullBlockPreconditioner
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+} // namespace COOLFluiD
+
+#endif // COOLFluiD_BlockLSS_BlockPreconditioner_hh
@@ -0,0 +1,227 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <algorithm>
+
+#include "Common/PE.hh"
+#include "Common/NotImplementedException.hh"
+#include "Framework/MethodCommandProvider.hh"
+#include "Framework/GlobalJacobianSparsity.hh"
+#include "Framework/SpaceMethod.hh"
+#include "Framework/MeshData.hh"
+#include "Framework/State.hh"
+
+#include "BlockLSS/StdSetup.hh"
+#include "BlockLSS/BlockLSSModule.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+MethodCommandProvider<StdSetup, BlockLSSData, BlockLSSModule>
+blockLSSStdSetupProvider("StdSetup");
+
+//////////////////////////////////////////////////////////////////////////////
+
+StdSetup::StdSetup(const std::string& name) :
+  BlockLSSCom(name),
+  socket_bStatesNeighbors("bStatesNeighbors"),
+  socket_states("states"),
+  socket_nodes("nodes")
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+StdSetup::~StdSetup()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+std::vector<SafePtr<BaseDataSocketSink> > StdSetup::needsSockets()
+{
+  std::vector<SafePtr<BaseDataSocketSink> > result;
+  result.push_back(&socket_bStatesNeighbors);
+  result.push_back(&socket_states);
+  result.push_back(&socket_nodes);
+  return result;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void StdSetup::execute()
+{
+  CFAUTOTRACE;
+
+  BlockLSSData& d = getMethodData();
+  if (d.useNodeBased()) {
+    throw NotImplementedException
+      (FromHere(), "StdSetup::execute() => node based assembly not supported by BlockLSS");
+  }
+
+  DataHandle<State*, GLOBAL> states = socket_states.getDataHandle();
+  const CFuint nbStates = states.size();
+  const CFuint nbEqs = d.getNbSysEquations();
+
+  // internal numbering: updatable states first, then ghost states
+  vector<CFuint>& upLocalIDs = d.getUpdatableLocalIDs();
+  upLocalIDs.clear();
+  vector<CFuint> localToInternal(nbStates);
+  vector<CFuint> ownedGlobalIDs;
+  vector<CFuint> ghostGlobalIDs;
+  for (CFuint i = 0; i < nbStates; ++i) {
+    if (states[i]->isParUpdatable()) {
+      localToInternal[i] = upLocalIDs.size();
+      upLocalIDs.push_back(i);
+      ownedGlobalIDs.push_back(states[i]->getGlobalID());
+    }
+  }
+  const CFuint nbOwned = upLocalIDs.size();
+  for (CFuint i = 0; i < nbStates; ++i) {
+    if (!states[i]->isParUpdatable()) {
+      localToInternal[i] = nbOwned + ghostGlobalIDs.size();
+      ghostGlobalIDs.push_back(states[i]->getGlobalID());
+    }
+  }
+
+  std::valarray<CFuint> internalIDs(nbStates);
+  std::valarray<bool> isGhost(nbStates);
+  for (CFuint i = 0; i < nbStates; ++i) {
+    internalIDs[i] = localToInternal[i];
+    isGhost[i] = !states[i]->isParUpdatable();
+  }
+  d.getLocalToGlobalMapping().createMapping(internalIDs, isGhost);
+
+  // matrix
+  vector<CFuint> rowPtr;
+  vector<CFuint> colIdx;
+  computePattern(localToInternal, nbOwned, rowPtr, colIdx);
+  d.getMatrix().createBlockCSR(nbEqs, nbStates, rowPtr, colIdx);
+
+  CFLog(VERBOSE, "StdSetup::execute() => " << nbOwned << " block rows, "
+        << colIdx.size() << " blocks of size " << nbEqs << "\n");
+
+  // vectors: the solution also holds the ghost entries
+  const string nsp = d.getNamespace();
+  MPI_Comm comm = PE::GetPE().GetCommunicator(nsp);
+  const CFuint globalSize = states.getGlobalSize()*nbEqs;
+  d.getRhsVector().create(comm, nbOwned*nbEqs, globalSize, "rhs");
+  d.getSolVector().create(comm, nbStates*nbEqs, globalSize, "sol");
+  d.getRhsVector().initialize(comm, 0.);
+  d.getSolVector().initialize(comm, 0.);
+
+  // solver
+  d.getHaloExchange().setup(nsp, ownedGlobalIDs, ghostGlobalIDs);
+  d.getKSP().setup(d.getNbKrylovSpaces(), d.isFlexible(), nbOwned*nbEqs, nbStates*nbEqs);
+  d.getKSP().setNbThreads(d.getNbThreads());
+  d.createPreconditioner();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void StdSetup::computePattern(const vector<CFuint>& localToInternal,
+                              const CFuint nbOwned,
+                              vector<CFuint>& rowPtr,
+                              vector<CFuint>& colIdx)
+{
+  CFAUTOTRACE;
+
+  DataHandle<State*, GLOBAL> states = socket_states.getDataHandle();
+  const CFuint nbStates = states.size();
+
+  SelfRegistPtr<GlobalJacobianSparsity> sparsity =
+    getMethodData().getCollaborator<SpaceMethod>()->createJacobianSparsity();
+  sparsity->setDataSockets(socket_states, socket_nodes, socket_bStatesNeighbors);
+
+  // this also fills the neighbors of the boundary states
+  std::valarray<CFint> nnz(nbStates);
+  std::valarray<CFint> ghostNnz(nbStates);
+  sparsity->computeNNz(nnz, ghostNnz);
+
+  ConnectivityTable<CFuint> pattern;
+  try {
+    sparsity->computeMatrixPattern(socket_states, pattern);
+  }
+  catch (NotImplementedException&) {
+    CFLog(VERBOSE, "StdSetup::computePattern() => using the cell-states connectivity\n");
+    getCellStatesPattern(pattern);
+  }
+  cf_assert(pattern.nbRows() == nbStates);
+
+  rowPtr.assign(nbOwned + 1, 0);
+  colIdx.clear();
+  vector<CFuint> row;
+  for (CFuint iRow = 0; iRow < nbOwned; ++iRow) {
+    const CFuint localID = getMethodData().getUpdatableLocalIDs()[iRow];
+    const CFuint nbNeighbors = pattern.nbCols(localID);
+    row.resize(nbNeighbors + 1);
+    row[0] = iRow;
+    for (CFuint in = 0; in < nbNeighbors; ++in) {
+      row[in + 1] = localToInternal[pattern(localID, in)];
+    }
+    sort(row.begin(), row.end());
+    row.erase(unique(row.begin(), row.end()), row.end());
+
+    colIdx.insert(colIdx.end(), row.begin(), row.end());
+    rowPtr[iRow + 1] = colIdx.size();
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void StdSetup::getCellStatesPattern(ConnectivityTable<CFuint>& pattern)
+{
+  CFAUTOTRACE;
+
+  DataHandle<State*, GLOBAL> states = socket_states.getDataHandle();
+  const CFuint nbStates = states.size();
+
+  SafePtr<ConnectivityTable<CFuint> > cellStates =
+    MeshDataStack::getActive()->getConnectivity("cellStates_InnerCells");
+  const CFuint nbCells = cellStates->nbRows();
+
+  vector<vector<CFuint> > neighbors(nbStates);
+  for (CFuint iCell = 0; iCell < nbCells; ++iCell) {
+    const CFuint nbCellStates = cellStates->nbCols(iCell);
+    for (CFuint is = 0; is < nbCellStates; ++is) {
+      const CFuint stateID = (*cellStates)(iCell, is);
+      for (CFuint in = 0; in < nbCellStates; ++in) {
+        if (in != is) {
+          neighbors[stateID].push_back((*cellStates)(iCell, in));
+        }
+      }
+    }
+  }
+
+  std::valarray<CFuint> nbCols(nbStates);
+  for (CFuint i = 0; i < nbStates; ++i) {
+    sort(neighbors[i].begin(), neighbors[i].end());
+    neighbors[i].erase(unique(neighbors[i].begin(), neighbors[i].end()), neighbors[i].end());
+    nbCols[i] = neighbors[i].size();
+  }
+
+  pattern.resize(nbCols);
+  for (CFuint i = 0; i < nbStates; ++i) {
+    for (CFuint in = 0; in < nbCols[i]; ++in) {
+      pattern(i, in) = neighbors[i][in];
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+} // namespace COOLFluiD
@@ -0,0 +1,82 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_BlockLSS_StdSetup_hh
+#define COOLFluiD_BlockLSS_StdSetup_hh
+
+#include "BlockLSS/BlockLSSData.hh"
+#include "Framework/DataSocketSink.hh"
+
+namespace COOLFluiD {
+
+  namespace Framework {
+    class State;
+    class Node;
+  }
+
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This is a standard command to setup the BlockLSS method.
+/// The updatable states are numbered first, followed by the ghost states:
+/// the matrix stores the updatable block rows, with block columns for all
+/// the local states, and the pattern is given by the GlobalJacobianSparsity
+/// of the space method.
+/// @author Andrea Lani
+class StdSetup : public BlockLSSCom {
+public:
+
+  /// Constructor
+  explicit StdSetup(const std::string& name);
+
+  /// Destructor
+  ~StdSetup();
+
+  /// Execute processing actions
+  void execute();
+
+  /**
+   * Returns the DataSockets that this command needs as sinks
+   * @return vector of SafePtr with the DataSockets
+   */
+  std::vector<Common::SafePtr<Framework::BaseDataSocketSink> > needsSockets();
+
+private:
+
+  /**
+   * Compute the block pattern of the updatable rows in internal numbering
+   * @param localToInternal  internal ID of each local state
+   * @param nbOwned          number of updatable states
+   */
+  void computePattern(const std::vector<CFuint>& localToInternal,
+                      const CFuint nbOwned,
+                      std::vector<CFuint>& rowPtr,
+                      std::vector<CFuint>& colIdx);
+
+  /// Get the state-state connectivity from the cells, for the space methods
+  /// whose sparsity does not provide the matrix pattern
+  void getCellStatesPattern(Common::ConnectivityTable<CFuint>& pattern);
+
+private:
+
+  /// socket for the list of neighbor states of the boundary states
+  Framework::DataSocketSink<std::valarray<Framework::State*> > socket_bStatesNeighbors;
+
+  /// socket for states
+  Framework::DataSocketSink<Framework::State*, Framework::GLOBAL> socket_states;
+
+  /// socket for nodes
+  Framework::DataSocketSink<Framework::Node*, Framework::GLOBAL> socket_nodes;
+
+}; // class StdSetup
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+} // namespace COOLFluiD
+
+#endif // COOLFluiD_BlockLSS_StdSetup_hh
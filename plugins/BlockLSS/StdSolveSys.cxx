@@ -0,0 +1,128 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include "Common/CFLog.hh"
+#include "Common/StringOps.hh"
+#include "Framework/MethodCommandProvider.hh"
+#include "Framework/PhysicalModel.hh"
+#include "Framework/SubSystemStatus.hh"
+
+#include "BlockLSS/StdSolveSys.hh"
+#include "BlockLSS/BlockLSSModule.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+MethodCommandProvider<StdSolveSys, BlockLSSData, BlockLSSModule>
+blockLSSStdSolveSysProvider("StdSolveSys");
+
+//////////////////////////////////////////////////////////////////////////////
+
+StdSolveSys::StdSolveSys(const std::string& name) :
+  BlockLSSCom(name),
+  socket_rhs("rhs"),
+  m_rhsIDs()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+StdSolveSys::~StdSolveSys()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void StdSolveSys::setup()
+{
+  CFAUTOTRACE;
+
+  const vector<CFuint>& upLocalIDs = getMethodData().getUpdatableLocalIDs();
+  const CFuint totalNbEqs = PhysicalModelStack::getActive()->getNbEq();
+  const std::valarray<bool>& maskArray = *getMethodData().getMaskArray();
+
+  m_rhsIDs.clear();
+  m_rhsIDs.reserve(upLocalIDs.size()*getMethodData().getNbSysEquations());
+  for (CFuint i = 0; i < upLocalIDs.size(); ++i) {
+    for (CFuint iEq = 0; iEq < totalNbEqs; ++iEq) {
+      if (maskArray[iEq]) {
+        m_rhsIDs.push_back(upLocalIDs[i]*totalNbEqs + iEq);
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void StdSolveSys::execute()
+{
+  CFAUTOTRACE;
+
+  BlockLSSData& d = getMethodData();
+  DataHandle<CFreal> rhs = socket_rhs.getDataHandle();
+
+  BlockCSRMatrix& mat = d.getMatrix();
+  CFreal *const b = d.getRhsVector().getArray();
+  CFreal *const x = d.getSolVector().getArray();
+
+  const CFuint vecSize = m_rhsIDs.size();
+  for (CFuint i = 0; i < vecSize; ++i) {
+    b[i] = rhs[m_rhsIDs[i]];
+  }
+
+  const CFuint nbIter = SubSystemStatusStack::getActive()->getNbIter();
+  if (d.getSaveRate() > 0) {
+    if (d.isSaveSystemToFile() || (nbIter%d.getSaveRate() == 0)) {
+      const string mFile = "mat-iter" + StringOps::to_str(nbIter) + ".dat";
+      mat.printToFile(mFile.c_str());
+
+      const string vFile = "rhs-iter" + StringOps::to_str(nbIter) + ".dat";
+      d.getRhsVector().printToFile(vFile.c_str());
+    }
+  }
+
+  BlockPreconditioner& pc = d.getPreconditioner();
+  pc.compute(mat);
+
+  CFreal resNorm = 0.;
+  const CFuint iter = d.getKSP().solve(mat, pc, d.getHaloExchange(), b, x,
+                                       d.getRelativeTolerance(),
+                                       d.getAbsoluteTolerance(),
+                                       d.getMaxIterations(), resNorm);
+
+  if (nbIter%d.getKSPShowRate() == 0) {
+    CFLog(INFO, "KSP convergence reached at iteration: " << iter
+          << " (residual " << resNorm << ")\n");
+  }
+
+  for (CFuint i = 0; i < vecSize; ++i) {
+    rhs[m_rhsIDs[i]] = x[i];
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+std::vector<SafePtr<BaseDataSocketSink> > StdSolveSys::needsSockets()
+{
+  std::vector<SafePtr<BaseDataSocketSink> > result;
+  result.push_back(&socket_rhs);
+  return result;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+} // namespace COOLFluiD
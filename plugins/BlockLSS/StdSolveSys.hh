@@ -0,0 +1,57 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_BlockLSS_StdSolveSys_hh
+#define COOLFluiD_BlockLSS_StdSolveSys_hh
+
+#include "BlockLSS/BlockLSSData.hh"
+#include "Framework/DataSocketSink.hh"
+
+namespace COOLFluiD {
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This is a standard command to solve the linear system with BlockLSS
+/// @author Andrea Lani
+class StdSolveSys : public BlockLSSCom {
+public:
+
+  /// Constructor
+  explicit StdSolveSys(const std::string& name);
+
+  /// Destructor
+  ~StdSolveSys();
+
+  /// Set up private data and data of the aggregated classes
+  void setup();
+
+  /// Execute processing actions
+  void execute();
+
+  /**
+   * Returns the DataSockets that this command needs as sinks
+   * @return vector of SafePtr with the DataSockets
+   */
+  std::vector<Common::SafePtr<Framework::BaseDataSocketSink> > needsSockets();
+
+private:
+
+  /// socket for the rhs
+  Framework::DataSocketSink<CFreal> socket_rhs;
+
+  /// positions in the rhs socket of the system unknowns, in the order
+  /// of the internal numbering of the updatable states
+  std::vector<CFuint> m_rhsIDs;
+
+}; // class StdSolveSys
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+} // namespace COOLFluiD
+
+#endif // COOLFluiD_BlockLSS_StdSolveSys_hh
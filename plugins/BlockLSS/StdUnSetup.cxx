@@ -0,0 +1,38 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include "Framework/MethodCommandProvider.hh"
+
+#include "BlockLSS/StdUnSetup.hh"
+#include "BlockLSS/BlockLSSModule.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+  namespace BlockLSS {
+
+//////////////////////////////////////////////////////////////////////////////
+
+Framework::MethodCommandProvider<StdUnSetup, BlockLSSData, BlockLSSModule>
+blockLSSStdUnSetupProvider("StdUnSetup");
+
+//////////////////////////////////////////////////////////////////////////////
+
+void StdUnSetup::execute()
+{
+  CFAUTOTRACE;
+
+  BlockLSSData& d = getMethodData();
+  d.getSolVector().destroy();
+  d.getRhsVector().destroy();
+  d.getMatrix().destroy();
+  d.getHaloExchange().unsetup();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace BlockLSS
+} // namespace COOLFluiD
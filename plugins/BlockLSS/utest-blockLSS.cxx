@@ -0,0 +1,228 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE "Test BlockLSS solver"
+
+#ifdef CF_HAVE_BOOST_1_59
+#include <boost/test/tools/floating_point_comparison.hpp>
+#else
+#include <boost/test/floating_point_comparison.hpp>
+#endif
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#include "Common/PE.hh"
+#include "BlockLSS/BlockCSRMatrix.hh"
+#include "BlockLSS/BlockGMRES.hh"
+#include "BlockLSS/BlockHaloExchange.hh"
+#include "BlockLSS/BlockJacobiPreconditioner.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD;
+using namespace COOLFluiD::Common;
+using namespace COOLFluiD::BlockLSS;
+
+using namespace boost::unit_test;
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// Initializes the parallel environment once for all the test cases
+struct PE_Fixture
+{
+  PE_Fixture()
+  {
+    PE::InitPE(&framework::master_test_suite().argc,
+               &framework::master_test_suite().argv);
+  }
+
+  ~PE_Fixture()
+  {
+    PE::DonePE();
+  }
+};
+
+BOOST_GLOBAL_FIXTURE( PE_Fixture );
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// Block tridiagonal system of nbGlobal block rows of size 2, with the rows
+/// split in contiguous ranges among the processes: each process stores its
+/// rows, followed by the ghost states of the neighbouring rows
+struct BlockLSS_Fixture
+{
+  /// common setup for each test case
+  BlockLSS_Fixture() : nbGlobal(40), nb(2)
+  {
+    const CFuint nbProc = PE::GetPE().GetProcessorCount("Default");
+    const CFuint rank = PE::GetPE().GetRank("Default");
+    const CFuint rangeSize = nbGlobal/nbProc + ((nbGlobal%nbProc > 0) ? 1 : 0);
+    first = std::min(rank*rangeSize, nbGlobal);
+    const CFuint last = std::min(first + rangeSize, nbGlobal);
+
+    for (CFuint i = first; i < last; ++i) {
+      owned.push_back(i);
+    }
+    if (first > 0 && last > first) {
+      ghosts.push_back(first - 1);
+    }
+    if (last < nbGlobal && last > first) {
+      ghosts.push_back(last);
+    }
+
+    halo.setup("Default", owned, ghosts);
+  }
+
+  /// common tear-down for each test case
+  ~BlockLSS_Fixture()
+  {
+    halo.unsetup();
+  }
+
+  /// @return the local index of the given global ID, -1 if not local
+  CFint getLocalIdx(const CFuint globalID) const
+  {
+    if (globalID >= first && globalID < first + owned.size()) {
+      return globalID - first;
+    }
+    for (CFuint i = 0; i < ghosts.size(); ++i) {
+      if (ghosts[i] == globalID) return owned.size() + i;
+    }
+    return -1;
+  }
+
+  /// exact solution in the given global row
+  static void exact(const CFuint globalID, CFreal* x)
+  {
+    x[0] = std::sin(0.3*globalID);
+    x[1] = std::cos(0.7*globalID) + 1.;
+  }
+
+  /// number of global block rows
+  const CFuint nbGlobal;
+
+  /// size of the blocks
+  const CFuint nb;
+
+  /// first global ID of this process
+  CFuint first;
+
+  /// global IDs of the updatable states
+  vector<CFuint> owned;
+
+  /// global IDs of the ghost states
+  vector<CFuint> ghosts;
+
+  /// halo exchange
+  BlockHaloExchange halo;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+BOOST_FIXTURE_TEST_SUITE( BlockLSS_TestSuite, BlockLSS_Fixture )
+
+////////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_CASE( test_halo_synchronize )
+{
+  const CFuint nbLocal = owned.size() + ghosts.size();
+  BOOST_CHECK_EQUAL( halo.getNbOwned(), owned.size() );
+  BOOST_CHECK_EQUAL( halo.getNbGhosts(), ghosts.size() );
+
+  vector<CFreal> x(nbLocal*nb + 1, -1.);
+  for (CFuint i = 0; i < owned.size(); ++i) {
+    x[i*nb] = owned[i];
+    x[i*nb+1] = 0.5*owned[i];
+  }
+  halo.synchronize(&x[0], nb);
+
+  for (CFuint i = 0; i < ghosts.size(); ++i) {
+    const CFuint iLocal = owned.size() + i;
+    BOOST_CHECK_EQUAL( x[iLocal*nb], ghosts[i] );
+    BOOST_CHECK_EQUAL( x[iLocal*nb+1], 0.5*ghosts[i] );
+  }
+
+  BOOST_CHECK_EQUAL( halo.sum(owned.size()), nbGlobal );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_CASE( test_gmres_solve )
+{
+  const CFuint nbOwned = owned.size();
+  const CFuint nbLocal = nbOwned + ghosts.size();
+
+  // pattern: each row couples with its neighbours, columns sorted by local index
+  vector<CFuint> rowPtr(1, 0);
+  vector<CFuint> colIdx;
+  for (CFuint i = 0; i < nbOwned; ++i) {
+    vector<CFuint> cols;
+    const CFuint g = owned[i];
+    if (g > 0) cols.push_back(getLocalIdx(g - 1));
+    cols.push_back(i);
+    if (g + 1 < nbGlobal) cols.push_back(getLocalIdx(g + 1));
+    sort(cols.begin(), cols.end());
+    colIdx.insert(colIdx.end(), cols.begin(), cols.end());
+    rowPtr.push_back(colIdx.size());
+  }
+
+  BlockCSRMatrix mat;
+  mat.createBlockCSR(nb, nbLocal, rowPtr, colIdx);
+
+  // diagonally dominant, non symmetric blocks
+  const CFreal diag[4] = {4., 1., 0., 4.};
+  const CFreal offDiag[4] = {-1., 0., 0.5, -1.};
+  for (CFuint i = 0; i < nbOwned; ++i) {
+    const CFuint g = owned[i];
+    for (CFuint ib = 0; ib < nb; ++ib) {
+      for (CFuint jb = 0; jb < nb; ++jb) {
+        mat.setValue(i*nb + ib, i*nb + jb, diag[ib*nb + jb]);
+        if (g > 0) {
+          mat.setValue(i*nb + ib, getLocalIdx(g - 1)*nb + jb, offDiag[ib*nb + jb]);
+        }
+        if (g + 1 < nbGlobal) {
+          mat.setValue(i*nb + ib, getLocalIdx(g + 1)*nb + jb, offDiag[ib*nb + jb]);
+        }
+      }
+    }
+  }
+
+  // right hand side b = A*xExact
+  vector<CFreal> xExact(nbLocal*nb + 1, 0.);
+  for (CFuint i = 0; i < nbLocal; ++i) {
+    exact((i < nbOwned) ? owned[i] : ghosts[i - nbOwned], &xExact[i*nb]);
+  }
+  vector<CFreal> b(nbLocal*nb + 1, 0.);
+  mat.multiply(&xExact[0], &b[0], 1);
+
+  BlockJacobiPreconditioner pc;
+  pc.compute(mat);
+
+  BlockGMRES gmres;
+  gmres.setup(30, false, nbOwned*nb, nbLocal*nb);
+
+  vector<CFreal> x(nbLocal*nb + 1, 0.);
+  CFreal resNorm = 0.;
+  const CFuint nbIter = gmres.solve(mat, pc, halo, &b[0], &x[0], 1e-12, 0., 200, resNorm);
+  BOOST_CHECK( nbIter < 200 );
+
+  CFreal errorSq = 0.;
+  for (CFuint i = 0; i < nbOwned*nb; ++i) {
+    errorSq += (x[i] - xExact[i])*(x[i] - xExact[i]);
+  }
+  BOOST_CHECK_SMALL( std::sqrt(halo.sum(errorSq)), 1e-9 );
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_SUITE_END()
+
+//////////////////////////////////////////////////////////////////////////////
@@ -14,6 +14,7 @@
 
 #include "CFmeshFileReader/CFmeshReader.hh"
 #include "CFmeshFileReader/CFmeshFileReader.hh"
+#include "Framework/Profiler.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -110,7 +111,7 @@ void CFmeshReader::generateMeshDataImpl()
   stp.start();
 
   cf_assert(m_readCFmesh.isNotNull());
-  m_readCFmesh->execute();
+  profileExecute(m_readCFmesh);
 
   stp.stop();
 
@@ -238,7 +239,7 @@ void CFmeshReader::setMethodImpl()
 {
   setupCommandsAndStrategies();
   cf_assert(m_setup.isNotNull());
-  m_setup->execute();
+  profileExecute(m_setup);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -246,7 +247,7 @@ void CFmeshReader::setMethodImpl()
 void CFmeshReader::unsetMethodImpl()
 {
   cf_assert(m_unSetup.isNotNull());
-  m_unSetup->execute();
+  profileExecute(m_unSetup);
   unsetupCommandsAndStrategies();
 }
 
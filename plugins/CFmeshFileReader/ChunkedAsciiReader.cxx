@@ -0,0 +1,380 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <cstdlib>
+#include <cstring>
+
+#include "Framework/BadFormatException.hh"
+
+#include "CFmeshFileReader/ChunkedAsciiReader.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace CFmeshFileReader {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// size of the chunks read from the file
+static const size_t CHUNK_SIZE = 8*1024*1024;
+
+/// exact powers of ten in double precision
+static const double POWERS_OF_TEN[] = {
+  1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+ChunkedAsciiReader::ChunkedAsciiReader(std::ifstream& file, bool isActive) :
+  m_file(file),
+  m_isActive(isActive),
+  m_startPos(),
+  m_offset(0),
+  m_buffer(),
+  m_pos(0),
+  m_end(0),
+  m_eof(false)
+{
+  if (m_isActive) {
+    m_startPos = m_file.tellg();
+    m_buffer.resize(CHUNK_SIZE);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ChunkedAsciiReader::~ChunkedAsciiReader()
+{
+  detach();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ChunkedAsciiReader::detach()
+{
+  if (m_isActive) {
+    m_file.clear();
+    m_file.seekg(m_startPos + static_cast<std::streamoff>(m_offset + m_pos));
+    m_isActive = false;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ChunkedAsciiReader::seek(const std::streampos position)
+{
+  if (!m_isActive) {
+    m_file.clear();
+    m_file.seekg(position);
+    return;
+  }
+
+  const std::streamoff bufferStart = static_cast<std::streamoff>(m_startPos) + m_offset;
+  const std::streamoff target = static_cast<std::streamoff>(position);
+  if (target >= bufferStart && target <= bufferStart + static_cast<std::streamoff>(m_end)) {
+    m_pos = static_cast<size_t>(target - bufferStart);
+    return;
+  }
+
+  // the buffer is discarded and refilled from the new position
+  m_file.clear();
+  m_file.seekg(position);
+  m_startPos = position;
+  m_offset = 0;
+  m_pos = 0;
+  m_end = 0;
+  m_eof = false;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ChunkedAsciiReader& ChunkedAsciiReader::operator>> (CFreal& value)
+{
+  if (!m_isActive) {
+    m_file >> value;
+  }
+  else {
+    const char* token = CFNULL;
+    const size_t length = nextToken(token);
+    value = parseReal(token, length);
+  }
+  return *this;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ChunkedAsciiReader& ChunkedAsciiReader::operator>> (RealVector& value)
+{
+  if (!m_isActive) {
+    m_file >> value;
+  }
+  else {
+    const CFuint size = value.size();
+    for (CFuint i = 0; i < size; ++i) {
+      const char* token = CFNULL;
+      const size_t length = nextToken(token);
+      value[i] = parseReal(token, length);
+    }
+  }
+  return *this;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ChunkedAsciiReader::skip(const CFuint nbTokens)
+{
+  if (!m_isActive) {
+    std::string token;
+    for (CFuint i = 0; i < nbTokens; ++i) {
+      m_file >> token;
+    }
+  }
+  else {
+    const char* token = CFNULL;
+    for (CFuint i = 0; i < nbTokens; ++i) {
+      nextToken(token);
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ChunkedAsciiReader::locateKeys(const char keyStart,
+				    std::vector<long unsigned int>& positions)
+{
+  cf_assert(m_isActive);
+
+  const long unsigned int start = static_cast<long unsigned int>(m_startPos);
+  bool isAfterSpace = (m_offset + m_pos == 0);
+  for (;;) {
+    // look for the key character, only at the beginning of a token
+    const char* first = &m_buffer[0];
+    const char* curr = first + m_pos;
+    const char* last = first + m_end;
+    while (curr < last) {
+      const char* key = static_cast<const char*>(memchr(curr, keyStart, last - curr));
+      if (key == CFNULL) {
+	isAfterSpace = isSpace(*(last-1));
+	break;
+      }
+      if ((key == curr && isAfterSpace) || (key > curr && isSpace(*(key-1)))) {
+	positions.push_back(start + m_offset + (key - first));
+      }
+      isAfterSpace = false;
+      curr = key + 1;
+    }
+    m_pos = m_end;
+    if (!fill()) break;
+  }
+
+  // go back to the starting position
+  m_offset = 0;
+  m_pos = 0;
+  detach();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bool ChunkedAsciiReader::fill()
+{
+  if (m_eof) return false;
+
+  // move the characters that have not been consumed to the beginning of the buffer
+  const size_t nbKept = m_end - m_pos;
+  if (nbKept > 0 && m_pos > 0) {
+    memmove(&m_buffer[0], &m_buffer[m_pos], nbKept);
+  }
+  m_offset += m_pos;
+  m_pos = 0;
+  m_end = nbKept;
+
+  // a token cannot be longer than the buffer
+  if (m_end == m_buffer.size()) {
+    m_buffer.resize(2*m_buffer.size());
+  }
+
+  m_file.read(&m_buffer[m_end], m_buffer.size() - m_end);
+  const std::streamsize nbRead = m_file.gcount();
+  m_end += static_cast<size_t>(nbRead);
+  if (nbRead == 0 || m_file.eof()) {
+    m_eof = true;
+  }
+  return (nbRead > 0);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+size_t ChunkedAsciiReader::nextToken(const char*& token)
+{
+  for (;;) {
+    // skip the white spaces
+    while (m_pos < m_end && isSpace(m_buffer[m_pos])) {
+      ++m_pos;
+    }
+
+    if (m_pos == m_end) {
+      if (!fill()) {
+	throw BadFormatException (FromHere(), "ChunkedAsciiReader => unexpected end of file");
+      }
+      continue;
+    }
+
+    size_t tokenEnd = m_pos;
+    while (tokenEnd < m_end && !isSpace(m_buffer[tokenEnd])) {
+      ++tokenEnd;
+    }
+
+    // the token may continue in the next chunk
+    if (tokenEnd == m_end && !m_eof) {
+      fill();
+      continue;
+    }
+
+    token = &m_buffer[m_pos];
+    const size_t length = tokenEnd - m_pos;
+    m_pos = tokenEnd;
+    return length;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+long long int ChunkedAsciiReader::parseInteger(const char* token, const size_t length) const
+{
+  size_t i = 0;
+  bool isNegative = false;
+  if (token[0] == '-' || token[0] == '+') {
+    isNegative = (token[0] == '-');
+    ++i;
+  }
+
+  if (i == length) {
+    throw BadFormatException
+      (FromHere(), "ChunkedAsciiReader => bad integer: " + std::string(token, length));
+  }
+
+  long long int value = 0;
+  for (; i < length; ++i) {
+    const unsigned int digit = static_cast<unsigned int>(token[i] - '0');
+    if (digit > 9) {
+      throw BadFormatException
+	(FromHere(), "ChunkedAsciiReader => bad integer: " + std::string(token, length));
+    }
+    value = 10*value + digit;
+  }
+  return (isNegative) ? -value : value;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFreal ChunkedAsciiReader::parseReal(const char* token, const size_t length) const
+{
+  // decompose the token into sign, mantissa and decimal exponent
+  size_t i = 0;
+  bool isNegative = false;
+  if (token[0] == '-' || token[0] == '+') {
+    isNegative = (token[0] == '-');
+    ++i;
+  }
+
+  unsigned long long int mantissa = 0;
+  CFuint nbDigits = 0;
+  CFuint nbZeros = 0;
+  CFint exponent = 0;
+  bool hasDigits = false;
+  bool isAfterDot = false;
+  for (; i < length; ++i) {
+    const char c = token[i];
+    const unsigned int digit = static_cast<unsigned int>(c - '0');
+    if (digit <= 9) {
+      hasDigits = true;
+      if (isAfterDot) --exponent;
+      if (digit == 0) {
+	// leading zeros are not significant, the other ones are kept
+	// aside until a non zero digit follows
+	if (mantissa > 0) ++nbZeros;
+      }
+      else {
+	nbDigits += nbZeros + 1;
+	if (nbDigits > 19) break;
+	for (; nbZeros > 0; --nbZeros) {
+	  mantissa *= 10;
+	}
+	mantissa = 10*mantissa + digit;
+      }
+    }
+    else if (c == '.' && !isAfterDot) {
+      isAfterDot = true;
+    }
+    else {
+      break;
+    }
+  }
+
+  // trailing zeros only scale the mantissa
+  exponent += nbZeros;
+
+  bool isFastPath = hasDigits && (nbDigits <= 15);
+  if (isFastPath && i < length) {
+    const char c = token[i];
+    if (c == 'e' || c == 'E' || c == 'd' || c == 'D') {
+      ++i;
+      bool isNegativeExp = false;
+      if (i < length && (token[i] == '-' || token[i] == '+')) {
+	isNegativeExp = (token[i] == '-');
+	++i;
+      }
+      isFastPath = (i < length);
+      CFint exp = 0;
+      for (; i < length && isFastPath; ++i) {
+	const unsigned int digit = static_cast<unsigned int>(token[i] - '0');
+	isFastPath = (digit <= 9 && exp < 10000);
+	exp = 10*exp + digit;
+      }
+      exponent += (isNegativeExp) ? -exp : exp;
+    }
+    else {
+      isFastPath = false;
+    }
+  }
+
+  // both the mantissa and the power of ten are exact doubles: the result is
+  // correctly rounded, as with strtod
+  if (isFastPath && exponent >= -22 && exponent <= 22) {
+    double value = static_cast<double>(mantissa);
+    value = (exponent < 0) ? value/POWERS_OF_TEN[-exponent] : value*POWERS_OF_TEN[exponent];
+    return static_cast<CFreal>((isNegative) ? -value : value);
+  }
+
+  // fall back to the standard conversion
+  char word[128];
+  if (length >= sizeof(word)) {
+    throw BadFormatException
+      (FromHere(), "ChunkedAsciiReader => bad real: " + std::string(token, length));
+  }
+  memcpy(word, token, length);
+  word[length] = '\0';
+  char* wordEnd = CFNULL;
+  const double value = strtod(word, &wordEnd);
+  if (wordEnd != word + length) {
+    throw BadFormatException
+      (FromHere(), "ChunkedAsciiReader => bad real: " + std::string(token, length));
+  }
+  return static_cast<CFreal>(value);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace CFmeshFileReader
+
+} // namespace COOLFluiD
@@ -0,0 +1,145 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_CFmeshFileReader_ChunkedAsciiReader_hh
+#define COOLFluiD_CFmeshFileReader_ChunkedAsciiReader_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <fstream>
+
+#include "MathTools/RealVector.hh"
+
+#include "CFmeshFileReader/CFmeshFileReaderAPI.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace CFmeshFileReader {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class reads the numbers of an ASCII file in large chunks, bypassing
+/// the formatted input of the stream.
+/// It is attached to an already opened file at its current position and,
+/// when detached, it puts the file back right after the last consumed token,
+/// so that the formatted reading can go on.
+/// The numbers are converted by a hand-written parser working directly on the
+/// buffer, without any memory allocation. If the reader is not active, all
+/// the readings are forwarded to the file itself.
+/// @author Andrea Lani
+class CFmeshFileReader_API ChunkedAsciiReader {
+public:
+
+  /// Constructor
+  /// @param file     file to read from, at the current position
+  /// @param isActive flag telling whether to read in chunks or through the file
+  ChunkedAsciiReader(std::ifstream& file, bool isActive);
+
+  /// Destructor, detaches the reader from the file
+  ~ChunkedAsciiReader();
+
+  /// @return true if the file is read in chunks
+  bool isActive() const {return m_isActive;}
+
+  /// Read an integer value
+  template <typename T>
+  ChunkedAsciiReader& operator>> (T& value)
+  {
+    if (!m_isActive) {
+      m_file >> value;
+    }
+    else {
+      const char* token = CFNULL;
+      const size_t length = nextToken(token);
+      value = static_cast<T>(parseInteger(token, length));
+    }
+    return *this;
+  }
+
+  /// Read a real value
+  ChunkedAsciiReader& operator>> (CFreal& value);
+
+  /// Read all the entries of a vector
+  ChunkedAsciiReader& operator>> (RealVector& value);
+
+  /// Skip the given number of tokens without converting them: their
+  /// characters are still scanned, use seek() to jump over whole sections
+  void skip(const CFuint nbTokens);
+
+  /// Go to the given position in the file, reusing the buffer if the
+  /// position is inside the current chunk
+  void seek(const std::streampos position);
+
+  /// Detach the reader from the file, leaving the file positioned right
+  /// after the last consumed token
+  void detach();
+
+  /// Get the positions of all the tokens starting with the given character,
+  /// from the current position until the end of the file
+  /// @post the reader is detached and the file is put back at the starting position
+  void locateKeys(const char keyStart, std::vector<long unsigned int>& positions);
+
+private: // functions
+
+  /// Refill the buffer, keeping the characters that have not been consumed yet
+  /// @return false if the end of the file was reached
+  bool fill();
+
+  /// Get the next token
+  /// @return the length of the token
+  size_t nextToken(const char*& token);
+
+  /// Convert a token to an integer
+  long long int parseInteger(const char* token, const size_t length) const;
+
+  /// Convert a token to a real
+  CFreal parseReal(const char* token, const size_t length) const;
+
+  /// Check if the character is a white space
+  static bool isSpace(const char c)
+  {
+    return (c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f');
+  }
+
+private: // data
+
+  /// file being read
+  std::ifstream& m_file;
+
+  /// flag telling whether the file is read in chunks
+  bool m_isActive;
+
+  /// position in the file where the reader was attached
+  std::streampos m_startPos;
+
+  /// number of characters before the beginning of the buffer since m_startPos
+  long unsigned int m_offset;
+
+  /// buffer holding the current chunk
+  std::vector<char> m_buffer;
+
+  /// position of the next character to consume in the buffer
+  size_t m_pos;
+
+  /// number of valid characters in the buffer
+  size_t m_end;
+
+  /// flag telling if the end of the file has been reached
+  bool m_eof;
+
+}; // end of class ChunkedAsciiReader
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace CFmeshFileReader
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_CFmeshFileReader_ChunkedAsciiReader_hh
@@ -7,6 +7,7 @@
 #include <numeric>
 
 #include <boost/progress.hpp>
+#include <boost/filesystem/operations.hpp>
 
 #include "Common/PE.hh"
 #include "Common/CFPrintContainer.hh"
@@ -26,6 +27,7 @@
 #include "Framework/SubSystemStatus.hh"
 
 #include "CFmeshFileReader/ParCFmeshFileReader.hh"
+#include "CFmeshFileReader/ChunkedAsciiReader.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -74,7 +76,10 @@ ParCFmeshFileReader::ParCFmeshFileReader() :
   m_hasPastNodes(false),
   m_hasPastStates(false),
   m_hasInterNodes(false),
-  m_hasInterStates(false)
+  m_hasInterStates(false),
+  m_sectionPositions(),
+  m_hasIndex(false),
+  m_index()
 {
   addConfigOptionsTo(this);
 
@@ -93,6 +98,12 @@ ParCFmeshFileReader::ParCFmeshFileReader() :
   
   m_inputToUpdateVecStr = "Identity";
   setParameter("InputToUpdate",&m_inputToUpdateVecStr);
+
+  m_fastAsciiParsing = false;
+  setParameter("FastAsciiParsing",&m_fastAsciiParsing);
+
+  m_useIndexFile = true;
+  setParameter("UseIndexFile",&m_useIndexFile);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -112,6 +123,9 @@ void ParCFmeshFileReader::defineConfigOptions(Config::OptionList& options)
   options.addConfigOption< std::vector<std::string> > ("MergeTRS", "Topological regions sets to be merged");
 
   options.addConfigOption< std::string >("InputToUpdate", "Transformer from input to update variables");
+
+  options.addConfigOption< bool >("FastAsciiParsing", "Read the lists of nodes, states and elements in large chunks with a dedicated parser, without converting the entries that are not needed. Without the index file (see UseIndexFile) every rank still scans and tokenizes the whole lists, only the conversions are saved");
+  options.addConfigOption< bool >("UseIndexFile", "Use the index file (.idx) written next to the CFmesh file, if present, to read only the needed parts of the lists: this is what avoids scanning the whole lists on every rank");
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -807,28 +821,55 @@ void ParCFmeshFileReader::readNodeList(ifstream& fin)
 
   getReadData().prepareNodalExtraVars();
 
+  // number of entries for each node in the file
+  const CFuint nbNodeEntries = dim*(1 + (m_hasPastNodes ? 1 : 0) + (m_hasInterNodes ? 1 : 0)) +
+    extraVars.size();
+
+  const bool useIndex = m_hasIndex && m_index.hasList("!LIST_NODE", m_totNbNodes);
+  const CFuint blockSize = (useIndex) ? m_index.getList("!LIST_NODE").getBlockSize() : 0;
+
+  ChunkedAsciiReader in(fin, m_fastAsciiParsing);
+
   CFuint countLocals = 0;
   for (CFuint iNode = 0; iNode < m_totNbNodes; ++iNode) {
 
+    // the blocks without any needed node are jumped over
+    if (useIndex && iNode%blockSize == 0) {
+      const CFuint blockEnd = std::min(iNode + blockSize, m_totNbNodes);
+      if (!hasEntryInRange(m_localNodeIDs, iNode, blockEnd) &&
+	  !hasEntryInRange(m_ghostNodeIDs, iNode, blockEnd)) {
+	iNode = blockEnd - 1;
+	continue;
+      }
+      in.seek(m_index.getList("!LIST_NODE").getBlockPosition(iNode/blockSize));
+    }
+
+    // the nodes that are not needed are not converted
+    const bool isLocal = hasEntry(m_localNodeIDs, iNode);
+    if (!isLocal && (in.isActive() || useIndex) && !hasEntry(m_ghostNodeIDs, iNode)) {
+      in.skip(nbNodeEntries);
+      continue;
+    }
+
     // read the node
-    fin >> tmpNode;
+    in >> tmpNode;
 
     if (m_hasPastNodes) {
-      fin >> tmpPastNode;
+      in >> tmpPastNode;
     }
 
     if (m_hasInterNodes) {
-      fin >> tmpInterNode;
+      in >> tmpInterNode;
     }
 
     if (nbExtraVars > 0) {
-      fin >> extraVars;
+      in >> extraVars;
     }
 
     CFuint localID = 0;
     bool isGhost = false;
     bool isFound = false;
-    if (hasEntry(m_localNodeIDs, iNode)) {
+    if (isLocal) {
       countLocals++;
       localID = nodes.addLocalPoint (iNode);
       cf_assert(localID < nbLocalNodes);
@@ -868,6 +909,12 @@ void ParCFmeshFileReader::readNodeList(ifstream& fin)
   CFLogDebugMin("m_localNodeIDs.size() = " << m_localNodeIDs.size() << "\n");
   CFLogDebugMin("m_ghostNodeIDs.size() = " << m_ghostNodeIDs.size() << "\n");
 
+  // go to the end of the list
+  if (useIndex) {
+    in.detach();
+    fin.seekg(static_cast<streamoff>(m_index.getList("!LIST_NODE").getEndPosition()));
+  }
+
   CFLogDebugMin( "ParCFmeshFileReader::readNodeList() end\n");
 }
 
@@ -913,6 +960,19 @@ void ParCFmeshFileReader::emptyNodeListRead(ifstream& fin)
 
   getReadData().prepareNodalExtraVars();
 
+  // the whole list is skipped
+  if (m_hasIndex && m_index.hasList("!LIST_NODE", m_totNbNodes)) {
+    fin.seekg(static_cast<streamoff>(m_index.getList("!LIST_NODE").getEndPosition()));
+    CFLogDebugMin( "ParCFmeshFileReader::emptyNodeListRead() end" << "\n");
+    return;
+  }
+  
+  if (m_fastAsciiParsing) {
+    skipToNextSection(fin);
+    CFLogDebugMin( "ParCFmeshFileReader::emptyNodeListRead() end" << "\n");
+    return;
+  }
+
   for (CFuint n = 0; n < m_totNbNodes; ++n) {
     fin >> node;
 
@@ -1050,28 +1110,61 @@ void ParCFmeshFileReader::readStateList(ifstream& fin)
     m_inputToUpdateVecTrans->setup(1);
   }
   
+  // number of entries for each state in the file
+  CFuint nbStateEntries = 0;
+  if (isWithSolution) {
+    nbStateEntries = m_originalNbEqs + nbEqs*((m_hasPastStates ? 1 : 0) + (m_hasInterStates ? 1 : 0)) +
+      extraVars.size();
+    if (m_useInitValues.size() > 0 && m_originalNbEqs > nbEqs) {
+      nbStateEntries += m_originalNbEqs - nbEqs;
+    }
+  }
+
+  const bool useIndex = m_hasIndex && isWithSolution && m_index.hasList("!LIST_STATE", m_totNbStates);
+  const CFuint blockSize = (useIndex) ? m_index.getList("!LIST_STATE").getBlockSize() : 0;
+
+  ChunkedAsciiReader in(fin, m_fastAsciiParsing);
+
   CFuint countLocals = 0;
   for (CFuint iState = 0; iState < m_totNbStates; ++iState)
   {
+    // the blocks without any needed state are jumped over
+    if (useIndex && iState%blockSize == 0) {
+      const CFuint blockEnd = std::min(iState + blockSize, m_totNbStates);
+      if (!hasEntryInRange(m_localStateIDs, iState, blockEnd) &&
+	  !hasEntryInRange(m_ghostStateIDs, iState, blockEnd)) {
+	iState = blockEnd - 1;
+	continue;
+      }
+      in.seek(m_index.getList("!LIST_STATE").getBlockPosition(iState/blockSize));
+    }
+
+    // the states that are not needed are not converted
+    const bool isLocal = hasEntry(m_localStateIDs, iState);
+    if (!isLocal && (in.isActive() || useIndex) && !hasEntry(m_ghostStateIDs, iState)) {
+      in.skip(nbStateEntries);
+      continue;
+    }
+
     // read the state
     if (isWithSolution) 
     {      
       // no init values were used
       if (m_useInitValues.size() == 0)
       {
-	fin >> readState;
+	in >> readState;
 
         if (m_hasPastStates) 
         {
-          fin >> tmpPastState;
+          in >> tmpPastState;
         }
 	
 	if (m_hasInterStates) {
-          fin >> tmpInterState;
+          in >> tmpInterState;
         }
 
         if (nbExtraVars > 0) {
-          fin >> extraVars;
+          in >> extraVars;
         }
 
         if (!hasTransformer) {
@@ -1091,18 +1184,18 @@ void ParCFmeshFileReader::readStateList(ifstream& fin)
       // using init values
       else {
 	cf_assert(m_useInitValues.size() == nbEqs);
-	fin >> readState;
+	in >> readState;
 	
 	if (m_hasPastStates) {
-	  fin >> tmpPastState;
+	  in >> tmpPastState;
 	}
 	
 	if (m_hasInterStates) {
-	  fin >> tmpInterState;
+	  in >> tmpInterState;
 	}
 	
 	if (nbExtraVars > 0) {
-	  fin >> extraVars;
+	  in >> extraVars;
 	}
 	
 	for (CFuint iEq = 0; iEq < nbEqs; ++iEq) {
@@ -1137,7 +1230,7 @@ void ParCFmeshFileReader::readStateList(ifstream& fin)
         {
 	  for (CFuint iEq = nbEqs; iEq < m_originalNbEqs; ++iEq)
 	  {
-            fin >> readState[iEq];
+            in >> readState[iEq];
           }
         }
       }
@@ -1146,7 +1239,7 @@ void ParCFmeshFileReader::readStateList(ifstream& fin)
     CFuint localID = 0;
     bool isGhost = false;
     bool isFound = false;
-    if (hasEntry(m_localStateIDs, iState)) {
+    if (isLocal) {
       countLocals++;
       localID = states.addLocalPoint (iState);
       cf_assert(localID < nbLocalStates);
@@ -1184,6 +1277,12 @@ void ParCFmeshFileReader::readStateList(ifstream& fin)
 
   cf_assert(countLocals == nbLocalStates);
 
+  // go to the end of the list
+  if (useIndex) {
+    in.detach();
+    fin.seekg(static_cast<streamoff>(m_index.getList("!LIST_STATE").getEndPosition()));
+  }
+
   CFLogDebugMin( "ParCFmeshFileReader::readStateList() end\n");
 }
 
@@ -1221,6 +1320,19 @@ void ParCFmeshFileReader::emptyStateListRead(ifstream& fin)
 
   getReadData().prepareStateExtraVars();
 
+  // the whole list is skipped
+  if (m_hasIndex && m_index.hasList("!LIST_STATE", m_totNbStates)) {
+    fin.seekg(static_cast<streamoff>(m_index.getList("!LIST_STATE").getEndPosition()));
+    CFLogDebugMin( "ParCFmeshFileReader::emptyStateListRead() end" << "\n");
+    return;
+  }
+  
+  if (m_fastAsciiParsing) {
+    skipToNextSection(fin);
+    CFLogDebugMin( "ParCFmeshFileReader::emptyStateListRead() end" << "\n");
+    return;
+  }
+
   if (isWithSolution) {
     for (CFuint s = 0; s < m_totNbStates; ++s) {
       // read the state values if they exist
@@ -1387,14 +1499,38 @@ void ParCFmeshFileReader::readElemListRank(PartitionerData& pdata,
   CFuint nodeID = 0;
   CFuint stateID = 0;
   
-  for (CFuint iType = 0; iType < m_totNbElemTypes; ++iType) {
+  // with the index, reading starts from the block holding the first element
+  const bool useIndex = m_hasIndex && m_index.hasList("!LIST_ELEM", m_totNbElem);
+  CFuint firstElem = 0;
+  if (useIndex) {
+    const CFmeshIndex::List& list = m_index.getList("!LIST_ELEM");
+    const CFuint iBlock = start/list.getBlockSize();
+    firstElem = iBlock*list.getBlockSize();
+    fin.seekg(static_cast<streamoff>(list.getBlockPosition(iBlock)));
+  }
+  
+  ChunkedAsciiReader in(fin, m_fastAsciiParsing);
+  const bool skipOthers = in.isActive() || useIndex;
+  
+  for (CFuint iType = 0; iType < m_totNbElemTypes && (!skipOthers || iElemBegin < end); ++iType) {
     const CFuint nbNodesInElem  = (*elementType)[iType].getNbNodes();
     const CFuint nbStatesInElem = (*elementType)[iType].getNbStates();
     const CFuint nbElementsPerType = (*elementType)[iType].getNbElems();
     const CFuint iElemEnd = iElemBegin + nbElementsPerType;
     
+    // the elements of the previous ranks are not converted
+    const CFuint skipBegin = std::max(iElemBegin, firstElem);
+    const CFuint skipEnd = std::min(iElemEnd, start);
+    if (skipOthers && skipBegin < skipEnd) {
+      in.skip((skipEnd - skipBegin)*(nbNodesInElem + nbStatesInElem));
+    }
+    
     // loop over the elements in this type
     for (CFuint iElem = iElemBegin; iElem < iElemEnd; ++iElem) {
+      if (skipOthers && (iElem < start || iElem >= end)) {
+	continue;
+      }
+      
       if (iElem < start || iElem >= end) {
 	for (CFuint iNode = 0; iNode < nbNodesInElem; ++iNode) {
 	  fin >> nodeID;
@@ -1413,11 +1549,11 @@ void ParCFmeshFileReader::readElemListRank(PartitionerData& pdata,
 	eptrs[ipos] = scount;
 	
 	for (CFuint j = 0; j < nbNodesInElem; ++j, ++ncount) {
-	  fin >> eNode[ncount];
+	  in >> eNode[ncount];
 	  checkDofID("node", iElem, j, eNode[ncount], m_totNbNodes);
 	}
 	for (CFuint j = 0; j < nbStatesInElem; ++j, ++scount) {
-	  fin >> eState[scount];
+	  in >> eState[scount];
 	  checkDofID("state", iElem, j, eState[scount], m_totNbStates);
 	}
 	
@@ -1431,6 +1567,16 @@ void ParCFmeshFileReader::readElemListRank(PartitionerData& pdata,
     
     iElemBegin +=  nbElementsPerType;
   }
+  
+  // the elements of the next ranks are jumped over
+  if (useIndex) {
+    in.detach();
+    fin.seekg(static_cast<streamoff>(m_index.getList("!LIST_ELEM").getEndPosition()));
+  }
+  else if (in.isActive()) {
+    in.detach();
+    skipToNextSection(fin);
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -1741,8 +1887,72 @@ void ParCFmeshFileReader::readGeomEntList(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
+void ParCFmeshFileReader::readFromFile(const boost::filesystem::path& filepath)
+{
+  m_sectionPositions.clear();
+  m_index.clear();
+  m_hasIndex = false;
+  
+  const boost::filesystem::path indexFile = CFmeshIndex::getIndexFilePath(filepath);
+  if (m_useIndexFile && boost::filesystem::exists(indexFile)) {
+    try {
+      m_index.readFromFile(indexFile);
+      m_hasIndex = m_index.isConsistentWith(filepath);
+    }
+    catch (BadFormatException& e) {
+      CFLog(WARN, e.what() << "\n");
+      m_hasIndex = false;
+    }
+    
+    if (!m_hasIndex) {
+      CFLog(WARN, "ParCFmeshFileReader::readFromFile() => " << indexFile.string() 
+	    << " does not match " << filepath.string() << " and will be ignored\n");
+    }
+    else {
+      CFLog(VERBOSE, "ParCFmeshFileReader::readFromFile() => using " << indexFile.string() << "\n");
+    }
+  }
+  
+  FileReader::readFromFile(filepath);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParCFmeshFileReader::locateSections(ifstream& file)
+{
+  CFLogDebugMin( "ParCFmeshFileReader::locateSections() start\n");
+  
+  // all the keys start with "!"
+  ChunkedAsciiReader in(file, true);
+  in.locateKeys('!', m_sectionPositions);
+  
+  CFLog(VERBOSE, "ParCFmeshFileReader::locateSections() => " 
+	<< m_sectionPositions.size() << " sections found\n");
+  CFLogDebugMin( "ParCFmeshFileReader::locateSections() end\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParCFmeshFileReader::skipToNextSection(ifstream& file)
+{
+  const long unsigned int position = static_cast<long unsigned int>(file.tellg());
+  vector<long unsigned int>::const_iterator next = 
+    upper_bound(m_sectionPositions.begin(), m_sectionPositions.end(), position);
+  if (next == m_sectionPositions.end()) {
+    throw BadFormatException (FromHere(), "ParCFmeshFileReader::skipToNextSection() => no section after the current one");
+  }
+  file.seekg(static_cast<streamoff>(*next));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 bool ParCFmeshFileReader::readString(ifstream& file)
 {
+  // the positions of all the sections are found once for all
+  if (m_fastAsciiParsing && m_sectionPositions.empty()) {
+    locateSections(file);
+  }
+  
   std::string key = "";
   file >> key;
 
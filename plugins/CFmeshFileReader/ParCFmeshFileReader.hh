@@ -16,6 +16,7 @@
 
 #include "Framework/FileReader.hh"
 #include "Framework/CFmeshReaderSource.hh"
+#include "Framework/CFmeshIndex.hh"
 #include "Framework/BadFormatException.hh"
 #include "Framework/PartitionerData.hh"
 #include "Framework/ElementDataArray.hh"
@@ -59,6 +60,9 @@ public: // member functions
   
   /// Sets up private data
   virtual void setup();
+
+  /// Reads the given file, using its index file if present
+  virtual void readFromFile(const boost::filesystem::path& filepath);
     
   /// Sets the pointer to the stored data
   void setReadData(const Common::SafePtr<Framework::CFmeshReaderSource>& data)
@@ -335,6 +339,12 @@ protected: // member functions
   /// Ineffective reading of the state list
   void emptyStateListRead(std::ifstream& fin);
 
+  /// Find the positions in the file of all the keys starting a section
+  void locateSections(std::ifstream& fin);
+
+  /// Jump to the beginning of the section following the current position
+  void skipToNextSection(std::ifstream& fin);
+
  protected:
   
   /// Set the element distribution array
@@ -412,6 +422,14 @@ protected: // member functions
     return binary_search(array.begin(), array.end(), value);
   }
   
+  /// Check if the container has an entry in [first, last)
+  template <typename ARRAY, typename T>
+    bool hasEntryInRange(const ARRAY& array, const T& first, const T& last)
+  {
+    typename ARRAY::const_iterator it = lower_bound(array.begin(), array.end(), first);
+    return (it != array.end() && *it < last);
+  }
+  
   /// Flag telling if the elements have been built
   bool areElementsBuild() const
   {
@@ -556,6 +574,21 @@ protected: // member functions
   /// Vector transformer from input to update variables
   Common::SelfRegistPtr<Framework::VarSetTransformer> m_inputToUpdateVecTrans;
 
+  /// flag telling whether to read the lists with the chunked ASCII parser
+  bool m_fastAsciiParsing;
+
+  /// positions in the file of the keys starting the sections
+  std::vector<long unsigned int> m_sectionPositions;
+
+  /// flag telling whether to use the index file, if present
+  bool m_useIndexFile;
+
+  /// flag telling whether a valid index file was found
+  bool m_hasIndex;
+
+  /// index of the file being read
+  Framework::CFmeshIndex m_index;
+
 }; // class ParCFmeshFileReader
 
 //////////////////////////////////////////////////////////////////////////////
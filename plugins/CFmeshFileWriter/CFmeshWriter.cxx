@@ -11,6 +11,7 @@
 #include "Framework/PathAppender.hh"
 #include "Framework/SimulationStatus.hh"
 #include "Framework/SubSystemStatus.hh"
+#include "Framework/Profiler.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -80,7 +81,7 @@ void CFmeshWriter::setMethodImpl()
 
   setupCommandsAndStrategies();
   cf_assert(_setup.isNotNull());
-  _setup->execute();
+  profileExecute(_setup);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -88,7 +89,7 @@ void CFmeshWriter::setMethodImpl()
 void CFmeshWriter::unsetMethodImpl()
 {
   cf_assert(_unSetup.isNotNull());
-  _unSetup->execute();
+  profileExecute(_unSetup);
   unsetupCommandsAndStrategies();
 
   // unsetup parent class
@@ -124,7 +125,7 @@ void CFmeshWriter::openImpl()
 void CFmeshWriter::writeImpl()
 {
   cf_assert(_writeSolution.isNotNull());
-  _writeSolution->execute();
+  profileExecute(_writeSolution);
 }
 
 //////////////////////////////////////////////////////////////////////////////
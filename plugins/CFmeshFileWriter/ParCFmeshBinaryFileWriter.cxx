@@ -57,7 +57,8 @@ void cmpAndTakeMaxAbs2(CFreal* invec, CFreal* inoutvec, int* len,
 ParCFmeshBinaryFileWriter::ParCFmeshBinaryFileWriter() :
   ParFileWriter(), 
   ConfigObject("ParCFmeshBinaryFileWriter"),
-  _writeData()
+  _writeData(),
+  _pendingFiles()
 { 
   addConfigOptionsTo(this);
   
@@ -66,12 +67,29 @@ ParCFmeshBinaryFileWriter::ParCFmeshBinaryFileWriter() :
   
   _maxBuffSize = 2147479200; // (CFuint) std::numeric_limits<int>::max();
   setParameter("MaxBuffSize",&_maxBuffSize);
+  
+  _asyncWrite = false;
+  setParameter("AsyncWrite",&_asyncWrite);
+  
+  _maxPendingWrites = 1;
+  setParameter("MaxPendingWrites",&_maxPendingWrites);
 }
       
 //////////////////////////////////////////////////////////////////////////////
 
 ParCFmeshBinaryFileWriter::~ParCFmeshBinaryFileWriter()
 {
+  // pending writes can only be completed if MPI is still running
+  int isFinalized = 0;
+  MPI_Finalized(&isFinalized);
+  if (!isFinalized) {
+    flush();
+  }
+  else {
+    for (CFuint i = 0; i < _pendingFiles.size(); ++i) {
+      deletePtr(_pendingFiles[i]);
+    }
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -80,6 +98,8 @@ void ParCFmeshBinaryFileWriter::defineConfigOptions(Config::OptionList& options)
 {
   options.addConfigOption< CFuint >("NbWriters", "Number of writers (and MPI groups)");
   options.addConfigOption< int >("MaxBuffSize", "Maximum buffer size for MPI I/O");
+  options.addConfigOption< bool >("AsyncWrite", "Write nodes and states in background with non-blocking MPI I/O");
+  options.addConfigOption< CFuint >("MaxPendingWrites", "Maximum number of files being written in background");
 }
       
 //////////////////////////////////////////////////////////////////////////////
@@ -88,6 +108,81 @@ void ParCFmeshBinaryFileWriter::setup()
 {
   ParFileWriter::setWriterGroup();
   _offset.resize(1);
+  
+  if (_maxPendingWrites == 0) {
+    CFLog(WARN, "ParCFmeshBinaryFileWriter::setup() => MaxPendingWrites = 0 is set to 1\n");
+    _maxPendingWrites = 1;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParCFmeshBinaryFileWriter::flush()
+{
+  while (_pendingFiles.size() > 0) {
+    completeOldestWrite();
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParCFmeshBinaryFileWriter::completeOldestWrite()
+{
+  cf_assert(_pendingFiles.size() > 0);
+  PendingFile* pf = _pendingFiles.front();
+  _pendingFiles.pop_front();
+  
+  CFLog(VERBOSE, "ParCFmeshBinaryFileWriter::completeOldestWrite() => " << pf->path.string() << "\n");
+  
+  if (_isWriterRank) {
+    if (pf->requests.size() > 0) {
+      vector<MPI_Status> status(pf->requests.size());
+      MPIError::getInstance().check
+	("MPI_Waitall", "ParCFmeshBinaryFileWriter::completeOldestWrite()", 
+	 MPI_Waitall((int)pf->requests.size(), &pf->requests[0], &status[0]));
+    }
+    // collective on the writers group: all writers complete the same file
+    MPI_File_close(&pf->fh);
+  }
+  
+  deletePtr(pf);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParCFmeshBinaryFileWriter::writeAll(const string& name, MPI_File* fh, 
+					  MPI_Offset offset, vector<CFreal>& buf, 
+					  const CFuint bufSize, const Group& wg)
+{
+  if (!_asyncWrite) {
+    MPIIOFunctions::writeAll(name, fh, offset, &buf[0], bufSize, _maxBuffSize, _myRank, wg);
+    return;
+  }
+  
+  cf_assert(_pendingFiles.size() > 0);
+  cf_assert(bufSize <= buf.size());
+  PendingFile& pf = *_pendingFiles.back();
+  
+  // the buffer is moved (not copied) into the staging area
+  pf.buffers.push_back(vector<CFreal>());
+  pf.buffers.back().swap(buf);
+  CFreal *const data = (bufSize > 0) ? &pf.buffers.back()[0] : CFNULL;
+  
+  // same chunks as in the synchronous writes
+  const CFuint maxSendSize = _maxBuffSize/sizeof(CFreal);
+  for (CFuint bufID = 0; bufID < bufSize; bufID += maxSendSize) {
+    const int wBufSize = (int)std::min(maxSendSize, bufSize - bufID);
+    const MPI_Offset bufOff = offset + (MPI_Offset)(bufID*sizeof(CFreal));
+    CFLog(VERBOSE, _myRank << " in " << name << " posts buffer of size " 
+	  << wBufSize << "/" << bufSize << " starting from " << bufOff << "\n");
+    
+    MPI_Request request;
+    MPIError::getInstance().check
+      ("MPI_File_iwrite_at", "ParCFmeshBinaryFileWriter::writeAll()", 
+       MPI_File_iwrite_at(*fh, bufOff, &data[bufID], wBufSize, 
+			  MPIStructDef::getMPIType(&data[bufID]), &request));
+    pf.requests.push_back(request);
+  }
 }
       
 //////////////////////////////////////////////////////////////////////////////
@@ -144,7 +239,29 @@ void ParCFmeshBinaryFileWriter::writeToFileStream
   const string writerName = nsp + "_Writers";
   Group& wg = PE::GetPE().getGroup(writerName);
   
-  char* fileName = const_cast<char*>(filepath.string().c_str()); 
+  if (_asyncWrite) {
+    // a file still being written must be completed before being reopened
+    for (CFuint i = 0; i < _pendingFiles.size(); ++i) {
+      if (_pendingFiles[i]->path == filepath) {
+	for (CFuint j = 0; j <= i; ++j) {
+	  completeOldestWrite();
+	}
+	break;
+      }
+    }
+    
+    // back-pressure: wait for the oldest file if the queue is full
+    while (_pendingFiles.size() >= _maxPendingWrites) {
+      completeOldestWrite();
+    }
+    
+    _pendingFiles.push_back(new PendingFile());
+    _pendingFiles.back()->path = filepath;
+    _pendingFiles.back()->fh = MPI_FILE_NULL;
+  }
+  
+  const string fileNameStr = filepath.string();
+  char* fileName = const_cast<char*>(fileNameStr.c_str()); 
   
   CFLog(VERBOSE, "fileName = " << filepath.string() << "\n");
   CFLog(VERBOSE, "wg.globalRanks.size() = " << wg.globalRanks.size() << "\n");
@@ -204,7 +321,11 @@ void ParCFmeshBinaryFileWriter::writeToFileStream
   // terminate the file
   writeEndFile(&_fh);
   
-  if (_isWriterRank) {
+  if (_asyncWrite) {
+    // the file will be closed once all its pending writes have completed
+    _pendingFiles.back()->fh = _fh;
+  }
+  else if (_isWriterRank) {
     MPI_File_close(&_fh);
   }
   
@@ -867,12 +988,12 @@ void ParCFmeshBinaryFileWriter::writeNodeList(MPI_File* fh)
     // MPI_File_write_at_all(*fh, wOffset[wRank], &elementToPrint[0], (int)wSendSize, 
     // MPIStructDef::getMPIType(&elementToPrint[0]), &_status); 
     
-    MPIIOFunctions::writeAll("ParCFmeshBinaryFileWriter::writeNodeList()", fh, wOffset[wRank], &elementToPrint[0], 
-			     wSendSize, _maxBuffSize, _myRank, wg);
+    writeAll("ParCFmeshBinaryFileWriter::writeNodeList()", fh, wOffset[wRank], elementToPrint, 
+	     wSendSize, wg);
   }
   
-  //reset the all sendElement list to 0
-  for (CFuint i = 0; i < maxElemSendSize; ++i) {
+  //reset the all sendElement list to 0 (empty if moved to the staging area)
+  for (CFuint i = 0; i < elementToPrint.size(); ++i) {
     elementToPrint[i] = 0;
   }
   
@@ -1073,12 +1194,12 @@ void ParCFmeshBinaryFileWriter::writeStateList(MPI_File* fh)
       // MPI_File_write_at_all(*fh, wOffset[wRank], &elementToPrint[0], (int)wSendSize,
       // MPIStructDef::getMPIType(&elementToPrint[0]), &_status); 
       
-      MPIIOFunctions::writeAll("ParCFmeshBinaryFileWriter::writeStateList()", fh, wOffset[wRank], &elementToPrint[0], 
-			       wSendSize, _maxBuffSize, _myRank, wg);
+      writeAll("ParCFmeshBinaryFileWriter::writeStateList()", fh, wOffset[wRank], elementToPrint, 
+	       wSendSize, wg);
     }
     
-    //reset the all sendElement list to 0
-    for (CFuint i = 0; i < maxElemSendSize; ++i) {
+    //reset the all sendElement list to 0 (empty if moved to the staging area)
+    for (CFuint i = 0; i < elementToPrint.size(); ++i) {
       elementToPrint[i] = 0;
     }
   }
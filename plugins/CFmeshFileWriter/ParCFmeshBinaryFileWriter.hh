@@ -9,11 +9,15 @@
 
 //////////////////////////////////////////////////////////////////////////////
 
+#include <deque>
+#include <list>
+
 #include "Config/ConfigObject.hh"
 #include "Framework/ParFileWriter.hh"
 #include "Framework/CFmeshWriterSource.hh"
 #include "Common/MPI/MPIStructDef.hh"
 #include "Common/MPI/MPIError.hh"
+#include "Common/Group.hh"
 #include "CFmeshFileWriter/CFmeshFileWriter.hh"
 
 //////////////////////////////////////////////////////////////////////////////
@@ -72,6 +76,9 @@ class CFmeshFileWriter_API ParCFmeshBinaryFileWriter :
   {
     getWriteData().releaseMemory();
   }
+  
+  /// Completes all the asynchronous writes that are still pending
+  virtual void flush();
 
 protected: // helper functions
   
@@ -118,11 +125,44 @@ protected: // helper functions
   /// Writes the end of the file
   void writeEndFile(MPI_File* fh);
   
+  /// Writes the given buffer starting from the given offset, either 
+  /// synchronously (collective call) or, in asynchronous mode, by moving 
+  /// the buffer into the staging area of the current file and posting 
+  /// non-blocking writes
+  void writeAll(const std::string& name, MPI_File* fh, MPI_Offset offset, 
+		std::vector<CFreal>& buf, const CFuint bufSize, 
+		const Common::Group& wg);
+  
+  /// Completes the pending writes of the oldest file in the queue and closes it
+  void completeOldestWrite();
+  
 protected: // data
   
+  /// File being written asynchronously, together with its staging 
+  /// buffers and its pending non-blocking requests
+  struct PendingFile {
+    /// file path
+    boost::filesystem::path path;
+    /// file handle (only meaningful on writer ranks)
+    MPI_File fh;
+    /// staging buffers, which must stay alive until the requests complete
+    std::list<std::vector<CFreal> > buffers;
+    /// pending requests
+    std::vector<MPI_Request> requests;
+  };
+  
   /// acquaintance of the data present in the CFmesh file
   Common::SafePtr<Framework::CFmeshWriterSource> _writeData;
   
+  /// queue of the files whose writes are still pending, oldest first
+  std::deque<PendingFile*> _pendingFiles;
+  
+  /// flag telling to write nodes and states asynchronously
+  bool _asyncWrite;
+  
+  /// maximum number of files with pending writes
+  CFuint _maxPendingWrites;
+  
 }; // class ParCFmeshBinaryFileWriter
 
 //////////////////////////////////////////////////////////////////////////////
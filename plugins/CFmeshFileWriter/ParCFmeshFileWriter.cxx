@@ -7,6 +7,8 @@
 #include <iomanip>
 #include <numeric>
 
+#include <boost/filesystem/operations.hpp>
+
 #include "ParCFmeshFileWriter.hh"
 
 #include "Framework/ElementTypeData.hh"
@@ -14,6 +16,7 @@
 #include "Framework/MeshData.hh"
 
 #include "Environment/FileHandlerOutput.hh"
+#include "Common/BadValueException.hh"
 #include "Common/CFMultiMap.hh"
 #include "Common/CFPrintContainer.hh"
 #include "Common/MPI/MPIStructDef.hh"
@@ -55,9 +58,17 @@ void cmpAndTakeMaxAbs(CFreal* invec, CFreal* inoutvec, int* len,
 ParCFmeshFileWriter::ParCFmeshFileWriter() :
   ParFileWriter(), 
   ConfigObject("ParCFmeshFileWriter"),
-  _writeData()
+  _writeData(),
+  _currIndex(CFNULL),
+  _mapFileToIndex()
 {
   addConfigOptionsTo(this);
+
+  _writeIndexFile = false;
+  setParameter("WriteIndexFile",&_writeIndexFile);
+
+  _indexBlockSize = 4096;
+  setParameter("IndexBlockSize",&_indexBlockSize);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -70,6 +81,19 @@ ParCFmeshFileWriter::~ParCFmeshFileWriter()
 
 void ParCFmeshFileWriter::defineConfigOptions(Config::OptionList& options)
 {
+  options.addConfigOption< bool >("WriteIndexFile", "Write an index file (.idx) with the positions of the lists, to speed up the parallel reading");
+  options.addConfigOption< CFuint >("IndexBlockSize", "Number of entries in each block of the index file");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParCFmeshFileWriter::configure ( Config::ConfigArgs& args )
+{
+  ConfigObject::configure(args);
+
+  if (_indexBlockSize == 0) {
+    throw BadValueException (FromHere(), "ParCFmeshFileWriter::configure() => IndexBlockSize must be > 0");
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -122,11 +146,26 @@ void ParCFmeshFileWriter::writeToFile(const boost::filesystem::path& filepath)
   MPI_Bcast(&isNewFile, 1, MPIStructDef::getMPIType(&isNewFile), _ioRank, _comm);
   _isNewFile = (isNewFile == 0) ? false : true;
   
+  _currIndex = CFNULL;
+  if (_writeIndexFile && _myRank == _ioRank) {
+    _currIndex = &_mapFileToIndex[filepath];
+    if (_isNewFile) {
+      _currIndex->clear();
+    }
+  }
+  
   writeToFileStream(filepath, file);
 
   if (_myRank == _ioRank) {
     fhandle->close();
   }
+  
+  // the index is written after the CFmesh file is complete
+  if (_currIndex != CFNULL) {
+    _currIndex->setFileSize(boost::filesystem::file_size(filepath));
+    _currIndex->writeToFile(CFmeshIndex::getIndexFilePath(filepath));
+    _currIndex = CFNULL;
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -182,6 +221,9 @@ void ParCFmeshFileWriter::writeToFileStream
   writeStateList(fout);
 
   if (_myRank == _ioRank) {
+    if (_currIndex != CFNULL) {
+      _currIndex->setEndPosition(fout->tellp());
+    }
     *fout << "!END" << "\n";
   }
 
@@ -382,8 +424,12 @@ void ParCFmeshFileWriter::writeElementList(std::ofstream *const fout)
 {
   CFLogDebugMin( "ParCFmeshFileWriter::writeElementList() called" << "\n");
 
+  CFmeshIndex::List* indexList = CFNULL;
   if (_myRank  == _ioRank) {
     *fout << "!LIST_ELEM " << "\n";
+    if (_currIndex != CFNULL) {
+      indexList = &_currIndex->beginList("!LIST_ELEM", _indexBlockSize);
+    }
   }
   
   SafePtr< vector<ElementTypeData> > me =
@@ -531,6 +577,9 @@ void ParCFmeshFileWriter::writeElementList(std::ofstream *const fout)
 
       if (_myRank == _ioRank) {
 	for (CFuint i = 0; i < sendSize; ++i) {
+	  if (indexList != CFNULL && i%nodesPlusStates == 0) {
+	    indexList->addEntry(*fout);
+	  }
 	  if ((i+1)%nodesPlusStates > 0) {
 	    *fout << elementToPrint[i] << " ";
 	  }
@@ -551,6 +600,10 @@ void ParCFmeshFileWriter::writeElementList(std::ofstream *const fout)
     }
   }
   
+  if (indexList != CFNULL) {
+    indexList->end(*fout);
+  }
+  
   CFLogInfo("Element written \n"); 
 
   CFLogDebugMin( "ParCFmeshFileWriter::writeElementList() end" << "\n");
@@ -576,6 +629,9 @@ void ParCFmeshFileWriter::writeTrsData(std::ofstream *const fout)
 
   for(CFuint iTRS = 0; iTRS < nbTRSs; ++iTRS) {
     if (_myRank == _ioRank) {
+      if (_currIndex != CFNULL) {
+	_currIndex->addTRS(fout->tellp());
+      }
       *fout << "!TRS_NAME " << trsNames[iTRS] << "\n";
       CFLogDebugMin("!TRS_NAME " << trsNames[iTRS] << "\n");
 
@@ -609,9 +665,13 @@ void ParCFmeshFileWriter::writeNodeList(std::ofstream *const fout)
 {
   CFLogDebugMin( "ParCFmeshFileWriter::writeNodeList() called" << "\n");
 
+  CFmeshIndex::List* indexList = CFNULL;
   if (_myRank == _ioRank) {
     cf_assert(fout != CFNULL);
     *fout << "!LIST_NODE " << "\n";
+    if (_currIndex != CFNULL) {
+      indexList = &_currIndex->beginList("!LIST_NODE", _indexBlockSize);
+    }
   }
 
   const CFuint totNbNodes = MeshDataStack::getActive()->getTotalNodeCount();
@@ -755,6 +815,9 @@ void ParCFmeshFileWriter::writeNodeList(std::ofstream *const fout)
       CFuint countN = 0;
       for (CFuint i = 0; i < sendSize; ++i) {
 	const CFreal coeff = (countN < dim) ? refL : 1.;
+	if (indexList != CFNULL && i%nodesStride == 0) {
+	  indexList->addEntry(*fout);
+	}
 	if ((i+1)%nodesStride > 0) {
           fout->precision(14);
           fout->setf(ios::scientific,ios::floatfield);
@@ -780,6 +843,10 @@ void ParCFmeshFileWriter::writeNodeList(std::ofstream *const fout)
     countElem += elementList.getSendDataSize(rangeID)/nodesStride;
   }
 
+  if (indexList != CFNULL) {
+    indexList->end(*fout);
+  }
+
   CFLogInfo("Nodes written \n");
 
   CFLogDebugMin( "ParCFmeshFileWriter::writeNodeList() end" << "\n");
@@ -793,8 +860,12 @@ void ParCFmeshFileWriter::writeStateList(std::ofstream *const fout)
 
   getWriteData().prepareStateExtraVars();
 
+  CFmeshIndex::List* indexList = CFNULL;
   if (_myRank == _ioRank) {
     *fout << "!LIST_STATE " << getWriteData().isWithSolution() << "\n";
+    if (_currIndex != CFNULL) {
+      indexList = &_currIndex->beginList("!LIST_STATE", _indexBlockSize);
+    }
   }
 
   if (getWriteData().isWithSolution()){
@@ -947,6 +1018,9 @@ void ParCFmeshFileWriter::writeStateList(std::ofstream *const fout)
 
       if (_myRank == _ioRank) {
 	for (CFuint i = 0; i < sendSize; ++i) {
+	  if (indexList != CFNULL && i%statesStride == 0) {
+	    indexList->addEntry(*fout);
+	  }
 	  if ((i+1)%statesStride > 0) {
 	    fout->precision(16);
             fout->setf(ios::scientific,ios::floatfield);
@@ -971,6 +1045,10 @@ void ParCFmeshFileWriter::writeStateList(std::ofstream *const fout)
     }
   }
 
+  if (indexList != CFNULL) {
+    indexList->end(*fout);
+  }
+
   CFLogInfo("States written \n");
 
   CFLogDebugMin( "ParCFmeshFileWriter::writeStateList() end" << "\n");
@@ -11,6 +11,7 @@
 
 #include "Framework/ParFileWriter.hh"
 #include "Framework/CFmeshWriterSource.hh"
+#include "Framework/CFmeshIndex.hh"
 #include "Common/SafePtr.hh"
 #include "CFmeshFileWriter/CFmeshFileWriter.hh"
 
@@ -39,6 +40,9 @@ public:
   /// @param options a OptionList where to add the Option's
   static void defineConfigOptions(Config::OptionList& options);
   
+  /// Configures this object with the supplied arguments
+  virtual void configure ( Config::ConfigArgs& args );
+  
   /// Opens and starts to write to the given file.
   /// @throw Common::FilesystemException
   virtual void writeToFile(const boost::filesystem::path& filepath);
@@ -120,6 +124,18 @@ protected: // data
   
   /// acquaintance of the data present in the CFmesh file
   Common::SafePtr<Framework::CFmeshWriterSource> _writeData;
+  
+  /// flag telling whether to write the index file next to the CFmesh file
+  bool _writeIndexFile;
+  
+  /// number of entries in each block of the index file
+  CFuint _indexBlockSize;
+  
+  /// index of the file being written, only on the IO rank
+  Framework::CFmeshIndex* _currIndex;
+  
+  /// index of each file already created
+  std::map<boost::filesystem::path, Framework::CFmeshIndex> _mapFileToIndex;
     
 }; // class ParCFmeshFileWriter
 
@@ -37,6 +37,9 @@ public:
   /// Set up some private data needed
   /// for the simulation
   void setup();
+  
+  /// Unsetup the private data, completing the pending writes
+  void unsetup();
 
   /// Configures the command.
   void configure ( Config::ConfigArgs& args );
@@ -13,6 +13,7 @@
 #include "Framework/CommandGroup.hh"
 #include "Framework/PhysicalModel.hh"
 #include "Framework/NamespaceSwitcher.hh"
+#include "Framework/Profiler.hh"
 
 #include "ConcurrentCoupler/ConcurrentCoupler.hh"
 #include "ConcurrentCoupler/ConcurrentCouplerMethod.hh"
@@ -376,7 +377,7 @@ void ConcurrentCouplerMethod::setMethodImpl()
   cf_assert(isConfigured());
   cf_assert(m_setup.isNotNull());
   
-  m_setup->execute();
+  profileExecute(m_setup);
   
   setupCommandsAndStrategies(); 
   
@@ -425,7 +426,7 @@ void ConcurrentCouplerMethod::preProcessReadImpl()
   // // preprocess interfaces
   // for(CFuint i = 0; i < m_preProcessRead.size(); ++i) {
   //   cf_assert(m_preProcessRead[i].isNotNull());
-  //   m_preProcessRead[i]->execute();
+  //   profileExecute(m_preProcessRead[i]);
   // }
   
 }
@@ -440,7 +441,7 @@ void ConcurrentCouplerMethod::preProcessWriteImpl()
   // // preprocess interfaces
   // for(CFuint i = 0; i < m_preProcessWrite.size(); ++i) {
   //   cf_assert(m_preProcessWrite[i].isNotNull());
-  //   m_preProcessWrite[i]->execute();
+  //   profileExecute(m_preProcessWrite[i]);
   // }
 
 }
@@ -461,7 +462,7 @@ void ConcurrentCouplerMethod::meshMatchingReadImpl()
   // // match interface meshes
   // for(CFuint i = 0; i < m_matchMeshesRead.size(); ++i) {
   //   cf_assert(m_matchMeshesRead[i].isNotNull());
-  //   m_matchMeshesRead[i]->execute();
+  //   profileExecute(m_matchMeshesRead[i]);
   // }
 
 }
@@ -476,7 +477,7 @@ void ConcurrentCouplerMethod::meshMatchingWriteImpl()
   // // match interface meshes
   // for(CFuint i = 0; i < m_matchMeshesWrite.size(); ++i) {
   //   cf_assert(m_matchMeshesWrite[i].isNotNull());
-  //   m_matchMeshesWrite[i]->execute();
+  //   profileExecute(m_matchMeshesWrite[i]);
   // }
 }
 
@@ -495,7 +496,7 @@ void ConcurrentCouplerMethod::dataTransferReadImpl()
   if (doCoupling) {
     for(CFuint i = 0; i < m_interfacesRead.size(); ++i) {
       cf_assert(m_interfacesRead[i].isNotNull());
-      m_interfacesRead[i]->execute();
+      profileExecute(m_interfacesRead[i]);
       
       // barrier ensures that at this point all coupled ranks synchronize
       CFLog(VERBOSE, "ConcurrentCouplerMethod::dataTransferReadImpl() => before barrier\n");
@@ -536,7 +537,7 @@ void ConcurrentCouplerMethod::dataTransferWriteImpl()
       
       CFLog(VERBOSE, "ConcurrentCouplerMethod::dataTransferWriteImpl() => before [" 
 	    << m_interfacesWrite[i]->getName() << "]\n");
-      m_interfacesWrite[i]->execute();
+      profileExecute(m_interfacesWrite[i]);
       CFLog(VERBOSE, "ConcurrentCouplerMethod::dataTransferWriteImpl() => after [" 
 	    << m_interfacesWrite[i]->getName() << "]\n");
       
@@ -47,6 +47,8 @@ void StdConcurrentDataTransfer::defineConfigOptions(Config::OptionList& options)
     ("SocketsConnType","Connectivity type for sockets to transfer (State or Node): this is ne1eded to define global IDs.");
   options.addConfigOption< vector<string> >
     ("SendToRecvVariableTransformer","Variables transformers from send to recv variables.");
+  options.addConfigOption< bool >
+    ("DirectTransfer","Exchange data directly between sending and receiving ranks with a cached communication plan (always done if both namespaces have more than one rank).");
 }
       
 //////////////////////////////////////////////////////////////////////////////
@@ -59,7 +61,8 @@ StdConcurrentDataTransfer::StdConcurrentDataTransfer(const std::string& name) :
   _sendToRecvVecTrans(),
   _isTransferRank(),
   _global2localIDs(),
-  _socketName2data()
+  _socketName2data(),
+  _transferPlans()
 {
   addConfigOptionsTo(this);
   
@@ -71,6 +74,9 @@ StdConcurrentDataTransfer::StdConcurrentDataTransfer(const std::string& name) :
   
   _sendToRecvVecTransStr = vector<string>();
   setParameter("SendToRecvVariableTransformer", &_sendToRecvVecTransStr);
+  
+  _directTransfer = false;
+  setParameter("DirectTransfer", &_directTransfer);
 }
       
 //////////////////////////////////////////////////////////////////////////////
@@ -150,6 +156,7 @@ void StdConcurrentDataTransfer::setup()
   
   cf_assert(_socketsSendRecv.size() > 0);
   _isTransferRank.resize(_socketsSendRecv.size());
+  _transferPlans.resize(_socketsSendRecv.size());
 }
  
 //////////////////////////////////////////////////////////////////////////////
@@ -180,7 +187,10 @@ void StdConcurrentDataTransfer::execute()
       const CFuint nbRanksSend = dtt->nbRanksSend;
       const CFuint nbRanksRecv = dtt->nbRanksRecv;
       
-      if (nbRanksSend > 1 && nbRanksRecv == 1) {
+      if (_directTransfer || (nbRanksSend > 1 && nbRanksRecv > 1)) {
+	directTransferData(i);
+      }
+      else if (nbRanksSend > 1 && nbRanksRecv == 1) {
 	gatherData(i);
       }
       else if (nbRanksSend == 1 && nbRanksRecv > 1) {
@@ -188,18 +198,18 @@ void StdConcurrentDataTransfer::execute()
 	scatterData(i);
 	// CFLog(VERBOSE, "StdConcurrentDataTransfer::execute() => after scatterData()\n");
       }
-      else if (nbRanksSend > 1 && nbRanksRecv > 1) {
-	throw NotImplementedException
-	  (FromHere(),"StdConcurrentDataTransfer::execute() => (nbRanksSend > 1 && nbRanksRecv > 1)");
-      }
     }
     
     // every process involved in the enclosing couping method needs to wait and synchronize 
     // after each communication operation is accomplished, since the next operation might 
     // involve some of the same ranks 
-    CFLog(VERBOSE, "StdConcurrentDataTransfer::execute() => before barrier\n");
-    MPI_Barrier(PE::GetPE().getGroup(getMethodData().getNamespace()).comm);
-    CFLog(VERBOSE, "StdConcurrentDataTransfer::execute() => after barrier\n");
+    // (not needed for direct transfers, which only involve the ranks of the transfer group
+    // and are completed by each of them before the next transfer starts)
+    if (!_directTransfer) {
+      CFLog(VERBOSE, "StdConcurrentDataTransfer::execute() => before barrier\n");
+      MPI_Barrier(PE::GetPE().getGroup(getMethodData().getNamespace()).comm);
+      CFLog(VERBOSE, "StdConcurrentDataTransfer::execute() => after barrier\n");
+    }
   }
   
   CFLog(VERBOSE, "StdConcurrentDataTransfer::execute() => end\n");
@@ -486,6 +496,271 @@ void StdConcurrentDataTransfer::scatterData(const CFuint idx)
   CFLog(INFO, "StdConcurrentDataTransfer::scatterData() from namespace[" << nspSend 
 	<< "] to namespace [" << nspRecv << "] within namespace [" << nspCoupling << "] => end\n");
 }
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// Compute the number of entries to send to each rank and the position of
+/// each entry in the send buffer, where the entries are sorted by rank
+static void sortByRank(const vector<int>& destRank, const CFuint nbRanks,
+		       vector<int>& sendCount, vector<CFuint>& position)
+{
+  sendCount.assign(nbRanks, 0);
+  for (CFuint i = 0; i < destRank.size(); ++i) {
+    if (destRank[i] >= 0) {sendCount[destRank[i]]++;}
+  }
+  
+  vector<CFuint> next(nbRanks, 0);
+  for (CFuint r = 1; r < nbRanks; ++r) {
+    next[r] = next[r-1] + sendCount[r-1];
+  }
+  
+  position.resize(destRank.size());
+  for (CFuint i = 0; i < destRank.size(); ++i) {
+    if (destRank[i] >= 0) {position[i] = next[destRank[i]]++;}
+  }
+}
+      
+//////////////////////////////////////////////////////////////////////////////
+
+void StdConcurrentDataTransfer::directTransferData(const CFuint idx)
+{
+  SafePtr<DataToTrasfer> dtt = _socketName2data.find(_socketsSendRecv[idx]); 
+  cf_assert(dtt.isNotNull());
+  
+  const string nspSend = dtt->nspSend;
+  const string nspRecv = dtt->nspRecv;
+  
+  CFLog(VERBOSE, "StdConcurrentDataTransfer::directTransferData() from namespace[" << nspSend 
+	<< "] to namespace [" << nspRecv << "] => start\n");
+  
+  Group& group   = PE::GetPE().getGroup(dtt->groupName);
+  const int rank = PE::GetPE().GetRank("Default"); // rank in MPI_COMM_WORLD
+  
+  // the plan is rebuilt by all the ranks of the group if the dofs of any of
+  // them have changed (e.g. after repartitioning), otherwise it is reused
+  const string nsp = (PE::GetPE().isRankInGroup(rank, nspRecv)) ? nspRecv : nspSend;
+  SafePtr<DataStorage> ds = getMethodData().getDataStorage(nsp);
+  cf_assert(ds.isNotNull());
+  vector<CFuint> dofIDs;
+  if (_socketsConnType[idx] == "State") {
+    fillDofIDs<State*>(dtt, ds, dofIDs);
+  }
+  if (_socketsConnType[idx] == "Node") {
+    fillDofIDs<Node*>(dtt, ds, dofIDs);
+  }
+  
+  TransferPlan& plan = _transferPlans[idx];
+  int changed = (!plan.isBuilt || dofIDs != plan.dofIDs) ? 1 : 0;
+  int anyChanged = 0;
+  MPIError::getInstance().check
+    ("MPI_Allreduce", "StdConcurrentDataTransfer::directTransferData()", 
+     MPI_Allreduce(&changed, &anyChanged, 1, MPIStructDef::getMPIType(&changed), 
+		   MPI_MAX, group.comm));
+  if (anyChanged == 1) {
+    plan.dofIDs.swap(dofIDs);
+    buildTransferPlan(idx);
+  }
+  
+  cf_assert(idx < _sendToRecvVecTrans.size());
+  SafePtr<VarSetTransformer> sendToRecvTrans = _sendToRecvVecTrans[idx].getPtr();
+  cf_assert(sendToRecvTrans.isNotNull());
+  const CFuint sendStride = dtt->sendStride;
+  const CFuint recvStride = dtt->recvStride;
+  
+  vector<CFreal> sendbuf(plan.sendLocalIDs.size()*recvStride);
+  vector<CFreal> recvbuf(plan.recvLocalIDs.size()*recvStride);
+  vector<MPI_Request> requests(plan.sendRanks.size() + plan.recvRanks.size());
+  CFuint nbRequests = 0;
+  
+  // receives are posted first
+  for (CFuint i = 0; i < plan.recvRanks.size(); ++i) {
+    const CFuint start = plan.recvStart[i]*recvStride;
+    const int count = (plan.recvStart[i+1] - plan.recvStart[i])*recvStride;
+    MPIError::getInstance().check
+      ("MPI_Irecv", "StdConcurrentDataTransfer::directTransferData()", 
+       MPI_Irecv(&recvbuf[start], count, MPIStructDef::getMPIType(&recvbuf[start]),
+		 plan.recvRanks[i], 0, group.comm, &requests[nbRequests++]));
+  }
+  
+  // the data are transformed to the recv variables before being sent
+  CFreal *const array = dtt->array;
+  RealVector tState(recvStride, static_cast<CFreal*>(NULL));
+  RealVector state(sendStride, static_cast<CFreal*>(NULL));
+  for (CFuint i = 0; i < plan.sendRanks.size(); ++i) {
+    for (CFuint s = plan.sendStart[i]; s < plan.sendStart[i+1]; ++s) {
+      state.wrap(sendStride, &array[plan.sendLocalIDs[s]*sendStride]);
+      tState.wrap(recvStride, &sendbuf[s*recvStride]);
+      sendToRecvTrans->transform((const RealVector&)state, (RealVector&)tState);
+    }
+    
+    const CFuint start = plan.sendStart[i]*recvStride;
+    const int count = (plan.sendStart[i+1] - plan.sendStart[i])*recvStride;
+    MPIError::getInstance().check
+      ("MPI_Isend", "StdConcurrentDataTransfer::directTransferData()", 
+       MPI_Isend(&sendbuf[start], count, MPIStructDef::getMPIType(&sendbuf[start]),
+		 plan.sendRanks[i], 0, group.comm, &requests[nbRequests++]));
+  }
+  
+  if (nbRequests > 0) {
+    MPIError::getInstance().check
+      ("MPI_Waitall", "StdConcurrentDataTransfer::directTransferData()", 
+       MPI_Waitall(nbRequests, &requests[0], MPI_STATUSES_IGNORE));
+  }
+  
+  for (CFuint r = 0; r < plan.recvLocalIDs.size(); ++r) {
+    const CFuint startR = plan.recvLocalIDs[r]*recvStride;
+    cf_assert(startR + recvStride <= dtt->arraySize);
+    for (CFuint s = 0; s < recvStride; ++s) {
+      array[startR + s] = recvbuf[r*recvStride + s];
+    }
+  }
+  
+  CFLog(VERBOSE, "StdConcurrentDataTransfer::directTransferData() from namespace[" << nspSend 
+	<< "] to namespace [" << nspRecv << "] => end\n");
+}
+      
+//////////////////////////////////////////////////////////////////////////////
+
+void StdConcurrentDataTransfer::buildTransferPlan(const CFuint idx)
+{
+  SafePtr<DataToTrasfer> dtt = _socketName2data.find(_socketsSendRecv[idx]); 
+  cf_assert(dtt.isNotNull());
+  
+  TransferPlan& plan = _transferPlans[idx];
+  const vector<CFuint>& dofIDs = plan.dofIDs;
+  const CFuint nbDofs = dofIDs.size();
+  
+  Group& group = PE::GetPE().getGroup(dtt->groupName);
+  const CFuint nbRanks = group.globalRanks.size();
+  const int rank = PE::GetPE().GetRank("Default"); // rank in MPI_COMM_WORLD
+  const bool isSendRank = PE::GetPE().isRankInGroup(rank, dtt->nspSend);
+  const bool isRecvRank = PE::GetPE().isRankInGroup(rank, dtt->nspRecv);
+  
+  // 1- the sending rank which updates each dof is registered on a
+  //    directory rank, chosen from the global ID of the dof
+  vector<int> destRank(nbDofs, -1);
+  if (isSendRank) {
+    for (CFuint i = 0; i < nbDofs; ++i) {
+      if (dofIDs[i] % 2 == 1) {destRank[i] = (dofIDs[i]/2) % nbRanks;}
+    }
+  }
+  
+  vector<int> sendCount;
+  vector<CFuint> position;
+  sortByRank(destRank, nbRanks, sendCount, position);
+  vector<CFuint> sendIDs(std::accumulate(sendCount.begin(), sendCount.end(), 0));
+  for (CFuint i = 0; i < nbDofs; ++i) {
+    if (destRank[i] >= 0) {sendIDs[position[i]] = dofIDs[i]/2;}
+  }
+  
+  vector<CFuint> recvIDs;
+  vector<int> recvCount;
+  exchange(group.comm, sendIDs, sendCount, recvIDs, recvCount);
+  
+  CFMap<CFuint, int> ownerRank(recvIDs.size());
+  for (CFuint r = 0, counter = 0; r < nbRanks; ++r) {
+    for (int i = 0; i < recvCount[r]; ++i, ++counter) {
+      ownerRank.insert(recvIDs[counter], r);
+    }
+  }
+  ownerRank.sortKeys();
+  
+  // 2- the receiving ranks ask the directory ranks which sending rank
+  //    updates each of their dofs
+  destRank.assign(nbDofs, -1);
+  if (isRecvRank) {
+    for (CFuint i = 0; i < nbDofs; ++i) {
+      destRank[i] = (dofIDs[i]/2) % nbRanks;
+    }
+  }
+  
+  sortByRank(destRank, nbRanks, sendCount, position);
+  sendIDs.resize(std::accumulate(sendCount.begin(), sendCount.end(), 0));
+  for (CFuint i = 0; i < nbDofs; ++i) {
+    if (destRank[i] >= 0) {sendIDs[position[i]] = dofIDs[i]/2;}
+  }
+  exchange(group.comm, sendIDs, sendCount, recvIDs, recvCount);
+  
+  vector<int> owners(recvIDs.size(), -1);
+  for (CFuint i = 0; i < recvIDs.size(); ++i) {
+    bool found = false;
+    const int owner = (ownerRank.size() > 0) ? ownerRank.find(recvIDs[i], found) : -1;
+    if (found) {owners[i] = owner;}
+  }
+  
+  // the answers come back in the order of the questions
+  vector<int> recvOwners;
+  vector<int> ownerCount;
+  exchange(group.comm, owners, recvCount, recvOwners, ownerCount);
+  
+  // 3- the receiving ranks send the global IDs of their dofs to the
+  //    sending ranks which update them
+  CFuint nbMissing = 0;
+  vector<int> dofOwner(nbDofs, -1);
+  for (CFuint i = 0; i < nbDofs; ++i) {
+    if (destRank[i] >= 0) {
+      dofOwner[i] = recvOwners[position[i]];
+      if (dofOwner[i] < 0) {nbMissing++;}
+    }
+  }
+  
+  sortByRank(dofOwner, nbRanks, sendCount, position);
+  sendIDs.resize(std::accumulate(sendCount.begin(), sendCount.end(), 0));
+  plan.recvLocalIDs.resize(sendIDs.size());
+  for (CFuint i = 0; i < nbDofs; ++i) {
+    if (dofOwner[i] >= 0) {
+      sendIDs[position[i]] = dofIDs[i]/2;
+      plan.recvLocalIDs[position[i]] = i;
+    }
+  }
+  exchange(group.comm, sendIDs, sendCount, recvIDs, recvCount);
+  
+  // the data will be received in the order in which they were requested ...
+  plan.recvRanks.clear();
+  plan.recvStart.assign(1, 0);
+  for (CFuint r = 0; r < nbRanks; ++r) {
+    if (sendCount[r] > 0) {
+      plan.recvRanks.push_back(r);
+      plan.recvStart.push_back(plan.recvStart.back() + sendCount[r]);
+    }
+  }
+  
+  // ... and sent in the same order
+  CFMap<CFuint, CFuint> global2local;
+  if (isSendRank) {
+    global2local.reserve(nbDofs);
+    for (CFuint i = 0; i < nbDofs; ++i) {
+      if (dofIDs[i] % 2 == 1) {global2local.insert(dofIDs[i]/2, i);}
+    }
+    global2local.sortKeys();
+  }
+  
+  plan.sendRanks.clear();
+  plan.sendStart.assign(1, 0);
+  plan.sendLocalIDs.resize(recvIDs.size());
+  for (CFuint r = 0, counter = 0; r < nbRanks; ++r) {
+    if (recvCount[r] > 0) {
+      plan.sendRanks.push_back(r);
+      plan.sendStart.push_back(plan.sendStart.back() + recvCount[r]);
+    }
+    for (int i = 0; i < recvCount[r]; ++i, ++counter) {
+      plan.sendLocalIDs[counter] = global2local.find(recvIDs[counter]);
+    }
+  }
+  
+  plan.isBuilt = true;
+  
+  if (nbMissing > 0) {
+    CFLog(WARN, "StdConcurrentDataTransfer::buildTransferPlan() => " << nbMissing 
+	  << " dofs in namespace [" << dtt->nspRecv << "] are not updated by any rank in namespace [" 
+	  << dtt->nspSend << "]\n");
+  }
+  
+  CFLog(INFO, "StdConcurrentDataTransfer::buildTransferPlan() => [" << _socketsSendRecv[idx] 
+	<< "] sends " << plan.sendLocalIDs.size() << " dofs to " << plan.sendRanks.size() 
+	<< " ranks, receives " << plan.recvLocalIDs.size() << " dofs from " 
+	<< plan.recvRanks.size() << " ranks\n");
+}
       
 //////////////////////////////////////////////////////////////////////////////
 
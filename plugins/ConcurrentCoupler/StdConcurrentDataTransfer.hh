@@ -118,6 +118,37 @@ protected: // functions
 			     std::vector<int>& sendcounts,
 			     std::vector<int>& sendIDcounts); 
   
+  /// exchange data directly between all the sending and receiving ranks,
+  /// following a communication plan which is rebuilt only if the
+  /// partition of the sending or receiving namespace changes
+  /// @param idx           index of the data transfer
+  virtual void directTransferData(const CFuint idx);
+  
+  /// build the communication plan of a direct transfer
+  /// @param idx           index of the data transfer
+  void buildTransferPlan(const CFuint idx);
+  
+  /// fill the global IDs of the local dofs, each multiplied by 2
+  /// and incremented by 1 if the dof is parallel updatable
+  /// @param ds            pointer to DataStorage
+  /// @param dofIDs        reference to the vector of IDs to fill in
+  template <typename T>
+  void fillDofIDs(Common::SafePtr<DataToTrasfer> dtt,
+		  Common::SafePtr<Framework::DataStorage> ds,
+		  std::vector<CFuint>& dofIDs);
+  
+  /// exchange the given data among all the ranks of the communicator
+  /// @param sendData      data to send, sorted by destination rank
+  /// @param sendCount     number of entries to send to each rank
+  /// @param recvData      data received, sorted by source rank
+  /// @param recvCount     number of entries received from each rank
+  template <typename T>
+  void exchange(MPI_Comm comm,
+		const std::vector<T>& sendData,
+		const std::vector<int>& sendCount,
+		std::vector<T>& recvData,
+		std::vector<int>& recvCount) const;
+  
   /// @return the rank (within nspCoupling) of the root process belonging to namespace nsp
   /// @param nsp           namespace to which the process belongs
   /// @param nspCoupling   coupling namespace 
@@ -131,6 +162,26 @@ protected: // functions
   /// @param idx  ID of the data socket to transfer
   void createTransferGroup(const CFuint idx);
   
+protected: // helper classes
+  
+  /// communication plan of a direct data transfer: for each rank to which
+  /// this rank sends (or from which it receives) data, the local IDs of the
+  /// dofs involved, in the order in which they are exchanged
+  class TransferPlan {
+  public:
+    /// default constructor
+    TransferPlan() : isBuilt(false) {}
+    
+    bool isBuilt;                      // tells if the plan has been built
+    std::vector<CFuint> dofIDs;        // dof IDs for which the plan was built (see fillDofIDs())
+    std::vector<int> sendRanks;        // ranks to which data are sent
+    std::vector<CFuint> sendStart;     // start of each send rank in sendLocalIDs
+    std::vector<CFuint> sendLocalIDs;  // local IDs of the dofs to send
+    std::vector<int> recvRanks;        // ranks from which data are received
+    std::vector<CFuint> recvStart;     // start of each recv rank in recvLocalIDs
+    std::vector<CFuint> recvLocalIDs;  // local IDs of the dofs to receive
+  };
+  
 protected: // data
   
   /// flag telling that the groups have been created
@@ -164,6 +215,12 @@ protected: // data
   /// variables transformers from send to recv variables
   std::vector<std::string> _sendToRecvVecTransStr;
   
+  /// communication plan for each direct data transfer
+  std::vector<TransferPlan> _transferPlans;
+  
+  /// flag telling to exchange data directly between sending and receiving ranks
+  bool _directTransfer;
+  
 }; // class StdConcurrentDataTransfer
       
 //////////////////////////////////////////////////////////////////////////////
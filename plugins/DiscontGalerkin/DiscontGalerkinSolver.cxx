@@ -1,6 +1,7 @@
 #include "Environment/ObjectProvider.hh"
 #include "DiscontGalerkin/DiscontGalerkin.hh"
 #include "DiscontGalerkin/DiscontGalerkinSolver.hh"
+#include "Framework/Profiler.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -213,7 +214,7 @@ void DiscontGalerkinSolver::setMethodImpl()
 
   setupCommandsAndStrategies();
   cf_assert(m_setup.isNotNull());
-  m_setup->execute();
+  profileExecute(m_setup);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -223,7 +224,7 @@ void DiscontGalerkinSolver::unsetMethodImpl()
   CFAUTOTRACE;
 
   cf_assert(m_unsetup.isNotNull());
-  m_unsetup->execute();
+  profileExecute(m_unsetup);
   unsetupCommandsAndStrategies();
 
   SpaceMethod::unsetMethodImpl();
@@ -245,7 +246,7 @@ void DiscontGalerkinSolver::initializeSolutionImpl(bool isRestart)
   if (!isRestart) {
      for(CFuint i = 0; i < m_inits.size(); ++i) {
       cf_assert(m_inits[i].isNotNull());
-      m_inits[i]->execute();
+      profileExecute(m_inits[i]);
     }
   }
 }
@@ -260,13 +261,13 @@ void DiscontGalerkinSolver::computeSpaceResidualImpl(CFreal factor)
   stopTimer.start();
 
 CFout << "DG begin\n" << CFendl;
-if (m_solveFaces.isNotNull()) m_solveFaces->execute();
+if (m_solveFaces.isNotNull()) profileExecute(m_solveFaces);
 
   cf_assert(m_solveCells.isNotNull());
-  m_solveCells->execute();
+  profileExecute(m_solveCells);
 
-if (m_stabilization.isNotNull()) m_stabilization->execute();
-//   m_timeDependencies->execute();
+if (m_stabilization.isNotNull()) profileExecute(m_stabilization);
+//   profileExecute(m_timeDependencies);
 
   applyBC();
 
@@ -290,7 +291,7 @@ void DiscontGalerkinSolver::applyBCImpl()
 
   for(CFuint i = 0; i < m_bcs.size(); ++i) {
     cf_assert(m_bcs[i].isNotNull());
-    m_bcs[i]->execute();
+    profileExecute(m_bcs[i]);
   }
 }
 
@@ -323,7 +324,7 @@ void DiscontGalerkinSolver::postProcessSolutionImpl()
 {
   CFAUTOTRACE;
    cf_assert(m_setResidual.isNotNull());
-   m_setResidual->execute();
+   profileExecute(m_setResidual);
 }
 
 //////////////////////////////////////////////////////////////////////////////
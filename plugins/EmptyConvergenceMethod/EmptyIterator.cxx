@@ -7,6 +7,7 @@
 #include "EmptyIterator.hh"
 #include "Environment/ObjectProvider.hh"
 #include "EmptyConvergenceMethod/EmptyConvergenceMethod.hh"
+#include "Framework/Profiler.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -107,14 +108,14 @@ void EmptyIterator::setMethodImpl()
 
   setupCommandsAndStrategies();
 
-  m_setup->execute();
+  profileExecute(m_setup);
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
 void EmptyIterator::unsetMethodImpl()
 {
-  m_unSetup->execute();
+  profileExecute(m_unSetup);
 
   unsetupCommandsAndStrategies();
 
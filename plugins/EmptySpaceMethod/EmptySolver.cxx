@@ -7,6 +7,7 @@
 #include "Environment/ObjectProvider.hh"
 #include "EmptySpaceMethod/Empty.hh"
 #include "EmptySpaceMethod/EmptySolver.hh"
+#include "Framework/Profiler.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -114,7 +115,7 @@ void EmptySolver::setMethodImpl()
 
   setupCommandsAndStrategies();
   cf_assert(m_setup.isNotNull());
-  m_setup->execute();
+  profileExecute(m_setup);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -124,7 +125,7 @@ void EmptySolver::unsetMethodImpl()
   CFAUTOTRACE;
 
   cf_assert(m_unsetup.isNotNull());
-  m_unsetup->execute();
+  profileExecute(m_unsetup);
   unsetupCommandsAndStrategies();
 
   SpaceMethod::setMethodImpl();
@@ -150,7 +151,7 @@ void EmptySolver::computeSpaceResidualImpl(CFreal factor)
 {
   CFAUTOTRACE;
   cf_assert(m_solve.isNotNull());
-  m_solve->execute();
+  profileExecute(m_solve);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -3,6 +3,7 @@
 #include "Framework/Method.hh"
 //#include "Utils/Event.hh"
 #include "Framework/SubSystemStatus.hh"
+#include "Framework/Profiler.hh"
 #include "ExplicitFilters/ExplicitFilters.hh"
 
 //////////////////////////////////////////////////////////////////////////////
@@ -154,13 +155,13 @@ void Filter::processDataImpl()
 
   // The prepare command should only be run once.
   // The iteration should be checked inside the prepare command
-  m_prepare->execute();
+  profileExecute(m_prepare);
 
   // execute all processes.
   // Each command should have a built-in processRate which can be configured
   for(CFuint i=0; i<m_processes.size(); ++i) {
     cf_assert(m_processes[i].isNotNull());
-    m_processes[i]->execute();
+    profileExecute(m_processes[i]);
   }
 
 }
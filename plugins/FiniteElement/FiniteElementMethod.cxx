@@ -12,6 +12,7 @@
 #include "ComputeInertiaTerm.hh"
 
 #include "FiniteElement/FiniteElement.hh"
+#include "Framework/Profiler.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -267,7 +268,7 @@ void FiniteElementMethod::initializeSolutionImpl(bool isRestart)
   if (!isRestart) {
     for(CFuint i = 0; i < m_inits.size(); ++i) {
       cf_assert(m_inits[i].isNotNull());
-      m_inits[i]->execute();
+      profileExecute(m_inits[i]);
     }
   }
 }
@@ -279,7 +280,7 @@ void FiniteElementMethod::prepareComputationImpl()
   CFAUTOTRACE;
 
   cf_assert(m_prepare.isNotNull());
-  m_prepare->execute();
+  profileExecute(m_prepare);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -289,7 +290,7 @@ void FiniteElementMethod::extrapolateStatesToNodesImpl()
   CFAUTOTRACE;
 
   cf_assert(m_extrapolateStates.isNotNull());
-  m_extrapolateStates->execute();
+  profileExecute(m_extrapolateStates);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -304,7 +305,7 @@ void FiniteElementMethod::computeSpaceResidualImpl(CFreal factor)
   // be multiplied
   m_data->setResFactor(factor);
 
-  m_computeSpaceResidual->execute();
+  profileExecute(m_computeSpaceResidual);
   applyBC();
 }
 
@@ -320,7 +321,7 @@ void FiniteElementMethod::computeTimeResidualImpl(CFreal factor)
   // be multiplied
   m_data->setResFactor(factor);
 
-  m_computeTimeResidual->execute();
+  profileExecute(m_computeTimeResidual);
   checkMatrixFrozen();
 }
 
@@ -334,7 +335,7 @@ void FiniteElementMethod::applyBCImpl()
   for(CFuint i = 0; i < m_bcs.size(); ++i)
   {
     cf_assert(m_bcs[i].isNotNull());
-    m_bcs[i]->execute();
+    profileExecute(m_bcs[i]);
   }
 }
 
@@ -347,7 +348,7 @@ void FiniteElementMethod::setMethodImpl()
   SpaceMethod::setMethodImpl();
 
   cf_assert(m_setup.isNotNull());
-  m_setup->execute();
+  profileExecute(m_setup);
 
   setupCommandsAndStrategies();
 }
@@ -359,7 +360,7 @@ void FiniteElementMethod::unsetMethodImpl()
   CFAUTOTRACE;
 
   cf_assert(m_unSetup.isNotNull());
-  m_unSetup->execute();
+  profileExecute(m_unSetup);
 
   unsetupCommandsAndStrategies();
 
@@ -3,6 +3,7 @@
 #include "Environment/ObjectProvider.hh"
 #include "FiniteVolume/FiniteVolume.hh"
 #include "FiniteVolume/DerivativeComputer.hh"
+#include "Framework/Profiler.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -64,6 +65,7 @@ CellCenterFVM::CellCenterFVM(const std::string& name)
     _afterMeshUpdate(),
     _spaceRHSForGivenCell(),
     _timeRHSForGivenCell(),
+    _threadData(),
     _isBcApplied(false)
 {
   addConfigOptionsTo(this);
@@ -158,6 +160,9 @@ Common::SafePtr<SpaceMethodData> CellCenterFVM::getSpaceMethodData()
 void CellCenterFVM::setCollaborator(MultiMethodHandle<LinearSystemSolver> lss)
 {
   _data->setLinearSystemSolver(lss);
+  for (CFuint i = 0; i < _threadData.size(); ++i) {
+    _threadData[i]->setLinearSystemSolver(lss);
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -167,6 +172,9 @@ void CellCenterFVM::setCollaborator(MultiMethodHandle<ConvergenceMethod> convMtd
   // convergence method collaborator is made available to the commands through
   // the method data
   _data->setConvergenceMethod(convMtd);
+  for (CFuint i = 0; i < _threadData.size(); ++i) {
+    _threadData[i]->setConvergenceMethod(convMtd);
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -217,6 +225,21 @@ void CellCenterFVM::configure ( Config::ConfigArgs& args )
   CFLog(VERBOSE, "CellCenterFVM::configureNested()\n");
   configureNested ( _data.getPtr(), args );
   
+  // each thread of the face loop gets its own copy of the data, with
+  // independent strategies, VarSets and geometric entity builders
+  _threadData.clear();
+  if (_data->getNbThreads() > 1) {
+    CFLog(VERBOSE, "CellCenterFVM::configure() => creating " << _data->getNbThreads() << " thread data\n");
+    vector<SafePtr<CellCenterFVMData> > threadData(_data->getNbThreads());
+    _threadData.resize(_data->getNbThreads());
+    for (CFuint i = 0; i < _threadData.size(); ++i) {
+      _threadData[i].reset(new CellCenterFVMData(this));
+      configureNested ( _threadData[i].getPtr(), args );
+      threadData[i] = _threadData[i].getPtr();
+    }
+    _data->setThreadData(threadData);
+  }
+  
   // add here configures to the CellCenterFVM
   clearSetupComs();
   clearUnSetupComs();
@@ -355,7 +378,7 @@ void CellCenterFVM::initializeSolutionImpl(bool isRestart)
     for(CFuint i = 0; i < _inits.size(); ++i) {
       cf_assert(_inits[i].isNotNull());
       CFLog(VERBOSE, "Initializing " << _inits[i]->getName() << "START\n");
-      _inits[i]->execute();
+      profileExecute(_inits[i]);
       CFLog(VERBOSE, "Initializing " << _inits[i]->getName() << "END\n");
     }
     
@@ -384,7 +407,7 @@ void CellCenterFVM::initializeSolutionImpl(bool isRestart)
 	}
 	
 	if (toInitialize) {
-	  _inits[i]->execute();
+	  profileExecute(_inits[i]);
 	}
       }
     }
@@ -405,7 +428,7 @@ void CellCenterFVM::computeSpaceResidualImpl(CFreal factor)
   applyBC();
   // BC should actually be applied after the computeResidual
   // and after the update of the states !!!
-  _computeSpaceRHS->execute();
+  profileExecute(_computeSpaceRHS);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -419,7 +442,7 @@ void CellCenterFVM::computeTimeResidualImpl(CFreal factor)
   _data->setResFactor(factor);
 
   if (!_computeTimeRHS->isNull()) {
-    _computeTimeRHS->execute();
+    profileExecute(_computeTimeRHS);
   }
   checkMatrixFrozen();
 }
@@ -436,7 +459,7 @@ void CellCenterFVM::applyBCImpl()
   for(CFuint i = 0; i < _bcs.size(); ++i) {
     cf_assert(_bcs[i].isNotNull());
     CFLog(VERBOSE, "Applying BC " << _bcs[i]->getName() << "START\n");
-    _bcs[i]->execute();
+    profileExecute(_bcs[i]);
     CFLog(VERBOSE, "Applying BC " << _bcs[i]->getName() << "END\n");
   }
   
@@ -472,6 +495,10 @@ void CellCenterFVM::setMethodImpl()
   SpaceMethod::setMethodImpl();
   
   CFLog(VERBOSE, "CellCenterFVM::setMethodImpl() => after SpaceMethod::setMethodImpl()\n");
+  
+  for (CFuint i = 0; i < _threadData.size(); ++i) {
+    _threadData[i]->setup();
+  }
  
   //setup has to be processed first to create InwardNormals
   // needed by the BC commands to create the nodal normals
@@ -480,7 +507,7 @@ void CellCenterFVM::setMethodImpl()
   for(CFuint i=0; i < _setups.size();i++){
     cf_assert(_setups[i].isNotNull());
     CFLog(VERBOSE, "CellCenterFVM::setMethodImpl() => start setting up " << _setups[i]->getName() << " \n");
-    _setups[i]->execute();
+    profileExecute(_setups[i]);
     CFLog(VERBOSE, "CellCenterFVM::setMethodImpl() => end setting up " << _setups[i]->getName() << " \n");
   }
   
@@ -511,9 +538,13 @@ void CellCenterFVM::unsetMethodImpl()
 
   for(CFuint i=0; i < _unSetups.size();++i){
     cf_assert(_unSetups[i].isNotNull());
-    _unSetups[i]->execute();
+    profileExecute(_unSetups[i]);
   }
-
+  
+  for (CFuint i = 0; i < _threadData.size(); ++i) {
+    _threadData[i]->unsetup();
+  }
+  
   SpaceMethod::unsetMethodImpl();
 }
 
@@ -523,7 +554,7 @@ Common::Signal::return_t CellCenterFVM::beforeMeshUpdateActionImpl(Common::Signa
 {
   CFAUTOTRACE;
 
-  _beforeMeshUpdate->execute();
+  profileExecute(_beforeMeshUpdate);
 
   return Common::Signal::return_t ();
 }
@@ -534,7 +565,7 @@ Common::Signal::return_t CellCenterFVM::afterMeshUpdateActionImpl(Common::Signal
 {
   CFAUTOTRACE;
 
-  _afterMeshUpdate->execute();
+  profileExecute(_afterMeshUpdate);
 
   return Common::Signal::return_t ();
 }
@@ -548,7 +579,7 @@ void CellCenterFVM::extrapolateStatesToNodesImpl()
   // ghost states have to be updated before extrapolating to nodes for output
   if (!_isBcApplied) {applyBCImpl();}
   // applyBCImpl();
-  _extrapolateStates->execute();
+  profileExecute(_extrapolateStates);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -582,6 +613,25 @@ std::vector<Common::SafePtr<NumericalStrategy> > CellCenterFVM::getStrategyList(
     result.push_back(eqFilter.d_castTo<NumericalStrategy>());
   }
   
+  // strategies of the per-thread data need sockets and setup as well
+  for (CFuint iThread = 0; iThread < _threadData.size(); ++iThread) {
+    SafePtr<CellCenterFVMData> td = _threadData[iThread].getPtr();
+    result.push_back(td->getPolyReconstructor().d_castTo<NumericalStrategy>());
+    result.push_back(td->getLimiter().d_castTo<NumericalStrategy>());
+    result.push_back(td->getNodalStatesExtrapolator().d_castTo<NumericalStrategy>());
+    result.push_back(td->getFluxSplitter().d_castTo<NumericalStrategy>());
+    result.push_back(td->getGeoDataComputer().d_castTo<NumericalStrategy>());
+    result.push_back(td->getDerivativeComputer().d_castTo<NumericalStrategy>());
+    result.push_back(td->getDiffusiveFluxComputer().d_castTo<NumericalStrategy>());
+    
+    SafePtr<vector<SelfRegistPtr<EquationFilter<CellCenterFVMData> > > > tdFilters =
+      td->getEquationFilters();
+    for(CFuint i=0; i<tdFilters->size();++i){
+      SafePtr<EquationFilter<CellCenterFVMData> > eqFilter = ((*tdFilters)[i]).getPtr();
+      result.push_back(eqFilter.d_castTo<NumericalStrategy>());
+    }
+  }
+  
   return result;
 }
 
@@ -603,7 +653,7 @@ void CellCenterFVM::computeSpaceRhsForStatesSetImpl(CFreal factor)
   _data->setResFactor(factor);
 
   cf_assert(_spaceRHSForGivenCell.isNotNull());
-  _spaceRHSForGivenCell->execute();
+  profileExecute(_spaceRHSForGivenCell);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -614,7 +664,7 @@ void CellCenterFVM::computeTimeRhsForStatesSetImpl(CFreal factor)
   _data->setResFactor(factor);
 
   cf_assert(_timeRHSForGivenCell.isNotNull());
-  _timeRHSForGivenCell->execute();
+  profileExecute(_timeRHSForGivenCell);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -185,6 +185,9 @@ private: // member data
   /// The data to share between CellCenterFVMCom commands
   Common::SharedPtr<CellCenterFVMData> _data;
   
+  /// Per-thread replicas of the data used by the threaded face loop
+  std::vector<Common::SharedPtr<CellCenterFVMData> > _threadData;
+  
   /// Flag telling if BC's have been applied already
   bool _isBcApplied;
   
@@ -48,6 +48,9 @@ void CellCenterFVMData::defineConfigOptions(Config::OptionList& options)
   options.addConfigOption< bool >("ReconstructSolutionVars", "Reconstruct the solution variables instead of the update ones");
   options.addConfigOption< std::string >("IntegratorOrder","Order of the Integration to be used for numerical quadrature.");
   options.addConfigOption< std::string >("IntegratorQuadrature","Type of Quadrature to be used in the Integration.");
+  options.addConfigOption< bool >("UseFaceGeoCache","Store face connectivity and geometry in contiguous arrays (rebuilt when the mesh moves).");
+  options.addConfigOption< CFuint >("NbThreads","Number of threads processing the internal faces (colored) in the RHS computation. Only used by the plain FVMCC_ComputeRHS command with a reentrant flux splitter (currently LaxFried) and without diffusive, axisymmetric or source terms and nodal extrapolation: every other case (e.g. Roe, AUSM, HLLE, Navier-Stokes, implicit jacobians) falls back to the serial face loop.");
+  options.addConfigOption< bool >("SplitPhaseSync","Overlap the parallel update of the states with the computation of the faces far from the partition boundary.");
 
 }
       
@@ -83,7 +86,9 @@ CellCenterFVMData::CellCenterFVMData(Common::SafePtr<Framework::Method> owner) :
   _useAverageFlux(false),
   _hasSourceTerm(false),
   _buildAllCells(false),
-  _resFactor(1.0)
+  _resFactor(1.0),
+  _faceGeoCache(),
+  _threadData()
 {
   addConfigOptionsTo(this);
 
@@ -143,6 +148,15 @@ CellCenterFVMData::CellCenterFVMData(Common::SafePtr<Framework::Method> owner) :
 
   _reconstructSolVars = false;
   setParameter("ReconstructSolutionVars",&_reconstructSolVars);
+  
+  _useFaceGeoCache = false;
+  setParameter("UseFaceGeoCache",&_useFaceGeoCache);
+  
+  _nbThreads = 1;
+  setParameter("NbThreads",&_nbThreads);
+  
+  _splitPhaseSync = false;
+  setParameter("SplitPhaseSync",&_splitPhaseSync);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -676,6 +690,8 @@ void CellCenterFVMData::unsetup()
   _faceTrsGeoBuilder.unsetup();
   _cellTrsGeoBuilder.unsetup();
   _geoWithNodesBuilder.unsetup();
+  
+  _faceGeoCache.clear();
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -28,6 +28,7 @@
 #include "FiniteVolume/FVMCC_EquationFilter.hh"
 #include "Framework/NodalStatesExtrapolator.hh"
 #include "FiniteVolume/FVMCC_PolyRec.hh"
+#include "FiniteVolume/FaceGeoCache.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -467,6 +468,34 @@ public:
     return &_volumeIntegrator;
   }
   
+  /// tell if the face geometry cache has to be used
+  bool useFaceGeoCache() const {return _useFaceGeoCache;}
+  
+  /// get the face geometry cache
+  Common::SafePtr<FaceGeoCache> getFaceGeoCache() {return &_faceGeoCache;}
+  
+  /// get the number of threads to use in the face loop
+  CFuint getNbThreads() const {return _nbThreads;}
+  
+  /// tell if the state synchronization has to be overlapped with the face loop
+  bool useSplitPhaseSync() const {return _splitPhaseSync;}
+  
+  /// get the number of per-thread replicas of this data
+  CFuint getNbThreadData() const {return _threadData.size();}
+  
+  /// get the per-thread replica of this data for the given thread
+  Common::SafePtr<CellCenterFVMData> getThreadData(CFuint iThread) const
+  {
+    cf_assert(iThread < _threadData.size());
+    return _threadData[iThread];
+  }
+  
+  /// set the per-thread replicas of this data (owned by the method)
+  void setThreadData(const std::vector<Common::SafePtr<CellCenterFVMData> >& threadData)
+  {
+    _threadData = threadData;
+  }
+  
 private:
   
   /**
@@ -667,6 +696,21 @@ private:
   /// reconstruct the solution (conservative) variables
   bool _reconstructSolVars;
   
+  /// flag telling to use the face geometry cache
+  bool _useFaceGeoCache;
+  
+  /// face geometry cache
+  FaceGeoCache _faceGeoCache;
+  
+  /// number of threads used to process the internal faces
+  CFuint _nbThreads;
+  
+  /// flag telling to overlap the state synchronization with the face loop
+  bool _splitPhaseSync;
+  
+  /// per-thread replicas of this data, each one with its own strategies and VarSets
+  std::vector<Common::SafePtr<CellCenterFVMData> > _threadData;
+  
   /// GhostStates / IDs Map
   Common::CFMap<Framework::State*, CFuint> _mapGhostStateIDs;
 
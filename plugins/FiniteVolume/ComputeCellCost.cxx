@@ -0,0 +1,420 @@
+#include <algorithm>
+
+#include "Common/PE.hh"
+#include "Common/EventHandler.hh"
+#include "Common/BadValueException.hh"
+#include "Common/ParserException.hh"
+#include "Common/MPI/MPIStructDef.hh"
+#include "MathTools/MathConsts.hh"
+#include "Environment/CFEnv.hh"
+#include "Environment/DirPaths.hh"
+#include "Environment/FileHandlerOutput.hh"
+#include "Environment/SingleBehaviorFactory.hh"
+#include "Framework/DataProcessing.hh"
+#include "Framework/MeshData.hh"
+#include "Framework/SubSystemStatus.hh"
+#include "Framework/MethodCommandProvider.hh"
+#include "FiniteVolume/FiniteVolume.hh"
+#include "FiniteVolume/ComputeCellCost.hh"
+
+//////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace FiniteVolume {
+
+//////////////////////////////////////////////////////////////////////
+
+MethodCommandProvider<ComputeCellCost, DataProcessingData, FiniteVolumeModule>
+computeCellCostFVMCCProvider("ComputeCellCostFVMCC");
+
+//////////////////////////////////////////////////////////////////////
+
+CFuint ComputeCellCost::m_nbRepartitions = 0;
+
+//////////////////////////////////////////////////////////////////////
+
+void ComputeCellCost::defineConfigOptions(Config::OptionList& options)
+{
+  options.addConfigOption< std::vector<std::string> >("Vars","Definition of the Variables (cell center coordinates).");
+  options.addConfigOption< std::vector<std::string> >("Def","Definition of the cost function (if empty, the cost is measured).");
+  options.addConfigOption< CFuint >("NbMeasureIterations","Number of iterations over which the cost is measured.");
+  options.addConfigOption< std::string >("OutputFile","Name of the output file for the cost (empty for no output).");
+  options.addConfigOption< CFreal >("ImbalanceThreshold","Load imbalance (max/average) above which the mesh is repartitioned (0 for never).");
+  options.addConfigOption< CFuint >("MaxNbRepartitions","Maximum number of repartitionings requested during the simulation.");
+}
+
+//////////////////////////////////////////////////////////////////////
+
+ComputeCellCost::ComputeCellCost(const std::string& name) :
+  DataProcessingCom(name),
+  socket_cellCost("cellCost"),
+  socket_cellTime("cellTime"),
+  socket_states("states"),
+  m_timer(),
+  m_startIter(0),
+  m_isMeasuring(false),
+  m_isCostComputed(false),
+  m_vFunction()
+{
+  addConfigOptionsTo(this);
+
+  m_functions = std::vector<std::string>();
+  setParameter("Def",&m_functions);
+
+  m_vars = std::vector<std::string>();
+  setParameter("Vars",&m_vars);
+
+  m_nbMeasureIter = 10;
+  setParameter("NbMeasureIterations",&m_nbMeasureIter);
+
+  m_nameOutputFile = "cellCost.dat";
+  setParameter("OutputFile",&m_nameOutputFile);
+
+  m_imbalanceThreshold = 0.;
+  setParameter("ImbalanceThreshold",&m_imbalanceThreshold);
+
+  m_maxNbRepartitions = 1;
+  setParameter("MaxNbRepartitions",&m_maxNbRepartitions);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+ComputeCellCost::~ComputeCellCost()
+{
+}
+
+//////////////////////////////////////////////////////////////////////
+
+std::vector<Common::SafePtr<BaseDataSocketSource> >
+ComputeCellCost::providesSockets()
+{
+  std::vector<Common::SafePtr<BaseDataSocketSource> > result;
+  result.push_back(&socket_cellCost);
+  result.push_back(&socket_cellTime);
+  return result;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+std::vector<Common::SafePtr<BaseDataSocketSink> >
+ComputeCellCost::needsSockets()
+{
+  std::vector<Common::SafePtr<BaseDataSocketSink> > result;
+  result.push_back(&socket_states);
+  return result;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void ComputeCellCost::configure ( Config::ConfigArgs& args )
+{
+  CFAUTOTRACE;
+
+  DataProcessingCom::configure(args);
+
+  if (m_functions.size() > 1) {
+    throw BadValueException
+      (FromHere(), "ComputeCellCost::configure() => only one cost function can be defined");
+  }
+
+  if (m_functions.size() == 1) {
+    m_vFunction.setFunctions(m_functions);
+    m_vFunction.setVariables(m_vars);
+    try {
+      m_vFunction.parse();
+    }
+    catch (Common::ParserException& e) {
+      CFout << e.what() << "\n";
+      throw; // retrow the exception to signal the error to the user
+    }
+  }
+  else if (m_nbMeasureIter == 0) {
+    throw BadValueException
+      (FromHere(), "ComputeCellCost::configure() => NbMeasureIterations must be > 0");
+  }
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void ComputeCellCost::setup()
+{
+  CFAUTOTRACE;
+
+  DataProcessingCom::setup();
+
+  const CFuint nbStates = socket_states.getDataHandle().size();
+  DataHandle<CFreal> cellCost = socket_cellCost.getDataHandle();
+  cellCost.resize(nbStates);
+  cellCost = 1.;
+
+  // the space method measures the times only while this storage is allocated
+  DataHandle<CFreal> cellTime = socket_cellTime.getDataHandle();
+  cellTime.resize(0);
+
+  m_isMeasuring = false;
+  m_isCostComputed = false;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void ComputeCellCost::execute()
+{
+  CFAUTOTRACE;
+
+  if (m_isCostComputed) return;
+
+  if (m_functions.size() == 1) {
+    computeCostFromFunction();
+    processCost();
+    return;
+  }
+
+  const CFuint iter = SubSystemStatusStack::getActive()->getNbIter();
+  if (!m_isMeasuring) {
+    DataHandle<CFreal> cellTime = socket_cellTime.getDataHandle();
+    cellTime.resize(socket_states.getDataHandle().size());
+    cellTime = 0.;
+
+    m_startIter = iter;
+    m_isMeasuring = true;
+    m_timer.restart();
+    return;
+  }
+
+  if (iter - m_startIter >= m_nbMeasureIter) {
+    m_timer.stop();
+    computeCostFromTimes();
+    processCost();
+  }
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void ComputeCellCost::computeCostFromFunction()
+{
+  CFAUTOTRACE;
+
+  DataHandle < Framework::State*, Framework::GLOBAL > states = socket_states.getDataHandle();
+  DataHandle<CFreal> cellCost = socket_cellCost.getDataHandle();
+
+  RealVector cost(1);
+  const CFuint nbStates = states.size();
+  for (CFuint iState = 0; iState < nbStates; ++iState) {
+    m_vFunction.evaluate(states[iState]->getCoordinates(), cost);
+    cellCost[iState] = std::max(cost[0], 0.);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void ComputeCellCost::computeCostFromTimes()
+{
+  CFAUTOTRACE;
+
+  DataHandle < Framework::State*, Framework::GLOBAL > states = socket_states.getDataHandle();
+  DataHandle<CFreal> cellCost = socket_cellCost.getDataHandle();
+  DataHandle<CFreal> cellTime = socket_cellTime.getDataHandle();
+
+  const CFuint nbStates = states.size();
+  CFreal measuredTime = 0.;
+  CFuint nbUpdatable = 0;
+  for (CFuint iState = 0; iState < nbStates; ++iState) {
+    measuredTime += cellTime[iState];
+    if (states[iState]->isParUpdatable()) nbUpdatable++;
+  }
+
+  // the rest of the iteration is assumed to cost the same in every cell:
+  // the less loaded processors also count the time spent waiting for the
+  // others, therefore the smallest value among the processors is the best
+  // estimate of this uniform part
+  const CFreal elapsed = m_timer.read();
+  CFreal baseTime = (nbUpdatable > 0) ?
+    std::max(elapsed - measuredTime, 0.)/static_cast<CFreal>(nbUpdatable) : MathTools::MathConsts::CFrealMax();
+
+  const std::string nsp = getMethodData().getNamespace();
+  CFreal minBaseTime = 0.;
+  MPI_Allreduce(&baseTime, &minBaseTime, 1, MPIStructDef::getMPIType(&baseTime),
+		MPI_MIN, PE::GetPE().GetCommunicator(nsp));
+
+  for (CFuint iState = 0; iState < nbStates; ++iState) {
+    cellCost[iState] = minBaseTime + cellTime[iState];
+  }
+
+  CFLog(INFO, "ComputeCellCost::computeCostFromTimes() => measured over "
+	<< SubSystemStatusStack::getActive()->getNbIter() - m_startIter << " iterations\n");
+
+  // stop the measurement in the space method
+  cellTime.resize(0);
+  m_isMeasuring = false;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void ComputeCellCost::processCost()
+{
+  CFAUTOTRACE;
+
+  DataHandle < Framework::State*, Framework::GLOBAL > states = socket_states.getDataHandle();
+  DataHandle<CFreal> cellCost = socket_cellCost.getDataHandle();
+
+  const std::string nsp = getMethodData().getNamespace();
+  MPI_Comm comm = PE::GetPE().GetCommunicator(nsp);
+  const CFuint nbProc = PE::GetPE().GetProcessorCount(nsp);
+
+  // local load and number of updatable cells
+  const CFuint nbStates = states.size();
+  CFreal localLoad[2] = {0., 0.};
+  for (CFuint iState = 0; iState < nbStates; ++iState) {
+    if (states[iState]->isParUpdatable()) {
+      localLoad[0] += cellCost[iState];
+      localLoad[1] += 1.;
+    }
+  }
+
+  CFreal totalLoad[2] = {0., 0.};
+  MPI_Allreduce(&localLoad[0], &totalLoad[0], 2, MPIStructDef::getMPIType(&localLoad[0]),
+		MPI_SUM, comm);
+
+  // normalize the cost by its average
+  const CFreal avCost = (totalLoad[0] > 0.) ? totalLoad[0]/totalLoad[1] : 1.;
+  for (CFuint iState = 0; iState < nbStates; ++iState) {
+    cellCost[iState] = (totalLoad[0] > 0.) ? cellCost[iState]/avCost : 1.;
+  }
+
+  CFreal maxLoad = 0.;
+  MPI_Allreduce(&localLoad[0], &maxLoad, 1, MPIStructDef::getMPIType(&localLoad[0]),
+		MPI_MAX, comm);
+  const CFreal imbalance = (totalLoad[0] > 0.) ?
+    maxLoad/(totalLoad[0]/static_cast<CFreal>(nbProc)) : 1.;
+
+  CFLog(NOTICE, "ComputeCellCost::processCost() => load imbalance = " << imbalance << "\n");
+
+  if (m_nameOutputFile != "") {
+    writeCostFile();
+  }
+
+  m_isCostComputed = true;
+
+  if (m_imbalanceThreshold > 0. && imbalance > m_imbalanceThreshold) {
+    if (m_nbRepartitions >= m_maxNbRepartitions) {
+      CFLog(NOTICE, "ComputeCellCost::processCost() => load imbalance above "
+	    << m_imbalanceThreshold << ", but already repartitioned " << m_nbRepartitions << " times\n");
+      return;
+    }
+    m_nbRepartitions++;
+    
+    CFLog(NOTICE, "ComputeCellCost::processCost() => load imbalance above "
+	  << m_imbalanceThreshold << ", restarting with a new partitioning\n");
+
+    // same restart as after a global remeshing: the solution is written,
+    // then the mesh is read again and partitioned with the new costs
+    Common::SafePtr<EventHandler> event_handler = Environment::CFEnv::getInstance().getEventHandler();
+    const std::string ssname = SubSystemStatusStack::getCurrentName();
+    std::string msg;
+    event_handler->call_signal
+      (event_handler->key(ssname, "CF_ON_MESHADAPTER_AFTERGLOBALREMESHING"), msg);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void ComputeCellCost::writeCostFile()
+{
+  CFAUTOTRACE;
+
+  DataHandle < Framework::State*, Framework::GLOBAL > states = socket_states.getDataHandle();
+  DataHandle<CFreal> cellCost = socket_cellCost.getDataHandle();
+  Common::SafePtr<TopologicalRegionSet> cells =
+    MeshDataStack::getActive()->getTrs("InnerCells");
+
+  // global element IDs and costs of the updatable cells
+  const CFuint nbCells = cells->getLocalNbGeoEnts();
+  vector<CFuint> globalIDs;
+  vector<CFreal> costs;
+  globalIDs.reserve(nbCells);
+  costs.reserve(nbCells);
+  CFuint maxGlobalID = 0;
+  for (CFuint iCell = 0; iCell < nbCells; ++iCell) {
+    const CFuint stateID = cells->getStateID(iCell, 0);
+    if (states[stateID]->isParUpdatable()) {
+      globalIDs.push_back(cells->getGlobalGeoID(iCell));
+      costs.push_back(cellCost[stateID]);
+      maxGlobalID = std::max(maxGlobalID, globalIDs.back());
+    }
+  }
+
+  const std::string nsp = getMethodData().getNamespace();
+  MPI_Comm comm = PE::GetPE().GetCommunicator(nsp);
+  const CFuint nbProc = PE::GetPE().GetProcessorCount(nsp);
+  const CFuint rank = PE::GetPE().GetRank(nsp);
+
+  CFuint nbGlobalCells = 0;
+  maxGlobalID += 1;
+  MPI_Allreduce(&maxGlobalID, &nbGlobalCells, 1, MPIStructDef::getMPIType(&maxGlobalID),
+		MPI_MAX, comm);
+
+  int sendCount = globalIDs.size();
+  vector<int> recvCounts(nbProc, 0);
+  MPI_Gather(&sendCount, 1, MPI_INT, &recvCounts[0], 1, MPI_INT, 0, comm);
+
+  vector<int> displs(nbProc, 0);
+  for (CFuint i = 1; i < nbProc; ++i) {
+    displs[i] = displs[i-1] + recvCounts[i-1];
+  }
+  const CFuint totalCount = (rank == 0) ? displs[nbProc-1] + recvCounts[nbProc-1] : 0;
+
+  // dummy element to avoid taking the address of an empty vector
+  vector<CFuint> allGlobalIDs(totalCount + 1);
+  vector<CFreal> allCosts(totalCount + 1);
+  globalIDs.push_back(0);
+  costs.push_back(0.);
+
+  MPI_Gatherv(&globalIDs[0], sendCount, MPIStructDef::getMPIType(&globalIDs[0]),
+	      &allGlobalIDs[0], &recvCounts[0], &displs[0],
+	      MPIStructDef::getMPIType(&allGlobalIDs[0]), 0, comm);
+  MPI_Gatherv(&costs[0], sendCount, MPIStructDef::getMPIType(&costs[0]),
+	      &allCosts[0], &recvCounts[0], &displs[0],
+	      MPIStructDef::getMPIType(&allCosts[0]), 0, comm);
+
+  if (rank == 0) {
+    vector<CFreal> globalCost(nbGlobalCells, 1.);
+    for (CFuint i = 0; i < totalCount; ++i) {
+      globalCost[allGlobalIDs[i]] = allCosts[i];
+    }
+
+    // same directory where ParMetis looks for the CellCostFile
+    boost::filesystem::path file = Environment::DirPaths::getInstance().getResultsDir() /
+      boost::filesystem::path(m_nameOutputFile);
+
+    SelfRegistPtr<Environment::FileHandlerOutput> fhandle =
+      Environment::SingleBehaviorFactory<Environment::FileHandlerOutput>::getInstance().create();
+    ofstream& fout = fhandle->open(file);
+
+    fout << nbGlobalCells << "\n";
+    for (CFuint i = 0; i < nbGlobalCells; ++i) {
+      fout << globalCost[i] << "\n";
+    }
+    fhandle->close();
+
+    CFLog(INFO, "ComputeCellCost::writeCostFile() => cost written in " << file.string() << "\n");
+  }
+}
+
+//////////////////////////////////////////////////////////////////////
+
+    } // namespace FiniteVolume
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////
@@ -0,0 +1,160 @@
+#ifndef COOLFluiD_Numerics_FiniteVolume_ComputeCellCost_hh
+#define COOLFluiD_Numerics_FiniteVolume_ComputeCellCost_hh
+
+//////////////////////////////////////////////////////////////////////
+
+#include "Common/Stopwatch.hh"
+#include "Framework/DataProcessingData.hh"
+#include "Framework/DataSocketSink.hh"
+#include "Framework/DataSocketSource.hh"
+#include "Framework/VectorialFunction.hh"
+
+//////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace FiniteVolume {
+
+//////////////////////////////////////////////////////////////////////
+
+/**
+ * This class computes the computational cost of each cell, to be used
+ * as weight for the mesh partitioning.
+ * The cost is either given by a user defined function of the cell center
+ * coordinates or measured as the time spent in the source terms of each
+ * cell (plus a uniform part for the rest of the iteration) during the first
+ * iterations. The cost, normalized by its average, is stored in the
+ * "cellCost" socket and written to a file that ParMetis can read at the
+ * next (re)partitioning. If the measured load imbalance among the processors
+ * exceeds a given threshold, a global restart of the simulation is requested
+ * (as after a global remeshing), which repartitions the mesh with these costs,
+ * at most a given number of times.
+ *
+ * @author Andrea Lani
+ *
+ */
+class ComputeCellCost : public Framework::DataProcessingCom {
+public:
+
+  /**
+   * Defines the Config Option's of this class
+   * @param options a OptionList where to add the Option's
+   */
+  static void defineConfigOptions(Config::OptionList& options);
+
+  /**
+   * Constructor
+   */
+  ComputeCellCost(const std::string& name);
+
+  /**
+   * Default destructor
+   */
+  ~ComputeCellCost();
+
+  /**
+   * Set up private data and data of the aggregated classes
+   * in this command before processing phase
+   */
+  void setup();
+
+  /**
+   * Execute on a set of dofs
+   */
+  void execute();
+
+  /**
+   * Configures this object with supplied arguments.
+   */
+  void configure ( Config::ConfigArgs& args );
+
+  /**
+   * Returns the DataSocket's that this command provides as sources
+   * @return a vector of SafePtr with the DataSockets
+   */
+  std::vector<Common::SafePtr<Framework::BaseDataSocketSource> > providesSockets();
+
+  /**
+   * Returns the DataSocket's that this command needs as sinks
+   * @return a vector of SafePtr with the DataSockets
+   */
+  std::vector<Common::SafePtr<Framework::BaseDataSocketSink> > needsSockets();
+
+private:
+
+  /// Compute the cost from the user defined function
+  void computeCostFromFunction();
+
+  /// Compute the cost from the measured times
+  void computeCostFromTimes();
+
+  /// Normalize the cost, compute the load imbalance, write the cost file and
+  /// request the repartitioning if needed
+  void processCost();
+
+  /// Write the cost of all the cells, in global element order
+  void writeCostFile();
+
+private: //data
+
+  /// socket for the cost of each cell
+  Framework::DataSocketSource<CFreal> socket_cellCost;
+
+  /// socket for the time spent in the source terms of each cell
+  Framework::DataSocketSource<CFreal> socket_cellTime;
+
+  /// storage of states
+  Framework::DataSocketSink < Framework::State* , Framework::GLOBAL > socket_states;
+
+  /// timer for the measurement iterations
+  Common::Stopwatch<Common::WallTime> m_timer;
+
+  /// iteration at which the measurement started
+  CFuint m_startIter;
+
+  /// flag telling if the measurement has started
+  bool m_isMeasuring;
+
+  /// flag telling if the cost has already been computed
+  bool m_isCostComputed;
+
+  /// the VectorialFunction to use
+  Framework::VectorialFunction m_vFunction;
+
+  /// a vector of string to hold the functions
+  std::vector<std::string> m_functions;
+
+  /// a vector of string to hold the variables
+  std::vector<std::string> m_vars;
+
+  /// number of iterations over which the times are measured
+  CFuint m_nbMeasureIter;
+
+  /// name of the output file for the cost
+  std::string m_nameOutputFile;
+
+  /// load imbalance above which the repartitioning is requested
+  CFreal m_imbalanceThreshold;
+
+  /// maximum number of repartitionings requested during the simulation
+  CFuint m_maxNbRepartitions;
+
+  /// number of repartitionings already requested (this command is
+  /// created again at each restart, therefore it is counted per process)
+  static CFuint m_nbRepartitions;
+
+}; // end of class ComputeCellCost
+
+//////////////////////////////////////////////////////////////////////
+
+    } // namespace FiniteVolume
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Numerics_FiniteVolume_ComputeCellCost_hh
@@ -50,6 +50,19 @@ void ConstantPolyRec::extrapolateImpl(GeometricEntity* const face)
 
 //////////////////////////////////////////////////////////////////////////////
 
+void ConstantPolyRec::extrapolateInFaceCenter(State *const left,
+					      State *const right,
+					      const RealVector& center)
+{
+  FVMCC_PolyRec::baseExtrapolateInFaceCenter(left, right, center);
+  getValues(LEFT).copyData(*left);
+  getValues(RIGHT).copyData(*right);
+  getBackupValues(LEFT) = getValues(LEFT);
+  getBackupValues(RIGHT) = getValues(RIGHT);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 void ConstantPolyRec::extrapolateImpl(GeometricEntity* const face,
 				      CFuint iVar, CFuint leftOrRight)
 {
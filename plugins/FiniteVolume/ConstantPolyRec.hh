@@ -3,6 +3,8 @@
 
 //////////////////////////////////////////////////////////////////////////////
 
+#include <typeinfo>
+
 #include "FVMCC_PolyRec.hh"
 
 //////////////////////////////////////////////////////////////////////////////
@@ -54,6 +56,21 @@ public:
     return result;
   }
   
+  /**
+   * Tell if extrapolateInFaceCenter() can replace extrapolate() 
+   */
+  virtual bool canExtrapolateInFaceCenter() const
+  {
+    return (typeid(*this) == typeid(ConstantPolyRec));
+  }
+  
+  /**
+   * Extrapolate the solution in the center of an internal face
+   */
+  virtual void extrapolateInFaceCenter(Framework::State *const left,
+				       Framework::State *const right,
+				       const RealVector& center);
+  
 private: // helper function
   
   /**
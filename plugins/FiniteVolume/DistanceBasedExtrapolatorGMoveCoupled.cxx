@@ -304,7 +304,8 @@ void DistanceBasedExtrapolatorGMoveCoupled::extrapolateInAllNodes()
 void DistanceBasedExtrapolatorGMoveCoupled::extrapolateInNodes
 (const vector<Node*>& nodes)
 {
-  cf_assert(false);
+  // the coupled nodal values are only computed for all the nodes at once
+  extrapolateInAllNodes();
 }
 
 
@@ -397,7 +397,8 @@ CFout << "\n";*/
 void DistanceBasedExtrapolatorGMoveCoupledAndNot::extrapolateInNodes
 (const vector<Node*>& nodes)
 {
-  cf_assert(false);
+  // the coupled nodal values are only computed for all the nodes at once
+  extrapolateInAllNodes();
 }
 
 
@@ -86,7 +86,7 @@ void FVMCC_ALEBDF2TimeRhsCoupling::computeNumericalTransMatrix(const CFuint iSta
     }
   }
 
-  if(!getMethodData().isSysMatrixFrozen()) {
+  if ((!getMethodData().isSysMatrixFrozen()) && getMethodData().doComputeJacobian()) {
   // now the contribution to the jacobian matrix is calculated
   _acc[iLSS]->setRowColIndex(0, currState->getLocalID());
 
@@ -149,7 +149,7 @@ void FVMCC_ALEBDF2TimeRhsCoupling::computeAnalyticalTransMatrix
     }
   }
 
-  if(!getMethodData().isSysMatrixFrozen()) {
+  if ((!getMethodData().isSysMatrixFrozen()) && getMethodData().doComputeJacobian()) {
   // now the contribution to the jacobian matrix is calculated
   _acc[iLSS]->setRowColIndex(0, currState->getLocalID());
 
@@ -155,7 +155,7 @@ void FVMCC_ALETimeRhsCoupling::computeNumericalTransMatrix
     rhs(iState, iVar, totalNbEqs) -= dU*resFactor;
   }
   
-  if(!getMethodData().isSysMatrixFrozen()) {
+  if ((!getMethodData().isSysMatrixFrozen()) && getMethodData().doComputeJacobian()) {
     // now the contribution to the jacobian matrix is calculated
     _acc[iLSS]->setRowColIndex(0, currState->getLocalID());
     
@@ -218,7 +218,7 @@ void FVMCC_ALETimeRhsCoupling::computeAnalyticalTransMatrix
     rhs(iState, iVar, totalNbEqs) -= dU*resFactor;
   }
 
-  if (!getMethodData().isSysMatrixFrozen()) {
+  if ((!getMethodData().isSysMatrixFrozen()) && getMethodData().doComputeJacobian()) {
     // now the contribution to the jacobian matrix is calculated
     _acc[iLSS]->setRowColIndex(0, currState->getLocalID());
     
@@ -2,10 +2,16 @@
 #include "FVMCC_ComputeRHS.hh"
 #include "Framework/MethodCommandProvider.hh"
 #include "Framework/MeshData.hh"
+#include "Framework/BaseTerm.hh"
+#include "Common/PE.hh"
 #include "MathTools/MatrixInverter.hh"
 #include "FiniteVolume/FVMCC_BC.hh"
 #include "FiniteVolume/DerivativeComputer.hh"
 
+#include <typeinfo>
+#include <boost/thread.hpp>
+#include <boost/bind.hpp>
+
 //////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -42,6 +48,9 @@ FVMCC_ComputeRHS::FVMCC_ComputeRHS(const std::string& name) :
   socket_limiter("limiter"),
   socket_gstates("gstates"),
   socket_nodes("nodes"),
+  socket_cellTime("cellTime", false),
+  _cellTimer(),
+  _cellTime(CFNULL),
   _fluxSplitter(CFNULL),
   _diffusiveFlux(CFNULL),
   _reconstrVar(CFNULL),
@@ -75,7 +84,36 @@ FVMCC_ComputeRHS::FVMCC_ComputeRHS(const std::string& name) :
   _fluxData(CFNULL),
   _tempUnitNormal(),
   _rExtraVars(),
-  _inverter(CFNULL)  
+  _inverter(CFNULL),
+  _faceGeoCache(CFNULL),
+  _cacheIdx(0),
+  _useThreads(false),
+  _faceColoring(),
+  _zeroGrad(),
+  _threadFlux(),
+  _threadDFlux(),
+  _threadCellFlag(),
+  _workers(),
+  _workerMutex(),
+  _taskReady(),
+  _taskDone(),
+  _taskCount(0),
+  _nbBusyWorkers(0),
+  _stopWorkers(false),
+  _taskTRS(0),
+  _taskFaces(CFNULL),
+  _taskFaceIDs(CFNULL),
+  _taskNbFaces(0),
+  _taskChunk(0),
+  _splitPhaseSync(false),
+  _phaseFaces(),
+  _nbPhase1Faces(),
+  _haloCells(),
+  _overlapNodes(),
+  _fluxBatchIsSetup(false),
+  _useFluxBatch(false),
+  _batchFluxSplitter(CFNULL),
+  _faceBatch()
 {
   addConfigOptionsTo(this);
 
@@ -90,13 +128,16 @@ FVMCC_ComputeRHS::FVMCC_ComputeRHS(const std::string& name) :
   
   _useAnalyticalMatrix = true;
   setParameter("useAnalyticalMatrix",&_useAnalyticalMatrix);
+  
+  _fluxBatchSize = 128;
+  setParameter("FluxBatchSize",&_fluxBatchSize);
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
 FVMCC_ComputeRHS::~FVMCC_ComputeRHS()
 {
-  
+  unsetupThreads();
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -108,6 +149,15 @@ void FVMCC_ComputeRHS::unsetup()
     deletePtr(_rExtraVars[i]);
   }
   
+  if (_splitPhaseSync) {
+    SafePtr<MeshData> meshData = MeshDataStack::getActive();
+    meshData->completeStateSync();
+    meshData->setDeferStateSync(false);
+    _splitPhaseSync = false;
+  }
+  
+  unsetupThreads();
+  
   CellCenterFVMCom::unsetup();
 }
 
@@ -126,6 +176,9 @@ void FVMCC_ComputeRHS::defineConfigOptions(Config::OptionList& options)
 
   options.addConfigOption< bool >
     ("useAnalyticalMatrix", "Flag telling if to use analytical matrix."); 
+  
+  options.addConfigOption< CFuint >
+    ("FluxBatchSize", "Number of internal faces per batch if the flux splitter supports batches (0 to disable)."); 
 }
       
 //////////////////////////////////////////////////////////////////////////////
@@ -143,8 +196,61 @@ void FVMCC_ComputeRHS::execute()
  
   CFLog(VERBOSE, "FVMCC_ComputeRHS::execute() START\n");
   
-  initializeComputationRHS();
+  if (!_fluxBatchIsSetup) {
+    setupFluxBatch();
+  }
+  
+  // the time spent in each cell is measured only while it is requested
+  _cellTime = CFNULL;
+  if (socket_cellTime.isConnected()) {
+    DataHandle<CFreal> cellTime = socket_cellTime.getDataHandle();
+    if (cellTime.size() > 0) {
+      _cellTime = &cellTime[0];
+    }
+  }
+  
+  SafePtr<MeshData> meshData = MeshDataStack::getActive();
+  if (_splitPhaseSync && meshData->isStateSyncPending()) {
+    // gradients and nodal values are computed with the old overlap states:
+    // they are exact for all the cells which are not close to the overlap
+    initializeComputationRHS();
+    computeFaces(1);
+    
+    // the overlap states are now up-to-date
+    // only the gradients and the nodal values depending on them are recomputed
+    meshData->completeStateSync();
+    _polyRec->computeGradientsInCells(_haloCells);
+    _nodalExtrapolator->extrapolateInNodes(_overlapNodes);
+    computeFaces(2);
+  }
+  else {
+    meshData->completeStateSync();
+    initializeComputationRHS();
+    computeFaces(0);
+  }
+  
+  finalizeComputationRHS();
+  
   
+  //   const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
+  //   DataHandle<CFreal> rhs = socket_rhs.getDataHandle();
+  //   DataHandle<State*, GLOBAL> states = socket_states.getDataHandle();
+//   for (CFuint iState = 0; iState < states.size(); ++iState) {
+//     for (CFuint iEq = 0; iEq < nbEqs; ++iEq) {
+//       cout.precision(14); cout.setf(ios::scientific,ios::floatfield); cout << rhs(iState, iEq, nbEqs) << " ";
+//     }
+//     cout << endl;
+//   }
+ 
+  CFLog(VERBOSE, "FVMCC_ComputeRHS::execute() END\n");
+  
+  CFTRACEEND;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FVMCC_ComputeRHS::computeFaces(const CFuint phase)
+{
   // set the list of faces
   vector<SafePtr<TopologicalRegionSet> > trs = MeshDataStack::getActive()->getTrsList();
   const CFuint nbTRSs = trs.size();
@@ -176,7 +282,21 @@ void FVMCC_ComputeRHS::execute()
     if (currTrs->getName() != "PartitionFaces" && currTrs->getName() != "InnerCells" && 
 	!binary_search(noBCTRS.begin(), noBCTRS.end(), currTrs->getName())) {
       
-      if (currTrs->hasTag("writable")) {
+      // internal faces are distributed among threads, boundary faces stay serial
+      if (_useThreads && !currTrs->hasTag("writable")) {
+	computeColoredFaces(iTRS, currTrs);
+	_faceIdx += currTrs->getLocalNbGeoEnts();
+	continue;
+      }
+      
+      // the boundary faces depend on the overlap states through the gradients
+      const bool isBTrs = currTrs->hasTag("writable");
+      if (phase == 1 && isBTrs) {
+	_faceIdx += currTrs->getLocalNbGeoEnts();
+	continue;
+      }
+      
+      if (isBTrs) {
 	_currBC = _bcMap.find(iTRS);
 	
 	// set the flag telling if the ghost states have to be placed on the face itself
@@ -199,9 +319,29 @@ void FVMCC_ComputeRHS::execute()
       geoData.faces = currTrs;
       
       const CFuint nbTrsFaces = currTrs->getLocalNbGeoEnts();
-      for (CFuint iFace = 0; iFace < nbTrsFaces; ++iFace, ++_faceIdx) {
+      const CFuint cacheStart = (_faceGeoCache.isNotNull()) ? _faceGeoCache->getTrsStart(iTRS) : 0;
+      const CFuint trsFaceIdx = _faceIdx;
+      
+      // range of faces to process in the current phase
+      const CFuint* phaseFaces = (phase > 0 && !isBTrs && nbTrsFaces > 0) ? &_phaseFaces[iTRS][0] : CFNULL;
+      const CFuint iStart = (phaseFaces != CFNULL && phase == 2) ? _nbPhase1Faces[iTRS] : 0;
+      const CFuint iEnd = (phaseFaces != CFNULL && phase == 1) ? _nbPhase1Faces[iTRS] : nbTrsFaces;
+      
+      if (_useFluxBatch && !isBTrs) {
+	computeBatchedFaces(cacheStart, phaseFaces, iStart, iEnd);
+	_faceIdx = trsFaceIdx + nbTrsFaces;
+	continue;
+      }
+      
+      for (CFuint i = iStart; i < iEnd; ++i) {
+	const CFuint iFace = (phaseFaces != CFNULL) ? phaseFaces[i] : i;
+	_faceIdx = trsFaceIdx + iFace;
         CFLogDebugMed( "iFace = " << iFace << "\n");
 	
+	// faces without updatable neighbors are skipped without being built
+	_cacheIdx = cacheStart + iFace;
+	if (_faceGeoCache.isNotNull() && !_faceGeoCache->isUpdatable(_cacheIdx)) continue;
+	
     	// reset the equation subsystem descriptor
 	PhysicalModelStack::getActive()->resetEquationSubSysDescriptor();
 	
@@ -295,25 +435,9 @@ void FVMCC_ComputeRHS::execute()
 	
 	geoBuilder->releaseGE(); 
       }
+      _faceIdx = trsFaceIdx + nbTrsFaces;
     }
   }
-    
-  finalizeComputationRHS();
-  
-  
-  //   const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
-  //   DataHandle<CFreal> rhs = socket_rhs.getDataHandle();
-  //   DataHandle<State*, GLOBAL> states = socket_states.getDataHandle();
-//   for (CFuint iState = 0; iState < states.size(); ++iState) {
-//     for (CFuint iEq = 0; iEq < nbEqs; ++iEq) {
-//       cout.precision(14); cout.setf(ios::scientific,ios::floatfield); cout << rhs(iState, iEq, nbEqs) << " ";
-//     }
-//     cout << endl;
-//   }
- 
-  CFLog(VERBOSE, "FVMCC_ComputeRHS::execute() END\n");
-  
-  CFTRACEEND;
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -439,11 +563,606 @@ void FVMCC_ComputeRHS::setup()
   CellTrsGeoBuilder::GeoData& cellGeoData = getMethodData().getCellTrsGeoBuilder()->getDataGE();
   cellGeoData.trs = cells;
   
+  _faceGeoCache = CFNULL;
+  if (getMethodData().useFaceGeoCache()) {
+    _faceGeoCache = getMethodData().getFaceGeoCache();
+    _faceGeoCache->build(socket_normals, socket_faceAreas, socket_states, socket_nodes);
+  }
+  
+  setupThreads();
+  setupSplitPhaseSync();
+  
+  // the flux splitter is set up after the commands: batches are set up lazily
+  _fluxBatchIsSetup = false;
+  
   CFLog(VERBOSE, "FVMCC_ComputeRHS::setup() END\n");
 }
       
 //////////////////////////////////////////////////////////////////////////////
 
+void FVMCC_ComputeRHS::setupSplitPhaseSync()
+{
+  _splitPhaseSync = false;
+  _phaseFaces.clear();
+  _nbPhase1Faces.clear();
+  _haloCells.clear();
+  _overlapNodes.clear();
+  
+  if (!getMethodData().useSplitPhaseSync() || !PE::GetPE().IsParallel()) return;
+  
+  // subclasses with their own face loop would not complete the pending synchronization
+  if (_useThreads || typeid(*this) != typeid(FVMCC_ComputeRHS)) {
+    CFLog(INFO, "FVMCC_ComputeRHS::setupSplitPhaseSync() => SplitPhaseSync not available with this command or with NbThreads > 1\n");
+    return;
+  }
+  
+  DataHandle<State*, GLOBAL> states = socket_states.getDataHandle();
+  DataHandle<Node*, GLOBAL> nodes = socket_nodes.getDataHandle();
+  SafePtr<TopologicalRegionSet> cells = MeshDataStack::getActive()->getTrs("InnerCells");
+  const CFuint nbCells = cells->getLocalNbGeoEnts();
+  
+  // flag the nodes of the overlap cells: the gradients and the nodal values
+  // of all the cells sharing one of these nodes depend on the overlap states
+  vector<bool> isOverlapNode(nodes.size(), false);
+  for (CFuint iCell = 0; iCell < nbCells; ++iCell) {
+    if (!states[cells->getStateID(iCell,0)]->isParUpdatable()) {
+      const CFuint nbCellNodes = cells->getNbNodesInGeo(iCell);
+      for (CFuint in = 0; in < nbCellNodes; ++in) {
+	isOverlapNode[cells->getNodeID(iCell, in)] = true;
+      }
+    }
+  }
+  
+  for (CFuint iNode = 0; iNode < nodes.size(); ++iNode) {
+    if (isOverlapNode[iNode]) {
+      _overlapNodes.push_back(nodes[iNode]);
+    }
+  }
+  
+  vector<bool> isHaloCell(states.size(), false);
+  for (CFuint iCell = 0; iCell < nbCells; ++iCell) {
+    const CFuint nbCellNodes = cells->getNbNodesInGeo(iCell);
+    for (CFuint in = 0; in < nbCellNodes; ++in) {
+      if (isOverlapNode[cells->getNodeID(iCell, in)]) {
+	isHaloCell[cells->getStateID(iCell,0)] = true;
+	_haloCells.push_back(cells->getStateID(iCell,0));
+	break;
+      }
+    }
+  }
+  
+  // internal faces between two cells independent from the overlap come first
+  vector<SafePtr<TopologicalRegionSet> > trs = MeshDataStack::getActive()->getTrsList();
+  const CFuint nbTRSs = trs.size();
+  _phaseFaces.resize(nbTRSs);
+  _nbPhase1Faces.resize(nbTRSs, 0);
+  CFuint nbPhase1Faces = 0;
+  CFuint nbFaces = 0;
+  for (CFuint iTRS = 0; iTRS < nbTRSs; ++iTRS) {
+    SafePtr<TopologicalRegionSet> currTrs = trs[iTRS];
+    if (currTrs->getName() == "PartitionFaces" || currTrs->getName() == "InnerCells" ||
+	currTrs->hasTag("writable")) continue;
+    
+    const CFuint nbTrsFaces = currTrs->getLocalNbGeoEnts();
+    vector<CFuint>& faceIDs = _phaseFaces[iTRS];
+    faceIDs.reserve(nbTrsFaces);
+    vector<CFuint> haloFaces;
+    for (CFuint iFace = 0; iFace < nbTrsFaces; ++iFace) {
+      if (isHaloCell[currTrs->getStateID(iFace,0)] || isHaloCell[currTrs->getStateID(iFace,1)]) {
+	haloFaces.push_back(iFace);
+      }
+      else {
+	faceIDs.push_back(iFace);
+      }
+    }
+    _nbPhase1Faces[iTRS] = faceIDs.size();
+    faceIDs.insert(faceIDs.end(), haloFaces.begin(), haloFaces.end());
+    
+    nbPhase1Faces += _nbPhase1Faces[iTRS];
+    nbFaces += nbTrsFaces;
+  }
+  
+  CFLog(VERBOSE, "FVMCC_ComputeRHS::setupSplitPhaseSync() => " << nbPhase1Faces << "/" 
+	<< nbFaces << " internal faces computed while synchronizing\n");
+  
+  _splitPhaseSync = true;
+  MeshDataStack::getActive()->setDeferStateSync(true);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FVMCC_ComputeRHS::setupThreads()
+{
+  const CFuint nbThreads = getMethodData().getNbThreadData();
+  _useThreads = (nbThreads > 1);
+  if (!_useThreads) return;
+  
+  // derived commands (jacobians, single state updates) and source terms rely 
+  // on the serial face ordering (e.g. through the cell flags), while the 
+  // diffusive fluxes and the non reentrant flux splitters modify the data 
+  // shared by the physical model
+  SafePtr<CellCenterFVMData> td0 = getMethodData().getThreadData(0);
+  const FVMCC_FluxSplitter *const fluxSplitter = 
+    dynamic_cast<FVMCC_FluxSplitter*>(&*td0->getFluxSplitter());
+  if (typeid(*this) != typeid(FVMCC_ComputeRHS) || getMethodData().isAxisymmetric() || 
+      getMethodData().hasSourceTerm() || _extrapolateInNodes || 
+      !td0->getDiffusiveFluxComputer()->isNull() || 
+      fluxSplitter == CFNULL || !fluxSplitter->isReentrant()) {
+    CFLog(INFO, "FVMCC_ComputeRHS::setupThreads() => threaded face loop not supported in "
+	  << getName() << ": falling back to serial\n");
+    _useThreads = false;
+    return;
+  }
+  
+  CFLog(INFO, "FVMCC_ComputeRHS::setupThreads() => using " << nbThreads << " threads\n");
+  
+  const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
+  _zeroGrad.assign(nbEqs, false);
+  _threadFlux.resize(nbThreads);
+  _threadDFlux.resize(nbThreads);
+  
+  SafePtr<TopologicalRegionSet> cells = MeshDataStack::getActive()->getTrs("InnerCells");
+  for (CFuint iThread = 0; iThread < nbThreads; ++iThread) {
+    _threadFlux[iThread].resize(nbEqs, 0.);
+    _threadDFlux[iThread].resize(nbEqs, 0.);
+    
+    // each thread works with its own VarSets, transformers and builders
+    SafePtr<CellCenterFVMData> td = getMethodData().getThreadData(iThread);
+    for (CFuint jThread = 0; jThread < iThread; ++jThread) {
+      SafePtr<CellCenterFVMData> tdj = getMethodData().getThreadData(jThread);
+      cf_always_assert(td != tdj);
+      cf_always_assert(td->getUpdateVar() != tdj->getUpdateVar());
+      cf_always_assert(td->getFluxSplitter() != tdj->getFluxSplitter());
+    }
+    td->getSolToUpdateInUpdateMatTrans()->setup(2);
+    td->getUpdateToSolutionVecTrans()->setup(2);
+    td->getSolutionToLinearVecTrans()->setup(2); 
+    td->getUpdateToReconstructionVecTrans()->setup(2);
+    td->getReconstructionToUpdateVecTrans()->setup(2);
+    td->getUpdateToSolutionInUpdateMatTrans()->setup(2);
+    td->getJacobianLinearizer()->setMaxNbStates(2);
+    
+    td->getUpdateVar()->setup();
+    td->getSolutionVar()->setup();
+    td->getDiffusiveVar()->setup();
+    
+    SafePtr<FaceCellTrsGeoBuilder> geoBuilderPtr = td->getFaceCellTrsGeoBuilder()->getGeoBuilder();
+    geoBuilderPtr->setDataSockets(socket_states, socket_gstates, socket_nodes);
+    geoBuilderPtr->setCellFlagSocket(socket_cellFlag);
+    FaceCellTrsGeoBuilder::GeoData& geoData = td->getFaceCellTrsGeoBuilder()->getDataGE();
+    geoData.cells = cells;
+    geoData.isBFace = false;
+  }
+  
+  // colorings are computed lazily the first time each TRS is processed
+  _faceColoring.clear();
+  _faceColoring.resize(MeshDataStack::getActive()->getTrsList().size());
+  
+  // the worker threads wait for the faces of each color until unsetup()
+  unsetupThreads();
+  _stopWorkers = false;
+  _nbBusyWorkers = 0;
+  for (CFuint iThread = 1; iThread < nbThreads; ++iThread) {
+    _workers.push_back(new boost::thread(boost::bind(&FVMCC_ComputeRHS::runWorker, 
+						     this, iThread)));
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FVMCC_ComputeRHS::unsetupThreads()
+{
+  if (_workers.size() == 0) return;
+  
+  {
+    boost::mutex::scoped_lock lock(_workerMutex);
+    _stopWorkers = true;
+  }
+  _taskReady.notify_all();
+  
+  for (CFuint i = 0; i < _workers.size(); ++i) {
+    _workers[i]->join();
+    deletePtr(_workers[i]);
+  }
+  _workers.clear();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FVMCC_ComputeRHS::runWorker(const CFuint iThread)
+{
+  CFuint lastTask = 0;
+  while (true) {
+    {
+      boost::mutex::scoped_lock lock(_workerMutex);
+      while (_taskCount == lastTask && !_stopWorkers) {
+	_taskReady.wait(lock);
+      }
+      if (_stopWorkers) return;
+      lastTask = _taskCount;
+    }
+    
+    computeColorChunk(iThread);
+    
+    boost::mutex::scoped_lock lock(_workerMutex);
+    cf_assert(_nbBusyWorkers > 0);
+    if (--_nbBusyWorkers == 0) {
+      _taskDone.notify_one();
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FVMCC_ComputeRHS::computeColorChunk(const CFuint iThread)
+{
+  const CFuint start = iThread*_taskChunk;
+  if (start < _taskNbFaces) {
+    computeThreadFaces(iThread, _taskTRS, _taskFaces, &_taskFaceIDs[start],
+		       std::min(_taskChunk, _taskNbFaces - start));
+  }
+}
+      
+//////////////////////////////////////////////////////////////////////////////
+
+void FVMCC_ComputeRHS::computeColoredFaces(const CFuint iTRS,
+					   SafePtr<TopologicalRegionSet> faces)
+{
+  cf_assert(iTRS < _faceColoring.size());
+  const CFuint nbTrsFaces = faces->getLocalNbGeoEnts();
+  FaceColoring& coloring = _faceColoring[iTRS];
+  
+  if (coloring.getNbFaces() != nbTrsFaces) {
+    vector<CFuint> leftIDs(nbTrsFaces);
+    vector<CFuint> rightIDs(nbTrsFaces);
+    if (_faceGeoCache.isNotNull()) {
+      const CFuint start = _faceGeoCache->getTrsStart(iTRS);
+      for (CFuint iFace = 0; iFace < nbTrsFaces; ++iFace) {
+	leftIDs[iFace]  = _faceGeoCache->getLeftID(start + iFace);
+	rightIDs[iFace] = _faceGeoCache->getRightID(start + iFace);
+      }
+    }
+    else {
+      for (CFuint iFace = 0; iFace < nbTrsFaces; ++iFace) {
+	leftIDs[iFace]  = faces->getStateID(iFace, 0);
+	rightIDs[iFace] = faces->getStateID(iFace, 1);
+      }
+    }
+    coloring.compute(socket_states.getDataHandle().size(), leftIDs, rightIDs);
+    CFLog(VERBOSE, "FVMCC_ComputeRHS::computeColoredFaces() => " << faces->getName() 
+	  << " has " << coloring.getNbColors() << " colors\n");
+  }
+  
+  PhysicalModelStack::getActive()->resetEquationSubSysDescriptor();
+  
+  const CFuint nbStates = socket_states.getDataHandle().size();
+  if (_threadCellFlag.size() != nbStates) {
+    _threadCellFlag.assign(nbStates, 0);
+  }
+  
+  const CFuint nbThreads = _threadFlux.size();
+  for (CFuint iColor = 0; iColor < coloring.getNbColors(); ++iColor) {
+    const CFuint nbFaces = coloring.getNbFacesInColor(iColor);
+    const CFuint* faceIDs = coloring.getFacesInColor(iColor);
+    const CFuint chunk = nbFaces/nbThreads + ((nbFaces%nbThreads > 0) ? 1 : 0);
+    
+    // faces in the same color don't share any cell: no locking is needed
+    {
+      boost::mutex::scoped_lock lock(_workerMutex);
+      _taskTRS = iTRS;
+      _taskFaces = faces;
+      _taskFaceIDs = faceIDs;
+      _taskNbFaces = nbFaces;
+      _taskChunk = chunk;
+      _nbBusyWorkers = _workers.size();
+      ++_taskCount;
+    }
+    _taskReady.notify_all();
+    
+    // the calling thread processes the first chunk
+    computeColorChunk(0);
+    
+    boost::mutex::scoped_lock lock(_workerMutex);
+    while (_nbBusyWorkers > 0) {
+      _taskDone.wait(lock);
+    }
+  }
+  
+  // the flags of the cells touched by the threads are merged serially
+  DataHandle<bool> cellFlag = socket_cellFlag.getDataHandle();
+  const CFuint nbCells = _threadCellFlag.size();
+  for (CFuint iCell = 0; iCell < nbCells; ++iCell) {
+    if (_threadCellFlag[iCell] != 0) {
+      cellFlag[iCell] = true;
+      _threadCellFlag[iCell] = 0;
+    }
+  }
+}
+      
+//////////////////////////////////////////////////////////////////////////////
+
+void FVMCC_ComputeRHS::computeThreadFaces(const CFuint iThread,
+					  const CFuint iTRS,
+					  SafePtr<TopologicalRegionSet> faces,
+					  const CFuint* faceIDs, 
+					  const CFuint nbFaces)
+{
+  CellCenterFVMData& td = *getMethodData().getThreadData(iThread);
+  
+  SafePtr<GeometricEntityPool<FaceCellTrsGeoBuilder> > geoBuilder = td.getFaceCellTrsGeoBuilder();
+  FaceCellTrsGeoBuilder::GeoData& geoData = geoBuilder->getDataGE();
+  geoData.faces = faces;
+  geoData.isBFace = false;
+  // the shared cell flags are neither read nor written by the threads
+  geoData.allCells = true;
+  
+  SafePtr<FVMCC_PolyRec> polyRec = td.getPolyReconstructor();
+  polyRec->setZeroGradient(&_zeroGrad);
+  
+  SafePtr<ConvectiveVarSet> reconstrVar = (td.reconstructSolVars()) ? 
+    td.getSolutionVar() : td.getUpdateVar();
+  SafePtr<FluxSplitter<CellCenterFVMData> > fluxSplitter = td.getFluxSplitter();
+  SafePtr<ComputeDiffusiveFlux> diffusiveFlux = td.getDiffusiveFluxComputer();
+  SafePtr<DiffusiveVarSet> diffVar = td.getDiffusiveVar();
+  SafePtr<EqFilter> eqFilter = (*td.getEquationFilters())[0].getPtr();
+  
+  DataHandle<CFreal> normals = socket_normals.getDataHandle();
+  DataHandle<CFreal> faceAreas = socket_faceAreas.getDataHandle();
+  DataHandle<CFreal> rhs = socket_rhs.getDataHandle();
+  
+  RealVector& flux = _threadFlux[iThread];
+  RealVector& dFlux = _threadDFlux[iThread];
+  RealVector& unitNormal = td.getUnitNormal();
+  const CFuint nbDim = unitNormal.size();
+  const CFuint nbEqs = flux.size();
+  const CFreal resFactor = getResFactor();
+  
+  const bool useCache = _faceGeoCache.isNotNull();
+  const CFuint cacheStart = (useCache) ? _faceGeoCache->getTrsStart(iTRS) : 0;
+  
+  for (CFuint i = 0; i < nbFaces; ++i) {
+    const CFuint cacheIdx = cacheStart + faceIDs[i];
+    if (useCache && !_faceGeoCache->isUpdatable(cacheIdx)) continue;
+    
+    geoData.idx = faceIDs[i];
+    GeometricEntity *const face = geoBuilder->buildGE();
+    State *const firstState = face->getState(0);
+    State *const lastState = face->getState(1);
+    
+    if (firstState->isParUpdatable() || lastState->isParUpdatable()) {
+      if (useCache) {
+	for (CFuint iDim = 0; iDim < nbDim; ++iDim) {
+	  unitNormal[iDim] = _faceGeoCache->getUnitNormal(cacheIdx, iDim);
+	}
+      }
+      else {
+	const CFuint faceID = face->getID();
+	const CFreal invArea = 1./faceAreas[faceID];
+	for (CFuint iDim = 0; iDim < nbDim; ++iDim) {
+	  unitNormal[iDim] = normals[faceID*nbDim + iDim]*invArea;
+	}
+      }
+      td.getCurrentFace() = face;
+      
+      polyRec->extrapolate(face);
+      
+      vector<State*>& states = polyRec->getExtrapolatedValues();
+      vector<RealVector>& pdata = polyRec->getExtrapolatedPhysicaData();
+      reconstrVar->computePhysicalData(*states[0], pdata[0]);
+      reconstrVar->computePhysicalData(*states[1], pdata[1]);
+      td.setIsPerturb(false);
+      
+      flux = 0.;
+      fluxSplitter->computeFlux(flux);
+      
+      if (_hasDiffusiveTerm && eqFilter->filterOnGeo(face)) {
+	diffVar->setFreezeCoeff(false);
+	dFlux = 0.;
+	diffusiveFlux->computeFlux(dFlux);
+	flux -= dFlux;
+      }
+      
+      const CFuint firstStateID = firstState->getLocalID();
+      const CFuint lastStateID = lastState->getLocalID();
+      for (CFuint iEq = 0; iEq < nbEqs; ++iEq) {
+	const CFreal rFlux = resFactor*flux[iEq];
+	rhs(firstStateID, iEq, nbEqs) -= rFlux;
+	rhs(lastStateID, iEq, nbEqs) += rFlux;
+      }
+      _threadCellFlag[firstStateID] = 1;
+      _threadCellFlag[lastStateID] = 1;
+    }
+    
+    geoBuilder->releaseGE(); 
+  }
+}
+      
+//////////////////////////////////////////////////////////////////////////////
+
+void FVMCC_ComputeRHS::setupFluxBatch()
+{
+  _fluxBatchIsSetup = true;
+  _useFluxBatch = false;
+  _batchFluxSplitter = CFNULL;
+  
+  FVMCC_FluxSplitter *const fs = dynamic_cast<FVMCC_FluxSplitter*>(&(*_fluxSplitter));
+  if (_fluxBatchSize == 0 || fs == CFNULL || !fs->hasFluxBatch()) return;
+  
+  // derived commands (jacobians) and the per-face corrections (source terms, 
+  // axisymmetry, multiple quadrature points) need the single face evaluation
+  if (typeid(*this) != typeid(FVMCC_ComputeRHS) || getMethodData().isAxisymmetric() || 
+      getMethodData().hasSourceTerm() || _polyRec->nbQPoints() != 1 || _useThreads) {
+    CFLog(INFO, "FVMCC_ComputeRHS::setupFluxBatch() => batched fluxes not supported in "
+	  << getName() << ": falling back to single face evaluation\n");
+    return;
+  }
+  
+  const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
+  const CFuint dim = PhysicalModelStack::getActive()->getDim();
+  RealVector pdata;
+  PhysicalModelStack::getActive()->getImplementor()->getConvectiveTerm()->resizePhysicalData(pdata);
+  _faceBatch.resize(_fluxBatchSize, nbEqs, pdata.size(), dim);
+  _batchFluxSplitter = fs;
+  _useFluxBatch = true;
+  
+  CFLog(INFO, "FVMCC_ComputeRHS::setupFluxBatch() => " << fs->getName() 
+	<< " computes the internal fluxes in batches of " << _fluxBatchSize << " faces\n");
+}
+      
+//////////////////////////////////////////////////////////////////////////////
+
+void FVMCC_ComputeRHS::computeBatchedFaces(const CFuint cacheStart,
+					   const CFuint* phaseFaces,
+					   const CFuint iStart,
+					   const CFuint iEnd)
+{
+  SafePtr<GeometricEntityPool<FaceCellTrsGeoBuilder> > geoBuilder = getMethodData().getFaceCellTrsGeoBuilder();
+  FaceCellTrsGeoBuilder::GeoData& geoData = geoBuilder->getDataGE();
+  
+  DataHandle<CFreal> faceAreas = socket_faceAreas.getDataHandle();
+  DataHandle<CFreal> rhs = socket_rhs.getDataHandle();
+  DataHandle<bool> cellFlag = socket_cellFlag.getDataHandle();
+  
+  vector<RealVector>& pdata = _polyRec->getExtrapolatedPhysicaData();
+  const RealVector& unitNormal = getMethodData().getUnitNormal();
+  const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
+  const CFreal resFactor = getResFactor();
+  
+  PhysicalModelStack::getActive()->resetEquationSubSysDescriptor();
+  _faceBatch.clear();
+  
+  // without diffusive fluxes and face limiters, the face is not needed: 
+  // IDs, unit normal, area and face center are all read from the cache
+  if (_faceGeoCache.isNotNull() && !_hasDiffusiveTerm && 
+      _polyRec->canExtrapolateInFaceCenter()) {
+    DataHandle<State*, GLOBAL> states = socket_states.getDataHandle();
+    RealVector& normal = getMethodData().getUnitNormal();
+    const CFuint dim = normal.size();
+    RealVector center(dim);
+    
+    for (CFuint i = iStart; i < iEnd; ++i) {
+      const CFuint iFace = (phaseFaces != CFNULL) ? phaseFaces[i] : i;
+      
+      _cacheIdx = cacheStart + iFace;
+      if (!_faceGeoCache->isUpdatable(_cacheIdx)) continue;
+      
+      const CFuint firstStateID = _faceGeoCache->getLeftID(_cacheIdx);
+      const CFuint lastStateID = _faceGeoCache->getRightID(_cacheIdx);
+      for (CFuint iDim = 0; iDim < dim; ++iDim) {
+	normal[iDim] = _faceGeoCache->getUnitNormal(_cacheIdx, iDim);
+	center[iDim] = _faceGeoCache->getFaceCenter(_cacheIdx, iDim);
+      }
+      
+      _polyRec->extrapolateInFaceCenter(states[firstStateID], states[lastStateID], center);
+      computePhysicalData();
+      getMethodData().setIsPerturb(false);
+      
+      const CFuint idx = _faceBatch.addFace(firstStateID, lastStateID, _faceGeoCache->getArea(_cacheIdx));
+      _faceBatch.setData(0, idx, pdata[0]);
+      _faceBatch.setData(1, idx, pdata[1]);
+      _faceBatch.setNormal(idx, normal);
+      
+      cellFlag[firstStateID] = true;
+      cellFlag[lastStateID] = true;
+      
+      if (_faceBatch.isFull()) {
+	flushFluxBatch();
+      }
+    }
+    
+    flushFluxBatch();
+    return;
+  }
+  
+  for (CFuint i = iStart; i < iEnd; ++i) {
+    const CFuint iFace = (phaseFaces != CFNULL) ? phaseFaces[i] : i;
+    
+    _cacheIdx = cacheStart + iFace;
+    if (_faceGeoCache.isNotNull() && !_faceGeoCache->isUpdatable(_cacheIdx)) continue;
+    
+    geoData.idx = iFace;
+    _currFace = geoBuilder->buildGE();
+    State *const firstState = _currFace->getState(0);
+    State *const lastState = _currFace->getState(1);
+    
+    if (firstState->isParUpdatable() || lastState->isParUpdatable()) {
+      setFaceIntegratorData();
+      _polyRec->extrapolate(_currFace);
+      computePhysicalData();
+      getMethodData().setIsPerturb(false);
+      
+      // the convective flux is computed later together with the other faces of the batch
+      const CFuint firstStateID = firstState->getLocalID();
+      const CFuint lastStateID = lastState->getLocalID();
+      const CFuint idx = _faceBatch.addFace(firstStateID, lastStateID, faceAreas[_currFace->getID()]);
+      _faceBatch.setData(0, idx, pdata[0]);
+      _faceBatch.setData(1, idx, pdata[1]);
+      _faceBatch.setNormal(idx, unitNormal);
+      
+      _isDiffusionActive = (*_eqFilters)[0]->filterOnGeo(_currFace);
+      if (_hasDiffusiveTerm && _isDiffusionActive) {
+	_diffVar->setFreezeCoeff(false);
+	if (_extrapolateInNodes) {
+	  _nodalExtrapolator->extrapolateInNodes(*_currFace->getNodes());
+	}
+	
+	_dFlux = 0.;
+	_diffusiveFlux->computeFlux(_dFlux);
+	for (CFuint iEq = 0; iEq < nbEqs; ++iEq) {
+	  const CFreal rFlux = resFactor*_dFlux[iEq];
+	  rhs(firstStateID, iEq, nbEqs) += rFlux;
+	  rhs(lastStateID, iEq, nbEqs) -= rFlux;
+	}
+      }
+      cellFlag[firstStateID] = true;
+      cellFlag[lastStateID] = true;
+    }
+    
+    geoBuilder->releaseGE();
+    
+    if (_faceBatch.isFull()) {
+      flushFluxBatch();
+    }
+  }
+  
+  flushFluxBatch();
+}
+      
+//////////////////////////////////////////////////////////////////////////////
+
+void FVMCC_ComputeRHS::flushFluxBatch()
+{
+  const CFuint nbFaces = _faceBatch.size();
+  if (nbFaces == 0) return;
+  
+  _batchFluxSplitter->computeFluxBatch(_faceBatch);
+  
+  DataHandle<CFreal> rhs = socket_rhs.getDataHandle();
+  DataHandle<CFreal> updateCoeff = socket_updateCoeff.getDataHandle();
+  const CFuint nbEqs = _faceBatch.getNbEqs();
+  const CFreal resFactor = getResFactor();
+  const CFreal *const leftUpdateCoeff = _faceBatch.getUpdateCoeff(0);
+  const CFreal *const rightUpdateCoeff = _faceBatch.getUpdateCoeff(1);
+  
+  for (CFuint iEq = 0; iEq < nbEqs; ++iEq) {
+    const CFreal *const flux = _faceBatch.getFlux(iEq);
+    for (CFuint i = 0; i < nbFaces; ++i) {
+      const CFreal rFlux = resFactor*flux[i];
+      rhs(_faceBatch.getStateID(0,i), iEq, nbEqs) -= rFlux;
+      rhs(_faceBatch.getStateID(1,i), iEq, nbEqs) += rFlux;
+    }
+  }
+  
+  for (CFuint i = 0; i < nbFaces; ++i) {
+    updateCoeff[_faceBatch.getStateID(0,i)] += leftUpdateCoeff[i];
+    updateCoeff[_faceBatch.getStateID(1,i)] += rightUpdateCoeff[i];
+  }
+  
+  _faceBatch.clear();
+}
+      
+//////////////////////////////////////////////////////////////////////////////
+
 void FVMCC_ComputeRHS::updateRHS()
 {
   if (getMethodData().isAxisymmetric()) {
@@ -516,6 +1235,17 @@ void FVMCC_ComputeRHS::setFaceIntegratorData()
   
   RealVector& unitNormal = getMethodData().getUnitNormal();
   const CFuint nbDim = unitNormal.size();
+  
+  // derived commands may process faces in a different order than the cache
+  if (_faceGeoCache.isNotNull() && _cacheIdx < _faceGeoCache->getNbFaces() &&
+      _faceGeoCache->getFaceID(_cacheIdx) == _currFace->getID()) {
+    for (CFuint i = 0; i < nbDim; ++i) {
+      unitNormal[i] = _faceGeoCache->getUnitNormal(_cacheIdx, i);
+    }
+    getMethodData().getCurrentFace() = _currFace;
+    return;
+  }
+  
   const CFuint startID = _currFace->getID()*nbDim;
   const CFreal invArea = 1./socket_faceAreas.getDataHandle()[_currFace->getID()];
   for (CFuint i = 0; i < nbDim; ++i) {
@@ -549,6 +1279,8 @@ void FVMCC_ComputeRHS::computeSourceTerm()
     if (cellFlag[cellID] ){ 
       continue;
     }
+    
+    if (_cellTime != CFNULL) {_cellTimer.restart();}
 
     GeometricEntity *const currCell = _currFace->getNeighborGeo(iCell);
     CFreal invR = 1.0;
@@ -586,6 +1318,10 @@ void FVMCC_ComputeRHS::computeSourceTerm()
       cellFlag[cellID] = true;
       _sourceJacobOnCell[iCell]= true;
     }
+    
+    if (_cellTime != CFNULL) {
+      _cellTime[cellID] += _cellTimer.read();
+    }
   }
   
   CFTRACEEND;
@@ -727,6 +1463,7 @@ vector<SafePtr<BaseDataSocketSink> > FVMCC_ComputeRHS::needsSockets()
   result.push_back(&socket_limiter);
   result.push_back(&socket_gstates);
   result.push_back(&socket_nodes);
+  result.push_back(&socket_cellTime);
   
   return result;
 }
@@ -743,6 +1480,16 @@ void FVMCC_ComputeRHS::initializeComputationRHS()
     (*_eqFilters)[i]->reset();
   }  
   
+  if (_useThreads) {
+    for (CFuint iThread = 0; iThread < _threadFlux.size(); ++iThread) {
+      SafePtr<vector<SelfRegistPtr<EqFilter> > > eqFilters = 
+	getMethodData().getThreadData(iThread)->getEquationFilters();
+      for (CFuint i = 0; i < eqFilters->size(); ++i) {
+	(*eqFilters)[i]->reset();
+      }
+    }
+  }
+  
   // _polyRec->updateWeights();
   _polyRec->computeGradients();
   
@@ -4,9 +4,17 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "CellCenterFVMData.hh"
+#include "Common/Stopwatch.hh"
 #include "Framework/DataSocketSink.hh"
 #include "ComputeDiffusiveFlux.hh"
 #include "FVMCC_PolyRec.hh"
+#include "FaceColoring.hh"
+#include "FaceBatch.hh"
+#include "FVMCC_FluxSplitter.hh"
+
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -207,6 +215,88 @@ protected:
   /// Compute the transformation matrix dP/dU numerically
   RealMatrix& computeNumericalTransMatrix(Framework::State& state);
   
+  /**
+   * Set up the per-thread method data, decide if the internal faces can be
+   * processed by multiple threads and start the worker threads.
+   * Each thread only works with its own method data (VarSets, transformers,
+   * flux splitter, reconstructor and geometry builder), which is why the
+   * threads are only used if the flux splitter is reentrant and there is
+   * no diffusive flux
+   */
+  void setupThreads();
+  
+  /**
+   * Stop and join the worker threads
+   */
+  void unsetupThreads();
+  
+  /**
+   * Loop of a worker thread, waiting for the faces of each color
+   * @param iThread index of the thread (and of its method data)
+   */
+  void runWorker(const CFuint iThread);
+  
+  /**
+   * Compute the chunk of the faces of the current color given to a thread
+   */
+  void computeColorChunk(const CFuint iThread);
+  
+  /**
+   * Compute the fluxes of the internal faces of the given TRS color by color,
+   * distributing the faces of each color among the threads
+   * @param iTRS  index of the TRS in the TRS list
+   * @param faces TRS to process
+   */
+  void computeColoredFaces(const CFuint iTRS,
+			   Common::SafePtr<Framework::TopologicalRegionSet> faces);
+  
+  /**
+   * Split the faces of each TRS into the ones which do not depend on the
+   * overlap states (processed while their synchronization is pending) and
+   * the remaining ones
+   */
+  void setupSplitPhaseSync();
+  
+  /**
+   * Compute the fluxes of the faces and add them to the RHS
+   * @param phase 0 for all faces, 1 for the faces independent from the
+   *              overlap states, 2 for the remaining ones
+   */
+  void computeFaces(const CFuint phase);
+  
+  /**
+   * Compute the fluxes of a range of internal faces with the data of
+   * the given thread and add them to the RHS
+   * @pre the faces are all of the same color
+   */
+  void computeThreadFaces(const CFuint iThread,
+			  const CFuint iTRS,
+			  Common::SafePtr<Framework::TopologicalRegionSet> faces,
+			  const CFuint* faceIDs, const CFuint nbFaces);
+  
+  /**
+   * Decide if the convective fluxes of the internal faces can be computed
+   * in batches by the flux splitter
+   */
+  void setupFluxBatch();
+  
+  /**
+   * Compute the fluxes of a range of internal faces of the current TRS,
+   * gathering the face data in batches for the convective flux evaluation
+   * @param cacheStart  start of the TRS inside the face geometry cache
+   * @param phaseFaces  ordering of the faces (CFNULL for the natural one)
+   * @param iStart      first face to process
+   * @param iEnd        end of the range of faces to process
+   */
+  void computeBatchedFaces(const CFuint cacheStart, const CFuint* phaseFaces,
+			   const CFuint iStart, const CFuint iEnd);
+  
+  /**
+   * Compute the convective fluxes of the current batch of faces and add
+   * them to the RHS and to the update coefficients
+   */
+  void flushFluxBatch();
+  
 protected:
   
   /// flags for cells
@@ -245,6 +335,17 @@ protected:
   /// storage of the nodes
   Framework::DataSocketSink < Framework::Node* , Framework::GLOBAL > socket_nodes;
   
+  /// storage of the time spent in the source terms of each cell
+  /// (optional, only filled while a cell cost monitor needs it)
+  Framework::DataSocketSink<CFreal> socket_cellTime;
+  
+  /// timer for the source terms of each cell
+  Common::Stopwatch<Common::WallTime> _cellTimer;
+  
+  /// time spent in the source terms of each cell, CFNULL if it is not measured
+  /// (set at each execute(), since the storage is resized by its owner)
+  CFreal* _cellTime;
+  
   /// flux splitter
   Common::SafePtr<Framework::FluxSplitter<CellCenterFVMData> > _fluxSplitter;  
   /// diffusive flux computer
@@ -365,6 +466,97 @@ protected:
   /// flag telling if to use analytical transformation matrix
   bool _useAnalyticalMatrix;
   
+  /// face geometry cache (CFNULL if not used)
+  Common::SafePtr<FaceGeoCache> _faceGeoCache;
+  
+  /// index of the current face inside the face geometry cache
+  CFuint _cacheIdx;
+  
+  /// flag telling if the internal faces are processed by multiple threads
+  bool _useThreads;
+  
+  /// face coloring for each TRS (only filled for the threaded TRSs)
+  std::vector<FaceColoring> _faceColoring;
+  
+  /// zero gradient flags for internal faces
+  std::vector<bool> _zeroGrad;
+  
+  /// temporary fluxes for each thread
+  std::vector<RealVector> _threadFlux;
+  
+  /// temporary diffusive fluxes for each thread
+  std::vector<RealVector> _threadDFlux;
+  
+  /// cell flags set by the threads, one byte per cell since the faces of 
+  /// one color are processed concurrently (merged into socket_cellFlag)
+  std::vector<char> _threadCellFlag;
+  
+  /// worker threads, living from setup() to unsetup() (the calling thread is the first one)
+  std::vector<boost::thread*> _workers;
+  
+  /// mutex protecting the task given to the worker threads
+  boost::mutex _workerMutex;
+  
+  /// condition signaling a new task to the worker threads
+  boost::condition_variable _taskReady;
+  
+  /// condition signaling the end of the task to the calling thread
+  boost::condition_variable _taskDone;
+  
+  /// counter of the tasks given to the worker threads
+  CFuint _taskCount;
+  
+  /// number of worker threads still processing the current task
+  CFuint _nbBusyWorkers;
+  
+  /// flag telling the worker threads to stop
+  bool _stopWorkers;
+  
+  /// index of the TRS of the current task
+  CFuint _taskTRS;
+  
+  /// TRS of the current task
+  Common::SafePtr<Framework::TopologicalRegionSet> _taskFaces;
+  
+  /// local IDs of the faces of the current color
+  const CFuint* _taskFaceIDs;
+  
+  /// number of faces of the current color
+  CFuint _taskNbFaces;
+  
+  /// number of faces given to each thread
+  CFuint _taskChunk;
+  
+  /// flag telling if the state synchronization is overlapped with the face loop
+  bool _splitPhaseSync;
+  
+  /// for each TRS, local face IDs with the faces independent from the overlap states first
+  std::vector<std::vector<CFuint> > _phaseFaces;
+  
+  /// for each TRS, number of faces independent from the overlap states
+  std::vector<CFuint> _nbPhase1Faces;
+  
+  /// cells whose gradients depend on the overlap states
+  std::vector<CFuint> _haloCells;
+  
+  /// nodes whose nodal values depend on the overlap states
+  std::vector<Framework::Node*> _overlapNodes;
+  
+  /// maximum number of faces per batch of convective fluxes (0 to disable)
+  CFuint _fluxBatchSize;
+  
+  /// flag telling if setupFluxBatch() has been called after the last setup
+  bool _fluxBatchIsSetup;
+  
+  /// flag telling if the convective fluxes of internal faces are computed in batches
+  bool _useFluxBatch;
+  
+  /// flux splitter computing batches of fluxes
+  Common::SafePtr<FVMCC_FluxSplitter> _batchFluxSplitter;
+  
+  /// SoA storage of the current batch of faces
+  FaceBatch _faceBatch;
+  
 }; // class FVMCC_ComputeRHS
 
 //////////////////////////////////////////////////////////////////////////////
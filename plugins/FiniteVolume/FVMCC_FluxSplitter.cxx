@@ -1,3 +1,4 @@
+#include "Common/NotImplementedException.hh"
 #include "Framework/MethodStrategyProvider.hh"
 #include "Framework/SubSystemStatus.hh"
 
@@ -123,6 +124,14 @@ void FVMCC_FluxSplitter::computeFlux(RealVector& result)
   }
 }
       
+//////////////////////////////////////////////////////////////////////////////
+
+void FVMCC_FluxSplitter::computeFluxBatch(FaceBatch& batch)
+{
+  throw Common::NotImplementedException
+    (FromHere(), "FVMCC_FluxSplitter::computeFluxBatch() not implemented in " + getName());
+}
+
 //////////////////////////////////////////////////////////////////////////////
  
 void FVMCC_FluxSplitter::configure ( Config::ConfigArgs& args )
@@ -8,6 +8,7 @@
 #include "Framework/VectorialFunction.hh"
 
 #include "FiniteVolume/CellCenterFVMData.hh"
+#include "FiniteVolume/FaceBatch.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -64,7 +65,44 @@ public:
    * Compute the flux in the current face
    */
   virtual void computeFlux(RealVector& result);
-  
+
+  /**
+   * Compute the flux per unit area in the current face from the extrapolated
+   * values and physical data already stored in the PolyReconstructor.
+   * No mesh data is accessed if the method data is flagged as perturbing
+   * (used by the flux splitter benchmark)
+   */
+  void computeUnitFlux(RealVector& result)
+  {
+    compute(result);
+  }
+
+  /**
+   * Tells if the fluxes of a batch of internal faces can be computed at once
+   * with computeFluxBatch() (only meaningful after setup())
+   */
+  virtual bool hasFluxBatch() const
+  {
+    return false;
+  }
+
+  /**
+   * Compute the fluxes integrated over the face areas and the update
+   * coefficient contributions of a batch of internal faces
+   */
+  virtual void computeFluxBatch(FaceBatch& batch);
+
+  /**
+   * Tells if the flux can be computed concurrently by several instances,
+   * each one configured in its own method data, i.e. if it only modifies
+   * its own members and the ones of its own VarSets (and not, for
+   * instance, the physical data shared by the physical model)
+   */
+  virtual bool isReentrant() const
+  {
+    return false;
+  }
+
 protected:
   
   /**
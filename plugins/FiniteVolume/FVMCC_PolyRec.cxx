@@ -4,6 +4,8 @@
 #include "Framework/BaseTerm.hh"
 #include "FiniteVolume/CellCenterFVMData.hh"
 
+#include <limits>
+
 //////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -39,7 +41,9 @@ FVMCC_PolyRec::FVMCC_PolyRec(const std::string& name) :
   _quadPointCoord(),
   _tmpLimiter(), 
   _gradientCoeff(),
-  _vFunction()
+  _vFunction(),
+  _edgeCellIDs(),
+  _cellEdges()
 {
   addConfigOptionsTo(this);
   
@@ -88,6 +92,42 @@ void FVMCC_PolyRec::setup()
       
 //////////////////////////////////////////////////////////////////////////////
       
+void FVMCC_PolyRec::setupCellEdges(const vector<CFuint>& cellIDs,
+				   DataHandle<vector<State*> > stencil)
+{
+  if (cellIDs == _edgeCellIDs && _cellEdges.size() > 0) return;
+  
+  _edgeCellIDs = cellIDs;
+  _cellEdges.clear();
+  
+  const CFuint nbStates = stencil.size();
+  vector<bool> isEdgeCell(nbStates, false);
+  for (CFuint i = 0; i < cellIDs.size(); ++i) {
+    isEdgeCell[cellIDs[i]] = true;
+  }
+  
+  // the edges are numbered as in the loops of computeGradients()
+  CFuint iEdge = 0;
+  for (CFuint iState = 0; iState < nbStates; ++iState) {
+    const CFuint stencilSize = stencil[iState].size();
+    for (CFuint in = 0; in < stencilSize; ++in) {
+      const State* const last = stencil[iState][in];
+      const CFuint lastID = (!last->isGhost()) ? last->getLocalID() : 
+	numeric_limits<CFuint>::max();
+      if (lastID > iState) {
+	if (isEdgeCell[iState] || (!last->isGhost() && isEdgeCell[lastID])) {
+	  _cellEdges.push_back(iState);
+	  _cellEdges.push_back(in);
+	  _cellEdges.push_back(iEdge);
+	}
+	++iEdge;
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 void FVMCC_PolyRec::prepareReconstruction()
 {
   // special treatment if input vars is "i"  (= iteration number)
@@ -171,6 +211,24 @@ void FVMCC_PolyRec::baseExtrapolateImpl(GeometricEntity* const face)
 
 //////////////////////////////////////////////////////////////////////////////
 
+void FVMCC_PolyRec::baseExtrapolateInFaceCenter(State *const left,
+						State *const right,
+						const RealVector& center)
+{
+  setIsBoundaryFace(false);
+  
+  Node& faceMidCoord = *_extrapCoord[0];
+  faceMidCoord = center;
+  
+  getValues(0).setSpaceCoordinates(&faceMidCoord);
+  getValues(1).setSpaceCoordinates(&faceMidCoord);
+  
+  getValues(0).setLocalID(left->getLocalID());
+  getValues(1).setLocalID(right->getLocalID());
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 void FVMCC_PolyRec::allocateReconstructionData()
 {
   // this data allocation is ok for 1st and 2nd order FV method 
@@ -71,6 +71,17 @@ public:
    */
   virtual void computeGradients() = 0;
   
+  /**
+   * Compute the gradients in the given cells only, the states of the other
+   * cells being unchanged since the last call to computeGradients().
+   * By default, all the gradients are recomputed
+   * @param cellIDs local IDs of the cells
+   */
+  virtual void computeGradientsInCells(const std::vector<CFuint>& cellIDs)
+  {
+    computeGradients();
+  }
+  
   /// Get the current left state
   Framework::State& getCurrLeftState()
   {
@@ -88,6 +99,27 @@ public:
    */
   CFuint nbQPoints() const {return 1;}
   
+  /**
+   * Tell if extrapolateInFaceCenter() can replace extrapolate() on the 
+   * internal faces, i.e. if the reconstruction only needs the two cell 
+   * states and the face center (no limiter to compute on the face)
+   */
+  virtual bool canExtrapolateInFaceCenter() const {return false;}
+  
+  /**
+   * Extrapolate the solution in the center of an internal face without
+   * building the face, if canExtrapolateInFaceCenter() is true
+   * @param left    state of the left cell
+   * @param right   state of the right cell
+   * @param center  coordinates of the face center
+   */
+  virtual void extrapolateInFaceCenter(Framework::State *const left,
+				       Framework::State *const right,
+				       const RealVector& center)
+  {
+    cf_assert(false);
+  }
+  
   /// Get the Geometric Shape Functions at current quadrature point
   const RealVector& getCurrentGeoShapeFunction(Framework::GeometricEntity *const face);
   
@@ -120,11 +152,30 @@ protected: // helper functions
   /// Allocate reconstruction data needed for the flux evaluation
   virtual void allocateReconstructionData();
   
+  /**
+   * Collect the edges of the given stencils touching the given cells, 
+   * unless they have already been collected for the same cells
+   * @param cellIDs local IDs of the cells
+   * @param stencil stencil of each cell, where an edge between two cells
+   *                appears only in the stencil of the cell with the lowest ID
+   * @post _cellEdges stores for each edge the ID of its first cell, the index
+   *       of its second cell in the stencil of the first one and its ID
+   */
+  void setupCellEdges(const std::vector<CFuint>& cellIDs, 
+		      Framework::DataHandle<std::vector<Framework::State*> > stencil);
+  
   /**
    * Extrapolate the solution in the face quadrature points
    */
   void baseExtrapolateImpl(Framework::GeometricEntity* const face);
   
+  /**
+   * Set the quadrature point of an internal face from its center
+   */
+  void baseExtrapolateInFaceCenter(Framework::State *const left,
+				   Framework::State *const right,
+				   const RealVector& center);
+  
   /**
    * Constantly extrapolate the solution in the face quadrature points
    * This ensures a default exrapolation
@@ -190,6 +241,12 @@ protected:
   /// a vector of string to hold the functions
   std::vector<std::string> _vars;
   
+  /// cells whose edges are stored in _cellEdges
+  std::vector<CFuint> _edgeCellIDs;
+  
+  /// edges touching the cells in _edgeCellIDs (3 entries per edge)
+  std::vector<CFuint> _cellEdges;
+  
 }; // end of class FVMCC_PolyRec
 
 //////////////////////////////////////////////////////////////////////////////
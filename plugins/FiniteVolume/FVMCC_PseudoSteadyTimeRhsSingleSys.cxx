@@ -73,31 +73,33 @@ void FVMCC_PseudoSteadyTimeRhsSingleSys::execute()
     }
   }
 
-  // add the diagonal entries in the jacobian (updateCoeff/CFL)
-  for (CFuint iState = 0; iState < nbStates; ++iState) {
-
-    if (states[iState]->isParUpdatable()) {
-      if (!_useGlobalDT) {
-	_diagValue = (dt > 0.0) ? volumes[iState]/dt :
-	  updateCoeff[iState*nbLSS + iLSS]/cfl;
-      }
-      else {
-	_diagValue = volumes[iState]/(minDt*cfl);
-      }
+  if (getMethodData().doComputeJacobian()) {
+    // add the diagonal entries in the jacobian (updateCoeff/CFL)
+    for (CFuint iState = 0; iState < nbStates; ++iState) {
 
-      if (!_useAnalyticalMatrix) {
-	// compute the transformation matrix numerically
-	computeNumericalTransMatrix(iState, iLSS);
+      if (states[iState]->isParUpdatable()) {
+	if (!_useGlobalDT) {
+	  _diagValue = (dt > 0.0) ? volumes[iState]/dt :
+	    updateCoeff[iState*nbLSS + iLSS]/cfl;
+	}
+	else {
+	  _diagValue = volumes[iState]/(minDt*cfl);
+	}
+
+	if (!_useAnalyticalMatrix) {
+	  // compute the transformation matrix numerically
+	  computeNumericalTransMatrix(iState, iLSS);
+	}
+	else {
+	  computeAnalyticalTransMatrix(iState, iLSS);
+	}
+
+	// add the values in the jacobian matrix
+	_jacobMatrix[iLSS]->addValues(*_acc[iLSS]);
+
+	// reset to zero the entries in the block accumulator
+	_acc[iLSS]->reset();
       }
-      else {
-	computeAnalyticalTransMatrix(iState, iLSS);
-      }
-
-      // add the values in the jacobian matrix
-      _jacobMatrix[iLSS]->addValues(*_acc[iLSS]);
-
-      // reset to zero the entries in the block accumulator
-      _acc[iLSS]->reset();
     }
   }
 }
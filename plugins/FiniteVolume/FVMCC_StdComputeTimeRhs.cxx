@@ -96,17 +96,19 @@ void FVMCC_StdComputeTimeRhs::execute()
   const LSSIdxMapping& idxMapping =
     getMethodData().getLinearSystemSolver()[0]->getLocalToGlobalMapping();
 
-  // add the diagonal entries in the jacobian (updateCoeff/CFL)
-  for (CFuint iState = 0; iState < nbStates; ++iState) {
-    if (states[iState]->isParUpdatable()) {
-
-      const CFreal diagValue = updateCoeff[iState]/cfl;
-      //CFuint globalID = states[iState]->getGlobalID()*nbEqs;
-      CFuint globalID = idxMapping.getColID
-	(states[iState]->getLocalID())*nbEqs;
-
-      for (CFuint iEq = 0; iEq < nbEqs; ++iEq, ++globalID) {
-	jacobMatrix->addValue(globalID, globalID, diagValue);
+  if (getMethodData().doComputeJacobian()) {
+    // add the diagonal entries in the jacobian (updateCoeff/CFL)
+    for (CFuint iState = 0; iState < nbStates; ++iState) {
+      if (states[iState]->isParUpdatable()) {
+
+	const CFreal diagValue = updateCoeff[iState]/cfl;
+	//CFuint globalID = states[iState]->getGlobalID()*nbEqs;
+	CFuint globalID = idxMapping.getColID
+	  (states[iState]->getLocalID())*nbEqs;
+
+	for (CFuint iEq = 0; iEq < nbEqs; ++iEq, ++globalID) {
+	  jacobMatrix->addValue(globalID, globalID, diagValue);
+	}
       }
     }
   }
@@ -123,19 +123,21 @@ void FVMCC_StdComputeTimeRhsCoupling::execute()
   const CFreal cfl = getMethodData().getCFL()->getCFLValue();
   const CFuint nbLSS = _lss.size();
 
-  // add the diagonal entries in the jacobian (updateCoeff/CFL)
-  for (CFuint iState = 0; iState < nbStates; ++iState) {
-    if (states[iState]->isParUpdatable()) {
-
-      // loop over the LSSs
-      for (CFuint iLSS = 0; iLSS < nbLSS; ++iLSS) {
-	const CFuint nbSysEqs = _equations[iLSS]->size();
-	const CFreal diagValue = updateCoeff[iState*nbLSS + iLSS]/cfl;
-	CFuint globalID = _idxMapping[iLSS]->getColID
-	  (states[iState]->getLocalID())*nbSysEqs;
-
-	for (CFuint iEq = 0; iEq < nbSysEqs; ++iEq, ++globalID) {
-	  _jacobMatrix[iLSS]->addValue(globalID, globalID, diagValue);
+  if (getMethodData().doComputeJacobian()) {
+    // add the diagonal entries in the jacobian (updateCoeff/CFL)
+    for (CFuint iState = 0; iState < nbStates; ++iState) {
+      if (states[iState]->isParUpdatable()) {
+
+	// loop over the LSSs
+	for (CFuint iLSS = 0; iLSS < nbLSS; ++iLSS) {
+	  const CFuint nbSysEqs = _equations[iLSS]->size();
+	  const CFreal diagValue = updateCoeff[iState*nbLSS + iLSS]/cfl;
+	  CFuint globalID = _idxMapping[iLSS]->getColID
+	    (states[iState]->getLocalID())*nbSysEqs;
+
+	  for (CFuint iEq = 0; iEq < nbSysEqs; ++iEq, ++globalID) {
+	    _jacobMatrix[iLSS]->addValue(globalID, globalID, diagValue);
+	  }
 	}
       }
     }
@@ -0,0 +1,91 @@
+#include "FiniteVolume/FaceBatch.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace FiniteVolume {
+
+//////////////////////////////////////////////////////////////////////////////
+
+FaceBatch::FaceBatch() :
+  m_capacity(0),
+  m_storageSize(0),
+  m_nbFaces(0),
+  m_nbEqs(0),
+  m_dataSize(0),
+  m_dim(0),
+  m_normals(),
+  m_areas(),
+  m_fluxes(),
+  m_updateCoeff(),
+  m_stateIDs()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+FaceBatch::~FaceBatch()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FaceBatch::resize(const CFuint capacity, const CFuint nbEqs,
+		       const CFuint dataSize, const CFuint dim)
+{
+  cf_assert(capacity > 0);
+
+  m_capacity = capacity;
+  m_storageSize = (capacity + BLOCK_SIZE - 1) & ~(BLOCK_SIZE - 1);
+  m_nbFaces = 0;
+  m_nbEqs = nbEqs;
+  m_dataSize = dataSize;
+  m_dim = dim;
+
+  const CFuint size = m_storageSize;
+  m_data[0].assign(dataSize*size, 0.);
+  m_data[1].assign(dataSize*size, 0.);
+  m_normals.assign(dim*size, 0.);
+  m_areas.assign(size, 0.);
+  m_fluxes.assign(nbEqs*size, 0.);
+  m_updateCoeff.assign(2*size, 0.);
+  m_stateIDs.assign(2*size, 0);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FaceBatch::pad()
+{
+  if (m_nbFaces == 0) return;
+
+  const CFuint last = m_nbFaces - 1;
+  const CFuint end = getPaddedSize();
+  for (CFuint idx = m_nbFaces; idx < end; ++idx) {
+    for (CFuint side = 0; side < 2; ++side) {
+      for (CFuint iVar = 0; iVar < m_dataSize; ++iVar) {
+	m_data[side][iVar*m_storageSize + idx] = m_data[side][iVar*m_storageSize + last];
+      }
+    }
+    for (CFuint iDim = 0; iDim < m_dim; ++iDim) {
+      m_normals[iDim*m_storageSize + idx] = m_normals[iDim*m_storageSize + last];
+    }
+    m_areas[idx] = m_areas[last];
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace FiniteVolume
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
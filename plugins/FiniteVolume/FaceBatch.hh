@@ -0,0 +1,221 @@
+#ifndef COOLFluiD_Numerics_FiniteVolume_FaceBatch_hh
+#define COOLFluiD_Numerics_FiniteVolume_FaceBatch_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "Common/COOLFluiD.hh"
+#include "MathTools/RealVector.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace FiniteVolume {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class stores the data of a batch of internal faces in SoA layout
+ * (one contiguous array per variable, indexed by the position of the face
+ * in the batch): the left and right physical data, the unit normals and
+ * the face areas as input, the integrated fluxes and the update coefficient
+ * contributions of the left and right cells as output.
+ * This allows flux splitters to process many faces in a single loop which
+ * the compiler can vectorize. The storage is padded to a multiple of
+ * BLOCK_SIZE faces, so that such loops can run over whole blocks (see pad()).
+ *
+ * @author Andrea Lani
+ *
+ */
+class FaceBatch {
+public:
+
+  /// the padded number of faces is a multiple of this
+  static const CFuint BLOCK_SIZE = 4;
+
+  /**
+   * Constructor
+   */
+  FaceBatch();
+
+  /**
+   * Destructor
+   */
+  ~FaceBatch();
+
+  /**
+   * Allocate the storage
+   * @param capacity  maximum number of faces in the batch
+   * @param nbEqs     number of equations
+   * @param dataSize  size of the physical data of each side
+   * @param dim       number of dimensions
+   */
+  void resize(const CFuint capacity, const CFuint nbEqs,
+	      const CFuint dataSize, const CFuint dim);
+
+  /// remove all the faces from the batch
+  void clear() {m_nbFaces = 0;}
+
+  /// get the number of faces in the batch
+  CFuint size() const {return m_nbFaces;}
+
+  /// get the maximum number of faces in the batch
+  CFuint getCapacity() const {return m_capacity;}
+
+  /// get the distance between two consecutive data, normal or flux arrays
+  CFuint getStride() const {return m_storageSize;}
+
+  /// get the number of faces rounded up to a multiple of BLOCK_SIZE
+  CFuint getPaddedSize() const {return (m_nbFaces + BLOCK_SIZE - 1) & ~(BLOCK_SIZE - 1);}
+
+  /**
+   * Copy the input data of the last face into the padding faces, up to
+   * getPaddedSize(), so that kernels can process them without producing
+   * floating point exceptions (their results are ignored)
+   */
+  void pad();
+
+  /// tells if no more faces can be added
+  bool isFull() const {return m_nbFaces == m_capacity;}
+
+  /// get the number of equations
+  CFuint getNbEqs() const {return m_nbEqs;}
+
+  /// get the size of the physical data of each side
+  CFuint getDataSize() const {return m_dataSize;}
+
+  /// get the number of dimensions
+  CFuint getDim() const {return m_dim;}
+
+  /**
+   * Add a face to the batch
+   * @param leftID   local ID of the left state
+   * @param rightID  local ID of the right state
+   * @param area     face area
+   * @return the position of the face inside the batch
+   */
+  CFuint addFace(const CFuint leftID, const CFuint rightID, const CFreal area)
+  {
+    cf_assert(m_nbFaces < m_capacity);
+    const CFuint idx = m_nbFaces++;
+    m_stateIDs[idx] = leftID;
+    m_stateIDs[m_storageSize + idx] = rightID;
+    m_areas[idx] = area;
+    return idx;
+  }
+
+  /// copy the physical data of the given side (0=left, 1=right) of a face
+  void setData(const CFuint side, const CFuint idx, const RealVector& pdata)
+  {
+    cf_assert(side < 2);
+    cf_assert(idx < m_nbFaces);
+    cf_assert(pdata.size() >= m_dataSize);
+    CFreal *const data = &m_data[side][idx];
+    for (CFuint iVar = 0; iVar < m_dataSize; ++iVar) {
+      data[iVar*m_storageSize] = pdata[iVar];
+    }
+  }
+
+  /// copy the unit normal of a face
+  void setNormal(const CFuint idx, const RealVector& unitNormal)
+  {
+    cf_assert(idx < m_nbFaces);
+    cf_assert(unitNormal.size() == m_dim);
+    for (CFuint iDim = 0; iDim < m_dim; ++iDim) {
+      m_normals[iDim*m_storageSize + idx] = unitNormal[iDim];
+    }
+  }
+
+  /// get the array of the physical data iVar of the given side
+  const CFreal* getData(const CFuint side, const CFuint iVar) const
+  {
+    cf_assert(side < 2);
+    cf_assert(iVar < m_dataSize);
+    return &m_data[side][iVar*m_storageSize];
+  }
+
+  /// get the array of the unit normal component iDim
+  const CFreal* getNormal(const CFuint iDim) const
+  {
+    cf_assert(iDim < m_dim);
+    return &m_normals[iDim*m_storageSize];
+  }
+
+  /// get the array of the face areas
+  const CFreal* getAreas() const {return &m_areas[0];}
+
+  /// get the array of the integrated flux component iEq
+  CFreal* getFlux(const CFuint iEq)
+  {
+    cf_assert(iEq < m_nbEqs);
+    return &m_fluxes[iEq*m_storageSize];
+  }
+
+  /// get the array of the update coefficient contributions of the given side
+  CFreal* getUpdateCoeff(const CFuint side)
+  {
+    cf_assert(side < 2);
+    return &m_updateCoeff[side*m_storageSize];
+  }
+
+  /// get the local ID of the state on the given side of a face
+  CFuint getStateID(const CFuint side, const CFuint idx) const
+  {
+    cf_assert(side < 2);
+    cf_assert(idx < m_nbFaces);
+    return m_stateIDs[side*m_storageSize + idx];
+  }
+
+private:
+
+  /// maximum number of faces
+  CFuint m_capacity;
+
+  /// number of allocated faces (capacity rounded up to a multiple of BLOCK_SIZE)
+  CFuint m_storageSize;
+
+  /// current number of faces
+  CFuint m_nbFaces;
+
+  /// number of equations
+  CFuint m_nbEqs;
+
+  /// size of the physical data
+  CFuint m_dataSize;
+
+  /// number of dimensions
+  CFuint m_dim;
+
+  /// left and right physical data
+  std::vector<CFreal> m_data[2];
+
+  /// unit normals
+  std::vector<CFreal> m_normals;
+
+  /// face areas
+  std::vector<CFreal> m_areas;
+
+  /// integrated fluxes
+  std::vector<CFreal> m_fluxes;
+
+  /// left and right update coefficient contributions
+  std::vector<CFreal> m_updateCoeff;
+
+  /// left and right state IDs
+  std::vector<CFuint> m_stateIDs;
+
+}; // end of class FaceBatch
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace FiniteVolume
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Numerics_FiniteVolume_FaceBatch_hh
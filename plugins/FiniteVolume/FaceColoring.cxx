@@ -0,0 +1,98 @@
+#include "FiniteVolume/FaceColoring.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace FiniteVolume {
+
+//////////////////////////////////////////////////////////////////////////////
+
+FaceColoring::FaceColoring() :
+  m_colorStart(),
+  m_faceIDs()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+FaceColoring::~FaceColoring()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FaceColoring::compute(const CFuint nbCells,
+			   const vector<CFuint>& leftCellIDs,
+			   const vector<CFuint>& rightCellIDs)
+{
+  cf_assert(leftCellIDs.size() == rightCellIDs.size());
+  const CFuint nbFaces = leftCellIDs.size();
+
+  // colors already taken by the faces of each cell
+  vector<vector<CFuint> > cellColors(nbCells);
+  vector<CFuint> faceColor(nbFaces, 0);
+  CFuint nbColors = 0;
+
+  for (CFuint iFace = 0; iFace < nbFaces; ++iFace) {
+    const CFuint leftID  = leftCellIDs[iFace];
+    const CFuint rightID = rightCellIDs[iFace];
+    cf_assert(leftID < nbCells);
+    cf_assert(rightID < nbCells);
+
+    const vector<CFuint>& lc = cellColors[leftID];
+    const vector<CFuint>& rc = cellColors[rightID];
+
+    // pick the smallest color not used by any of the two neighbor cells
+    CFuint color = 0;
+    for (bool found = false; !found; ) {
+      found = (find(lc.begin(), lc.end(), color) == lc.end()) &&
+	(find(rc.begin(), rc.end(), color) == rc.end());
+      if (!found) ++color;
+    }
+
+    faceColor[iFace] = color;
+    cellColors[leftID].push_back(color);
+    cellColors[rightID].push_back(color);
+    nbColors = max(nbColors, color + 1);
+  }
+
+  // count the faces per color and store them color by color
+  m_colorStart.assign(nbColors + 1, 0);
+  for (CFuint iFace = 0; iFace < nbFaces; ++iFace) {
+    m_colorStart[faceColor[iFace] + 1]++;
+  }
+  for (CFuint iColor = 0; iColor < nbColors; ++iColor) {
+    m_colorStart[iColor + 1] += m_colorStart[iColor];
+  }
+
+  m_faceIDs.resize(nbFaces);
+  vector<CFuint> counter(m_colorStart.begin(), m_colorStart.end() - 1);
+  for (CFuint iFace = 0; iFace < nbFaces; ++iFace) {
+    m_faceIDs[counter[faceColor[iFace]]++] = iFace;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FaceColoring::clear()
+{
+  vector<CFuint>().swap(m_colorStart);
+  vector<CFuint>().swap(m_faceIDs);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace FiniteVolume
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
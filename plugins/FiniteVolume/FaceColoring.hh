@@ -0,0 +1,98 @@
+#ifndef COOLFluiD_Numerics_FiniteVolume_FaceColoring_hh
+#define COOLFluiD_Numerics_FiniteVolume_FaceColoring_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "Common/COOLFluiD.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace FiniteVolume {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class partitions a list of faces into colors such that no two faces
+ * with the same color share a neighbor cell. All the faces of one color can
+ * therefore scatter their contributions into per-cell storage concurrently.
+ * The faces are stored color by color in a compressed (CSR-like) array.
+ *
+ * @author Andrea Lani
+ *
+ */
+class FaceColoring {
+public:
+
+  /**
+   * Constructor
+   */
+  FaceColoring();
+
+  /**
+   * Destructor
+   */
+  ~FaceColoring();
+
+  /**
+   * Compute the coloring with a greedy algorithm
+   * @param nbCells      upper bound for the cell IDs
+   * @param leftCellIDs  ID of the left cell of each face
+   * @param rightCellIDs ID of the right cell of each face
+   */
+  void compute(const CFuint nbCells,
+	       const std::vector<CFuint>& leftCellIDs,
+	       const std::vector<CFuint>& rightCellIDs);
+
+  /**
+   * Clear the coloring
+   */
+  void clear();
+
+  /// get the number of colors
+  CFuint getNbColors() const
+  {
+    return (m_colorStart.size() > 0) ? m_colorStart.size() - 1 : 0;
+  }
+
+  /// get the number of faces in the given color
+  CFuint getNbFacesInColor(const CFuint iColor) const
+  {
+    cf_assert(iColor+1 < m_colorStart.size());
+    return m_colorStart[iColor+1] - m_colorStart[iColor];
+  }
+
+  /// get the (TRS local) face IDs of the given color
+  const CFuint* getFacesInColor(const CFuint iColor) const
+  {
+    cf_assert(iColor < m_colorStart.size());
+    return (m_faceIDs.size() > 0) ? &m_faceIDs[m_colorStart[iColor]] : CFNULL;
+  }
+
+  /// get the total number of colored faces
+  CFuint getNbFaces() const {return m_faceIDs.size();}
+
+private:
+
+  /// start of each color inside m_faceIDs (size = nb colors + 1)
+  std::vector<CFuint> m_colorStart;
+
+  /// face IDs sorted by color
+  std::vector<CFuint> m_faceIDs;
+
+}; // end of class FaceColoring
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace FiniteVolume
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Numerics_FiniteVolume_FaceColoring_hh
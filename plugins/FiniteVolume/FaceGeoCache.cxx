@@ -0,0 +1,141 @@
+#include "FiniteVolume/FaceGeoCache.hh"
+#include "Framework/MeshData.hh"
+#include "Framework/PhysicalModel.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace FiniteVolume {
+
+//////////////////////////////////////////////////////////////////////////////
+
+FaceGeoCache::FaceGeoCache() :
+  m_trsStart(),
+  m_faceID(),
+  m_leftID(),
+  m_rightID(),
+  m_trsID(),
+  m_isUpdatable(),
+  m_area(),
+  m_unitNormal(),
+  m_faceCenter()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+FaceGeoCache::~FaceGeoCache()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FaceGeoCache::build(DataSocketSink<CFreal>& socket_normals,
+			 DataSocketSink<CFreal>& socket_faceAreas,
+			 DataSocketSink<State*, GLOBAL>& socket_states,
+			 DataSocketSink<Node*, GLOBAL>& socket_nodes)
+{
+  CFAUTOTRACE;
+
+  DataHandle<CFreal> normals = socket_normals.getDataHandle();
+  DataHandle<CFreal> faceAreas = socket_faceAreas.getDataHandle();
+  DataHandle<State*, GLOBAL> states = socket_states.getDataHandle();
+  DataHandle<Node*, GLOBAL> nodes = socket_nodes.getDataHandle();
+
+  vector<SafePtr<TopologicalRegionSet> > trs = MeshDataStack::getActive()->getTrsList();
+  const CFuint nbTRSs = trs.size();
+  const CFuint dim = PhysicalModelStack::getActive()->getDim();
+
+  // count the faces TRS by TRS (cells and partition faces are not cached)
+  m_trsStart.assign(nbTRSs + 1, 0);
+  for (CFuint iTRS = 0; iTRS < nbTRSs; ++iTRS) {
+    const std::string& name = trs[iTRS]->getName();
+    const CFuint nbTrsFaces = (name != "PartitionFaces" && name != "InnerCells") ?
+      trs[iTRS]->getLocalNbGeoEnts() : 0;
+    m_trsStart[iTRS+1] = m_trsStart[iTRS] + nbTrsFaces;
+  }
+
+  const CFuint nbFaces = m_trsStart[nbTRSs];
+  m_faceID.resize(nbFaces);
+  m_leftID.resize(nbFaces);
+  m_rightID.resize(nbFaces);
+  m_trsID.resize(nbFaces);
+  m_isUpdatable.resize(nbFaces);
+  m_area.resize(nbFaces);
+  m_unitNormal.resize(nbFaces*dim);
+  m_faceCenter.resize(nbFaces*dim);
+
+  for (CFuint iTRS = 0; iTRS < nbTRSs; ++iTRS) {
+    const TopologicalRegionSet& faces = *trs[iTRS];
+    const bool isBTrs = faces.hasTag("writable");
+    const CFuint start = m_trsStart[iTRS];
+    const CFuint nbTrsFaces = m_trsStart[iTRS+1] - start;
+
+    for (CFuint iFace = 0; iFace < nbTrsFaces; ++iFace) {
+      const CFuint i = start + iFace;
+      const CFuint faceID = faces.getLocalGeoID(iFace);
+      const CFuint leftID = faces.getStateID(iFace, 0);
+      const CFuint rightID = faces.getStateID(iFace, 1);
+
+      m_faceID[i] = faceID;
+      m_leftID[i] = leftID;
+      m_rightID[i] = rightID;
+      m_trsID[i] = iTRS;
+      m_isUpdatable[i] = states[leftID]->isParUpdatable() ||
+	(!isBTrs && states[rightID]->isParUpdatable());
+
+      const CFreal area = faceAreas[faceID];
+      const CFreal invArea = 1./area;
+      m_area[i] = area;
+      for (CFuint iDim = 0; iDim < dim; ++iDim) {
+	m_unitNormal[iDim*nbFaces + i] = normals[faceID*dim + iDim]*invArea;
+      }
+
+      const CFuint nbFaceNodes = faces.getNbNodesInGeo(iFace);
+      const CFreal invNbNodes = 1./static_cast<CFreal>(nbFaceNodes);
+      for (CFuint iDim = 0; iDim < dim; ++iDim) {
+	CFreal sum = 0.;
+	for (CFuint in = 0; in < nbFaceNodes; ++in) {
+	  sum += (*nodes[faces.getNodeID(iFace, in)])[iDim];
+	}
+	m_faceCenter[iDim*nbFaces + i] = sum*invNbNodes;
+      }
+    }
+  }
+
+  CFLog(VERBOSE, "FaceGeoCache::build() => " << nbFaces << " faces cached\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FaceGeoCache::clear()
+{
+  vector<CFuint>().swap(m_trsStart);
+  vector<CFuint>().swap(m_faceID);
+  vector<CFuint>().swap(m_leftID);
+  vector<CFuint>().swap(m_rightID);
+  vector<CFuint>().swap(m_trsID);
+  vector<bool>().swap(m_isUpdatable);
+  vector<CFreal>().swap(m_area);
+  vector<CFreal>().swap(m_unitNormal);
+  vector<CFreal>().swap(m_faceCenter);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace FiniteVolume
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,167 @@
+#ifndef COOLFluiD_Numerics_FiniteVolume_FaceGeoCache_hh
+#define COOLFluiD_Numerics_FiniteVolume_FaceGeoCache_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "Framework/DataSocketSink.hh"
+#include "Framework/State.hh"
+#include "Framework/Node.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace FiniteVolume {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class stores, in contiguous arrays (structure of arrays), the geometric
+ * and connectivity data of all the faces processed by the cell center FVM
+ * residual computation: local face ID, left and right state IDs (the right one
+ * is a ghost state ID on boundary faces), TRS ID, parallel updatable flag,
+ * area, unit normal and face center.
+ * Faces are stored TRS by TRS, in the same order in which they appear inside
+ * each TRS, so that the data of the i-th face of a TRS is found at
+ * getTrsStart(iTRS) + i.
+ * The cache has to be rebuilt whenever the mesh moves.
+ *
+ * @author Andrea Lani
+ *
+ */
+class FaceGeoCache {
+public:
+
+  /**
+   * Constructor
+   */
+  FaceGeoCache();
+
+  /**
+   * Destructor
+   */
+  ~FaceGeoCache();
+
+  /**
+   * Build the cache
+   * @param socket_normals    face normals (not normalized)
+   * @param socket_faceAreas  face areas
+   * @param socket_states     states
+   * @param socket_nodes      nodes
+   */
+  void build(Framework::DataSocketSink<CFreal>& socket_normals,
+	     Framework::DataSocketSink<CFreal>& socket_faceAreas,
+	     Framework::DataSocketSink<Framework::State*, Framework::GLOBAL>& socket_states,
+	     Framework::DataSocketSink<Framework::Node*, Framework::GLOBAL>& socket_nodes);
+
+  /**
+   * Clear the cache
+   */
+  void clear();
+
+  /// tell if the cache has been built
+  bool isBuilt() const {return m_trsStart.size() > 0;}
+
+  /// get the total number of cached faces
+  CFuint getNbFaces() const {return m_faceID.size();}
+
+  /// get the position of the first face of the given TRS
+  CFuint getTrsStart(const CFuint iTRS) const
+  {
+    cf_assert(iTRS+1 < m_trsStart.size());
+    return m_trsStart[iTRS];
+  }
+
+  /// get the number of cached faces in the given TRS
+  CFuint getNbFacesInTrs(const CFuint iTRS) const
+  {
+    cf_assert(iTRS+1 < m_trsStart.size());
+    return m_trsStart[iTRS+1] - m_trsStart[iTRS];
+  }
+
+  /// get the local (mesh) ID of the given face
+  CFuint getFaceID(const CFuint i) const {return m_faceID[i];}
+
+  /// get the ID of the left state
+  CFuint getLeftID(const CFuint i) const {return m_leftID[i];}
+
+  /// get the ID of the right state (ghost state ID if on the boundary)
+  CFuint getRightID(const CFuint i) const {return m_rightID[i];}
+
+  /// get the ID of the TRS to which the face belongs
+  CFuint getTrsID(const CFuint i) const {return m_trsID[i];}
+
+  /// tell if the face has at least one parallel updatable neighbor state
+  bool isUpdatable(const CFuint i) const {return m_isUpdatable[i];}
+
+  /// get the face area
+  CFreal getArea(const CFuint i) const {return m_area[i];}
+
+  /// get the given component of the unit normal
+  CFreal getUnitNormal(const CFuint i, const CFuint iDim) const
+  {
+    return m_unitNormal[iDim*m_faceID.size() + i];
+  }
+
+  /// get the given component of the face center
+  CFreal getFaceCenter(const CFuint i, const CFuint iDim) const
+  {
+    return m_faceCenter[iDim*m_faceID.size() + i];
+  }
+
+  /// get the array with the given unit normal component for all faces
+  const CFreal* getUnitNormalComponent(const CFuint iDim) const
+  {
+    return &m_unitNormal[iDim*m_faceID.size()];
+  }
+
+  /// get the array with the given face center component for all faces
+  const CFreal* getFaceCenterComponent(const CFuint iDim) const
+  {
+    return &m_faceCenter[iDim*m_faceID.size()];
+  }
+
+private:
+
+  /// position of the first face of each TRS (size = nb TRSs + 1)
+  std::vector<CFuint> m_trsStart;
+
+  /// local face IDs
+  std::vector<CFuint> m_faceID;
+
+  /// left state IDs
+  std::vector<CFuint> m_leftID;
+
+  /// right state IDs (ghost IDs on boundary faces)
+  std::vector<CFuint> m_rightID;
+
+  /// TRS IDs
+  std::vector<CFuint> m_trsID;
+
+  /// flags telling if the face has to be processed in this partition
+  std::vector<bool> m_isUpdatable;
+
+  /// face areas
+  std::vector<CFreal> m_area;
+
+  /// unit normals, stored component by component
+  std::vector<CFreal> m_unitNormal;
+
+  /// face centers, stored component by component
+  std::vector<CFreal> m_faceCenter;
+
+}; // end of class FaceGeoCache
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace FiniteVolume
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Numerics_FiniteVolume_FaceGeoCache_hh
@@ -89,22 +89,33 @@ void InitState::executeOnTrs()
   cf_assert(trsStates->size() > 0);
   DataHandle < Framework::State*, Framework::GLOBAL > states = socket_states.getDataHandle();
   
-  std::vector<CFuint>::iterator itd;
-  if(_inputAdimensionalValues)
-  {
-    for (itd = trsStates->begin(); itd != trsStates->end(); ++itd) {
-      State* const currState = states[(*itd)];
-      _vFunction.evaluate(currState->getCoordinates(), *_input);
-      *currState = *_inputToUpdateVar->transform(_input);
+  // the functions are evaluated for all the states at once
+  const CFuint nbStates = trsStates->size();
+  const CFuint nbVars = _vFunction.getNbVars();
+  const CFuint nbFuncs = _vFunction.getNbFuncs();
+  vector<CFreal> coords(nbVars*nbStates);
+  for (CFuint i = 0; i < nbStates; ++i) {
+    cf_assert((*trsStates)[i] < states.size());
+    const Node& node = states[(*trsStates)[i]]->getCoordinates();
+    cf_assert(node.size() == nbVars);
+    for (CFuint iVar = 0; iVar < nbVars; ++iVar) {
+      coords[iVar*nbStates + i] = node[iVar];
     }
   }
-  else
-  {
-    State dimState;
-    for (itd = trsStates->begin(); itd != trsStates->end(); ++itd) {
-      cf_assert((*itd) < states.size());
-      State* const currState = states[(*itd)];
-      _vFunction.evaluate(currState->getCoordinates(), *_input);
+  vector<CFreal> values(nbFuncs*nbStates);
+  _vFunction.evaluateBatch(nbStates, &coords[0], &values[0]);
+  
+  State dimState;
+  for (CFuint i = 0; i < nbStates; ++i) {
+    State* const currState = states[(*trsStates)[i]];
+    for (CFuint iFun = 0; iFun < nbFuncs; ++iFun) {
+      (*_input)[iFun] = values[iFun*nbStates + i];
+    }
+    
+    if(_inputAdimensionalValues) {
+      *currState = *_inputToUpdateVar->transform(_input);
+    }
+    else {
       dimState = *_inputToUpdateVar->transform(_input);
       _varSet->setAdimensionalValues(dimState, *currState);
     }
@@ -122,6 +122,15 @@ public:
    */
   virtual void compute(RealVector& result);
   
+  /**
+   * Tells that the flux only works with its own data and the ones of
+   * the VarSets and transformers of its method data
+   */
+  virtual bool isReentrant() const
+  {
+    return true;
+  }
+  
 protected:
   
   /**
@@ -151,12 +151,88 @@ void LeastSquareP1PolyRec2D::computeGradients()
 
 //////////////////////////////////////////////////////////////////////////////
 
+void LeastSquareP1PolyRec2D::computeGradientsInCells(const vector<CFuint>& cellIDs)
+{
+  prepareReconstruction();
+  
+  DataHandle < Framework::State*, Framework::GLOBAL > states = socket_states.getDataHandle();
+  DataHandle<vector<State*> > stencil = socket_stencil.getDataHandle();
+  DataHandle<CFreal> weights = socket_weights.getDataHandle();
+  DataHandle<CFreal> uX = socket_uX.getDataHandle();
+  DataHandle<CFreal> uY = socket_uY.getDataHandle();
+  
+  setupCellEdges(cellIDs, stencil);
+  
+  const CFuint nbCells = cellIDs.size();
+  const CFuint nbEdges = _cellEdges.size()/3;
+  const CFuint nbEquations = PhysicalModelStack::getActive()->getNbEq();
+  
+  for(CFuint iVar = 0; iVar < nbEquations; ++iVar) {
+    for(CFuint i = 0; i < nbCells; ++i) {
+      _lf1[cellIDs[i]] = 0.0;
+      _lf2[cellIDs[i]] = 0.0;
+    }
+    
+    // same sums as in computeGradients(), restricted to the edges of the cells
+    for(CFuint e = 0; e < nbEdges; ++e) {
+      const CFuint firstID = _cellEdges[3*e];
+      const State* const first = states[firstID];
+      const State* const last = stencil[firstID][_cellEdges[3*e+1]];
+      const RealVector& nodeFirst = first->getCoordinates();
+      const RealVector& nodeLast = last->getCoordinates();
+      const CFreal weig = weights[_cellEdges[3*e+2]];
+      const CFreal dx = weig*(nodeLast[0] - nodeFirst[0]);
+      const CFreal dy = weig*(nodeLast[1] - nodeFirst[1]);
+      const CFreal du = weig*((*last)[iVar] - (*first)[iVar]);
+      const CFreal dxdu = dx*du;
+      const CFreal dydu = dy*du;
+      
+      _lf1[firstID] += dxdu;
+      _lf2[firstID] += dydu;
+      
+      if (!last->isGhost()) {
+	const CFuint lastID = last->getLocalID();
+	_lf1[lastID] += dxdu;
+	_lf2[lastID] += dydu;
+      }
+    }
+    
+    for(CFuint i = 0; i < nbCells; ++i) {
+      const CFuint iState = cellIDs[i];
+      const CFreal invDet = 1./(_l11[iState]*_l22[iState] - _l12[iState]*_l12[iState]);
+      uX(iState,iVar,nbEquations) = (_l22[iState]*_lf1[iState] - _l12[iState]*_lf2[iState])*invDet;
+      uY(iState,iVar,nbEquations) = (_l11[iState]*_lf2[iState] - _l12[iState]*_lf1[iState])*invDet;
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 void LeastSquareP1PolyRec2D::extrapolateImpl(GeometricEntity* const face)
 {
   FVMCC_PolyRec::baseExtrapolateImpl(face);
   
   // first compute the limiter
   computeFaceLimiter(face);
+  
+  linearRecImpl(face->getState(LEFT), face->getState(RIGHT));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void LeastSquareP1PolyRec2D::extrapolateInFaceCenter(State *const left,
+                                                     State *const right,
+                                                     const RealVector& center)
+{
+  FVMCC_PolyRec::baseExtrapolateInFaceCenter(left, right, center);
+  linearRecImpl(left, right);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void LeastSquareP1PolyRec2D::linearRecImpl(const State *const state,
+                                           const State *const neighState)
+{
   DataHandle<CFreal> uX = socket_uX.getDataHandle();
   DataHandle<CFreal> uY = socket_uY.getDataHandle();
   DataHandle<CFreal> newLimiter = socket_limiter.getDataHandle();
@@ -165,10 +241,8 @@ void LeastSquareP1PolyRec2D::extrapolateImpl(GeometricEntity* const face)
   // don't forget the "&" !!!
   const vector<Node*>& coord = getCoord();
   vector<State*>& valuesLR  = getExtrapolatedValues();
-  const State *const state = face->getState(LEFT);
   const CFuint stateID = state->getLocalID();
   const RealVector& stateCoord = state->getCoordinates();
-  const State *const neighState = face->getState(RIGHT);
   const CFuint neighStateIDgrad = (!isBoundaryFace()) ? neighState->getLocalID() : stateID;
   const RealVector& neighStateCoord = neighState->getCoordinates();
 
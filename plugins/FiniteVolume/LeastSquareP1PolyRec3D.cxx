@@ -139,61 +139,7 @@ void LeastSquareP1PolyRec3D::computeGradients()
     }
 
     for(CFuint iState = 0; iState < nbStates; ++iState) {
-
-      const CFreal det = _l11[iState]*_l22[iState]*_l33[iState]
-	- _l11[iState]*_l23[iState]*_l23[iState]
-	- _l12[iState]*_l12[iState]*_l33[iState]
-	+ _l12[iState]*_l13[iState]*_l23[iState]
-	+ _l13[iState]*_l12[iState]*_l23[iState]
-	- _l13[iState]*_l13[iState]*_l22[iState];
-
-      if (!(std::abs(det) > MathTools::MathConsts::CFrealEps())) {
-	CFout << "Det is zero."<<"\n";
-      }
-
-      const CFreal linv11 = _l22[iState]*_l33[iState] - _l23[iState]*_l23[iState];
-      const CFreal linv22 = _l11[iState]*_l33[iState] - _l13[iState]*_l13[iState];
-      const CFreal linv33 = _l11[iState]*_l22[iState] - _l12[iState]*_l12[iState];
-      const CFreal linv12 = -(_l12[iState]*_l33[iState] - _l13[iState]*_l23[iState]);
-      const CFreal linv13 = _l12[iState]*_l23[iState] - _l13[iState]*_l22[iState];
-      const CFreal linv23 = -(_l11[iState]*_l23[iState] - _l13[iState]*_l12[iState]);
-
-      // A cure to the singularites in calculating the determinant
-      if (!MathChecks::isZero(det)) {
-	uX(iState,iVar,nbEquations) = (linv11*_lf1[iState] +
-				       linv12*_lf2[iState] +
-				       linv13*_lf3[iState])/det;
-	uY(iState,iVar,nbEquations) = (linv12*_lf1[iState] +
-				       linv22*_lf2[iState] +
-				       linv23*_lf3[iState])/det;
-	uZ(iState,iVar,nbEquations) = (linv13*_lf1[iState] +
-				       linv23*_lf2[iState] +
-				       linv33*_lf3[iState])/det;
-	
-	// if (std::abs(_uX(iState,iVar,nbEquations)) > 0.) CFout << "ux = " << _uX(iState,iVar,nbEquations) << "\n";
-	// if (std::abs(_uY(iState,iVar,nbEquations)) > 0.) CFout << "uy = " << _uY(iState,iVar,nbEquations) << "\n";
-	// if (std::abs(_uZ(iState,iVar,nbEquations)) > 0.) CFout << "uz = " << _uZ(iState,iVar,nbEquations) << "\n";
-      }
-      else {
-	uX(iState,iVar,nbEquations) = 0.0;
-	uY(iState,iVar,nbEquations) = 0.0;
-	uZ(iState,iVar,nbEquations) = 0.0;
-      }
-
-      CFLogDebugMed( "det = " << det
-		     << ", l11 = " << _l11[iState]
-		     << ", l12 = " << _l12[iState]
-		     << ", l13 = " << _l13[iState]
-		     << ", l22 = " << _l22[iState]
-		     << ", l23 = " << _l23[iState]
-		     << ", l33 = " << _l33[iState]
-		     <<", lf1 = " << _lf1[iState]
-		     <<", lf2 = " << _lf2[iState]
-		     <<", lf3 = " << _lf3[iState]
-		     << ", uX =" << uX(iState,iVar,nbEquations)
-		     << ", uY =" << uY(iState,iVar,nbEquations)
-		     << ", uZ =" << uZ(iState,iVar,nbEquations)
-		     << "\n");
+      computeCellGradient(iState, iVar, nbEquations, uX, uY, uZ);
     }
   }
   
@@ -213,6 +159,128 @@ void LeastSquareP1PolyRec3D::computeGradients()
 
 //////////////////////////////////////////////////////////////////////////////
 
+void LeastSquareP1PolyRec3D::computeGradientsInCells(const vector<CFuint>& cellIDs)
+{
+  prepareReconstruction();
+  
+  DataHandle < Framework::State*, Framework::GLOBAL > states = socket_states.getDataHandle();
+  DataHandle<vector<State*> > stencil = socket_stencil.getDataHandle();
+  DataHandle<CFreal> weights = socket_weights.getDataHandle();
+  DataHandle<CFreal> uX = socket_uX.getDataHandle();
+  DataHandle<CFreal> uY = socket_uY.getDataHandle();
+  DataHandle<CFreal> uZ = socket_uZ.getDataHandle();
+  
+  setupCellEdges(cellIDs, stencil);
+  
+  const CFuint nbCells = cellIDs.size();
+  const CFuint nbEdges = _cellEdges.size()/3;
+  const CFuint nbEquations = PhysicalModelStack::getActive()->getNbEq();
+  
+  for(CFuint iVar = 0; iVar < nbEquations; ++iVar) {
+    for(CFuint i = 0; i < nbCells; ++i) {
+      _lf1[cellIDs[i]] = 0.0;
+      _lf2[cellIDs[i]] = 0.0;
+      _lf3[cellIDs[i]] = 0.0;
+    }
+    
+    // same sums as in computeGradients(), restricted to the edges of the cells
+    for(CFuint e = 0; e < nbEdges; ++e) {
+      const CFuint firstID = _cellEdges[3*e];
+      const State* const first = states[firstID];
+      const State* const last = stencil[firstID][_cellEdges[3*e+1]];
+      const RealVector& nodeFirst = first->getCoordinates();
+      const RealVector& nodeLast = last->getCoordinates();
+      const CFreal weig = weights[_cellEdges[3*e+2]];
+      const CFreal dx = weig*(nodeLast[0] - nodeFirst[0]);
+      const CFreal dy = weig*(nodeLast[1] - nodeFirst[1]);
+      const CFreal dz = weig*(nodeLast[2] - nodeFirst[2]);
+      const CFreal du = weig*((*last)[iVar] - (*first)[iVar]);
+      
+      _lf1[firstID] += dx*du;
+      _lf2[firstID] += dy*du;
+      _lf3[firstID] += dz*du;
+      
+      if (!last->isGhost()) {
+	const CFuint lastID = last->getLocalID();
+	_lf1[lastID] += dx*du;
+	_lf2[lastID] += dy*du;
+	_lf3[lastID] += dz*du;
+      }
+    }
+    
+    for(CFuint i = 0; i < nbCells; ++i) {
+      computeCellGradient(cellIDs[i], iVar, nbEquations, uX, uY, uZ);
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void LeastSquareP1PolyRec3D::computeCellGradient(const CFuint iState, 
+						 const CFuint iVar,
+						 const CFuint nbEquations,
+						 DataHandle<CFreal>& uX,
+						 DataHandle<CFreal>& uY,
+						 DataHandle<CFreal>& uZ)
+{
+  const CFreal det = _l11[iState]*_l22[iState]*_l33[iState]
+    - _l11[iState]*_l23[iState]*_l23[iState]
+    - _l12[iState]*_l12[iState]*_l33[iState]
+    + _l12[iState]*_l13[iState]*_l23[iState]
+    + _l13[iState]*_l12[iState]*_l23[iState]
+    - _l13[iState]*_l13[iState]*_l22[iState];
+
+  if (!(std::abs(det) > MathTools::MathConsts::CFrealEps())) {
+    CFout << "Det is zero."<<"\n";
+  }
+
+  const CFreal linv11 = _l22[iState]*_l33[iState] - _l23[iState]*_l23[iState];
+  const CFreal linv22 = _l11[iState]*_l33[iState] - _l13[iState]*_l13[iState];
+  const CFreal linv33 = _l11[iState]*_l22[iState] - _l12[iState]*_l12[iState];
+  const CFreal linv12 = -(_l12[iState]*_l33[iState] - _l13[iState]*_l23[iState]);
+  const CFreal linv13 = _l12[iState]*_l23[iState] - _l13[iState]*_l22[iState];
+  const CFreal linv23 = -(_l11[iState]*_l23[iState] - _l13[iState]*_l12[iState]);
+
+  // A cure to the singularites in calculating the determinant
+  if (!MathChecks::isZero(det)) {
+    uX(iState,iVar,nbEquations) = (linv11*_lf1[iState] +
+				   linv12*_lf2[iState] +
+				   linv13*_lf3[iState])/det;
+    uY(iState,iVar,nbEquations) = (linv12*_lf1[iState] +
+				   linv22*_lf2[iState] +
+				   linv23*_lf3[iState])/det;
+    uZ(iState,iVar,nbEquations) = (linv13*_lf1[iState] +
+				   linv23*_lf2[iState] +
+				   linv33*_lf3[iState])/det;
+    
+    // if (std::abs(_uX(iState,iVar,nbEquations)) > 0.) CFout << "ux = " << _uX(iState,iVar,nbEquations) << "\n";
+    // if (std::abs(_uY(iState,iVar,nbEquations)) > 0.) CFout << "uy = " << _uY(iState,iVar,nbEquations) << "\n";
+    // if (std::abs(_uZ(iState,iVar,nbEquations)) > 0.) CFout << "uz = " << _uZ(iState,iVar,nbEquations) << "\n";
+  }
+  else {
+    uX(iState,iVar,nbEquations) = 0.0;
+    uY(iState,iVar,nbEquations) = 0.0;
+    uZ(iState,iVar,nbEquations) = 0.0;
+  }
+
+  CFLogDebugMed( "det = " << det
+		 << ", l11 = " << _l11[iState]
+		 << ", l12 = " << _l12[iState]
+		 << ", l13 = " << _l13[iState]
+		 << ", l22 = " << _l22[iState]
+		 << ", l23 = " << _l23[iState]
+		 << ", l33 = " << _l33[iState]
+		 <<", lf1 = " << _lf1[iState]
+		 <<", lf2 = " << _lf2[iState]
+		 <<", lf3 = " << _lf3[iState]
+		 << ", uX =" << uX(iState,iVar,nbEquations)
+		 << ", uY =" << uY(iState,iVar,nbEquations)
+		 << ", uZ =" << uZ(iState,iVar,nbEquations)
+		 << "\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 void LeastSquareP1PolyRec3D::extrapolateImpl(GeometricEntity* const face)
 {
   FVMCC_PolyRec::baseExtrapolateImpl(face);
@@ -220,6 +288,24 @@ void LeastSquareP1PolyRec3D::extrapolateImpl(GeometricEntity* const face)
   // first compute the limiter
   computeFaceLimiter(face);
   
+  linearRecImpl(face->getState(LEFT), face->getState(RIGHT));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void LeastSquareP1PolyRec3D::extrapolateInFaceCenter(State *const left,
+                                                     State *const right,
+                                                     const RealVector& center)
+{
+  FVMCC_PolyRec::baseExtrapolateInFaceCenter(left, right, center);
+  linearRecImpl(left, right);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void LeastSquareP1PolyRec3D::linearRecImpl(const State *const state,
+                                           const State *const neighState)
+{
   DataHandle<CFreal> uX = socket_uX.getDataHandle();
   DataHandle<CFreal> uY = socket_uY.getDataHandle();
   DataHandle<CFreal> uZ = socket_uZ.getDataHandle();
@@ -229,10 +315,8 @@ void LeastSquareP1PolyRec3D::extrapolateImpl(GeometricEntity* const face)
   // don't forget the "&" !!!
   const vector<Node*>& coord = getCoord();
   vector<State*>& valuesLR  = getExtrapolatedValues();
-  const State *const state = face->getState(LEFT);
   const CFuint stateID = state->getLocalID();
   const RealVector& stateCoord = state->getCoordinates();
-  const State *const neighState = face->getState(RIGHT);
   const RealVector& neighStateCoord = neighState->getCoordinates();
   const CFuint neighStateIDgrad = (!isBoundaryFace()) ? neighState->getLocalID() : stateID;
   
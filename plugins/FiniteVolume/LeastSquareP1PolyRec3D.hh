@@ -3,6 +3,8 @@
 
 //////////////////////////////////////////////////////////////////////////////
 
+#include <typeinfo>
+
 #include "FiniteVolume/FVMCC_PolyRec.hh"
 
 #ifdef CF_HAVE_CUDA
@@ -157,6 +159,11 @@ public:
    * Compute the gradients
    */
   virtual void computeGradients();
+  
+  /**
+   * Compute the gradients in the given cells only
+   */
+  virtual void computeGradientsInCells(const std::vector<CFuint>& cellIDs);
 
   /**
    * Set up the private data
@@ -167,9 +174,35 @@ public:
    * Update the weights when nodes are moving
    */
   virtual void updateWeights();
+  
+  /**
+   * Tell if extrapolateInFaceCenter() can replace extrapolate(): 
+   * the face limiter is not computed if the limiter is null
+   */
+  virtual bool canExtrapolateInFaceCenter() const
+  {
+    return (typeid(*this) == typeid(LeastSquareP1PolyRec3D) && _isLimiterNull);
+  }
+  
+  /**
+   * Extrapolate the solution in the center of an internal face
+   */
+  virtual void extrapolateInFaceCenter(Framework::State *const left,
+				       Framework::State *const right,
+				       const RealVector& center);
 
 protected:
 
+  /**
+   * Solve the least square system for the gradient of the given variable
+   * in the given cell, once the right hand sides _lf1, _lf2, _lf3 are computed
+   */
+  void computeCellGradient(const CFuint iState, const CFuint iVar,
+			   const CFuint nbEquations,
+			   Framework::DataHandle<CFreal>& uX,
+			   Framework::DataHandle<CFreal>& uY,
+			   Framework::DataHandle<CFreal>& uZ);
+
   /**
    * Extrapolate the solution in the face quadrature points
    */
@@ -181,6 +214,13 @@ protected:
   virtual void extrapolateImpl(Framework::GeometricEntity* const face,
                                CFuint iVar, CFuint leftOrRight);
 
+  /**
+   * Linearly extrapolate the solution of the two given states 
+   * in the face quadrature point, with the current limiter
+   */
+  void linearRecImpl(const Framework::State *const state,
+		     const Framework::State *const neighState);
+
 protected:
 
   /// socket for stencil
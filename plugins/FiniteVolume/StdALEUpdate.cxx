@@ -68,6 +68,12 @@ void StdALEUpdate::execute()
   updateNormalsData();
   updateFaceAreas();
   updateReconstructor();
+  
+  // the face geometry has changed: the cached one has to be rebuilt
+  if (getMethodData().useFaceGeoCache()) {
+    getMethodData().getFaceGeoCache()->build
+      (socket_normals, socket_faceAreas, socket_states, socket_nodes);
+  }
 
   //!->To modify the Ghost nodes, we need the normals -> after updateNormalsData
   modifyOffMeshNodes();
@@ -46,6 +46,15 @@ public:
    */
   void computeGradients();
 
+  /**
+   * Compute the gradients in the given cells: all of them are recomputed,
+   * since this class has its own gradient computation
+   */
+  virtual void computeGradientsInCells(const std::vector<CFuint>& cellIDs)
+  {
+    computeGradients();
+  }
+
   /**
    * Set up the private data
    */
@@ -337,7 +337,8 @@ void DistanceBasedExtrapolatorGMoveRhoivtLTECoupled::extrapolateInAllNodes()
 void DistanceBasedExtrapolatorGMoveRhoivtLTECoupled::extrapolateInNodes
 (const vector<Node*>& nodes)
 {
-  cf_assert(false);
+  // the coupled nodal values are only computed for all the nodes at once
+  extrapolateInAllNodes();
 }
 
 
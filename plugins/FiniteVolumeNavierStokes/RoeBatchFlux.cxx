@@ -0,0 +1,44 @@
+#include "Framework/MethodStrategyProvider.hh"
+
+#include "FiniteVolumeNavierStokes/RoeBatchFlux.hh"
+#include "FiniteVolumeNavierStokes/FiniteVolumeNavierStokes.hh"
+
+#include "NavierStokes/Euler2DVarSet.hh"
+#include "NavierStokes/Euler3DVarSet.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::Physics::NavierStokes;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace FiniteVolume {
+
+//////////////////////////////////////////////////////////////////////////////
+
+MethodStrategyProvider<RoeBatchFlux<Euler2DVarSet>,
+		       CellCenterFVMData,
+                       FluxSplitter<CellCenterFVMData>,
+		       FiniteVolumeNavierStokesModule>
+roeBatch2dProvider("RoeBatch2D");
+
+MethodStrategyProvider<RoeBatchFlux<Euler3DVarSet>,
+		       CellCenterFVMData,
+                       FluxSplitter<CellCenterFVMData>,
+		       FiniteVolumeNavierStokesModule>
+roeBatch3dProvider("RoeBatch3D");
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace FiniteVolume
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
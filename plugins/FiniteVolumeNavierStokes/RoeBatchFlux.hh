@@ -0,0 +1,142 @@
+#ifndef COOLFluiD_Numerics_FiniteVolume_RoeBatchFlux_hh
+#define COOLFluiD_Numerics_FiniteVolume_RoeBatchFlux_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "Framework/ConvectiveVarSet.hh"
+#include "FiniteVolume/RoeFlux.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace FiniteVolume {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class computes the Roe flux for the Euler and Navier-Stokes perfect
+ * gas models. Single faces are processed exactly as in RoeFlux, while the
+ * internal faces can be processed in batches (see FaceBatch): in this case
+ * the dissipation |A|(UR-UL) is evaluated in closed form from the Roe
+ * averaged wave strengths, with straight-line code for each number of
+ * dimensions and without virtual calls and temporary matrices, in loops
+ * over whole blocks of faces which the compiler can vectorize.
+ *
+ * @author Andrea Lani
+ *
+ */
+template <class UPDATEVAR>
+class RoeBatchFlux : public RoeFlux {
+public:
+  typedef UPDATEVAR UPVAR;
+
+  /**
+   * Constructor
+   */
+  RoeBatchFlux(const std::string& name);
+
+  /**
+   * Default destructor
+   */
+  virtual ~RoeBatchFlux();
+
+  /**
+   * Set up private data
+   */
+  virtual void setup();
+
+  /**
+   * Tells if the fluxes of a batch of internal faces can be computed at once
+   */
+  virtual bool hasFluxBatch() const
+  {
+    return m_hasFluxBatch;
+  }
+
+  /**
+   * Compute the fluxes integrated over the face areas and the update
+   * coefficient contributions of a batch of internal faces
+   */
+  virtual void computeFluxBatch(FaceBatch& batch);
+
+protected:
+
+  /**
+   * Batched flux computation for the given number of dimensions
+   */
+  template <int DIM>
+  void computeBatch(FaceBatch& batch);
+
+  /**
+   * Compute the squared speed of sound of the Roe averaged states
+   * of whole blocks of faces
+   * @param stride  distance between two physical data arrays of the batch
+   */
+  template <int DIM>
+  static void computeSquaredSoundSpeed(const CFuint nbBlocks, const CFuint stride,
+				       const CFreal gammaMinus1,
+				       const CFreal* dataL, const CFreal* dataR,
+				       const CFreal* sqrtRhoL, const CFreal* sqrtRhoR,
+				       CFreal* cf_restrict a2);
+
+  /**
+   * Compute the integrated fluxes and the update coefficient contributions
+   * of whole blocks of faces, given the speed of sound of the Roe averaged
+   * states: the restrict qualified outputs let the compiler vectorize the
+   * loop without runtime alias checks
+   * @param stride  distance between two physical data (or normal) arrays of the batch
+   */
+  template <int DIM>
+  static void computeFluxes(const CFuint nbBlocks, const CFuint stride,
+			    const CFreal gammaMinus1, const CFreal diffCoeff,
+			    const CFreal* dataL, const CFreal* dataR,
+			    const CFreal* normals, const CFreal* area,
+			    const CFreal* sqrtRhoL, const CFreal* sqrtRhoR, const CFreal* a,
+			    CFreal* cf_restrict fluxRho, CFreal* cf_restrict fluxX,
+			    CFreal* cf_restrict fluxY, CFreal* cf_restrict fluxZ,
+			    CFreal* cf_restrict fluxEnergy,
+			    CFreal* cf_restrict updateCoeffL, CFreal* cf_restrict updateCoeffR);
+
+  /**
+   * Tells if the given variable set computes the physical data of a
+   * calorically perfect gas
+   */
+  static bool isPerfectGasVarSet(const Framework::ConvectiveVarSet& varSet);
+
+private:
+
+  /// flag telling if the fluxes can be computed in batches
+  bool m_hasFluxBatch;
+
+  /// specific heat ratio
+  CFreal m_gamma;
+
+  /// square root of the left densities of the batch
+  std::vector<CFreal> m_sqrtRhoL;
+
+  /// square root of the right densities of the batch
+  std::vector<CFreal> m_sqrtRhoR;
+
+  /// speed of sound of the Roe averaged states of the batch
+  std::vector<CFreal> m_soundSpeed;
+
+}; // end of class RoeBatchFlux
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace FiniteVolume
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "RoeBatchFlux.ci"
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Numerics_FiniteVolume_RoeBatchFlux_hh
@@ -10,6 +10,7 @@
 #include "FluctSplit/FluctSplit.hh"
 #include "FluctSplit/ArtificialDiffusionStrategy.hh"
 #include "FluctSplit/FluctuationSplitData.hh"
+#include "Framework/Profiler.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -337,7 +338,7 @@ void FluctuationSplit::initializeSolutionImpl(bool isRestart)
     _data->setInitializationPhase(true);
     for(CFuint i = 0; i < _inits.size(); ++i) {
       cf_assert(_inits[i].isNotNull());
-      _inits[i]->execute();
+      profileExecute(_inits[i]);
     }
     _data->setInitializationPhase(false);
   }
@@ -349,7 +350,7 @@ void FluctuationSplit::extrapolateStatesToNodesImpl()
 {
   CFAUTOTRACE;
 
-  _extrapolateStates->execute();
+  profileExecute(_extrapolateStates);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -362,7 +363,7 @@ void FluctuationSplit::computeSpaceResidualImpl(CFreal factor)
   _data->setResFactor(factor);
 
   cf_assert(_computeSpaceRHS.isNotNull());
-  _computeSpaceRHS->execute();
+  profileExecute(_computeSpaceRHS);
   // apply the boundary conditions
   applyBC();
 }
@@ -381,7 +382,7 @@ void FluctuationSplit::computeTimeResidualImpl(CFreal factor)
   // if there time discretization is defined
   if (!_computeTimeRHS->isNull())
   {
-    _computeTimeRHS->execute();
+    profileExecute(_computeTimeRHS);
   }
 }
 
@@ -394,7 +395,7 @@ void FluctuationSplit::applyBCImpl()
   for(CFuint i = 0; i < _bcs.size(); ++i)
   {
     cf_assert(_bcs[i].isNotNull());
-    _bcs[i]->execute();
+    profileExecute(_bcs[i]);
   }
 }
 
@@ -429,7 +430,7 @@ void FluctuationSplit::setMethodImpl()
   for(CFuint i=0; i < _setups.size(); ++i)
   {
     cf_assert(_setups[i].isNotNull());
-    _setups[i]->execute();
+    profileExecute(_setups[i]);
   }
 
   setupCommandsAndStrategies();
@@ -446,7 +447,7 @@ void FluctuationSplit::unsetMethodImpl()
 
   for(CFuint i=0; i < _unSetups.size(); ++i){
     cf_assert(_unSetups[i].isNotNull());
-    _unSetups[i]->execute();
+    profileExecute(_unSetups[i]);
   }
 
   SpaceMethod::unsetMethodImpl();
@@ -459,7 +460,7 @@ Common::Signal::return_t FluctuationSplit::beforeMeshUpdateActionImpl(Common::Si
   CFAUTOTRACE;
 
   cf_assert(_beforeMeshUpdate.isNotNull());
-  _beforeMeshUpdate->execute();
+  profileExecute(_beforeMeshUpdate);
 
   return Common::Signal::return_t ();
 }
@@ -471,7 +472,7 @@ Common::Signal::return_t FluctuationSplit::afterMeshUpdateActionImpl(Common::Sig
   CFAUTOTRACE;
 
   cf_assert(_afterMeshUpdate.isNotNull());
-  _afterMeshUpdate->execute();
+  profileExecute(_afterMeshUpdate);
 
   return Common::Signal::return_t ();
 }
@@ -130,37 +130,39 @@ void PseudoSteadyTimeRhs::execute()
 	rhs(iState, iEq, nbEqs) -= coeffAddRhs[iEq]*dU*diagValue;
       }
 
-      // now the contribution to the jacobian matrix is calculated
-      _acc->setRowColIndex(0, currState->getLocalID());
-      for (CFuint iVar = 0; iVar < nbEqs; ++iVar) {
-	// perturb the given component of the state vector
-	_numericalJacob->perturb(iVar, (*currState)[iVar]);
-
-	// this first transformed state HAS TO BE stored,
-	// since the returned pointer will chenge pointee after
-	// the second call to transform()
-	_tempPertState = static_cast<RealVector&>
-	  (*updateToSolutionVecTrans->transform(currState));
-
-	// compute the finite difference derivative of the flux
-	_numericalJacob->computeDerivative(_tempState,
-					   _tempPertState,
-					   _fluxDiff);
-
-	// remove contribution from components whose time jacobian
-	// has to be discarded
-	_fluxDiff *= diagValue*coeffAddRhs;
-
-	_acc->addValues(0, 0, iVar, &_fluxDiff[0]);
-	// restore the unperturbed value
-	_numericalJacob->restore((*currState)[iVar]);
-      }
+      if (getMethodData().doComputeJacobian()) {
+	// now the contribution to the jacobian matrix is calculated
+	_acc->setRowColIndex(0, currState->getLocalID());
+	for (CFuint iVar = 0; iVar < nbEqs; ++iVar) {
+	  // perturb the given component of the state vector
+	  _numericalJacob->perturb(iVar, (*currState)[iVar]);
+
+	  // this first transformed state HAS TO BE stored,
+	  // since the returned pointer will chenge pointee after
+	  // the second call to transform()
+	  _tempPertState = static_cast<RealVector&>
+	    (*updateToSolutionVecTrans->transform(currState));
+
+	  // compute the finite difference derivative of the flux
+	  _numericalJacob->computeDerivative(_tempState,
+					     _tempPertState,
+					     _fluxDiff);
+
+	  // remove contribution from components whose time jacobian
+	  // has to be discarded
+	  _fluxDiff *= diagValue*coeffAddRhs;
+
+	  _acc->addValues(0, 0, iVar, &_fluxDiff[0]);
+	  // restore the unperturbed value
+	  _numericalJacob->restore((*currState)[iVar]);
+	}
 
-      // add the values in the jacobian matrix
-      jacobMatrix->addValues(*_acc);
+	// add the values in the jacobian matrix
+	jacobMatrix->addValues(*_acc);
 
-      // reset to zero the entries in the block accumulator
-      _acc->reset();
+	// reset to zero the entries in the block accumulator
+	_acc->reset();
+      }
     }
   }
 }
@@ -87,17 +87,19 @@ void TwoLayerComputeTimeRhsImpl::execute()
   const LSSIdxMapping& idxMapping =
     getMethodData().getLinearSystemSolver()[0]->getLocalToGlobalMapping();
 
-  // add the diagonal entries in the jacobian (updateCoeff/CFL)
-  for (CFuint iState = 0; iState < nbStates; ++iState) {
-    if (states[iState]->isParUpdatable()) {
-
-      CFreal diagValue1 = interUpdateCoeff[iState]*overCfl;
-      CFreal diagValue2 = updateCoeff[iState]*overCfl;
-
-      CFuint globalID = idxMapping.getColID(states[iState]->getLocalID())*2*nbEqs;
-      for (CFuint iEq = 0; iEq < 2*nbEqs; ++iEq, ++globalID) {
-        if (iEq < nbEqs) jacobMatrix->addValue(globalID, globalID, diagValue1);
-        else jacobMatrix->addValue(globalID, globalID, diagValue2);
+  if (getMethodData().doComputeJacobian()) {
+    // add the diagonal entries in the jacobian (updateCoeff/CFL)
+    for (CFuint iState = 0; iState < nbStates; ++iState) {
+      if (states[iState]->isParUpdatable()) {
+
+	CFreal diagValue1 = interUpdateCoeff[iState]*overCfl;
+	CFreal diagValue2 = updateCoeff[iState]*overCfl;
+
+	CFuint globalID = idxMapping.getColID(states[iState]->getLocalID())*2*nbEqs;
+	for (CFuint iEq = 0; iEq < 2*nbEqs; ++iEq, ++globalID) {
+	  if (iEq < nbEqs) jacobMatrix->addValue(globalID, globalID, diagValue1);
+	  else jacobMatrix->addValue(globalID, globalID, diagValue2);
+	}
       }
     }
   }
@@ -0,0 +1,761 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+#include "Common/BadValueException.hh"
+#include "Common/Stopwatch.hh"
+#include "Config/ConfigFileReader.hh"
+#include "Environment/CFEnv.hh"
+#include "Environment/DirPaths.hh"
+#include "Environment/Factory.hh"
+#include "Environment/ModuleLoader.hh"
+#include "MathTools/MathConsts.hh"
+#include "Framework/DataSocketSource.hh"
+#include "Framework/MeshData.hh"
+#include "Framework/Namespace.hh"
+#include "Framework/NamespaceSwitcher.hh"
+#include "Framework/PhysicalModel.hh"
+#include "Framework/SubSystemStatus.hh"
+#include "FiniteVolume/CellCenterFVM.hh"
+#include "FiniteVolume/FaceBatch.hh"
+#include "FiniteVolume/FVMCC_FluxSplitter.hh"
+#include "FiniteVolume/FVMCC_PolyRec.hh"
+
+/**
+ @file flux-splitter-benchmark.cxx: micro-benchmark of the FVMCC flux splitters.
+
+ The flux splitters are instantiated through their providers inside a
+ CellCenterFVM method which is configured but never set up on a mesh:
+ only the VarSets, the transformers, the reconstructor and the splitter
+ itself are set up. Each splitter is then evaluated on a fixed set of
+ synthetic faces (random left/right states around a reference state and
+ random unit normals), mimicking the per-face work of FVMCC_ComputeRHS
+ without the contributions to the update coefficient.
+
+ For every splitter it reports:
+  - the best time over the loops in ns/face and the corresponding throughput
+  - the consistency error max|F(u,u,n) - f(u).n|/max|f(u).n|
+  - the maximum relative deviation from the first splitter of the model
+  - for the splitters with a batched evaluation, the maximum relative
+    deviation of the batched fluxes from the single face ones
+
+ With "--smoke true" (run by ctest) only a few faces and one loop are used,
+ and the exit status is non zero if a splitter fails or if its consistency
+ error or its batch deviation is above the given tolerance.
+
+ By default, Euler and Navier-Stokes 2D/3D perfect gas models are run.
+ Other models (e.g. NEQ) can be run by selecting the model, VarSets and
+ splitters on the command line, loading the needed modules and providing
+ the model options in a CFcase-like file, e.g.:
+
+   flux-splitter-benchmark --modules "libNEQ libFiniteVolumeNEQ libMutationpp"
+     --model NavierStokes2DNEQ --updateVar RhoivtTv --solutionVar Cons
+     --linearVar Rhoivt --diffusiveVar RhoivtTv --splitters AUSMPlusUpMS2D
+     --refState "..." --config neq.inter
+
+ where the keys in the file are prefixed by the model name
+ (e.g. NavierStokes2DNEQ.PropertyLibrary = Mutationpp).
+**/
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD;
+using namespace COOLFluiD::Common;
+using namespace COOLFluiD::Config;
+using namespace COOLFluiD::Environment;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::Numerics::FiniteVolume;
+
+//////////////////////////////////////////////////////////////////////////////
+
+class AppOptions : public Config::ConfigObject {
+
+  public:
+
+    static void defineConfigOptions(Config::OptionList& options)
+    {
+      options.addConfigOption< CFuint > ("log","Logging level for output");
+      options.addConfigOption< bool >   ("help", "Show this help");
+      options.addConfigOption< CFuint > ("nbFaces","Number of synthetic faces");
+      options.addConfigOption< CFuint > ("nbLoops","Number of timed loops over all the faces (the best one is reported)");
+      options.addConfigOption< CFuint > ("seed","Seed of the random generator of the synthetic states");
+      options.addConfigOption< CFreal > ("perturbation","Relative amplitude of the perturbation of the reference state");
+      options.addConfigOption< bool >   ("smoke","Smoke test: few faces and one loop, failing if a splitter fails or is not consistent");
+      options.addConfigOption< CFreal > ("tolerance","Maximum consistency error accepted by the smoke test");
+      options.addConfigOption< std::string > ("model","Physical model to benchmark (all the built-in perfect gas models if empty)");
+      options.addConfigOption< std::string > ("updateVar","Update variables");
+      options.addConfigOption< std::string > ("solutionVar","Solution variables");
+      options.addConfigOption< std::string > ("linearVar","Linearization variables");
+      options.addConfigOption< std::string > ("diffusiveVar","Diffusive variables (needed by models with a diffusive term)");
+      options.addConfigOption< std::vector<std::string> > ("splitters","Flux splitters to benchmark");
+      options.addConfigOption< std::vector<CFreal> > ("refState","Reference state in update variables");
+      options.addConfigOption< std::vector<std::string> > ("modules","Additional modules to load");
+      options.addConfigOption< std::string > ("config","File with additional configuration options");
+    }
+
+    AppOptions() : ConfigObject("FluxSplitterBenchmark"),
+      logLevel(ERROR),
+      showUsage(false),
+      nbFaces(100000),
+      nbLoops(5),
+      seed(1),
+      perturbation(0.1),
+      smoke(false),
+      tolerance(1e-8),
+      model(),
+      updateVar("Pvt"),
+      solutionVar("Cons"),
+      linearVar("Roe"),
+      diffusiveVar(),
+      splitters(),
+      refState(),
+      modules(),
+      configFile()
+    {
+      addConfigOptionsTo(this);
+      addEnvironmentVariable("COOLFLUID_OPTS");
+
+      setParameter("log",          &logLevel);
+      setParameter("help",         &showUsage);
+      setParameter("nbFaces",      &nbFaces);
+      setParameter("nbLoops",      &nbLoops);
+      setParameter("seed",         &seed);
+      setParameter("perturbation", &perturbation);
+      setParameter("smoke",        &smoke);
+      setParameter("tolerance",    &tolerance);
+      setParameter("model",        &model);
+      setParameter("updateVar",    &updateVar);
+      setParameter("solutionVar",  &solutionVar);
+      setParameter("linearVar",    &linearVar);
+      setParameter("diffusiveVar", &diffusiveVar);
+      setParameter("splitters",    &splitters);
+      setParameter("refState",     &refState);
+      setParameter("modules",      &modules);
+      setParameter("config",       &configFile);
+    }
+
+  public:
+
+      CFuint  logLevel;
+      bool showUsage;
+      CFuint nbFaces;
+      CFuint nbLoops;
+      CFuint seed;
+      CFreal perturbation;
+      bool smoke;
+      CFreal tolerance;
+      std::string model;
+      std::string updateVar;
+      std::string solutionVar;
+      std::string linearVar;
+      std::string diffusiveVar;
+      std::vector<std::string> splitters;
+      std::vector<CFreal> refState;
+      std::vector<std::string> modules;
+      std::string configFile;
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// Physical model, VarSets and flux splitters of one benchmark case
+struct BenchmarkCase {
+  std::string model;
+  std::string updateVar;
+  std::string solutionVar;
+  std::string linearVar;
+  std::string diffusiveVar;
+  std::vector<std::string> splitters;
+  std::vector<CFreal> refState;
+};
+
+/// Synthetic faces shared by all the splitters of a case
+struct SyntheticFaces {
+  CFuint nbFaces;
+  CFuint nbEqs;
+  CFuint dim;
+  std::vector<CFreal> leftStates;
+  std::vector<CFreal> rightStates;
+  std::vector<CFreal> normals;
+};
+
+/// Outcome of the benchmark of one flux splitter
+struct SplitterResult {
+  SplitterResult() : ok(false), nsPerFace(0.), consistencyError(0.), batchError(-1.), fluxes() {}
+  bool ok;
+  std::string error;
+  CFreal nsPerFace;
+  CFreal consistencyError;
+  /// negative if the splitter has no batched evaluation
+  CFreal batchError;
+  std::vector<CFreal> fluxes;
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// Uniform random number in [-1,1) (minimal standard generator, reproducible
+/// on every platform)
+CFreal nextRandom(CFuint& seed)
+{
+  seed = static_cast<CFuint>((static_cast<unsigned long long>(seed)*48271ULL) % 2147483647ULL);
+  return 2.*static_cast<CFreal>(seed)/2147483647. - 1.;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void buildSyntheticFaces(const BenchmarkCase& bc, const AppOptions& options,
+                         SyntheticFaces& faces)
+{
+  faces.nbFaces = options.nbFaces;
+  faces.nbEqs = PhysicalModelStack::getActive()->getNbEq();
+  faces.dim = PhysicalModelStack::getActive()->getDim();
+
+  if (bc.refState.size() != faces.nbEqs) {
+    throw BadValueException
+      (FromHere(), "refState of " + bc.model + " must have " +
+       StringOps::to_str(faces.nbEqs) + " entries");
+  }
+
+  CFuint seed = options.seed % 2147483646 + 1;
+  faces.leftStates.resize(faces.nbFaces*faces.nbEqs);
+  faces.rightStates.resize(faces.nbFaces*faces.nbEqs);
+  faces.normals.resize(faces.nbFaces*faces.dim);
+
+  for (CFuint iFace = 0; iFace < faces.nbFaces; ++iFace) {
+    const CFuint start = iFace*faces.nbEqs;
+    for (CFuint iEq = 0; iEq < faces.nbEqs; ++iEq) {
+      const CFreal ref = bc.refState[iEq];
+      faces.leftStates[start + iEq]  = ref*(1. + options.perturbation*nextRandom(seed));
+      faces.rightStates[start + iEq] = ref*(1. + options.perturbation*nextRandom(seed));
+    }
+
+    CFreal norm = 0.;
+    do {
+      norm = 0.;
+      for (CFuint iDim = 0; iDim < faces.dim; ++iDim) {
+        const CFreal n = nextRandom(seed);
+        faces.normals[iFace*faces.dim + iDim] = n;
+        norm += n*n;
+      }
+    } while (norm < 1e-6);
+
+    const CFreal invNorm = 1./std::sqrt(norm);
+    for (CFuint iDim = 0; iDim < faces.dim; ++iDim) {
+      faces.normals[iFace*faces.dim + iDim] *= invNorm;
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// Sets up the parts of the CellCenterFVMData used by the flux splitters,
+/// connecting the limiter socket of the reconstructor to a local source
+void setupFluxData(CellCenterFVMData& data, DataSocketSource<CFreal>& limiter)
+{
+  const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
+  const CFuint dim = PhysicalModelStack::getActive()->getDim();
+
+  data.getUpdateVar()->setup();
+  data.getSolutionVar()->setup();
+  data.getDiffusiveVar()->setup();
+
+  data.getSolToUpdateInUpdateMatTrans()->setup(2);
+  data.getUpdateToSolutionVecTrans()->setup(2);
+  data.getSolutionToLinearVecTrans()->setup(2);
+  data.getUpdateToReconstructionVecTrans()->setup(2);
+  data.getReconstructionToUpdateVecTrans()->setup(2);
+  data.getUpdateToSolutionInUpdateMatTrans()->setup(2);
+  data.getJacobianLinearizer()->setMaxNbStates(2);
+
+  data.getUnitNormal().resize(dim);
+
+  SafePtr<FVMCC_PolyRec> polyRec = data.getPolyReconstructor();
+  vector<SafePtr<BaseDataSocketSink> > sinks = polyRec->needsSockets();
+  for (CFuint i = 0; i < sinks.size(); ++i) {
+    if (sinks[i]->getDataSocketName() == "limiter") {
+      limiter.setNamespace(sinks[i]->getNamespace());
+      limiter.allocate(MeshDataStack::getActive()->getDataStorage(), sinks[i]->getNamespace());
+      limiter.getDataHandle().resize(nbEqs);
+      sinks[i]->connectTo(&limiter);
+    }
+  }
+
+  polyRec->setup();
+  data.getFluxSplitter()->setup();
+
+  // no contribution to the update coefficient: faces and sockets are not needed
+  data.setIsPerturb(true);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void runSplitter(const BenchmarkCase& bc, const std::string& splitter,
+                 const SyntheticFaces& faces, const AppOptions& options,
+                 const ConfigArgs& extraArgs, SplitterResult& result)
+{
+  const std::string methodName = "FluxBenchmark" + bc.model + splitter;
+  const std::string prefix = methodName + ".";
+
+  ConfigArgs args = extraArgs;
+  args[prefix + "Namespace"] = bc.model;
+  args[prefix + "Data.FluxSplitter"] = splitter;
+  args[prefix + "Data.UpdateVar"] = bc.updateVar;
+  args[prefix + "Data.SolutionVar"] = bc.solutionVar;
+  args[prefix + "Data.LinearVar"] = bc.linearVar;
+  if (!bc.diffusiveVar.empty()) {
+    args[prefix + "Data.DiffusiveVar"] = bc.diffusiveVar;
+  }
+
+  SelfRegistPtr<SpaceMethod> method;
+  method.reset(Factory<SpaceMethod>::getInstance().getProvider("CellCenterFVM")->create(methodName));
+  method->configure(args);
+  method->setSocketNamespaces();
+
+  CellCenterFVMData& data = *dynamic_cast<CellCenterFVM*>(method.getPtr())->getData();
+  DataSocketSource<CFreal> limiter("limiter");
+  setupFluxData(data, limiter);
+
+  SafePtr<FVMCC_FluxSplitter> fluxSplitter = data.getFluxSplitter().d_castTo<FVMCC_FluxSplitter>();
+  SafePtr<ConvectiveVarSet> updateVar = data.getUpdateVar();
+  SafePtr<FVMCC_PolyRec> polyRec = data.getPolyReconstructor();
+  vector<State*>& states = polyRec->getExtrapolatedValues();
+  vector<RealVector>& pdata = polyRec->getExtrapolatedPhysicaData();
+  RealVector& unitNormal = data.getUnitNormal();
+
+  Node faceCenter;
+  faceCenter = 0.;
+  states[0]->setSpaceCoordinates(&faceCenter);
+  states[1]->setSpaceCoordinates(&faceCenter);
+
+  const CFuint nbFaces = faces.nbFaces;
+  const CFuint nbEqs = faces.nbEqs;
+  const CFuint dim = faces.dim;
+  RealVector flux(0., nbEqs);
+  result.fluxes.resize(nbFaces*nbEqs);
+
+  // timed loops, same per-face work as FVMCC_ComputeRHS
+  Stopwatch<WallTime> stp;
+  CFreal bestTime = MathTools::MathConsts::CFrealMax();
+  for (CFuint iLoop = 0; iLoop < std::max<CFuint>(options.nbLoops, 1); ++iLoop) {
+    stp.restart();
+    for (CFuint iFace = 0; iFace < nbFaces; ++iFace) {
+      const CFuint start = iFace*nbEqs;
+      State& stateL = *states[0];
+      State& stateR = *states[1];
+      for (CFuint iEq = 0; iEq < nbEqs; ++iEq) {
+        stateL[iEq] = faces.leftStates[start + iEq];
+        stateR[iEq] = faces.rightStates[start + iEq];
+      }
+      for (CFuint iDim = 0; iDim < dim; ++iDim) {
+        unitNormal[iDim] = faces.normals[iFace*dim + iDim];
+      }
+
+      updateVar->computePhysicalData(stateL, pdata[0]);
+      updateVar->computePhysicalData(stateR, pdata[1]);
+
+      flux = 0.;
+      fluxSplitter->computeUnitFlux(flux);
+
+      for (CFuint iEq = 0; iEq < nbEqs; ++iEq) {
+        result.fluxes[start + iEq] = flux[iEq];
+      }
+    }
+    stp.stop();
+    bestTime = std::min(bestTime, stp.read());
+  }
+  result.nsPerFace = bestTime*1e9/static_cast<CFreal>(nbFaces);
+
+  // batched evaluation of the same faces (with unit areas, so that the
+  // integrated fluxes are the unit ones), compared with the single face one
+  result.batchError = -1.;
+  if (fluxSplitter->hasFluxBatch()) {
+    const CFuint batchSize = 128;
+    FaceBatch batch;
+    batch.resize(batchSize, nbEqs, pdata[0].size(), dim);
+    result.batchError = 0.;
+    for (CFuint batchStart = 0; batchStart < nbFaces; batchStart += batchSize) {
+      const CFuint batchEnd = std::min(batchStart + batchSize, nbFaces);
+      batch.clear();
+      for (CFuint iFace = batchStart; iFace < batchEnd; ++iFace) {
+        const CFuint start = iFace*nbEqs;
+        for (CFuint iEq = 0; iEq < nbEqs; ++iEq) {
+          (*states[0])[iEq] = faces.leftStates[start + iEq];
+          (*states[1])[iEq] = faces.rightStates[start + iEq];
+        }
+        for (CFuint iDim = 0; iDim < dim; ++iDim) {
+          unitNormal[iDim] = faces.normals[iFace*dim + iDim];
+        }
+        updateVar->computePhysicalData(*states[0], pdata[0]);
+        updateVar->computePhysicalData(*states[1], pdata[1]);
+
+        const CFuint idx = batch.addFace(0, 1, 1.);
+        batch.setData(0, idx, pdata[0]);
+        batch.setData(1, idx, pdata[1]);
+        batch.setNormal(idx, unitNormal);
+      }
+
+      fluxSplitter->computeFluxBatch(batch);
+
+      for (CFuint idx = 0; idx < batch.size(); ++idx) {
+        const CFuint start = (batchStart + idx)*nbEqs;
+        CFreal maxDiff = 0.;
+        CFreal maxFlux = 0.;
+        for (CFuint iEq = 0; iEq < nbEqs; ++iEq) {
+          maxDiff = std::max(maxDiff, std::abs(batch.getFlux(iEq)[idx] - result.fluxes[start + iEq]));
+          maxFlux = std::max(maxFlux, std::abs(result.fluxes[start + iEq]));
+        }
+        result.batchError = std::max(result.batchError,
+                                     maxDiff/std::max(maxFlux, MathTools::MathConsts::CFrealEps()));
+      }
+    }
+  }
+
+  // consistency check: with identical left and right states the numerical
+  // flux must reduce to the physical one
+  const CFuint nbChecks = std::min<CFuint>(nbFaces, 1000);
+  result.consistencyError = 0.;
+  for (CFuint iFace = 0; iFace < nbChecks; ++iFace) {
+    const CFuint start = iFace*nbEqs;
+    for (CFuint iEq = 0; iEq < nbEqs; ++iEq) {
+      (*states[0])[iEq] = faces.leftStates[start + iEq];
+      (*states[1])[iEq] = faces.leftStates[start + iEq];
+    }
+    for (CFuint iDim = 0; iDim < dim; ++iDim) {
+      unitNormal[iDim] = faces.normals[iFace*dim + iDim];
+    }
+    updateVar->computePhysicalData(*states[0], pdata[0]);
+    updateVar->computePhysicalData(*states[1], pdata[1]);
+
+    flux = 0.;
+    fluxSplitter->computeUnitFlux(flux);
+
+    const RealVector& physFlux = updateVar->getFlux()(pdata[0], unitNormal);
+    CFreal maxDiff = 0.;
+    CFreal maxFlux = 0.;
+    for (CFuint iEq = 0; iEq < nbEqs; ++iEq) {
+      maxDiff = std::max(maxDiff, std::abs(flux[iEq] - physFlux[iEq]));
+      maxFlux = std::max(maxFlux, std::abs(physFlux[iEq]));
+    }
+    result.consistencyError = std::max(result.consistencyError,
+                                       maxDiff/std::max(maxFlux, MathTools::MathConsts::CFrealEps()));
+  }
+
+  // the local limiter source is going out of scope
+  vector<SafePtr<BaseDataSocketSink> > sinks = polyRec->needsSockets();
+  for (CFuint i = 0; i < sinks.size(); ++i) {
+    if (sinks[i]->getDataSocketName() == "limiter") {
+      sinks[i]->unplug();
+    }
+  }
+  limiter.deallocate();
+
+  result.ok = true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// Creates the namespace, the singletons and the physical model of a case
+/// and makes them active
+void activateModel(const BenchmarkCase& bc, const ConfigArgs& extraArgs)
+{
+  const std::string ssName = SubSystemStatusStack::getCurrentName();
+  NamespaceSwitcher& nsw = NamespaceSwitcher::getInstance(ssName);
+
+  SafePtr<Namespace> nsp = nsw.createUniqueNamespace(bc.model);
+  nsp->setMeshDataName(bc.model);
+  nsp->setPhysicalModelName(bc.model);
+  nsp->setPhysicalModelType(bc.model);
+  nsp->setSubSystemStatusName(bc.model);
+
+  MeshDataStack::getInstance().createUnique(bc.model);
+  SafePtr<PhysicalModel> physModel = PhysicalModelStack::getInstance().createUnique(bc.model);
+  SubSystemStatusStack::getInstance().createUnique(bc.model);
+
+  if (!physModel->isConfigured()) {
+    SelfRegistPtr<PhysicalModelImpl> physModelImpl =
+      Factory<PhysicalModelImpl>::getInstance().getProvider(bc.model)->create(bc.model);
+    ConfigArgs args = extraArgs;
+    physModelImpl->configure(args);
+
+    physModel->setPhysicalModelImpl(physModelImpl);
+    const CFuint nbEqs = physModel->getNbEq();
+    physModel->setEquationSubSysDescriptor(0,nbEqs,0);
+  }
+
+  nsw.setEnabled(true);
+  MeshDataStack::getInstance().setEnabled(true);
+  PhysicalModelStack::getInstance().setEnabled(true);
+  SubSystemStatusStack::getInstance().setEnabled(true);
+  nsw.pushNamespace(bc.model);
+
+  PhysicalModelStack::getActive()->getImplementor()->setup();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// @return the number of splitters which failed or, in smoke test mode,
+///         whose consistency error is above the tolerance
+CFuint runCase(const BenchmarkCase& bc, const AppOptions& options,
+               const ConfigArgs& extraArgs)
+{
+  activateModel(bc, extraArgs);
+
+  SyntheticFaces faces;
+  buildSyntheticFaces(bc, options, faces);
+
+  cout << "\n" << bc.model << " (" << bc.updateVar << " update, "
+       << bc.solutionVar << " solution): " << faces.nbFaces << " faces, "
+       << faces.nbEqs << " equations\n";
+  cout << setw(28) << left << "  splitter" << right
+       << setw(12) << "ns/face"
+       << setw(14) << "Mfaces/s"
+       << setw(14) << "consistency"
+       << setw(14) << "max dev." << "   reference\n";
+
+  CFuint nbFailures = 0;
+  const SplitterResult* reference = CFNULL;
+  std::string referenceName;
+  std::vector<SplitterResult> results(bc.splitters.size());
+
+  for (CFuint iSp = 0; iSp < bc.splitters.size(); ++iSp) {
+    const std::string& splitter = bc.splitters[iSp];
+    SplitterResult& result = results[iSp];
+    try {
+      runSplitter(bc, splitter, faces, options, extraArgs, result);
+    }
+    catch (std::exception& e) {
+      result.ok = false;
+      result.error = e.what();
+    }
+
+    cout << "  " << setw(26) << left << splitter << right;
+    if (!result.ok) {
+      cout << "  FAILED: " << result.error << "\n";
+      nbFailures++;
+      continue;
+    }
+
+    // deviation from the first successful splitter of this case
+    CFreal maxDev = 0.;
+    if (reference == CFNULL) {
+      reference = &result;
+      referenceName = splitter;
+    }
+    else {
+      const CFuint nbEqs = faces.nbEqs;
+      for (CFuint iFace = 0; iFace < faces.nbFaces; ++iFace) {
+        CFreal maxDiff = 0.;
+        CFreal maxFlux = 0.;
+        for (CFuint iEq = 0; iEq < nbEqs; ++iEq) {
+          const CFuint idx = iFace*nbEqs + iEq;
+          maxDiff = std::max(maxDiff, std::abs(result.fluxes[idx] - reference->fluxes[idx]));
+          maxFlux = std::max(maxFlux, std::abs(reference->fluxes[idx]));
+        }
+        maxDev = std::max(maxDev, maxDiff/std::max(maxFlux, MathTools::MathConsts::CFrealEps()));
+      }
+    }
+
+    cout << setw(12) << fixed << setprecision(1) << result.nsPerFace
+         << setw(14) << setprecision(3) << 1e3/result.nsPerFace
+         << setw(14) << scientific << setprecision(2) << result.consistencyError
+         << setw(14) << maxDev << "   " << referenceName << "\n";
+    cout.unsetf(ios::floatfield);
+
+    if (result.batchError >= 0.) {
+      cout << "  " << setw(26) << left << (splitter + " batched") << right
+           << setw(12 + 14 + 14 + 14) << scientific << setprecision(2) << result.batchError
+           << "   " << splitter << "\n";
+      cout.unsetf(ios::floatfield);
+    }
+
+    if (options.smoke && !(result.consistencyError <= options.tolerance)) {
+      cout << "  " << splitter << " FAILED: consistency error above " << options.tolerance << "\n";
+      nbFailures++;
+    }
+    if (options.smoke && result.batchError > options.tolerance) {
+      cout << "  " << splitter << " FAILED: batched fluxes deviate by more than " << options.tolerance << "\n";
+      nbFailures++;
+    }
+
+    // fluxes are only kept for the reference
+    if (&result != reference) {
+      std::vector<CFreal>().swap(result.fluxes);
+    }
+  }
+
+  NamespaceSwitcher::getInstance(SubSystemStatusStack::getCurrentName()).popNamespace();
+
+  return nbFailures;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void addBuiltinCases(std::vector<BenchmarkCase>& cases)
+{
+  BenchmarkCase euler2D;
+  euler2D.model = "Euler2D";
+  euler2D.updateVar = "Puvt";
+  euler2D.solutionVar = "Cons";
+  euler2D.linearVar = "Roe";
+  euler2D.splitters.push_back("Roe");
+  euler2D.splitters.push_back("RoeT4");
+  euler2D.splitters.push_back("AUSMPlusUp2D");
+  euler2D.splitters.push_back("AUSMPlus2D");
+  euler2D.splitters.push_back("HLLE2D");
+  euler2D.splitters.push_back("StegerWarming");
+  euler2D.splitters.push_back("RoeBatch2D");
+  // p [Pa], u, v [m/s], T [K]
+  euler2D.refState.push_back(1e5);
+  euler2D.refState.push_back(200.);
+  euler2D.refState.push_back(50.);
+  euler2D.refState.push_back(300.);
+  cases.push_back(euler2D);
+
+  BenchmarkCase euler3D = euler2D;
+  euler3D.model = "Euler3D";
+  euler3D.updateVar = "Pvt";
+  euler3D.splitters.clear();
+  euler3D.splitters.push_back("Roe");
+  euler3D.splitters.push_back("AUSMPlusUp3D");
+  euler3D.splitters.push_back("AUSMPlus3D");
+  euler3D.splitters.push_back("HLLE3D");
+  euler3D.splitters.push_back("StegerWarming");
+  euler3D.splitters.push_back("RoeBatch3D");
+  euler3D.refState.insert(euler3D.refState.begin() + 3, 20.);
+  cases.push_back(euler3D);
+
+  // the convective fluxes are the same, but the VarSets are the NS ones
+  BenchmarkCase ns2D = euler2D;
+  ns2D.model = "NavierStokes2D";
+  ns2D.diffusiveVar = "Puvt";
+  ns2D.splitters.erase(ns2D.splitters.begin() + 1);
+  cases.push_back(ns2D);
+
+  BenchmarkCase ns3D = euler3D;
+  ns3D.model = "NavierStokes3D";
+  ns3D.diffusiveVar = "Pvt";
+  cases.push_back(ns3D);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char** argv)
+{
+  AppOptions options;
+  options.getOptionList().setStrictArgs(true);
+
+  // process the command line
+  try
+  {
+    options.getOptionList().processCommandLine(argc, argv);
+  }
+  // Something bad happened. Dump the usage statement:
+  catch (const Exception& e)
+  {
+    cerr << options.writeUsage();
+    exit(1);
+  }
+
+  Environment::CFEnv::getInstance().initiate(argc, argv);
+  CFLogger::getInstance().setMainLoggerLevel(options.logLevel);
+
+  // showUsage if --help
+  if (options.showUsage)
+  {
+    cout << options.writeUsage();
+    exit(0);
+  }
+
+  // the smoke test only checks that every splitter runs and is consistent
+  if (options.smoke)
+  {
+    options.nbFaces = std::min<CFuint>(options.nbFaces, 1000);
+    options.nbLoops = 1;
+  }
+
+  int return_value = 0;
+  try
+  {
+    // modules not linked to this application (e.g. NEQ and its thermodynamic library)
+    if (!options.modules.empty()) {
+      ModuleLoader loader;
+      std::vector<boost::filesystem::path> paths = DirPaths::getInstance().getModulesDir();
+      loader.setSearchPaths(paths);
+      for (CFuint i = 0; i < options.modules.size(); ++i) {
+        loader.loadModule(options.modules[i]);
+      }
+    }
+    Environment::CFEnv::getInstance().initiateModules();
+
+    ConfigArgs extraArgs;
+    if (!options.configFile.empty()) {
+      ConfigFileReader configReader;
+      configReader.parse(options.configFile, extraArgs);
+    }
+
+    std::vector<BenchmarkCase> cases;
+    if (options.model.empty()) {
+      addBuiltinCases(cases);
+    }
+    else {
+      BenchmarkCase userCase;
+      userCase.model = options.model;
+      userCase.updateVar = options.updateVar;
+      userCase.solutionVar = options.solutionVar;
+      userCase.linearVar = options.linearVar;
+      userCase.diffusiveVar = options.diffusiveVar;
+      userCase.splitters = options.splitters;
+      userCase.refState = options.refState;
+      cases.push_back(userCase);
+    }
+
+    // restrict the built-in cases to the requested splitters
+    if (options.model.empty() && !options.splitters.empty()) {
+      for (CFuint iCase = 0; iCase < cases.size(); ++iCase) {
+        std::vector<std::string> selected;
+        for (CFuint iSp = 0; iSp < cases[iCase].splitters.size(); ++iSp) {
+          const std::string& name = cases[iCase].splitters[iSp];
+          if (std::find(options.splitters.begin(), options.splitters.end(), name) != options.splitters.end()) {
+            selected.push_back(name);
+          }
+        }
+        cases[iCase].splitters = selected;
+      }
+    }
+
+    CFuint nbFailures = 0;
+    for (CFuint iCase = 0; iCase < cases.size(); ++iCase) {
+      if (!cases[iCase].splitters.empty()) {
+        nbFailures += runCase(cases[iCase], options, extraArgs);
+      }
+    }
+    if (nbFailures > 0) {
+      cerr << nbFailures << " flux splitter(s) failed" << endl;
+      return_value = 1;
+    }
+  }
+  catch (std::exception& e)
+  {
+    cerr << e.what() << endl;
+    cerr << "Aborting ... " << endl;
+    return_value = 1;
+  }
+  catch (...)
+  {
+    cerr << "Unknown exception thrown and not caught !!!" << endl;
+    cerr << "Aborting ... " << endl;
+    return_value = 1;
+  }
+
+  Environment::CFEnv::getInstance().terminate();
+
+  return return_value;
+}
@@ -11,6 +11,7 @@
 #include "Framework/SubSystemStatus.hh"
 #include "ForwardEuler/ForwardEuler.hh"
 #include "Framework/CFL.hh"
+#include "Framework/Profiler.hh"
 #include "MathTools/MathConsts.hh"
 
 //////////////////////////////////////////////////////////////////////////////
@@ -127,14 +128,14 @@ void FwdEuler::setMethodImpl()
 
   setupCommandsAndStrategies();
 
-  m_setup->execute();
+  profileExecute(m_setup);
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
 void FwdEuler::unsetMethodImpl()
 {
-  m_unSetup->execute();
+  profileExecute(m_unSetup);
 
   unsetupCommandsAndStrategies();
 
@@ -158,7 +159,7 @@ void FwdEuler::takeStepImpl()
 
   // do a prepare step, usually backing up the solution to pastStates
   CFLog(VERBOSE, "ForwardEuler::takeStep(): calling Prepare step\n");
-  if (m_prepare->isNotNull()) { m_prepare->execute(); }
+  if (m_prepare->isNotNull()) { profileExecute(m_prepare); }
 
   getConvergenceMethodData()->getConvergenceStatus().res     = subSysStatus->getResidual();
   getConvergenceMethodData()->getConvergenceStatus().iter    = 0;
@@ -182,7 +183,7 @@ void FwdEuler::takeStepImpl()
     // do an intermediate step, useful for some special
     // types of temporal discretization
     CFLog(VERBOSE, "ForwardEuler::takeStep(): calling Intermediate step\n");
-    m_intermediate->execute();
+    profileExecute(m_intermediate);
 
     CFLog(VERBOSE, "ForwardEuler::takeStep(): computing the Time Residual\n");
     getMethodData()->getCollaborator<SpaceMethod>()->computeTimeResidual(1.0);
@@ -190,7 +191,7 @@ void FwdEuler::takeStepImpl()
     CFLog(VERBOSE, "ForwardEuler::takeStep(): updating the solution\n");
 
     if (m_data->getDoUpdateSolution()) {
-      m_updateSol->execute();
+      profileExecute(m_updateSol);
     }
 
     CFLog(VERBOSE, "ForwardEuler::syncGlobalDataComputeResidual()\n");
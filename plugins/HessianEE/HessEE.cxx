@@ -1,6 +1,7 @@
 #include "HessEE.hh"
 #include "Environment/ObjectProvider.hh"
 #include "Framework/SubSystemStatus.hh"
+#include "Framework/Profiler.hh"
 #include "HessianEE/HessianEE.hh"
 
 //////////////////////////////////////////////////////////////////////////////
@@ -112,14 +113,14 @@ void HessEE::setMethodImpl()
 
   _data->getGeoWithNodesBuilder()->setup();
   setupCommandsAndStrategies();
-  _setup->execute();
+  profileExecute(_setup);
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
 void HessEE::unsetMethodImpl()
 {
-  _unSetup->execute();
+  profileExecute(_unSetup);
   unsetupCommandsAndStrategies();
 
   ErrorEstimatorMethod::unsetMethodImpl();
@@ -137,23 +138,23 @@ void HessEE::estimateImpl()
     // set the nodal states at first
     getMethodData()->getCollaborator<SpaceMethod>()->extrapolateStatesToNodes();
 
-    _computeFunction->execute();
+    profileExecute(_computeFunction);
 
-    _computeHessian->execute();
+    profileExecute(_computeHessian);
 
     _data->rSmthDataName() = "hessian";
     _data->rSmthNIter() = _data->getHessSmoothNb();
     _data->rSmthWght() = _data->getHessSmoothWght();
-    _smoother->execute();
+    profileExecute(_smoother);
 
-    _computeMetric->execute();
+    profileExecute(_computeMetric);
 
     _data->rSmthDataName() = "metric";
     _data->rSmthNIter() = _data->getMetricSmoothNb();
     _data->rSmthWght() = _data->getMetricSmoothWght();
-    _smoother->execute();
+    profileExecute(_smoother);
 
-    _updater->execute();
+    profileExecute(_updater);
   }
 }
 
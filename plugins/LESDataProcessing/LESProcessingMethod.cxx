@@ -5,6 +5,7 @@
 #include "Framework/SubSystemStatus.hh"
 #include "LESProcessingMethod.hh"
 #include "Framework/DataProcessingMethod.hh"
+#include "Framework/Profiler.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -126,13 +127,13 @@ void LESProcessing::processDataImpl()
 
   // The prepare command should only be run once.
   // The iteration should be checked inside the prepare command
-  // m_prepare->execute();
+  // profileExecute(m_prepare);
 
   // execute all processes.
   // Each command should have a built-in processRate which can be configured
   for(CFuint i=0; i<m_processes.size(); ++i) {
     cf_assert(m_processes[i].isNotNull());
-    m_processes[i]->execute();
+    profileExecute(m_processes[i]);
   }
 
 }
@@ -6,6 +6,7 @@
 #include "Framework/SubSystemStatus.hh"
 #include "Framework/SpaceMethod.hh"
 #include "Framework/CFL.hh"
+#include "Framework/Profiler.hh"
 
 #include "LUSGSMethod/LUSGSMethod.hh"
 #include "LUSGSMethod/LUSGSCrankNich.hh"
@@ -107,28 +108,28 @@ void LUSGSCrankNich::takeStepImpl()
   m_data->setForwardSweep(true);
   m_data->setStopSweep(false);
   // Update states set index (it is equal to -1 at this point)
-  m_updateStatesSetIndex->execute();
+  profileExecute(m_updateStatesSetIndex);
   for (;!m_data->stopSweep();)
   {
     // Compute space residual for the current states set
     m_data->getCollaborator<SpaceMethod>()->computeSpaceRhsForStatesSet(0.5);
 
     // store the past rhs
-    m_backupPastRhs->execute();
+    profileExecute(m_backupPastRhs);
 
     // Update states set index
-    m_updateStatesSetIndex->execute();
+    profileExecute(m_updateStatesSetIndex);
   }
 
   // set the states set index back to -1
   m_data->setForwardSweep(false);
   m_data->setStopSweep(false);
   // Update states set index (it is equal to the number of states sets at this point)
-  m_updateStatesSetIndex->execute();
+  profileExecute(m_updateStatesSetIndex);
   for (;!m_data->stopSweep();)
   {
       // Update states set index
-    m_updateStatesSetIndex->execute();
+    profileExecute(m_updateStatesSetIndex);
   }
 
   // SET CURRENT TIME TO TIME AT N+1 (IN THE FOLLOWING ONLY (APPROXIMATIONS OF) THE RHS AT N+1 ARE COMPUTED
@@ -152,7 +153,7 @@ void LUSGSCrankNich::takeStepImpl()
 
     // FACTORIZES THE BLOCK JACOBIAN MATRICES.
     CFLog(VERBOSE,"Starting matrix factorizations\n");
-    m_luFactorization->execute();
+    profileExecute(m_luFactorization);
 
     // output factorization time
     CFLog(VERBOSE,"Computing and factorizing diagonal block matrices took: " << timer << "s\n");
@@ -174,26 +175,26 @@ void LUSGSCrankNich::takeStepImpl()
     m_data->setForwardSweep(true);
     m_data->setStopSweep(false);
     // Update states set index (it is equal to -1 at this point)
-    m_updateStatesSetIndex->execute();
+    profileExecute(m_updateStatesSetIndex);
     for (;!m_data->stopSweep();)
     {
       // Compute space residual for the current states set
       m_data->getCollaborator<SpaceMethod>()->computeSpaceRhsForStatesSet(0.5);
 
       // add the past rhs
-      m_addPastRhs->execute();
+      profileExecute(m_addPastRhs);
 
       // Compute time residual for the current states set
       m_data->getCollaborator<SpaceMethod>()->computeTimeRhsForStatesSet(1.0);
 
       // Compute the solution update for the current states set
-      m_computeStatesSetUpdate->execute();
+      profileExecute(m_computeStatesSetUpdate);
 
       // Update the solution for the current states set
-      m_updateSol->execute();
+      profileExecute(m_updateSol);
 
       // Update states set index
-      m_updateStatesSetIndex->execute();
+      profileExecute(m_updateStatesSetIndex);
     }
 
     // Syncronize the states
@@ -207,29 +208,29 @@ void LUSGSCrankNich::takeStepImpl()
     m_data->setForwardSweep(false);
     m_data->setStopSweep(false);
     // Update states set index (it is equal to the number of states sets at this point)
-    m_updateStatesSetIndex->execute();
+    profileExecute(m_updateStatesSetIndex);
     for (;!m_data->stopSweep();)
     {
       // Compute space residual for the current states set
       m_data->getCollaborator<SpaceMethod>()->computeSpaceRhsForStatesSet(0.5);
 
       // add the past rhs
-      m_addPastRhs->execute();
+      profileExecute(m_addPastRhs);
 
       // Compute time residual for the current states set
       m_data->getCollaborator<SpaceMethod>()->computeTimeRhsForStatesSet(1.0);
 
       // Compute the solution update for the current states set
-      m_computeStatesSetUpdate->execute();
+      profileExecute(m_computeStatesSetUpdate);
 
       // Update the solution for the current states set
-      m_updateSol->execute();
+      profileExecute(m_updateSol);
 
       // add contribution of current states set to the residual norms in the local processor
       m_data->getLUSGSNormComputer()->addStatesSetContribution();
 
       // Update states set index
-      m_updateStatesSetIndex->execute();
+      profileExecute(m_updateStatesSetIndex);
     }
 
     // Syncronize the states
@@ -6,6 +6,7 @@
 #include "Framework/SubSystemStatus.hh"
 #include "Framework/SpaceMethod.hh"
 #include "Framework/CFL.hh"
+#include "Framework/Profiler.hh"
 
 #include "LUSGSMethod/LUSGSMethod.hh"
 #include "LUSGSMethod/LUSGSIterator.hh"
@@ -158,14 +159,14 @@ void LUSGSIterator::setMethodImpl()
 
 //   m_data->setLinearSystemSolver(getLinearSystemSolver());
   setupCommandsAndStrategies();
-  m_setup->execute();
+  profileExecute(m_setup);
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
 void LUSGSIterator::unsetMethodImpl()
 {
-  m_unSetup->execute();
+  profileExecute(m_unSetup);
   unsetupCommandsAndStrategies();
   //call the parent
   ConvergenceMethod::unsetMethodImpl();
@@ -187,7 +188,7 @@ void LUSGSIterator::prepare()
     getConvergenceMethodData()->getCFL()->update();
   }
 
-  m_prepare->execute();
+  profileExecute(m_prepare);
 
   getConvergenceMethodData()->getConvergenceStatus().res     = subSysStatus->getResidual();
   getConvergenceMethodData()->getConvergenceStatus().iter    = 0;
@@ -239,7 +240,7 @@ void LUSGSIterator::takeStepImpl()
 
     // Factorizes the block Jacobian matrices.
     CFLog(VERBOSE,"Starting matrix factorizations\n");
-    m_luFactorization->execute();
+    profileExecute(m_luFactorization);
 
     // output factorization time
     CFLog(VERBOSE,"Computing and factorizing diagonal block matrices took: " << timer << "s\n");
@@ -257,13 +258,13 @@ void LUSGSIterator::takeStepImpl()
     subSysStatus->setFirstStep( k == 1 );
     subSysStatus->setMaxDT(MathTools::MathConsts::CFrealMax());
 
-//     m_init->execute();
+//     profileExecute(m_init);
     // Do forward sweep
     CFLog(VERBOSE,"LUSGSIterator::takeStep(): starting forward sweep\n");
     m_data->setForwardSweep(true);
     m_data->setStopSweep(false);
     // Update states set index (it is equal to -1 at this point)
-    m_updateStatesSetIndex->execute();
+    profileExecute(m_updateStatesSetIndex);
     for (;!m_data->stopSweep();)
     {
       // Compute space residual for the current states set
@@ -273,13 +274,13 @@ void LUSGSIterator::takeStepImpl()
 //       m_data->getCollaborator<SpaceMethod>()->computeTimeRhsForStatesSet(1.0);
 
       // Compute the solution update for the current states set
-      m_computeStatesSetUpdate->execute();
+      profileExecute(m_computeStatesSetUpdate);
 
       // Update the solution for the current states set
-      m_updateSol->execute();
+      profileExecute(m_updateSol);
 
       // Update states set index
-      m_updateStatesSetIndex->execute();
+      profileExecute(m_updateStatesSetIndex);
     }
 
     // Syncronize the states
@@ -293,7 +294,7 @@ void LUSGSIterator::takeStepImpl()
     m_data->setForwardSweep(false);
     m_data->setStopSweep(false);
     // Update states set index (it is equal to the number of states sets at this point)
-    m_updateStatesSetIndex->execute();
+    profileExecute(m_updateStatesSetIndex);
     for (;!m_data->stopSweep();)
     {
       // Compute space residual for the current states set
@@ -303,16 +304,16 @@ void LUSGSIterator::takeStepImpl()
 //       m_data->getCollaborator<SpaceMethod>()->computeTimeRhsForStatesSet(1.0);
 
       // Compute the solution update for the current states set
-      m_computeStatesSetUpdate->execute();
+      profileExecute(m_computeStatesSetUpdate);
 
       // Update the solution for the current states set
-      m_updateSol->execute();
+      profileExecute(m_updateSol);
 
       // add contribution of current states set to the residual norms in the local processor
       m_data->getLUSGSNormComputer()->addStatesSetContribution();
 
       // Update states set index
-      m_updateStatesSetIndex->execute();
+      profileExecute(m_updateStatesSetIndex);
     }
 
     // Syncronize the states
@@ -101,27 +101,47 @@ public:
 
   inline void setFaceTypes(std::vector<std::string>& wallNames, std::vector<std::string>& boundaryNames){
        m_particleTracking.setFaceTypes(m_wallTypes, wallNames, boundaryNames );
+       m_faceTypes = &m_wallTypes;
    }
 
+  /// set up this solver as a replica of the given one, sharing its face types,
+  /// so that both can track particles concurrently
+  void setupReplica(LagrangianSolver& master, Framework::SocketBundle sockets)
+  {
+    m_particleTracking.setDataSockets(sockets);
+    m_particleTracking.setupAlgorithm();
+    m_faceTypes = master.m_faceTypes;
+  }
+
    //inline CFuint getFaceStateID(CFuint faceID){return m_wallTypes(faceID,1);}
 
    inline CFuint getWallGhotsStateId(CFuint faceID){
-     cf_assert(m_wallTypes(faceID,0) !=  ParticleTracking::INTERNAL_FACE );
-     return m_wallTypes(faceID,2);
+     cf_assert((*m_faceTypes)(faceID,0) !=  ParticleTracking::INTERNAL_FACE );
+     return (*m_faceTypes)(faceID,2);
    }
 
    inline CFuint getWallStateId(CFuint faceID){
-     cf_assert(m_wallTypes(faceID,0) !=  ParticleTracking::INTERNAL_FACE );
-     return m_wallTypes(faceID,1);
+     cf_assert((*m_faceTypes)(faceID,0) !=  ParticleTracking::INTERNAL_FACE );
+     return (*m_faceTypes)(faceID,1);
    }
 
    inline CFuint getFaceType(CFuint faceID){
-       cf_assert(m_wallTypes(faceID,0)!= -1 );
-       return m_wallTypes(faceID,0);
+       cf_assert((*m_faceTypes)(faceID,0)!= -1 );
+       return (*m_faceTypes)(faceID,0);
    }
 
    void bufferCommitParticle(CFuint faceID);
 
+   /// get the current particle, which leaves the partition through the given face,
+   /// as it has to be sent to the process owning the neighbor cell
+   void getLeavingParticle(CFuint faceID, Particle<UserData>& particle, CFuint& processRank);
+
+   /// commit a particle to be sent to the given process
+   inline void bufferCommitParticle(const Particle<UserData>& particle, CFuint processRank)
+   {
+     m_sendBuffer->push_back(particle, processRank);
+   }
+
 private:
 
   void (ParticleTracking::*getNormalsPtr) (CFuint, RealVector, RealVector);
@@ -133,6 +153,9 @@ private:
   PARTICLE_TRACKING m_particleTracking;
 
   MathTools::CFMat<CFint> m_wallTypes;
+
+  /// face types used by this solver (the ones of the master solver for replicas)
+  const MathTools::CFMat<CFint>* m_faceTypes;
   
   std::auto_ptr<SendBuffer<Particle<UserData> > > m_sendBuffer;
   
@@ -144,7 +167,8 @@ private:
 
 template<typename UserData, class PARTICLE_TRACKING>
 LagrangianSolver<UserData,PARTICLE_TRACKING>::LagrangianSolver(const std::string& name) :
-  m_particleTracking(name)
+  m_particleTracking(name),
+  m_faceTypes(&m_wallTypes)
 {
 }
 
@@ -160,22 +184,31 @@ LagrangianSolver<UserData,PARTICLE_TRACKING>::~LagrangianSolver()
 template<typename UserData, class PARTICLE_TRACKING>
 void LagrangianSolver<UserData, PARTICLE_TRACKING>::bufferCommitParticle(CFuint faceID)
 {
-  const std::string nsp = Framework::MeshDataStack::getActive()->getPrimaryNamespace();
-  
-  static CFint rank = Common::PE::GetPE().GetRank(nsp);
-  cf_assert(m_wallTypes(faceID,0) == ParticleTracking::COMP_DOMAIN_FACE );
-  cf_assert(m_wallTypes(faceID,2) != rank );
-  
-  static Particle<UserData> sendParticle;
-  getParticle(sendParticle);
-  CFuint processRank = m_wallTypes(faceID,2);
+  Particle<UserData> sendParticle;
+  CFuint processRank = 0;
+  getLeavingParticle(faceID, sendParticle, processRank);
   //CFLog(INFO, "processRank: "<<processRank<<"\n");
-  sendParticle.commonData.cellID = m_wallTypes(faceID,3);
   m_sendBuffer->push_back(sendParticle, processRank );
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
+template<typename UserData, class PARTICLE_TRACKING>
+void LagrangianSolver<UserData, PARTICLE_TRACKING>::getLeavingParticle(CFuint faceID,
+								       Particle<UserData>& particle,
+								       CFuint& processRank)
+{
+  cf_assert((*m_faceTypes)(faceID,0) == ParticleTracking::COMP_DOMAIN_FACE );
+  cf_assert((*m_faceTypes)(faceID,2) != Common::PE::GetPE().GetRank
+	    (Framework::MeshDataStack::getActive()->getPrimaryNamespace()));
+  
+  getParticle(particle);
+  processRank = (*m_faceTypes)(faceID,2);
+  particle.commonData.cellID = (*m_faceTypes)(faceID,3);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 template<typename UserData, class PARTICLE_TRACKING>
 bool LagrangianSolver<UserData,PARTICLE_TRACKING>::sincronizeParticles(std::vector< Particle<UserData> >&particleBuffer,
 								       bool isLastPhoton)
@@ -84,6 +84,15 @@ protected: //data
   
   CommonData m_particleCommonData;
 
+  /// scratch storage for points (size 3)
+  RealVector m_pointBuffer;
+
+  /// scratch storage for directions (size 3)
+  RealVector m_directionBuffer;
+
+  /// scratch storage for the cartesian normals in axisymmetric cases
+  RealVector m_cartNormal;
+
 };
 
 } // namespace RadiativeTransfer
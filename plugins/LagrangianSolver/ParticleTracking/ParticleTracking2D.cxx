@@ -21,7 +21,7 @@ ParticleTracking2D::~ParticleTracking2D()
 }
 
 void ParticleTracking2D::getCommonData(CommonData &data){
-    static RealVector initialPoint(3);
+    RealVector& initialPoint = m_pointBuffer;
     getExitPoint(initialPoint);
 
     data.currentPoint[0]=initialPoint[0];
@@ -36,7 +36,7 @@ void ParticleTracking2D::getCommonData(CommonData &data){
 
 void ParticleTracking2D::newParticle(CommonData &particle)
 {
-    static RealVector buffer(2);
+    RealVector& buffer = m_directionBuffer;
     ParticleTracking::newParticle(particle);
 
    // std::cout<<"%*******************\n %NEW PARTICLE \n %************************************\n";
@@ -71,7 +71,7 @@ CFreal ParticleTracking2D::getStepDistance()
 }
 
 void ParticleTracking2D::newDirection(RealVector &direction){
-  static RealVector initialPoint(2);
+  RealVector& initialPoint = m_pointBuffer;
   cf_assert(direction.size() <= 3);
   getExitPoint(initialPoint);
 
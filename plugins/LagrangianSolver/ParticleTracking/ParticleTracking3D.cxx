@@ -29,7 +29,7 @@ ParticleTracking3D::~ParticleTracking3D(){
 }
 
 void ParticleTracking3D::getCommonData(CommonData &data){
-  static RealVector initialPoint(3);
+  RealVector& initialPoint = m_pointBuffer;
   getExitPoint(initialPoint);
 
   data.currentPoint[0]=initialPoint[0];
@@ -307,7 +307,7 @@ void ParticleTracking3D::newParticle(CommonData &particle){
 
 //  std::cout<<"%*******************\n%NEW PARTICLE\n%************************************\n";
 
-  static RealVector buffer(3);
+  RealVector& buffer = m_directionBuffer;
   ParticleTracking::newParticle(particle);
 
   m_entryCellID = m_particleCommonData.cellID;
@@ -27,7 +27,7 @@ ParticleTrackingAxi::~ParticleTrackingAxi()
 }
 
 void ParticleTrackingAxi::getCommonData(CommonData &data){
-    static RealVector initialPoint(3);
+    RealVector& initialPoint = m_pointBuffer;
     getExitPoint(initialPoint);
 
     data.currentPoint[0]=initialPoint[0];
@@ -44,7 +44,7 @@ void ParticleTrackingAxi::getCommonData(CommonData &data){
 
 void ParticleTrackingAxi::newParticle(CommonData &particle)
 {
-    static RealVector buffer(3);
+    RealVector& buffer = m_directionBuffer;
     ParticleTracking::newParticle(particle);
 
     m_particle_t_old=1e-8;
@@ -63,6 +63,8 @@ void ParticleTrackingAxi::newParticle(CommonData &particle)
 
 void ParticleTrackingAxi::setupAlgorithm(){
   m_maxNbFaces = Framework::MeshDataStack::getActive()->Statistics().getMaxNbFacesInCell();
+  t_candidates.resize(m_maxNbFaces*2);
+  f_candidates.resize(m_maxNbFaces*2);
 }
 
 //Maybe use the cell->getNeighborGeos() for caching.
@@ -84,7 +86,7 @@ CFreal ParticleTrackingAxi::getStepDistance()
 }
 
 void ParticleTrackingAxi::newDirection(RealVector &direction){
-  static RealVector initialPoint(3);
+  RealVector& initialPoint = m_pointBuffer;
   cf_assert(direction.size() == 3);
   getExitPoint(initialPoint);
 
@@ -135,8 +137,6 @@ void ParticleTrackingAxi::trackingStep(){
 
   static DataHandle<CFint> faceIsOutwards= m_sockets.isOutward.getDataHandle();
 
-  static vector<CFreal> t_candidates(m_maxNbFaces*2);
-  static vector<CFuint> f_candidates(m_maxNbFaces*2);
 
   CellTrsGeoBuilder::GeoData& cellData = m_cellBuilder.getDataGE();
   //this->m_cellIdx = this->m_CellIDmap.find(this->m_entryCellID);
@@ -49,6 +49,10 @@ private:
     RealVector faceOutNormal;
     RealVector rayTangent;
 
+    /// intersection parameters and faces of the candidate exit faces
+    std::vector<CFreal> t_candidates;
+    std::vector<CFuint> f_candidates;
+
 };
 
 
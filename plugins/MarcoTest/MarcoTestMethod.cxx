@@ -8,6 +8,7 @@
 #include "Environment/ObjectProvider.hh"
 #include "Framework/SpaceMethod.hh"
 #include "Framework/SubSystemStatus.hh"
+#include "Framework/Profiler.hh"
 #include "MarcoTest/MarcoTest.hh"
 #include "MathTools/MathConsts.hh"
 
@@ -113,7 +114,7 @@ void MarcoTestMethod::setMethodImpl()
 
   ConvergenceMethod::setMethodImpl();
   
-  m_setup->execute(); 
+  profileExecute(m_setup); 
  
   setupCommandsAndStrategies();
 
@@ -127,7 +128,7 @@ void MarcoTestMethod::unsetMethodImpl()
   //  unsetupCommandsAndStrategies();
   unsetupCommandsAndStrategies();
 
-  m_unsetup->execute();
+  profileExecute(m_unsetup);
 
   ConvergenceMethod::unsetMethodImpl(); 
 }
@@ -142,7 +143,7 @@ void MarcoTestMethod::takeStepImpl()
   subSysStatus->updateTimeStep();
   
   // // Commands have execute, setup and unsetup Marco
-  m_algo->execute();
+  profileExecute(m_algo);
   ConvergenceMethod::syncGlobalDataComputeResidual(false);
   subSysStatus->updateCurrentTime();
   
@@ -1,6 +1,7 @@
 #include "Environment/ObjectProvider.hh"
 #include "Environment/DirPaths.hh"
 #include "Framework/SpaceMethod.hh"
+#include "Framework/Profiler.hh"
 
 #include "MatrixStabilityMethodWriter/MatrixStabilityMethodWriter.hh"
 #include "MatrixStabilityMethodWriter/MatrixStabilityMethod.hh"
@@ -105,14 +106,14 @@ void MatrixStabilityMethod::setMethodImpl()
   ConvergenceMethod::setMethodImpl();
 
   setupCommandsAndStrategies();
-  m_setup->execute();
+  profileExecute(m_setup);
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
 void MatrixStabilityMethod::unsetMethodImpl()
 {
-  m_unSetup->execute();
+  profileExecute(m_unSetup);
   unsetupCommandsAndStrategies();
   //call the parent
   ConvergenceMethod::unsetMethodImpl();
@@ -151,7 +152,7 @@ void MatrixStabilityMethod::takeStepImpl()
 
   // set all states to zero
   m_data->setAllStatesToZero(true);
-  m_setStates->execute();
+  profileExecute(m_setStates);
   m_data->setAllStatesToZero(false);
 
   // loop over the states
@@ -162,7 +163,7 @@ void MatrixStabilityMethod::takeStepImpl()
     // set the current state to one
     m_data->setStateIdx(i);
     m_data->setStateToZero(false);
-    m_setStates->execute();
+    profileExecute(m_setStates);
 
     // Compute the RHS
     m_data->getCollaborator<SpaceMethod>()->prepareComputation();
@@ -170,11 +171,11 @@ void MatrixStabilityMethod::takeStepImpl()
     m_data->getCollaborator<SpaceMethod>()->computeTimeResidual(1.0);
 
     // add column to the file
-    m_addMatrixColumnToFile->execute();
+    profileExecute(m_addMatrixColumnToFile);
 
     // reset the current state to zero
     m_data->setStateToZero(true);
-    m_setStates->execute();
+    profileExecute(m_setStates);
   }
 
   // close the file
@@ -2,6 +2,7 @@
 #include "Environment/ObjectProvider.hh"
 #include "Framework/MeshAdapterMethod.hh"
 #include "Framework/SubSystemStatus.hh"
+#include "Framework/Profiler.hh"
 
 #include "MeshAdapterSpringAnalogy/MeshAdapterSpringAnalogy.hh"
 #include "MeshAdapterSpringAnalogy/SpringAnalogy.hh"
@@ -150,14 +151,14 @@ void SpringAnalogy::setMethodImpl()
   _data->getGeoWithNodesBuilder()->setup();
 
   setupCommandsAndStrategies();
-  _setup->execute();
+  profileExecute(_setup);
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
 void SpringAnalogy::unsetMethodImpl()
 {
-  _unSetup->execute();
+  profileExecute(_unSetup);
   unsetupCommandsAndStrategies();
 
   MeshAdapterMethod::unsetMethodImpl();
@@ -187,10 +188,10 @@ void SpringAnalogy::adaptMeshImpl()
       for(CFuint i=0;i<_prepares.size();i++)
       {
         cf_assert(_prepares[i].isNotNull());
-        _prepares[i]->execute();
+        profileExecute(_prepares[i]);
       }
 
-      _transformMesh->execute();
+      profileExecute(_transformMesh);
       (_data.getPtr())->updateCurrentStep();
     }
 
@@ -2,6 +2,7 @@
 #include "Environment/ObjectProvider.hh"
 #include "Framework/MeshAdapterMethod.hh"
 #include "Framework/SubSystemStatus.hh"
+#include "Framework/Profiler.hh"
 
 #include "MeshFEMMove/MeshFEMMove.hh"
 #include "MeshFEMMove/FEMMove.hh"
@@ -170,14 +171,14 @@ void FEMMove::setMethodImpl()
 
   setupCommandsAndStrategies();
 
-  _setup->execute();
+  profileExecute(_setup);
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
 void FEMMove::unsetMethodImpl()
 {
-  _unSetup->execute();
+  profileExecute(_unSetup);
 
   unsetupCommandsAndStrategies();
 
@@ -201,9 +202,9 @@ void FEMMove::adaptMeshImpl()
     for(CFuint i=0;i<_prepares.size();i++)
     {
       cf_assert(_prepares[i].isNotNull());
-      _prepares[i]->execute();
+      profileExecute(_prepares[i]);
     }
-    _transformMesh->execute();
+    profileExecute(_transformMesh);
 
     // raise the event for the update of the data in the other methods
     event_handler->call_signal (event_handler->key(ssname, "CF_ON_MESHADAPTER_AFTERMESHUPDATE"), msg );
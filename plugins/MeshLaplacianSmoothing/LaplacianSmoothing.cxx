@@ -2,6 +2,7 @@
 #include "Environment/ObjectProvider.hh"
 #include "Framework/MeshAdapterMethod.hh"
 #include "Framework/SubSystemStatus.hh"
+#include "Framework/Profiler.hh"
 
 #include "MeshLaplacianSmoothing/MeshLaplacianSmoothing.hh"
 #include "MeshLaplacianSmoothing/LaplacianSmoothing.hh"
@@ -137,14 +138,14 @@ void LaplacianSmoothing::setMethodImpl()
   MeshAdapterMethod::setMethodImpl();
 
   setupCommandsAndStrategies();
-  _setup->execute();
+  profileExecute(_setup);
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
 void LaplacianSmoothing::unsetMethodImpl()
 {
-  _unSetup->execute();
+  profileExecute(_unSetup);
   unsetupCommandsAndStrategies();
 
   MeshAdapterMethod::unsetMethodImpl();
@@ -169,10 +170,10 @@ void LaplacianSmoothing::adaptMeshImpl()
     for(CFuint i=0;i<_prepares.size();i++)
     {
       cf_assert(_prepares[i].isNotNull());
-      _prepares[i]->execute();
+      profileExecute(_prepares[i]);
     }
 
-    _transformMesh->execute();
+    profileExecute(_transformMesh);
 
     // Raise the event for the update of the data in the other methods
     event_handler->call_signal (event_handler->key(ssname, "CF_ON_MESHADAPTER_AFTERMESHUPDATE"), msg );
@@ -2,6 +2,7 @@
 #include "Environment/ObjectProvider.hh"
 #include "Framework/MeshAdapterMethod.hh"
 #include "Framework/SubSystemStatus.hh"
+#include "Framework/Profiler.hh"
 
 #include "MeshRigidMove/RigidMove.hh"
 #include "MeshRigidMove/MeshRigidMove.hh"
@@ -140,7 +141,7 @@ void RigidMove::setMethodImpl()
   MeshAdapterMethod::setMethodImpl();
 
   setupCommandsAndStrategies();
-  _setup->execute();
+  profileExecute(_setup);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -148,7 +149,7 @@ void RigidMove::setMethodImpl()
 void RigidMove::unsetMethodImpl()
 {
   CFLog(VERBOSE, "RigidMove::unsetMethodImpl() START\n");
-  _unSetup->execute(); 
+  profileExecute(_unSetup); 
   unsetupCommandsAndStrategies();
   MeshAdapterMethod::unsetMethodImpl();
   CFLog(VERBOSE, "RigidMove::unsetMethodImpl() END\n");
@@ -171,9 +172,9 @@ void RigidMove::adaptMeshImpl()
     for(CFuint i=0;i<_prepares.size();i++)
     {
       cf_assert(_prepares[i].isNotNull());
-      _prepares[i]->execute();
+      profileExecute(_prepares[i]);
     }
-    _transformMesh->execute();
+    profileExecute(_transformMesh);
 
     // raise the event for the update of the data in the other methods
     event_handler->call_signal (event_handler->key(ssname,"CF_ON_MESHADAPTER_AFTERMESHUPDATE"), msg );
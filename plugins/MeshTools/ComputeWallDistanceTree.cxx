@@ -0,0 +1,123 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <boost/bind.hpp>
+
+#include "Common/PE.hh"
+#include "Common/ChunkedThreads.hh"
+#include "Common/Stopwatch.hh"
+#include "Framework/DataProcessing.hh"
+#include "Framework/MethodCommandProvider.hh"
+#include "Framework/MeshData.hh"
+#include "Framework/PhysicalModel.hh"
+#include "MeshTools/MeshTools.hh"
+#include "MeshTools/WallDistanceTree.hh"
+#include "MeshTools/ComputeWallDistanceTree.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Common;
+using namespace COOLFluiD::Framework;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace MeshTools {
+
+//////////////////////////////////////////////////////////////////////////////
+
+MethodCommandProvider<ComputeWallDistanceTree, DataProcessingData, MeshToolsModule>
+computeWallDistanceTreeProvider("ComputeWallDistanceTree");
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ComputeWallDistanceTree::defineConfigOptions(Config::OptionList& options)
+{
+   options.addConfigOption< CFuint >("MaxFacesInLeaf","Maximum number of wall faces in each leaf of the search tree.");
+   options.addConfigOption< CFuint >("NbThreads","Number of threads computing the distances.");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ComputeWallDistanceTree::ComputeWallDistanceTree(const std::string& name) :
+  ComputeWallDistance(name)
+{
+  addConfigOptionsTo(this);
+
+  m_maxFacesInLeaf = 4;
+  setParameter("MaxFacesInLeaf",&m_maxFacesInLeaf);
+
+  m_nbThreads = 1;
+  setParameter("NbThreads",&m_nbThreads);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ComputeWallDistanceTree::~ComputeWallDistanceTree()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ComputeWallDistanceTree::execute()
+{
+  CFAUTOTRACE;
+
+  CFLog(INFO, "ComputeWallDistanceTree::execute() => Computing distance to the wall ...\n");
+
+  Stopwatch<WallTime> stp;
+  stp.start();
+
+  DataHandle < Framework::Node*, Framework::GLOBAL > nodes = socket_nodes.getDataHandle();
+  DataHandle < Framework::State*, Framework::GLOBAL > states = socket_states.getDataHandle();
+  DataHandle< CFreal> wallDistance = socket_wallDistance.getDataHandle();
+  const CFuint dim = PhysicalModelStack::getActive()->getDim();
+  const std::string nsp = getMethodData().getNamespace();
+
+  // the tree is rebuilt at every call, since the mesh could have moved
+  WallDistanceTree tree(dim, m_maxFacesInLeaf);
+  for (CFuint iTRS = 0; iTRS < _boundaryTRS.size(); ++iTRS) {
+    tree.addFaces(MeshDataStack::getActive()->getTrs(_boundaryTRS[iTRS]), nodes);
+  }
+  tree.gatherFaces(nsp);
+  tree.build();
+
+  CFLog(INFO, "ComputeWallDistanceTree::execute() => tree built over " << tree.getNbFaces()
+	<< " wall faces in " << stp.read() << "s\n");
+
+  // the queries do not modify the tree: the states are split in contiguous
+  // chunks, each written by one thread only
+  runChunked(states.size(), m_nbThreads,
+	     boost::bind(&ComputeWallDistanceTree::computeDistances, this, &tree, _1, _2));
+
+  CFLog(INFO, "ComputeWallDistanceTree::execute() => took " << stp.read() << "s\n");
+
+  if (PE::GetPE().GetProcessorCount(nsp) == 1) {
+    printToFile();
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ComputeWallDistanceTree::computeDistances(const WallDistanceTree* tree,
+					       const CFuint start, const CFuint end)
+{
+  DataHandle < Framework::State*, Framework::GLOBAL > states = socket_states.getDataHandle();
+  DataHandle< CFreal> wallDistance = socket_wallDistance.getDataHandle();
+  for (CFuint iState = start; iState < end; ++iState) {
+    wallDistance[iState] = tree->computeDistance(&states[iState]->getCoordinates()[0]);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace MeshTools
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,83 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_MeshTools_ComputeWallDistanceTree_hh
+#define COOLFluiD_MeshTools_ComputeWallDistanceTree_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "MeshTools/ComputeWallDistance.hh"
+#include "MeshTools/WallDistanceTree.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace MeshTools {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ *
+ * This class computes the exact distance from the states to the faces of
+ * the wall TRSs, using a WallDistanceTree built over the faces of all the
+ * processors. The states are split in contiguous chunks processed by
+ * concurrent threads.
+ *
+ * @author Andrea Lani
+ *
+ */
+class ComputeWallDistanceTree : public ComputeWallDistance {
+public:
+
+  /**
+   * Defines the Config Option's of this class
+   * @param options a OptionList where to add the Option's
+   */
+  static void defineConfigOptions(Config::OptionList& options);
+
+  /**
+   * Constructor.
+   */
+  ComputeWallDistanceTree(const std::string& name);
+
+  /**
+   * Default destructor
+   */
+  ~ComputeWallDistanceTree();
+
+  /**
+   * Execute on a set of dofs
+   */
+  void execute();
+
+private: // helper functions
+
+  /**
+   * Compute the wall distance of the states in [start, end)
+   */
+  void computeDistances(const WallDistanceTree* tree,
+			const CFuint start, const CFuint end);
+
+private:
+
+  /// maximum number of faces in each leaf of the tree
+  CFuint m_maxFacesInLeaf;
+
+  /// number of threads computing the distances
+  CFuint m_nbThreads;
+
+}; // end of class ComputeWallDistanceTree
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace MeshTools
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_MeshTools_ComputeWallDistanceTree_hh
@@ -10,6 +10,17 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "Environment/ModuleRegister.hh"
+#include "Common/ExportAPI.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// Define the macro MeshTools_API
+/// @note build system defines MeshTools_EXPORTS when compiling MeshTools files
+#ifdef MeshTools_EXPORTS
+#   define MeshTools_API CF_EXPORT_API
+#else
+#   define MeshTools_API CF_IMPORT_API
+#endif
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -0,0 +1,503 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <algorithm>
+#include <cmath>
+
+#include "Common/PE.hh"
+
+#ifdef CF_HAVE_MPI
+#include "Common/MPI/MPIError.hh"
+#include "Common/MPI/MPIStructDef.hh"
+#endif
+
+#include "MathTools/MathConsts.hh"
+#include "MeshTools/WallDistanceTree.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Common;
+using namespace COOLFluiD::Framework;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace MeshTools {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// Functor comparing the segments or triangles by the given coordinate of their centroid
+class PrimCentroidLess {
+public:
+  PrimCentroidLess(const vector<CFreal>& centroid, const CFuint dim, const CFuint axis) :
+    m_centroid(centroid), m_dim(dim), m_axis(axis) {}
+
+  bool operator() (const CFuint p1, const CFuint p2) const
+  {
+    return m_centroid[p1*m_dim + m_axis] < m_centroid[p2*m_dim + m_axis];
+  }
+
+private:
+  const vector<CFreal>& m_centroid;
+  const CFuint m_dim;
+  const CFuint m_axis;
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+WallDistanceTree::WallDistanceTree(const CFuint dim, const CFuint maxLeafSize) :
+  m_dim(dim),
+  m_maxLeafSize(std::max<CFuint>(maxLeafSize, 1)),
+  m_primStride(dim*dim),
+  m_primCoord(),
+  m_primFace(),
+  m_faceFirstPrim(1, 0),
+  m_primCentroid(),
+  m_primIDs(),
+  m_tree()
+{
+  cf_assert(dim == DIM_2D || dim == DIM_3D);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+WallDistanceTree::~WallDistanceTree()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void WallDistanceTree::clear()
+{
+  m_primCoord.clear();
+  m_primFace.clear();
+  m_faceFirstPrim.assign(1, 0);
+  m_primCentroid.clear();
+  m_primIDs.clear();
+  m_tree.clear();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void WallDistanceTree::addFaces(SafePtr<TopologicalRegionSet> faces,
+				DataHandle<Node*, GLOBAL> nodes)
+{
+  const CFuint nbFaces = faces->getLocalNbGeoEnts();
+  vector<CFreal> coord;
+  for (CFuint iFace = 0; iFace < nbFaces; ++iFace) {
+    const CFuint nbNodesInFace = faces->getNbNodesInGeo(iFace);
+    coord.resize(nbNodesInFace*m_dim);
+    for (CFuint iNode = 0; iNode < nbNodesInFace; ++iNode) {
+      const Node& node = *nodes[faces->getNodeID(iFace, iNode)];
+      for (CFuint iDim = 0; iDim < m_dim; ++iDim) {
+	coord[iNode*m_dim + iDim] = node[iDim];
+      }
+    }
+    addFace(nbNodesInFace, &coord[0]);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void WallDistanceTree::addFace(const CFuint nbNodesInFace, const CFreal *const coord)
+{
+  const CFuint faceID = getNbFaces();
+
+  // the vertices come first, high-order nodes (if any) are ignored
+  if (m_dim == DIM_2D) {
+    cf_assert(nbNodesInFace >= 2);
+    m_primCoord.insert(m_primCoord.end(), coord, coord + 4);
+    m_primFace.push_back(faceID);
+  }
+  else {
+    const CFuint nbVertices = (nbNodesInFace == 3 || nbNodesInFace == 6) ? 3 : 4;
+    cf_assert(nbNodesInFace >= nbVertices);
+    m_primCoord.insert(m_primCoord.end(), coord, coord + 9);
+    m_primFace.push_back(faceID);
+    if (nbVertices == 4) {
+      // the quadrilateral is split into the triangles (0,1,2) and (0,2,3)
+      m_primCoord.insert(m_primCoord.end(), coord, coord + 3);
+      m_primCoord.insert(m_primCoord.end(), coord + 6, coord + 12);
+      m_primFace.push_back(faceID);
+    }
+  }
+
+  m_faceFirstPrim.push_back(m_primFace.size());
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void WallDistanceTree::gatherFaces(const std::string& nsp)
+{
+#ifdef CF_HAVE_MPI
+  const CFuint nbProc = PE::GetPE().GetProcessorCount(nsp);
+  if (nbProc == 1) return;
+
+  MPI_Comm comm = PE::GetPE().GetCommunicator(nsp);
+
+  // number of segments or triangles of each local face
+  const CFuint nbLocalFaces = getNbFaces();
+  vector<int> localNbPrims(nbLocalFaces + 1, 0);
+  for (CFuint iFace = 0; iFace < nbLocalFaces; ++iFace) {
+    localNbPrims[iFace] = m_faceFirstPrim[iFace+1] - m_faceFirstPrim[iFace];
+  }
+
+  int localSize[2];
+  localSize[0] = nbLocalFaces;
+  localSize[1] = m_primCoord.size();
+  vector<int> sizes(2*nbProc, 0);
+  MPIError::getInstance().check
+    ("MPI_Allgather", "WallDistanceTree::gatherFaces()",
+     MPI_Allgather(&localSize[0], 2, MPIStructDef::getMPIType(&localSize[0]),
+		   &sizes[0], 2, MPIStructDef::getMPIType(&localSize[0]), comm));
+
+  vector<int> faceSizes(nbProc, 0);
+  vector<int> faceDispls(nbProc, 0);
+  vector<int> coordSizes(nbProc, 0);
+  vector<int> coordDispls(nbProc, 0);
+  for (CFuint p = 0; p < nbProc; ++p) {
+    faceSizes[p] = sizes[2*p];
+    coordSizes[p] = sizes[2*p+1];
+    if (p > 0) {
+      faceDispls[p] = faceDispls[p-1] + faceSizes[p-1];
+      coordDispls[p] = coordDispls[p-1] + coordSizes[p-1];
+    }
+  }
+  const CFuint globalNbFaces = faceDispls[nbProc-1] + faceSizes[nbProc-1];
+  const CFuint globalSize = coordDispls[nbProc-1] + coordSizes[nbProc-1];
+  if (globalNbFaces == 0) return;
+
+  vector<int> nbPrims(globalNbFaces, 0);
+  MPIError::getInstance().check
+    ("MPI_Allgatherv", "WallDistanceTree::gatherFaces()",
+     MPI_Allgatherv(&localNbPrims[0], localSize[0], MPIStructDef::getMPIType(&localNbPrims[0]),
+		    &nbPrims[0], &faceSizes[0], &faceDispls[0],
+		    MPIStructDef::getMPIType(&nbPrims[0]), comm));
+
+  // one more entry to have a valid pointer even if no faces are local
+  vector<CFreal> localCoord(m_primCoord);
+  localCoord.push_back(0.);
+  m_primCoord.resize(globalSize);
+  MPIError::getInstance().check
+    ("MPI_Allgatherv", "WallDistanceTree::gatherFaces()",
+     MPI_Allgatherv(&localCoord[0], localSize[1], MPIStructDef::getMPIType(&localCoord[0]),
+		    &m_primCoord[0], &coordSizes[0], &coordDispls[0],
+		    MPIStructDef::getMPIType(&m_primCoord[0]), comm));
+
+  // the faces are numbered by rank and then in the order they were added
+  m_faceFirstPrim.resize(globalNbFaces + 1);
+  m_primFace.clear();
+  for (CFuint iFace = 0; iFace < globalNbFaces; ++iFace) {
+    m_faceFirstPrim[iFace+1] = m_faceFirstPrim[iFace] + nbPrims[iFace];
+    m_primFace.insert(m_primFace.end(), nbPrims[iFace], iFace);
+  }
+  cf_assert(m_primFace.size()*m_primStride == m_primCoord.size());
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void WallDistanceTree::build()
+{
+  const CFuint nbPrims = m_primFace.size();
+  const CFuint nbNodesInPrim = m_primStride/m_dim;
+
+  m_primCentroid.assign(nbPrims*m_dim, 0.);
+  m_primIDs.resize(nbPrims);
+  for (CFuint iPrim = 0; iPrim < nbPrims; ++iPrim) {
+    m_primIDs[iPrim] = iPrim;
+    const CFreal *const coord = &m_primCoord[iPrim*m_primStride];
+    for (CFuint iNode = 0; iNode < nbNodesInPrim; ++iNode) {
+      for (CFuint iDim = 0; iDim < m_dim; ++iDim) {
+	m_primCentroid[iPrim*m_dim + iDim] += coord[iNode*m_dim + iDim]/nbNodesInPrim;
+      }
+    }
+  }
+
+  m_tree.clear();
+  if (nbPrims == 0) return;
+
+  // leaves hold more than m_maxLeafSize/2 entries and there are about
+  // twice as many nodes as leaves
+  m_tree.reserve(4*nbPrims/m_maxLeafSize + 1);
+  m_tree.push_back(TreeNode());
+  buildNode(0, nbPrims);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFuint WallDistanceTree::buildNode(const CFuint begin, const CFuint end)
+{
+  // the node being built is always the last one
+  const CFuint nodeID = m_tree.size() - 1;
+  const CFuint nbNodesInPrim = m_primStride/m_dim;
+
+  // bounding box of the segments or triangles and of their centroids
+  CFreal bbMin[3];
+  CFreal bbMax[3];
+  CFreal cMin[3];
+  CFreal cMax[3];
+  for (CFuint iDim = 0; iDim < m_dim; ++iDim) {
+    bbMin[iDim] = cMin[iDim] = MathTools::MathConsts::CFrealMax();
+    bbMax[iDim] = cMax[iDim] = -MathTools::MathConsts::CFrealMax();
+  }
+  for (CFuint i = begin; i < end; ++i) {
+    const CFuint iPrim = m_primIDs[i];
+    const CFreal *const coord = &m_primCoord[iPrim*m_primStride];
+    for (CFuint iNode = 0; iNode < nbNodesInPrim; ++iNode) {
+      for (CFuint iDim = 0; iDim < m_dim; ++iDim) {
+	bbMin[iDim] = std::min(bbMin[iDim], coord[iNode*m_dim + iDim]);
+	bbMax[iDim] = std::max(bbMax[iDim], coord[iNode*m_dim + iDim]);
+      }
+    }
+    for (CFuint iDim = 0; iDim < m_dim; ++iDim) {
+      cMin[iDim] = std::min(cMin[iDim], m_primCentroid[iPrim*m_dim + iDim]);
+      cMax[iDim] = std::max(cMax[iDim], m_primCentroid[iPrim*m_dim + iDim]);
+    }
+  }
+
+  for (CFuint iDim = 0; iDim < m_dim; ++iDim) {
+    m_tree[nodeID].bbMin[iDim] = bbMin[iDim];
+    m_tree[nodeID].bbMax[iDim] = bbMax[iDim];
+  }
+
+  if (end - begin <= m_maxLeafSize) {
+    m_tree[nodeID].first = begin;
+    m_tree[nodeID].nbPrims = end - begin;
+    return nodeID;
+  }
+
+  // split at the median of the centroids along the longest extent
+  CFuint axis = 0;
+  for (CFuint iDim = 1; iDim < m_dim; ++iDim) {
+    if (cMax[iDim] - cMin[iDim] > cMax[axis] - cMin[axis]) axis = iDim;
+  }
+  const CFuint middle = begin + (end - begin)/2;
+  std::nth_element(m_primIDs.begin() + begin, m_primIDs.begin() + middle,
+		   m_primIDs.begin() + end, PrimCentroidLess(m_primCentroid, m_dim, axis));
+
+  // the first child is stored right after this node, the second one
+  // right after the whole first subtree
+  m_tree.push_back(TreeNode());
+  buildNode(begin, middle);
+  m_tree.push_back(TreeNode());
+  const CFuint right = buildNode(middle, end);
+
+  m_tree[nodeID].first = right;
+  m_tree[nodeID].nbPrims = 0;
+  return nodeID;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFreal WallDistanceTree::computeDistance(const CFreal *const point, CFint& faceID) const
+{
+  CFreal minDistSq = MathTools::MathConsts::CFrealMax();
+
+  // warm start: the previous closest face gives an upper bound which
+  // prunes most of the tree if the point has not moved much
+  if (faceID >= 0 && static_cast<CFuint>(faceID) < getNbFaces()) {
+    for (CFuint iPrim = m_faceFirstPrim[faceID]; iPrim < m_faceFirstPrim[faceID+1]; ++iPrim) {
+      minDistSq = std::min(minDistSq, getPrimDistanceSq(iPrim, point));
+    }
+  }
+  else {
+    faceID = -1;
+  }
+
+  if (m_tree.size() == 0) {
+    return (faceID < 0) ? minDistSq : std::sqrt(minDistSq);
+  }
+
+  // the depth of the tree is bounded by log2 of the number of faces
+  CFuint stack[128];
+  CFuint stackSize = 0;
+  stack[stackSize++] = 0;
+
+  while (stackSize > 0) {
+    const CFuint nodeID = stack[--stackSize];
+    const TreeNode& node = m_tree[nodeID];
+    if (getBoxDistanceSq(node, point) >= minDistSq) continue;
+
+    if (node.nbPrims > 0) {
+      const CFuint end = node.first + node.nbPrims;
+      for (CFuint i = node.first; i < end; ++i) {
+	const CFreal distSq = getPrimDistanceSq(m_primIDs[i], point);
+	if (distSq < minDistSq) {
+	  minDistSq = distSq;
+	  faceID = m_primFace[m_primIDs[i]];
+	}
+      }
+    }
+    else {
+      // the closest child is visited first, as it is popped first
+      const CFuint left = nodeID + 1;
+      const CFuint right = node.first;
+      const CFreal leftDistSq = getBoxDistanceSq(m_tree[left], point);
+      const CFreal rightDistSq = getBoxDistanceSq(m_tree[right], point);
+      cf_assert(stackSize + 2 <= 128);
+      if (leftDistSq < rightDistSq) {
+	if (rightDistSq < minDistSq) stack[stackSize++] = right;
+	stack[stackSize++] = left;
+      }
+      else {
+	if (leftDistSq < minDistSq) stack[stackSize++] = left;
+	stack[stackSize++] = right;
+      }
+    }
+  }
+
+  return std::sqrt(minDistSq);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFreal WallDistanceTree::computeClosestPoint(const CFuint faceID, const CFreal *const point,
+					     CFreal *const closest) const
+{
+  cf_assert(faceID < getNbFaces());
+
+  CFreal minDistSq = MathTools::MathConsts::CFrealMax();
+  CFreal primClosest[3];
+  for (CFuint iPrim = m_faceFirstPrim[faceID]; iPrim < m_faceFirstPrim[faceID+1]; ++iPrim) {
+    const CFreal distSq = getPrimDistanceSq(iPrim, point, primClosest);
+    if (distSq < minDistSq) {
+      minDistSq = distSq;
+      for (CFuint iDim = 0; iDim < m_dim; ++iDim) {closest[iDim] = primClosest[iDim];}
+    }
+  }
+  return std::sqrt(minDistSq);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFreal WallDistanceTree::getBoxDistanceSq(const TreeNode& node, const CFreal *const point) const
+{
+  CFreal distSq = 0.;
+  for (CFuint iDim = 0; iDim < m_dim; ++iDim) {
+    const CFreal p = point[iDim];
+    const CFreal d = (p < node.bbMin[iDim]) ? node.bbMin[iDim] - p :
+      ((p > node.bbMax[iDim]) ? p - node.bbMax[iDim] : 0.);
+    distSq += d*d;
+  }
+  return distSq;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFreal WallDistanceTree::getPrimDistanceSq(const CFuint iPrim, const CFreal *const point,
+					   CFreal *const closest) const
+{
+  const CFreal *const coord = &m_primCoord[iPrim*m_primStride];
+  return (m_dim == DIM_2D) ? getSegmentDistanceSq(coord, coord + 2, point, closest) :
+    getTriangleDistanceSq(coord, coord + 3, coord + 6, point, closest);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFreal WallDistanceTree::getSegmentDistanceSq(const CFreal *const a, const CFreal *const b,
+					      const CFreal *const point,
+					      CFreal *const closest) const
+{
+  CFreal abSq = 0.;
+  CFreal apDotAb = 0.;
+  for (CFuint iDim = 0; iDim < m_dim; ++iDim) {
+    const CFreal ab = b[iDim] - a[iDim];
+    abSq += ab*ab;
+    apDotAb += (point[iDim] - a[iDim])*ab;
+  }
+
+  // parameter of the projection of the point, clipped to the segment
+  const CFreal t = (abSq > 0.) ? std::max(0., std::min(1., apDotAb/abSq)) : 0.;
+  CFreal distSq = 0.;
+  for (CFuint iDim = 0; iDim < m_dim; ++iDim) {
+    const CFreal x = a[iDim] + t*(b[iDim] - a[iDim]);
+    if (closest != CFNULL) closest[iDim] = x;
+    const CFreal d = point[iDim] - x;
+    distSq += d*d;
+  }
+  return distSq;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFreal WallDistanceTree::getTriangleDistanceSq(const CFreal *const a, const CFreal *const b,
+					       const CFreal *const c, const CFreal *const point,
+					       CFreal *const closest) const
+{
+  // closest point on the triangle, found from the Voronoi region of the
+  // point (C. Ericson, Real-Time Collision Detection, 5.1.5)
+  CFreal ab[3], ac[3], ap[3];
+  for (CFuint iDim = 0; iDim < 3; ++iDim) {
+    ab[iDim] = b[iDim] - a[iDim];
+    ac[iDim] = c[iDim] - a[iDim];
+    ap[iDim] = point[iDim] - a[iDim];
+  }
+
+  const CFreal d1 = ab[0]*ap[0] + ab[1]*ap[1] + ab[2]*ap[2];
+  const CFreal d2 = ac[0]*ap[0] + ac[1]*ap[1] + ac[2]*ap[2];
+  if (d1 <= 0. && d2 <= 0.) return getSegmentDistanceSq(a, a, point, closest);
+
+  CFreal bp[3];
+  for (CFuint iDim = 0; iDim < 3; ++iDim) {bp[iDim] = point[iDim] - b[iDim];}
+  const CFreal d3 = ab[0]*bp[0] + ab[1]*bp[1] + ab[2]*bp[2];
+  const CFreal d4 = ac[0]*bp[0] + ac[1]*bp[1] + ac[2]*bp[2];
+  if (d3 >= 0. && d4 <= d3) return getSegmentDistanceSq(b, b, point, closest);
+
+  const CFreal vc = d1*d4 - d3*d2;
+  if (vc <= 0. && d1 >= 0. && d3 <= 0.) return getSegmentDistanceSq(a, b, point, closest);
+
+  CFreal cp[3];
+  for (CFuint iDim = 0; iDim < 3; ++iDim) {cp[iDim] = point[iDim] - c[iDim];}
+  const CFreal d5 = ab[0]*cp[0] + ab[1]*cp[1] + ab[2]*cp[2];
+  const CFreal d6 = ac[0]*cp[0] + ac[1]*cp[1] + ac[2]*cp[2];
+  if (d6 >= 0. && d5 <= d6) return getSegmentDistanceSq(c, c, point, closest);
+
+  const CFreal vb = d5*d2 - d1*d6;
+  if (vb <= 0. && d2 >= 0. && d6 <= 0.) return getSegmentDistanceSq(a, c, point, closest);
+
+  const CFreal va = d3*d6 - d5*d4;
+  if (va <= 0. && (d4 - d3) >= 0. && (d5 - d6) >= 0.) return getSegmentDistanceSq(b, c, point, closest);
+
+  // the point projects inside the triangle
+  const CFreal sum = va + vb + vc;
+  if (!(sum > 0.)) {
+    // degenerate triangle: closest of its edges
+    const CFreal *const edges[6] = {a, b, b, c, a, c};
+    CFreal minDistSq = MathTools::MathConsts::CFrealMax();
+    CFreal edgeClosest[3];
+    for (CFuint iEdge = 0; iEdge < 3; ++iEdge) {
+      const CFreal distSq = getSegmentDistanceSq(edges[2*iEdge], edges[2*iEdge+1], point, edgeClosest);
+      if (distSq < minDistSq) {
+	minDistSq = distSq;
+	if (closest != CFNULL) {
+	  for (CFuint iDim = 0; iDim < 3; ++iDim) {closest[iDim] = edgeClosest[iDim];}
+	}
+      }
+    }
+    return minDistSq;
+  }
+  const CFreal v = vb/sum;
+  const CFreal w = vc/sum;
+  CFreal distSq = 0.;
+  for (CFuint iDim = 0; iDim < 3; ++iDim) {
+    const CFreal x = a[iDim] + v*ab[iDim] + w*ac[iDim];
+    if (closest != CFNULL) closest[iDim] = x;
+    const CFreal d = point[iDim] - x;
+    distSq += d*d;
+  }
+  return distSq;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace MeshTools
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,215 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_MeshTools_WallDistanceTree_hh
+#define COOLFluiD_MeshTools_WallDistanceTree_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+
+#include "Framework/Storage.hh"
+#include "Framework/Node.hh"
+#include "Framework/TopologicalRegionSet.hh"
+#include "MeshTools/MeshTools.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace MeshTools {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class computes the exact distance from any point to a set of wall
+ * faces (segments in 2D, triangles or quadrilaterals in 3D, the latter
+ * split into two triangles).
+ * The faces of the given TRSs are collected on each processor and then
+ * replicated on all the processors of the namespace with a single
+ * collective call. A bounding volume hierarchy (BVH) is then built over
+ * them, so that each distance query only visits the boxes which are closer
+ * than the current minimum distance.
+ * The queries do not modify the tree and can be run concurrently.
+ *
+ * @author Andrea Lani
+ *
+ */
+class MeshTools_API WallDistanceTree {
+public:
+
+  /**
+   * Constructor
+   * @param dim         space dimension (2 or 3)
+   * @param maxLeafSize maximum number of segments or triangles in each leaf of the tree
+   */
+  WallDistanceTree(const CFuint dim, const CFuint maxLeafSize = 4);
+
+  /**
+   * Destructor
+   */
+  ~WallDistanceTree();
+
+  /**
+   * Remove all the faces and the tree
+   */
+  void clear();
+
+  /**
+   * Add the local faces of the given TRS
+   */
+  void addFaces(Common::SafePtr<Framework::TopologicalRegionSet> faces,
+		Framework::DataHandle<Framework::Node*, Framework::GLOBAL> nodes);
+
+  /**
+   * Add one face given the coordinates of its nodes, stored contiguously
+   */
+  void addFace(const CFuint nbNodesInFace, const CFreal *const coord);
+
+  /**
+   * Replicate the faces added by all the processors of the given namespace
+   * on every processor
+   */
+  void gatherFaces(const std::string& nsp);
+
+  /**
+   * Build the tree over the faces
+   */
+  void build();
+
+  /**
+   * @return the number of faces in the tree, numbered in the order they
+   *         were added (on each processor, by rank, after gatherFaces())
+   */
+  CFuint getNbFaces() const {return m_faceFirstPrim.size() - 1;}
+
+  /**
+   * Compute the distance from the given point to the closest face
+   * @param point coordinates of the point
+   * @return the distance, or MathTools::MathConsts::CFrealMax() if there are no faces
+   */
+  CFreal computeDistance(const CFreal *const point) const
+  {
+    CFint faceID = -1;
+    return computeDistance(point, faceID);
+  }
+
+  /**
+   * Compute the distance from the given point to the closest face
+   * @param point  coordinates of the point
+   * @param faceID closest face, -1 if there are no faces; if it is a valid
+   *               face on input, the distance to it is used as starting
+   *               bound of the search (warm start)
+   * @return the distance, or MathTools::MathConsts::CFrealMax() if there are no faces
+   */
+  CFreal computeDistance(const CFreal *const point, CFint& faceID) const;
+
+  /**
+   * Compute the closest point of the given face to the given point
+   * @param faceID  face
+   * @param point   coordinates of the point
+   * @param closest coordinates of the closest point
+   * @return the distance between the two points
+   */
+  CFreal computeClosestPoint(const CFuint faceID, const CFreal *const point,
+			     CFreal *const closest) const;
+
+private: // helper classes
+
+  /**
+   * Node of the tree, either a leaf with a range of faces or an inner
+   * node with two children
+   */
+  class TreeNode {
+  public:
+    /// lower corner of the bounding box
+    CFreal bbMin[3];
+
+    /// upper corner of the bounding box
+    CFreal bbMax[3];
+
+    /// first segment or triangle (leaf) or second child (inner node)
+    CFuint first;
+
+    /// number of segments or triangles, 0 for inner nodes
+    CFuint nbPrims;
+  };
+
+private: // helper functions
+
+  /**
+   * Build the subtree over the segments or triangles in [begin, end)
+   * @return the index of the root of the subtree
+   */
+  CFuint buildNode(const CFuint begin, const CFuint end);
+
+  /**
+   * @return the squared distance from the point to the bounding box of the node
+   */
+  CFreal getBoxDistanceSq(const TreeNode& node, const CFreal *const point) const;
+
+  /**
+   * @return the squared distance from the point to the given segment or triangle
+   * @param closest if not null, set to the closest point
+   */
+  CFreal getPrimDistanceSq(const CFuint iPrim, const CFreal *const point,
+			   CFreal *const closest = CFNULL) const;
+
+  /**
+   * @return the squared distance from the point to the segment (a,b)
+   * @param closest if not null, set to the closest point
+   */
+  CFreal getSegmentDistanceSq(const CFreal *const a, const CFreal *const b,
+			      const CFreal *const point, CFreal *const closest = CFNULL) const;
+
+  /**
+   * @return the squared distance from the point to the triangle (a,b,c)
+   * @param closest if not null, set to the closest point
+   */
+  CFreal getTriangleDistanceSq(const CFreal *const a, const CFreal *const b,
+			       const CFreal *const c, const CFreal *const point,
+			       CFreal *const closest = CFNULL) const;
+
+private: // data
+
+  /// space dimension
+  CFuint m_dim;
+
+  /// maximum number of segments or triangles in a leaf
+  CFuint m_maxLeafSize;
+
+  /// number of coordinates of each segment or triangle (nodes times dimension)
+  CFuint m_primStride;
+
+  /// coordinates of the nodes of each segment or triangle
+  std::vector<CFreal> m_primCoord;
+
+  /// face to which each segment or triangle belongs
+  std::vector<CFuint> m_primFace;
+
+  /// first segment or triangle of each face, plus the total number at the end
+  std::vector<CFuint> m_faceFirstPrim;
+
+  /// centroid of each segment or triangle, used to build the tree
+  std::vector<CFreal> m_primCentroid;
+
+  /// segments or triangles sorted by leaf
+  std::vector<CFuint> m_primIDs;
+
+  /// nodes of the tree, the first one being the root
+  std::vector<TreeNode> m_tree;
+
+}; // end of class WallDistanceTree
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace MeshTools
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_MeshTools_WallDistanceTree_hh
@@ -0,0 +1,228 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE "Test wall distance tree"
+
+#ifdef CF_HAVE_BOOST_1_59
+#include <boost/test/tools/floating_point_comparison.hpp>
+#else
+#include <boost/test/floating_point_comparison.hpp>
+#endif
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdlib>
+#include <algorithm>
+
+#include "MeshTools/WallDistanceTree.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD;
+using namespace COOLFluiD::MeshTools;
+
+using namespace boost::unit_test;
+
+//////////////////////////////////////////////////////////////////////////////
+
+struct WallDistanceTree_Fixture
+{
+  /// common setup for each test case
+  WallDistanceTree_Fixture()
+  {
+    std::srand(3);
+  }
+
+  /// common tear-down for each test case
+  ~WallDistanceTree_Fixture()
+  {
+  }
+
+  /// @return a random number in [a,b]
+  static CFreal random(const CFreal a, const CFreal b)
+  {
+    return a + (b - a)*std::rand()/RAND_MAX;
+  }
+
+  /// @return the squared distance from p to the segment (a,b)
+  static CFreal segmentDistanceSq(const CFreal* a, const CFreal* b,
+				  const CFreal* p, const CFuint dim)
+  {
+    CFreal ab2 = 0.;
+    CFreal t = 0.;
+    for (CFuint i = 0; i < dim; ++i) {
+      ab2 += (b[i] - a[i])*(b[i] - a[i]);
+      t += (p[i] - a[i])*(b[i] - a[i]);
+    }
+    t = (ab2 > 0.) ? std::max(0., std::min(1., t/ab2)) : 0.;
+
+    CFreal d2 = 0.;
+    for (CFuint i = 0; i < dim; ++i) {
+      const CFreal q = p[i] - a[i] - t*(b[i] - a[i]);
+      d2 += q*q;
+    }
+    return d2;
+  }
+
+  /// @return the squared distance from p to the triangle (a,b,c): either the
+  ///         distance to the plane, if the projection falls inside the
+  ///         triangle, or the distance to the closest edge
+  static CFreal triangleDistanceSq(const CFreal* a, const CFreal* b,
+				   const CFreal* c, const CFreal* p)
+  {
+    CFreal ab[3], ac[3], ap[3];
+    for (CFuint i = 0; i < 3; ++i) {
+      ab[i] = b[i] - a[i];
+      ac[i] = c[i] - a[i];
+      ap[i] = p[i] - a[i];
+    }
+    const CFreal n[3] = {ab[1]*ac[2] - ab[2]*ac[1],
+			 ab[2]*ac[0] - ab[0]*ac[2],
+			 ab[0]*ac[1] - ab[1]*ac[0]};
+    const CFreal nn = n[0]*n[0] + n[1]*n[1] + n[2]*n[2];
+    const CFreal h = (ap[0]*n[0] + ap[1]*n[1] + ap[2]*n[2])/nn;
+
+    // barycentric coordinates of the projection
+    CFreal q[3];
+    for (CFuint i = 0; i < 3; ++i) {
+      q[i] = ap[i] - h*n[i];
+    }
+    const CFreal d00 = ac[0]*ac[0] + ac[1]*ac[1] + ac[2]*ac[2];
+    const CFreal d01 = ac[0]*ab[0] + ac[1]*ab[1] + ac[2]*ab[2];
+    const CFreal d11 = ab[0]*ab[0] + ab[1]*ab[1] + ab[2]*ab[2];
+    const CFreal d20 = q[0]*ac[0] + q[1]*ac[1] + q[2]*ac[2];
+    const CFreal d21 = q[0]*ab[0] + q[1]*ab[1] + q[2]*ab[2];
+    const CFreal den = d00*d11 - d01*d01;
+    const CFreal u = (d11*d20 - d01*d21)/den;
+    const CFreal v = (d00*d21 - d01*d20)/den;
+    if (u >= 0. && v >= 0. && u + v <= 1.) {
+      return h*h*nn;
+    }
+
+    return std::min(segmentDistanceSq(a, b, p, 3),
+		    std::min(segmentDistanceSq(b, c, p, 3), segmentDistanceSq(a, c, p, 3)));
+  }
+
+  /// Fill in the tree with small random faces and store the same faces as
+  /// segments or triangles, quadrilaterals being split along (0,2)
+  void addRandomFaces(WallDistanceTree& tree, const CFuint dim, const CFuint nbFaces)
+  {
+    m_prims.clear();
+    CFreal coord[12];
+    for (CFuint iFace = 0; iFace < nbFaces; ++iFace) {
+      const CFuint nbNodes = (dim == 2) ? 2 : ((iFace%2 == 1) ? 3 : 4);
+      CFreal center[3];
+      for (CFuint i = 0; i < dim; ++i) {
+	center[i] = random(0., 1.);
+      }
+      for (CFuint k = 0; k < nbNodes*dim; ++k) {
+	coord[k] = center[k%dim] + random(-0.025, 0.025);
+      }
+      tree.addFace(nbNodes, coord);
+
+      if (dim == 2) {
+	m_prims.insert(m_prims.end(), coord, coord + 4);
+      }
+      else {
+	m_prims.insert(m_prims.end(), coord, coord + 9);
+	if (nbNodes == 4) {
+	  m_prims.insert(m_prims.end(), coord, coord + 3);
+	  m_prims.insert(m_prims.end(), coord + 6, coord + 12);
+	}
+      }
+    }
+  }
+
+  /// @return the distance from p to the closest face, looping over all of them
+  CFreal bruteForceDistance(const CFreal* p, const CFuint dim) const
+  {
+    const CFuint stride = dim*dim;
+    CFreal best = 1e300;
+    for (CFuint i = 0; i < m_prims.size()/stride; ++i) {
+      const CFreal* c = &m_prims[i*stride];
+      best = std::min(best, (dim == 2) ? segmentDistanceSq(c, c + 2, p, 2) :
+		      triangleDistanceSq(c, c + 3, c + 6, p));
+    }
+    return std::sqrt(best);
+  }
+
+  /// Compare the tree with the brute force search
+  void checkAgainstBruteForce(const CFuint dim)
+  {
+    WallDistanceTree tree(dim, 4);
+    addRandomFaces(tree, dim, 3000);
+    tree.build();
+    BOOST_REQUIRE_EQUAL( tree.getNbFaces(), 3000u );
+
+    for (CFuint iPoint = 0; iPoint < 1000; ++iPoint) {
+      // the points also lie outside the box of the faces
+      CFreal p[3];
+      for (CFuint i = 0; i < 3; ++i) {
+	p[i] = random(-0.25, 1.25);
+      }
+      const CFreal exact = bruteForceDistance(p, dim);
+      BOOST_CHECK_SMALL( tree.computeDistance(p) - exact, 1e-12 );
+
+      // a random face as warm start does not change the result
+      CFint faceID = std::rand()%tree.getNbFaces();
+      BOOST_CHECK_SMALL( tree.computeDistance(p, faceID) - exact, 1e-12 );
+      BOOST_REQUIRE( faceID >= 0 );
+
+      // the closest point of the closest face is at the same distance
+      CFreal closest[3];
+      const CFreal d = tree.computeClosestPoint(faceID, p, closest);
+      CFreal d2 = 0.;
+      for (CFuint i = 0; i < dim; ++i) {
+	d2 += (closest[i] - p[i])*(closest[i] - p[i]);
+      }
+      BOOST_CHECK_SMALL( d - exact, 1e-12 );
+      BOOST_CHECK_SMALL( std::sqrt(d2) - exact, 1e-12 );
+    }
+  }
+
+  /// segments or triangles of the faces, stored by coordinates
+  vector<CFreal> m_prims;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+BOOST_FIXTURE_TEST_SUITE( WallDistanceTree_TestSuite, WallDistanceTree_Fixture )
+
+////////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_CASE( test_2D )
+{
+  checkAgainstBruteForce(2);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_CASE( test_3D )
+{
+  checkAgainstBruteForce(3);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_CASE( test_no_faces )
+{
+  WallDistanceTree tree(3, 4);
+  tree.build();
+  BOOST_CHECK_EQUAL( tree.getNbFaces(), 0u );
+
+  const CFreal p[3] = {0., 0., 0.};
+  CFint faceID = 0;
+  BOOST_CHECK( tree.computeDistance(p, faceID) > 1e300 );
+  BOOST_CHECK_EQUAL( faceID, -1 );
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_SUITE_END()
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,650 @@
+#include "MutationppI/MutationppTabulated.hh"
+#include "MutationppI/Mutationpp.hh"
+#include "Common/CFLog.hh"
+#include "Common/PE.hh"
+#include "Common/Stopwatch.hh"
+#include "Common/BadValueException.hh"
+#ifdef CF_HAVE_MPI
+#include "Common/MPI/MPIStructDef.hh"
+#include "Common/MPI/MPIError.hh"
+#endif
+#include "Environment/ObjectProvider.hh"
+#include <fstream>
+#include <iomanip>
+#include <cstdio>
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::MathTools;
+using namespace COOLFluiD::Common;
+
+using Mutation::Thermodynamics::Y_TO_X;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Physics {
+
+    namespace Mutationpp {
+
+//////////////////////////////////////////////////////////////////////////////
+
+Environment::ObjectProvider<MutationppTabulated,
+			    PhysicalPropertyLibrary,
+			    MutationppModule,
+			    1>
+mutationppTabulatedProvider("MutationppTabulated");
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MutationppTabulated::defineConfigOptions(Config::OptionList& options)
+{
+  options.addConfigOption< CFreal >("Tmin","Minimum temperature in the table.");
+  options.addConfigOption< CFreal >("Tmax","Maximum temperature in the table.");
+  options.addConfigOption< CFreal >("Pmin","Minimum pressure in the table.");
+  options.addConfigOption< CFreal >("Pmax","Maximum pressure in the table.");
+  options.addConfigOption< CFuint >("NbT","Initial number of temperatures in the table.");
+  options.addConfigOption< CFuint >("NbP","Initial number of pressures in the table.");
+  options.addConfigOption< CFuint >("MaxNbPoints","Maximum number of points in the table.");
+  options.addConfigOption< CFreal >
+    ("Tolerance","Maximum interpolation error (relative for properties, absolute for mass fractions).");
+  options.addConfigOption< std::string >
+    ("TableFile","File where to read the table from or to write it to once built (none if empty). A file built with different bounds, state model, thermodynamic database, ShiftH0 or Tolerance is rebuilt.");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+MutationppTabulated::MutationppTabulated(const std::string& name)
+  : MutationLibrarypp(name),
+    m_table(),
+    m_entries(),
+    m_lastT(-1.),
+    m_lastP(-1.),
+    m_lastInTable(false),
+    m_isMixtureSet(false)
+{
+  addConfigOptionsTo(this);
+
+  m_Tmin = 200.;
+  setParameter("Tmin",&m_Tmin);
+
+  m_Tmax = 15000.;
+  setParameter("Tmax",&m_Tmax);
+
+  m_pmin = 10.;
+  setParameter("Pmin",&m_pmin);
+
+  m_pmax = 1e6;
+  setParameter("Pmax",&m_pmax);
+
+  m_nbT = 256;
+  setParameter("NbT",&m_nbT);
+
+  m_nbP = 32;
+  setParameter("NbP",&m_nbP);
+
+  m_maxNbPoints = 4000000;
+  setParameter("MaxNbPoints",&m_maxNbPoints);
+
+  m_tolerance = 1e-3;
+  setParameter("Tolerance",&m_tolerance);
+
+  m_tableFile = "";
+  setParameter("TableFile",&m_tableFile);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+MutationppTabulated::~MutationppTabulated()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MutationppTabulated::setup()
+{
+  CFLog(VERBOSE, "MutationppTabulated::setup() => start\n");
+
+  if (_stateModelName != "Equil") {
+    throw BadValueException
+      (FromHere(), "MutationppTabulated::setup() => only \"Equil\" state model can be tabulated");
+  }
+  if (m_Tmin <= 0. || m_Tmax <= m_Tmin || m_pmin <= 0. || m_pmax <= m_pmin ||
+      m_nbT < 2 || m_nbP < 2) {
+    throw BadValueException
+      (FromHere(), "MutationppTabulated::setup() => wrong table bounds or sizes");
+  }
+
+  MutationLibrarypp::setup();
+
+  // stored in the table file, since it changes the tabulated values
+  m_thermoDB = Mutation::MixtureOptions(_mixtureName).getThermodynamicDatabase();
+
+  m_entries.resize(Y0 + _NS);
+
+  // the table is built (or read) by the first process only and then
+  // broadcast to all the others
+  if (PE::GetPE().GetRank("Default") == 0) {
+    if (m_tableFile.empty() || !readTable(m_tableFile)) {
+      buildTable();
+      if (!m_tableFile.empty()) {
+	writeTable(m_tableFile);
+      }
+    }
+  }
+  broadcastTable();
+
+  // the mixture state has been modified while building the table
+  m_lastT = m_lastP = -1.;
+  m_isMixtureSet = false;
+
+  CFLog(VERBOSE, "MutationppTabulated::setup() => end\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bool MutationppTabulated::lookUp(const CFreal temp, const CFreal pressure)
+{
+  if (temp != m_lastT || pressure != m_lastP) {
+    m_lastT = temp;
+    m_lastP = pressure;
+    m_isMixtureSet = false;
+    m_lastInTable = m_table.isInside(temp, pressure);
+    if (m_lastInTable) {
+      m_table.interpolate(temp, pressure, &m_entries[0]);
+    }
+  }
+  return m_lastInTable;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MutationppTabulated::setMixtureState()
+{
+  // nothing to do if no point has been looked up since the last reset
+  if (!m_isMixtureSet && m_lastT > 0.) {
+    m_gasMixture->setState(&m_lastP, &m_lastT, 1);
+    m_isMixtureSet = true;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MutationppTabulated::setComposition(CFdouble& temp,
+					 CFdouble& pressure,
+					 RealVector* x)
+{
+  if (temp < 100.) {temp = 100.;}
+
+  if (lookUp(temp, pressure)) {
+    for (CFint i = 0; i < _NS; ++i) {
+      m_y[i] = std::max(m_entries[Y0 + i], 0.);
+    }
+    if (x != CFNULL) {
+      m_gasMixture->convert<Y_TO_X>(&m_y[0], &(*x)[0]);
+    }
+  }
+  else {
+    MutationLibrarypp::setComposition(temp, pressure, x);
+    m_isMixtureSet = true;
+  }
+
+  CFLog(DEBUG_MAX, "MutationppTabulated::setComposition() => m_y = " << m_y << "\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MutationppTabulated::setDensityEnthalpyEnergy(CFdouble& temp,
+						   CFdouble& pressure,
+						   RealVector& dhe)
+{
+  if (lookUp(temp, pressure)) {
+    dhe[0] = m_entries[RHO_OVER_P]*pressure;
+    dhe[1] = m_entries[H];
+    dhe[2] = dhe[1] - 1./m_entries[RHO_OVER_P];
+  }
+  else {
+    setMixtureState();
+    MutationLibrarypp::setDensityEnthalpyEnergy(temp, pressure, dhe);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MutationppTabulated::gammaAndSoundSpeed(CFdouble& temp,
+					     CFdouble& pressure,
+					     CFdouble& rho,
+					     CFdouble& gamma,
+					     CFdouble& soundSpeed)
+{
+  if (lookUp(temp, pressure)) {
+    gamma = m_entries[GAMMA];
+    soundSpeed = m_entries[SOUND_SPEED];
+  }
+  else {
+    setMixtureState();
+    MutationLibrarypp::gammaAndSoundSpeed(temp, pressure, rho, gamma, soundSpeed);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MutationppTabulated::frozenGammaAndSoundSpeed(CFdouble& temp,
+						   CFdouble& pressure,
+						   CFdouble& rho,
+						   CFdouble& gamma,
+						   CFdouble& soundSpeed,
+						   RealVector* tVec)
+{
+  lookUp(temp, pressure);
+  setMixtureState();
+  MutationLibrarypp::frozenGammaAndSoundSpeed(temp, pressure, rho, gamma, soundSpeed, tVec);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFdouble MutationppTabulated::density(CFdouble& temp,
+				      CFdouble& pressure,
+				      CFreal* tVec)
+{
+  if (lookUp(temp, pressure)) {
+    return m_entries[RHO_OVER_P]*pressure;
+  }
+  setMixtureState();
+  return m_gasMixture->density();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFdouble MutationppTabulated::energy(CFdouble& temp,
+				     CFdouble& pressure)
+{
+  if (lookUp(temp, pressure)) {
+    return m_entries[H] - 1./m_entries[RHO_OVER_P];
+  }
+  setMixtureState();
+  return m_gasMixture->mixtureEnergyMass() - m_H0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFdouble MutationppTabulated::enthalpy(CFdouble& temp,
+				       CFdouble& pressure)
+{
+  if (lookUp(temp, pressure)) {
+    return m_entries[H];
+  }
+  setMixtureState();
+  return m_gasMixture->mixtureHMass() - m_H0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFdouble MutationppTabulated::soundSpeed(CFdouble& temp,
+					 CFdouble& pressure)
+{
+  if (lookUp(temp, pressure)) {
+    return m_entries[SOUND_SPEED];
+  }
+  setMixtureState();
+  return m_gasMixture->equilibriumSoundSpeed();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFdouble MutationppTabulated::eta(CFdouble& temp,
+				  CFdouble& pressure,
+				  CFreal* tVec)
+{
+  if (lookUp(temp, pressure)) {
+    return m_entries[MU];
+  }
+  setMixtureState();
+  return m_gasMixture->viscosity();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFdouble MutationppTabulated::lambdaEQ(CFdouble& temp,
+				       CFdouble& pressure)
+{
+  if (lookUp(temp, pressure)) {
+    return m_entries[LAMBDA];
+  }
+  setMixtureState();
+  return m_gasMixture->equilibriumThermalConductivity();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFdouble MutationppTabulated::lambdaNEQ(CFdouble& temp,
+					CFdouble& pressure)
+{
+  lookUp(temp, pressure);
+  setMixtureState();
+  return MutationLibrarypp::lambdaNEQ(temp, pressure);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFdouble MutationppTabulated::sigma(CFdouble& temp,
+				    CFdouble& pressure,
+				    CFreal* tVec)
+{
+  // the base class sets the mixture state at the (possibly clipped) temperature,
+  // which is the current one until the next point is looked up
+  const CFdouble result = MutationLibrarypp::sigma(temp, pressure, tVec);
+  m_lastT = m_lastP = -1.;
+  m_isMixtureSet = true;
+  return result;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFdouble MutationppTabulated::pressure(CFdouble& rho,
+				       CFdouble& temp,
+				       CFreal* tVec)
+{
+  // the pressure solves rho = (rho/p)(T,p)*p, where rho/p depends weakly on p:
+  // the fixed point iteration starts from the last looked up pressure, if any
+  CFreal p = (m_lastP > 0.) ? m_lastP : std::sqrt(m_pmin*m_pmax);
+  for (CFuint iter = 0; iter < 50; ++iter) {
+    CFreal rhoOverP = 0.;
+    if (lookUp(temp, p)) {
+      rhoOverP = m_entries[RHO_OVER_P];
+    }
+    else {
+      setMixtureState();
+      rhoOverP = m_gasMixture->density()/p;
+    }
+
+    const CFreal newP = rho/rhoOverP;
+    const bool converged = (std::abs(newP - p) <= 1e-12*p);
+    p = newP;
+    if (converged) break;
+  }
+
+  // the following queries refer to the computed pressure
+  lookUp(temp, p);
+
+  CFLog(DEBUG_MAX, "MutationppTabulated::pressure() => rho = " << rho
+	<< ", T = " << temp << " => p = " << p << "\n");
+  cf_assert(p > 0.);
+  return p;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MutationppTabulated::getMassProductionTerm(CFdouble& temp,
+						RealVector& tVec,
+						CFdouble& pressure,
+						CFdouble& rho,
+						const RealVector& ys,
+						bool flagJac,
+						RealVector& omega,
+						RealMatrix& jacobian)
+{
+  setMixtureState();
+  MutationLibrarypp::getMassProductionTerm(temp, tVec, pressure, rho, ys, flagJac, omega, jacobian);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MutationppTabulated::getSource(CFdouble& temp,
+				    RealVector& tVec,
+				    CFdouble& pressure,
+				    CFdouble& rho,
+				    const RealVector& ys,
+				    bool flagJac,
+				    RealVector& omega,
+				    RealVector& omegav,
+				    CFdouble& omegaRad,
+				    RealMatrix& jacobian)
+{
+  setMixtureState();
+  MutationLibrarypp::getSource(temp, tVec, pressure, rho, ys, flagJac, omega, omegav, omegaRad, jacobian);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MutationppTabulated::getRhoUdiff(CFdouble& temp,
+				      CFdouble& pressure,
+				      RealVector& normConcGradients,
+				      CFreal* tVec,
+				      RealVector& rhoUdiff,
+				      bool fast)
+{
+  lookUp(temp, pressure);
+  setMixtureState();
+  MutationLibrarypp::getRhoUdiff(temp, pressure, normConcGradients, tVec, rhoUdiff, fast);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MutationppTabulated::getSpeciesTotEnthalpies(CFdouble& temp,
+						  RealVector& tVec,
+						  CFdouble& pressure,
+						  RealVector& hsTot,
+						  RealVector* hsVib,
+						  RealVector* hsEl)
+{
+  lookUp(temp, pressure);
+  setMixtureState();
+  MutationLibrarypp::getSpeciesTotEnthalpies(temp, tVec, pressure, hsTot, hsVib, hsEl);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MutationppTabulated::computeEntries(CFreal temp, CFreal pressure, CFreal* values)
+{
+  m_gasMixture->setState(&pressure, &temp, 1);
+
+  values[RHO_OVER_P]  = m_gasMixture->density()/pressure;
+  values[H]           = m_gasMixture->mixtureHMass() - m_H0;
+  values[GAMMA]       = m_gasMixture->mixtureEquilibriumGamma();
+  values[SOUND_SPEED] = m_gasMixture->equilibriumSoundSpeed();
+  values[MU]          = m_gasMixture->viscosity();
+  values[LAMBDA]      = m_gasMixture->equilibriumThermalConductivity();
+
+  const double* y = m_gasMixture->Y();
+  for (CFint i = 0; i < _NS; ++i) {
+    values[Y0 + i] = y[i];
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MutationppTabulated::fillTable(const CFuint nbT, const CFuint nbP)
+{
+  typedef UniformLookupTable2D<CFreal> Table;
+  m_table.initialize(m_Tmin, m_Tmax, nbT, Table::LINEAR,
+		     m_pmin, m_pmax, nbP, Table::LOGARITHMIC, m_entries.size());
+
+  for (CFuint j = 0; j < nbP; ++j) {
+    const CFreal p = m_table.getKey2(j);
+    for (CFuint i = 0; i < nbT; ++i) {
+      computeEntries(m_table.getKey1(i), p, m_table.getValues(i,j));
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFreal MutationppTabulated::computeMaxError()
+{
+  const CFuint nbEntries = m_entries.size();
+  vector<CFreal> exact(nbEntries);
+  vector<CFreal> interp(nbEntries);
+  CFreal maxError = 0.;
+
+  // the error of the bilinear interpolation is largest around the cell centers
+  for (CFuint j = 0; j < m_table.getNbKeys2() - 1; ++j) {
+    const CFreal p = std::sqrt(m_table.getKey2(j)*m_table.getKey2(j+1));
+    for (CFuint i = 0; i < m_table.getNbKeys1() - 1; ++i) {
+      const CFreal T = 0.5*(m_table.getKey1(i) + m_table.getKey1(i+1));
+      computeEntries(T, p, &exact[0]);
+      m_table.interpolate(T, p, &interp[0]);
+
+      for (CFuint iv = 0; iv < nbEntries; ++iv) {
+	const CFreal scale = (iv < static_cast<CFuint>(Y0)) ? std::abs(exact[iv]) : 1.;
+	if (scale > 0.) {
+	  maxError = std::max(maxError, std::abs(interp[iv] - exact[iv])/scale);
+	}
+      }
+    }
+  }
+
+  return maxError;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MutationppTabulated::buildTable()
+{
+  Stopwatch<WallTime> stp;
+  stp.start();
+
+  CFuint nbT = m_nbT;
+  CFuint nbP = m_nbP;
+  for (;;) {
+    fillTable(nbT, nbP);
+    const CFreal error = computeMaxError();
+    CFLog(INFO, "MutationppTabulated::buildTable() => " << nbT << " x " << nbP
+	  << " points, max interpolation error = " << error << "\n");
+
+    if (error <= m_tolerance) break;
+
+    // halve the spacing in both directions
+    const CFuint newNbT = 2*nbT - 1;
+    const CFuint newNbP = 2*nbP - 1;
+    if (newNbT*newNbP > m_maxNbPoints) {
+      CFLog(WARN, "MutationppTabulated::buildTable() => tolerance " << m_tolerance
+	    << " not reached within " << m_maxNbPoints << " points\n");
+      break;
+    }
+    nbT = newNbT;
+    nbP = newNbP;
+  }
+
+  CFLog(INFO, "MutationppTabulated::buildTable() took " << stp << "s\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MutationppTabulated::broadcastTable()
+{
+#ifdef CF_HAVE_MPI
+  if (!PE::GetPE().IsParallel()) return;
+
+  MPI_Comm comm = PE::GetPE().GetCommunicator("Default");
+  const bool isMaster = (PE::GetPE().GetRank("Default") == 0);
+
+  CFuint nbKeys[2] = {m_table.getNbKeys1(), m_table.getNbKeys2()};
+  MPIError::getInstance().check
+    ("MPI_Bcast", "MutationppTabulated::broadcastTable()",
+     MPI_Bcast(&nbKeys[0], 2, MPIStructDef::getMPIType(&nbKeys[0]), 0, comm));
+
+  if (!isMaster) {
+    typedef UniformLookupTable2D<CFreal> Table;
+    m_table.initialize(m_Tmin, m_Tmax, nbKeys[0], Table::LINEAR,
+		       m_pmin, m_pmax, nbKeys[1], Table::LOGARITHMIC, m_entries.size());
+  }
+
+  vector<CFreal>& data = m_table.getData();
+  MPIError::getInstance().check
+    ("MPI_Bcast", "MutationppTabulated::broadcastTable()",
+     MPI_Bcast(&data[0], static_cast<int>(data.size()), MPIStructDef::getMPIType(&data[0]), 0, comm));
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bool MutationppTabulated::readTable(const std::string& fileName)
+{
+  ifstream fin(fileName.c_str());
+  if (!fin) return false;
+
+  std::string mixture;
+  CFuint nbEntries = 0;
+  CFuint nbT = 0;
+  CFuint nbP = 0;
+  CFreal Tmin = 0., Tmax = 0., pmin = 0., pmax = 0.;
+  fin >> mixture >> nbEntries >> nbT >> nbP >> Tmin >> Tmax >> pmin >> pmax;
+
+  std::string stateModel;
+  std::string thermoDB;
+  bool shiftH0 = false;
+  CFreal tolerance = 0.;
+  fin >> stateModel >> thermoDB >> shiftH0 >> tolerance;
+
+  if (!fin || mixture != _mixtureName || nbEntries != m_entries.size() ||
+      Tmin != m_Tmin || Tmax != m_Tmax || pmin != m_pmin || pmax != m_pmax ||
+      stateModel != _stateModelName || thermoDB != m_thermoDB ||
+      shiftH0 != m_shiftHO || tolerance != m_tolerance ||
+      nbT < 2 || nbP < 2) {
+    CFLog(WARN, "MutationppTabulated::readTable() => " << fileName
+	  << " does not match the current settings: table will be rebuilt\n");
+    return false;
+  }
+
+  typedef UniformLookupTable2D<CFreal> Table;
+  m_table.initialize(m_Tmin, m_Tmax, nbT, Table::LINEAR,
+		     m_pmin, m_pmax, nbP, Table::LOGARITHMIC, nbEntries);
+  vector<CFreal>& data = m_table.getData();
+  for (CFuint i = 0; i < data.size(); ++i) {
+    fin >> data[i];
+  }
+
+  if (!fin) {
+    CFLog(WARN, "MutationppTabulated::readTable() => " << fileName
+	  << " is incomplete: table will be rebuilt\n");
+    return false;
+  }
+
+  CFLog(INFO, "MutationppTabulated::readTable() => " << nbT << " x " << nbP
+	<< " points read from " << fileName << "\n");
+  return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MutationppTabulated::writeTable(const std::string& fileName)
+{
+  // the table is written to a temporary file and then renamed, so that
+  // the file is never seen partially written
+  const std::string tmpName = fileName + ".tmp";
+  ofstream fout(tmpName.c_str());
+  if (!fout) {
+    CFLog(WARN, "MutationppTabulated::writeTable() => cannot open " << tmpName << "\n");
+    return;
+  }
+
+  fout << _mixtureName << " " << m_entries.size() << " "
+       << m_table.getNbKeys1() << " " << m_table.getNbKeys2() << "\n";
+  fout << setprecision(17) << m_Tmin << " " << m_Tmax << " "
+       << m_pmin << " " << m_pmax << "\n";
+  fout << _stateModelName << " " << m_thermoDB << " "
+       << m_shiftHO << " " << m_tolerance << "\n";
+
+  const vector<CFreal>& data = m_table.getData();
+  const CFuint nbEntries = m_entries.size();
+  for (CFuint i = 0; i < data.size(); ++i) {
+    fout << data[i] << (((i+1)%nbEntries == 0) ? "\n" : " ");
+  }
+  fout.close();
+
+  std::rename(tmpName.c_str(), fileName.c_str());
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace Mutationpp
+
+  } // namespace Physics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
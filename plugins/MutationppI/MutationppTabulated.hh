@@ -0,0 +1,321 @@
+#ifndef COOLFluiD_Physics_Mutationpp_MutationppTabulated_hh
+#define COOLFluiD_Physics_Mutationpp_MutationppTabulated_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "MutationppI/MutationLibrarypp.hh"
+#include "Common/UniformLookupTable2D.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Physics {
+
+    namespace Mutationpp {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class implements a Mutation++ library for mixtures in local
+ * thermodynamic equilibrium (LTE) which answers the queries of composition,
+ * thermodynamic and transport properties at given temperature and pressure
+ * by bilinear interpolation inside a table, uniformly spaced in temperature
+ * and in log(pressure).
+ * The table is built at setup (or read from file) by the first process,
+ * refined until the interpolation error at the centers of the table cells
+ * is below the given tolerance, and broadcast to the other processes.
+ * Queries outside the table fall back to Mutation++, whose mixture state is
+ * set lazily at the last looked up point before any query that reads it.
+ *
+ * @author Andrea Lani
+ *
+ */
+class MutationppTabulated : public MutationLibrarypp {
+public:
+
+  /**
+   * Defines the Config Option's of this class
+   * @param options a OptionList where to add the Option's
+   */
+  static void defineConfigOptions(Config::OptionList& options);
+
+  /**
+   * Constructor without arguments
+   */
+  MutationppTabulated(const std::string& name);
+
+  /**
+   * Default destructor
+   */
+  virtual ~MutationppTabulated();
+
+  /**
+   * Setups the data of the library
+   */
+  void setup();
+
+  /**
+   * Calculates the composition given temperature and pressure.
+   * @param temp temperature
+   * @param pressure pressure
+   * @param x composition array (one component for each species)
+   */
+  void setComposition(CFdouble& temp,
+		      CFdouble& pressure,
+		      RealVector* x);
+
+  /**
+   * Calculates the density, the enthalpy and the internal energy
+   * @param temp temperature
+   * @param pressure pressure
+   * @param dhe array with density, enthalpy, energy
+   */
+  void setDensityEnthalpyEnergy(CFdouble& temp,
+				CFdouble& pressure,
+				RealVector& dhe);
+
+  /**
+   * Calculates the specific heat ratio and the speed of sound in
+   * thermal equilibrium.
+   * @param temp temperature
+   * @param pressure pressure
+   * @param rho density
+   * @param gamma specific heat ratio
+   * @param soundSpeed speed
+   */
+  void gammaAndSoundSpeed(CFdouble& temp,
+			  CFdouble& pressure,
+			  CFdouble& rho,
+			  CFdouble& gamma,
+			  CFdouble& soundSpeed);
+
+  /**
+   * Calculates the specific heat ratio and the speed of sound in
+   * thermal equilibrium with frozen chemistry.
+   */
+  void frozenGammaAndSoundSpeed(CFdouble& temp,
+				CFdouble& pressure,
+				CFdouble& rho,
+				CFdouble& gamma,
+				CFdouble& soundSpeed,
+				RealVector* tVec);
+
+  /**
+   * Calculates the density given temperature and pressure.
+   */
+  CFdouble density(CFdouble& temp,
+		   CFdouble& pressure,
+		   CFreal* tVec);
+
+  /**
+   * Calculates the internal energy at given temperature and pressure.
+   */
+  CFdouble energy(CFdouble& temp,
+		  CFdouble& pressure);
+
+  /**
+   * Calculates the enthalpy at given temperature and pressure.
+   */
+  CFdouble enthalpy(CFdouble& temp,
+		    CFdouble& pressure);
+
+  /**
+   * Calculates the speed of sound in thermal equilibrium.
+   */
+  CFdouble soundSpeed(CFdouble& temp,
+		      CFdouble& pressure);
+
+  /**
+   * Calculates the dynamic viscosity, given temperature and pressure
+   */
+  CFdouble eta(CFdouble& temp, CFdouble& pressure, CFreal* tVec);
+
+  /**
+   * Calculates the equilibrium thermal conductivity, given temperature and pressure
+   */
+  CFdouble lambdaEQ(CFdouble& temp, CFdouble& pressure);
+
+  /**
+   * Calculates the frozen thermal conductivity
+   */
+  CFdouble lambdaNEQ(CFdouble& temp, CFdouble& pressure);
+
+  /**
+   * Calculates the electrical conductivity given temperature and pressure
+   */
+  CFdouble sigma(CFdouble& temp,
+		 CFdouble& pressure,
+		 CFreal* tVec);
+
+  /**
+   * Calculates the pressure given density and temperature, by inverting
+   * the tabulated density at the given temperature
+   */
+  CFdouble pressure(CFdouble& rho,
+		    CFdouble& temp,
+		    CFreal* tVec);
+
+  /**
+   * Returns the mass production terms at the last looked up point
+   */
+  void getMassProductionTerm(CFdouble& temp,
+			     RealVector& tVec,
+			     CFdouble& pressure,
+			     CFdouble& rho,
+			     const RealVector& ys,
+			     bool flagJac,
+			     RealVector& omega,
+			     RealMatrix& jacobian);
+
+  /**
+   * Returns the source terms at the last looked up point
+   */
+  void getSource(CFdouble& temp,
+		 RealVector& tVec,
+		 CFdouble& pressure,
+		 CFdouble& rho,
+		 const RealVector& ys,
+		 bool flagJac,
+		 RealVector& omega,
+		 RealVector& omegav,
+		 CFdouble& omegaRad,
+		 RealMatrix& jacobian);
+
+  /**
+   * Returns the diffusion velocities of species multiplied by the species
+   * densities
+   */
+  void getRhoUdiff(CFdouble& temp,
+		   CFdouble& pressure,
+		   RealVector& normConcGradients,
+		   CFreal* tVec,
+		   RealVector& rhoUdiff,
+		   bool fast);
+
+  /**
+   * Returns the total enthalpies per unit mass of species
+   */
+  void getSpeciesTotEnthalpies(CFdouble& temp,
+			       RealVector& tVec,
+			       CFdouble& pressure,
+			       RealVector& hsTot,
+			       RealVector* hsVib,
+			       RealVector* hsEl);
+
+private: // helper functions
+
+  /// indices of the tabulated quantities (mass fractions come last)
+  enum TableEntry {RHO_OVER_P=0, H=1, GAMMA=2, SOUND_SPEED=3, MU=4, LAMBDA=5, Y0=6};
+
+  /**
+   * Interpolate the tabulated quantities at the given temperature and pressure
+   * @return true if the point lies inside the table
+   */
+  bool lookUp(const CFreal temp, const CFreal pressure);
+
+  /**
+   * Set the state of the Mutation++ mixture at the last looked up
+   * temperature and pressure, if not done already
+   */
+  void setMixtureState();
+
+  /**
+   * Compute the exact tabulated quantities with Mutation++
+   */
+  void computeEntries(CFreal temp, CFreal pressure, CFreal* values);
+
+  /**
+   * Build the table, refining it until the tolerance is met
+   */
+  void buildTable();
+
+  /**
+   * Fill in the table with nbT x nbP points
+   */
+  void fillTable(const CFuint nbT, const CFuint nbP);
+
+  /**
+   * Compute the maximum interpolation error at the centers of the table cells
+   */
+  CFreal computeMaxError();
+
+  /**
+   * Broadcast the table built by the first process to the other ones
+   */
+  void broadcastTable();
+
+  /**
+   * Read the table from file
+   * @return true if the file exists and matches the current settings
+   */
+  bool readTable(const std::string& fileName);
+
+  /**
+   * Write the table to file
+   */
+  void writeTable(const std::string& fileName);
+
+private:
+
+  /// table of the properties
+  Common::UniformLookupTable2D<CFreal> m_table;
+
+  /// interpolated quantities at the last looked up point
+  std::vector<CFreal> m_entries;
+
+  /// temperature of the last looked up point
+  CFreal m_lastT;
+
+  /// pressure of the last looked up point
+  CFreal m_lastP;
+
+  /// flag telling if the last looked up point lies inside the table
+  bool m_lastInTable;
+
+  /// flag telling if the state of the mixture corresponds to the last looked up point
+  bool m_isMixtureSet;
+
+  /// minimum temperature in the table
+  CFreal m_Tmin;
+
+  /// maximum temperature in the table
+  CFreal m_Tmax;
+
+  /// minimum pressure in the table
+  CFreal m_pmin;
+
+  /// maximum pressure in the table
+  CFreal m_pmax;
+
+  /// initial number of temperatures in the table
+  CFuint m_nbT;
+
+  /// initial number of pressures in the table
+  CFuint m_nbP;
+
+  /// maximum number of points in the table
+  CFuint m_maxNbPoints;
+
+  /// tolerance on the interpolation error
+  CFreal m_tolerance;
+
+  /// name of the file where to read/write the table
+  std::string m_tableFile;
+
+  /// name of the thermodynamic database of the mixture
+  std::string m_thermoDB;
+
+}; // end of class MutationppTabulated
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace Mutationpp
+
+  } // namespace Physics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Physics_Mutationpp_MutationppTabulated_hh
@@ -10,6 +10,7 @@
 #include "NewtonMethod/NewtonMethod.hh"
 #include "Framework/CFL.hh"
 #include "Framework/SpaceMethod.hh"
+#include "Framework/Profiler.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -79,7 +80,7 @@ void BDF2_InitCN::takeStepImpl()
   }
 
   // prepare to take a time step
-  m_prepare->execute();
+  profileExecute(m_prepare);
 
   // reset the achieved flag
   m_data->setAchieved(false);
@@ -96,7 +97,7 @@ void BDF2_InitCN::takeStepImpl()
     // prepare for the CranckNicholson step (backup rhs^0)
     getMethodData()->getCollaborator<SpaceMethod>()->prepareComputation();
     getMethodData()->getCollaborator<SpaceMethod>()->computeSpaceResidual(0.5);
-    m_prepare1stStep->execute();
+    profileExecute(m_prepare1stStep);
 
     // sweeps to solve the nonlinear system
     for(CFuint k = 0; !m_data->isAchieved(); ++k)
@@ -108,7 +109,7 @@ void BDF2_InitCN::takeStepImpl()
       getMethodData()->getCollaborator<SpaceMethod>()->computeSpaceResidual(0.5);
 
       // add rhs^0
-      m_intermediate1stStep->execute();
+      profileExecute(m_intermediate1stStep);
 
       // RHS will be changed here (from steady to pseudoSteady)
       // including the time contribution
@@ -118,7 +119,7 @@ void BDF2_InitCN::takeStepImpl()
       getLinearSystemSolver().apply(mem_fun(&LinearSystemSolver::solveSys));
 
       // update the solution
-      m_updateSol->execute();
+      profileExecute(m_updateSol);
 
       // synchronize the states and compute the residual norms
       ConvergenceMethod::syncGlobalDataComputeResidual(true);
@@ -171,7 +172,7 @@ void BDF2_InitCN::takeStepImpl()
       getLinearSystemSolver().apply(mem_fun(&LinearSystemSolver::solveSys));
 
       // update the solution
-      m_updateSol->execute();
+      profileExecute(m_updateSol);
 
       // synchronize the states and compute the residual norms
       ConvergenceMethod::syncGlobalDataComputeResidual(true);
@@ -204,7 +205,7 @@ void BDF2_InitCN::takeStepImpl()
     subSysStatus->updateCurrentTime();
   }
 
-  if(subSysStatus->isMovingMesh()) m_aleUpdate->execute();
+  if(subSysStatus->isMovingMesh()) profileExecute(m_aleUpdate);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -4,6 +4,8 @@
 // GNU Lesser General Public License version 3 (LGPLv3).
 // See doc/lgpl.txt and doc/gpl.txt for the license text.
 
+#include <algorithm>
+
 #include "Common/Stopwatch.hh"
 
 #include "Environment/ObjectProvider.hh"
@@ -12,6 +14,7 @@
 #include "Framework/SubSystemStatus.hh"
 #include "Framework/SpaceMethod.hh"
 #include "Framework/CFL.hh"
+#include "Framework/Profiler.hh"
 
 #include "NewtonMethod/NewtonMethod.hh"
 #include "NewtonMethod/NewtonIterator.hh"
@@ -55,7 +58,14 @@ void NewtonIterator::defineConfigOptions(Config::OptionList& options)
 //////////////////////////////////////////////////////////////////////////////
 
 NewtonIterator::NewtonIterator(const std::string& name)
-  : ConvergenceMethod(name)
+  : ConvergenceMethod(name),
+    m_jacobAge(0),
+    m_nbJacobSincePC(0),
+    m_refLinearIter(0),
+    m_lastResidual(MathTools::MathConsts::CFrealMax()),
+    m_pcRebuilt(true),
+    m_forceJacobReason(""),
+    m_jacobStatus("")
 {
   addConfigOptionsTo(this);
 
@@ -138,14 +148,21 @@ void NewtonIterator::setMethodImpl()
 
   m_data->setLinearSystemSolver(getLinearSystemSolver());
   setupCommandsAndStrategies();
-  m_setup->execute();
+  profileExecute(m_setup);
+
+  if (m_data->isJacobianLagged()) {
+    CFLog(INFO, "NewtonIterator => jacobian lag policy: JacobianLag = " << m_data->getJacobianLag()
+	  << ", PreconditionerLag = " << m_data->getPreconditionerLag()
+	  << ", refresh if linear iterations > " << m_data->getJacobianLagIterRatio()
+	  << " x reference or log10(residual) increase > " << m_data->getJacobianLagResidualIncrease() << "\n");
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
 void NewtonIterator::unsetMethodImpl()
 {
-  m_unSetup->execute();
+  profileExecute(m_unSetup);
   unsetupCommandsAndStrategies();
 
   ConvergenceMethod::unsetMethodImpl();
@@ -167,7 +184,7 @@ void NewtonIterator::prepare()
   }
   
   // prepare to take a time step
-  m_prepare->execute();
+  profileExecute(m_prepare);
 
   getConvergenceMethodData()->getConvergenceStatus().res     = subSysStatus->getResidual();
   getConvergenceMethodData()->getConvergenceStatus().iter    = 0;
@@ -212,7 +229,7 @@ void NewtonIterator::takeStepImpl()
     CFLog(VERBOSE, "NewtonIterator::takeStep(): before first update CFL\n");
     getConvergenceMethodData()->getCFL()->update(cvgst.get());
     
-    m_init->execute();
+    profileExecute(m_init);
     CFLog(VERBOSE, "NewtonIterator::takeStep(): preparing Computation\n");
     getMethodData()->getCollaborator<SpaceMethod>()->prepareComputation();
    
@@ -220,6 +237,9 @@ void NewtonIterator::takeStepImpl()
     // this will make the solvers compute the jacobian only during the first iteration at each time step
     (m_data->freezeJacobian() && k > 1) ? m_data->setDoComputeJacobFlag(false) : m_data->setDoComputeJacobFlag(true);
     
+    // this can keep the jacobian and the preconditioner over several steps
+    applyJacobianLag();
+    
     // this is needed for cases like jacobian free
     getMethodData()->getCollaborator<SpaceMethod>()->setComputeJacobianFlag( m_data->getDoComputeJacobFlag() );
     
@@ -232,7 +252,7 @@ void NewtonIterator::takeStepImpl()
     
     // do an intermediate step, useful for some special types of temporal discretization
     CFLog(VERBOSE, "NewtonIterator::takeStep(): calling Intermediate step\n");
-    m_intermediate->execute();
+    profileExecute(m_intermediate);
     
     CFLog(VERBOSE, "NewtonIterator::takeStep(): computing the Time Residual\n");
     getMethodData()->getCollaborator<SpaceMethod>()->computeTimeResidual(1.0);
@@ -262,7 +282,7 @@ void NewtonIterator::takeStepImpl()
     }
 
     CFLog(VERBOSE, "NewtonIterator::takeStep(): updating the solution\n");
-    m_updateSol->execute();
+    profileExecute(m_updateSol);
     
     // synchronize the states and compute the residual norms
     ConvergenceMethod::syncGlobalDataComputeResidual(true);
@@ -270,10 +290,16 @@ void NewtonIterator::takeStepImpl()
     getMethodData()->getCollaborator<SpaceMethod>()->postProcessSolution();
     getConvergenceMethodData()->getConvergenceStatus().res = subSysStatus->getResidual();
 
+    checkJacobianLag();
+
     // Display info over each step of the Newton iterator
     if (m_data->isPrintHistory())
     {
-      CFout << "Newton Step: " << k << " L2 dU: " << getConvergenceMethodData()->getConvergenceStatus().res  << " CFL: " << getConvergenceMethodData()->getCFL()->getCFLValue() << "\n";
+      CFout << "Newton Step: " << k << " L2 dU: " << getConvergenceMethodData()->getConvergenceStatus().res  << " CFL: " << getConvergenceMethodData()->getCFL()->getCFLValue();
+      if (m_data->isJacobianLagged()) {
+	CFout << " Jacobian: " << m_jacobStatus;
+      }
+      CFout << "\n";
     }
 
     m_data->setAchieved(m_stopCondControler->isAchieved(getConvergenceMethodData()->getConvergenceStatus()));
@@ -286,6 +312,83 @@ void NewtonIterator::takeStepImpl()
   CFLog(VERBOSE, "NewtonIterator::takeStepImpl() END\n");
 }
 
+//////////////////////////////////////////////////////////////////////////////
+
+void NewtonIterator::applyJacobianLag()
+{
+  if (!m_data->isJacobianLagged()) return;
+
+  // the jacobian is recomputed only if no one else is freezing it
+  std::string reason = "";
+  if (m_data->getDoComputeJacobFlag()) {
+    if (m_jacobAge == 0) {
+      reason = "first";
+    }
+    else if (!m_forceJacobReason.empty()) {
+      reason = m_forceJacobReason;
+    }
+    else if (m_jacobAge >= m_data->getJacobianLag()) {
+      reason = "lag";
+    }
+  }
+
+  const bool refresh = !reason.empty();
+  m_pcRebuilt = false;
+  if (refresh) {
+    // a forced refresh also rebuilds the preconditioner
+    m_pcRebuilt = (m_jacobAge == 0 || !m_forceJacobReason.empty() ||
+		   m_nbJacobSincePC + 1 >= m_data->getPreconditionerLag());
+    m_nbJacobSincePC = (m_pcRebuilt) ? 0 : m_nbJacobSincePC + 1;
+    m_jacobAge = 1;
+    m_jacobStatus = "refreshed (" + reason + ")";
+  }
+  else {
+    ++m_jacobAge;
+    m_jacobStatus = "lagged (age " + StringOps::to_str(m_jacobAge) + ")";
+  }
+  m_jacobStatus += (m_pcRebuilt) ? ", PC rebuilt" : ", PC reused";
+  m_forceJacobReason = "";
+
+  m_data->setDoComputeJacobFlag(refresh);
+  for (CFuint i = 0; i < getLinearSystemSolver().size(); ++i) {
+    getLinearSystemSolver()[i]->setReusePreconditioner(!m_pcRebuilt);
+  }
+
+  CFLog(VERBOSE, "NewtonIterator::applyJacobianLag() => jacobian " << m_jacobStatus << "\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void NewtonIterator::checkJacobianLag()
+{
+  if (!m_data->isJacobianLagged()) return;
+
+  // solvers that do not report their iterations are never checked
+  CFuint nbLinearIter = 0;
+  for (CFuint i = 0; i < getLinearSystemSolver().size(); ++i) {
+    nbLinearIter = std::max(nbLinearIter, getLinearSystemSolver()[i]->getNbIterations());
+  }
+
+  const bool isLagged = (m_jacobAge > 1 || !m_pcRebuilt);
+  if (m_pcRebuilt) {
+    m_refLinearIter = nbLinearIter;
+  }
+  else if (nbLinearIter > m_data->getJacobianLagIterRatio()*std::max<CFuint>(m_refLinearIter, 1)) {
+    m_forceJacobReason = "linear iterations";
+  }
+
+  const CFreal residual = getConvergenceMethodData()->getConvergenceStatus().res;
+  if (isLagged && m_lastResidual < MathTools::MathConsts::CFrealMax() &&
+      residual - m_lastResidual > m_data->getJacobianLagResidualIncrease()) {
+    m_forceJacobReason = "residual increase";
+  }
+  m_lastResidual = residual;
+
+  if (!m_forceJacobReason.empty()) {
+    CFLog(VERBOSE, "NewtonIterator::checkJacobianLag() => refresh forced by " << m_forceJacobReason << "\n");
+  }
+}
+
 //////////////////////////////////////////////////////////////////////////////
 
     } // namespace NewtonMethod
@@ -77,6 +77,14 @@ protected: // abstract interface implementations
   /// Perform the prepare phase before any iteration
   virtual void prepare ();
 
+  /// Decide if the jacobian and the preconditioner are recomputed in this
+  /// Newton step, according to the jacobian lag policy
+  void applyJacobianLag();
+
+  /// Check the linear iterations and the residual after a Newton step
+  /// and force a refresh of the jacobian if they degraded
+  void checkJacobianLag();
+
 protected: // member data
 
 ///The data to share between NewtonMethodMethod commands
@@ -125,6 +133,27 @@ protected: // member data
   ///The string for configuration of m_aleUpdate command
   std::string m_aleUpdateStr;
 
+  /// number of Newton steps using the current jacobian (0 if none computed yet)
+  CFuint m_jacobAge;
+
+  /// number of jacobian refreshes since the preconditioner was rebuilt
+  CFuint m_nbJacobSincePC;
+
+  /// linear iterations right after the last rebuild of the preconditioner
+  CFuint m_refLinearIter;
+
+  /// log10 of the residual at the previous Newton step
+  CFreal m_lastResidual;
+
+  /// flag telling that the preconditioner was rebuilt in the current step
+  bool m_pcRebuilt;
+
+  /// reason forcing a refresh of the jacobian in the next step (empty if none)
+  std::string m_forceJacobReason;
+
+  /// jacobian status of the current step, for the convergence output
+  std::string m_jacobStatus;
+
 }; // class NewtonIterator
 
 //////////////////////////////////////////////////////////////////////////////
@@ -4,6 +4,8 @@
 // GNU Lesser General Public License version 3 (LGPLv3).
 // See doc/lgpl.txt and doc/gpl.txt for the license text.
 
+#include <algorithm>
+
 #include "NewtonMethod/NewtonIteratorData.hh"
 #include "NewtonMethod/NewtonMethod.hh"
 
@@ -35,6 +37,10 @@ void NewtonIteratorData::defineConfigOptions(Config::OptionList& options)
    options.addConfigOption< bool >          ("SaveSystemToFile","Save files of matrix rhs solution vectors at each Newton step");
    options.addConfigOption< bool >          ("PrintHistory","Print convergence history for each Newton Iterator step");
    options.addConfigOption< vector<CFuint> >("MaxSteps","Maximum steps to perform in the newton loop.");
+   options.addConfigOption< CFuint >        ("JacobianLag","Maximum number of Newton steps using the same jacobian (default = 1, i.e. recompute at every step).");
+   options.addConfigOption< CFreal >        ("JacobianLagIterRatio","Recompute the lagged jacobian if the linear iterations exceed this ratio times those after the last refresh.");
+   options.addConfigOption< CFreal >        ("JacobianLagResidualIncrease","Recompute the lagged jacobian if the log10 of the residual increases by more than this.");
+   options.addConfigOption< CFuint >        ("PreconditionerLag","Rebuild the preconditioner only every this number of jacobian refreshes (default = 1).");
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -57,6 +63,18 @@ NewtonIteratorData::NewtonIteratorData(Common::SafePtr<Framework::Method> owner)
 
   m_saveSystemToFile = false;
   setParameter("SaveSystemToFile",&m_saveSystemToFile);
+
+  m_jacobianLag = 1;
+  setParameter("JacobianLag",&m_jacobianLag);
+
+  m_jacobianLagIterRatio = 2.;
+  setParameter("JacobianLagIterRatio",&m_jacobianLagIterRatio);
+
+  m_jacobianLagResidualIncrease = 0.;
+  setParameter("JacobianLagResidualIncrease",&m_jacobianLagResidualIncrease);
+
+  m_preconditionerLag = 1;
+  setParameter("PreconditionerLag",&m_preconditionerLag);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -78,6 +96,10 @@ void NewtonIteratorData::configure ( Config::ConfigArgs& args )
     m_maxSteps[0] = 1;
   }
   cf_assert(m_maxSteps.size() > 0);
+
+  // 0 would mean never computing the jacobian
+  m_jacobianLag = std::max<CFuint>(m_jacobianLag, 1);
+  m_preconditionerLag = std::max<CFuint>(m_preconditionerLag, 1);
 }
 
 //////////////////////////////////////////////////////////////////////////////
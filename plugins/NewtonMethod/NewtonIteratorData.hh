@@ -80,6 +80,36 @@ public: // functions
     return m_saveSystemToFile;
   }
 
+  /// Gets the maximum number of Newton steps using the same jacobian
+  CFuint getJacobianLag() const
+  {
+    return m_jacobianLag;
+  }
+
+  /// Gets the ratio of linear iterations above which a lagged jacobian is recomputed
+  CFreal getJacobianLagIterRatio() const
+  {
+    return m_jacobianLagIterRatio;
+  }
+
+  /// Gets the increase of the log10 of the residual above which a lagged jacobian is recomputed
+  CFreal getJacobianLagResidualIncrease() const
+  {
+    return m_jacobianLagResidualIncrease;
+  }
+
+  /// Gets the number of jacobian refreshes between two rebuilds of the preconditioner
+  CFuint getPreconditionerLag() const
+  {
+    return m_preconditionerLag;
+  }
+
+  /// Checks if the jacobian or the preconditioner can be lagged
+  bool isJacobianLagged() const
+  {
+    return (m_jacobianLag > 1 || m_preconditionerLag > 1);
+  }
+
   /// Gets the flag that indicates we are at the last iteration
   bool isAchieved() const
   {
@@ -127,6 +157,18 @@ private: // data
   /// flag to indicate saving files of system matrix, rhs and solution vectors at each iteration
   bool m_saveSystemToFile;
 
+  /// maximum number of Newton steps using the same jacobian
+  CFuint m_jacobianLag;
+
+  /// ratio of linear iterations above which a lagged jacobian is recomputed
+  CFreal m_jacobianLagIterRatio;
+
+  /// increase of the log10 of the residual above which a lagged jacobian is recomputed
+  CFreal m_jacobianLagResidualIncrease;
+
+  /// number of jacobian refreshes between two rebuilds of the preconditioner
+  CFuint m_preconditionerLag;
+
 }; // end of class NewtonIteratorData
 
 //////////////////////////////////////////////////////////////////////////////
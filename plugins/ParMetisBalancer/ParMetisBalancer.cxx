@@ -5,6 +5,7 @@
 #include "ParMetisBalancer/ParMetisBalancer.hh"
 #include "ParMetisBalancer/ParMetisBalancerModule.hh"
 #include "ParMetisBalancer/ParMetisBalancerData.hh"
+#include "Framework/Profiler.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -71,7 +72,7 @@ Common::SafePtr<MethodData> ParMetisBalancer::getMethodData() const
 
 void ParMetisBalancer::doDynamicBalanceImpl()
 {
-  m_repart->execute();
+  profileExecute(m_repart);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -97,7 +98,7 @@ void ParMetisBalancer::setMethodImpl()
 
   setupCommandsAndStrategies();
   cf_assert(m_setup.isNotNull());
-  m_setup->execute();
+  profileExecute(m_setup);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -105,7 +106,7 @@ void ParMetisBalancer::setMethodImpl()
 void ParMetisBalancer::unsetMethodImpl()
 {
   cf_assert(m_unSetup.isNotNull());
-  m_unSetup->execute();
+  profileExecute(m_unSetup);
   unsetupCommandsAndStrategies();
 
   DynamicBalancerMethod::unsetMethodImpl();
@@ -49,6 +49,7 @@ StdRepart::StdRepart(const std::string& name) :
   ParMetisBalancerCom(name),
   socket_nodes("nodes"),
   socket_states("states"),
+  socket_cellCost("cellCost", false),
   m_cells(NULL),
   m_nodes(NULL),
   m_states(NULL)
@@ -268,27 +269,19 @@ void StdRepart::callParMetisAdaptiveRepart()
     part[i] = 0;
   }
   
-  ///HACK:: introduce waights for testing -- to be removed later!! 
+  // weights on vertices, computed from the cost of the cells
   wgtflag=2;  // 0 for no weights(vwgt and adjwgt=NULL), 2 weight on vertices only(adjwgt=NULL)
-    ncon   =1;  // no of weights for each vertex
+  ncon   =1;  // no of weights for each vertex
     
-    tpwgts = new PartitionerData::RealT[ncon*nparts];
-    for(int i=0; i<(ncon*nparts); ++i) tpwgts[i] = 1./nparts;
+  tpwgts = new PartitionerData::RealT[ncon*nparts];
+  for(int i=0; i<(ncon*nparts); ++i) tpwgts[i] = 1./nparts;
     
-    ubvec = new PartitionerData::RealT[ncon];
-    for(int i=0; i<ncon; ++i) ubvec[i] = 1.05;
+  ubvec = new PartitionerData::RealT[ncon];
+  for(int i=0; i<ncon; ++i) ubvec[i] = 1.05;
     
-    vwgt = new PartitionerData::IndexT[myNodes];
-    for(CFuint i=0; i<(myNodes); ++i) vwgt[i]=1;
-
-      if(PE::GetPE().GetRank(nsp)==0)
-        for(CFuint i=0; i<(myNodes); ++i) vwgt[i]=3;
-      if(PE::GetPE().GetRank(nsp)==1)
-        for(CFuint i=0; i<(myNodes); ++i) vwgt[i]=10;
-      if(PE::GetPE().GetRank(nsp)==2)
-        for(CFuint i=0; i<(myNodes); ++i) vwgt[i]=5;
-  /// /////////////////////////////////////////////////////////////
-
+  vwgt = new PartitionerData::IndexT[myNodes];
+  setVertexWeights(vwgt);
+  
   CFLogDebugMin( "Calling ParMetis::AdaptiveRepart()\n");
   Common::Stopwatch<Common::WallTime> MetisTimer;
 
@@ -312,6 +305,42 @@ void StdRepart::callParMetisAdaptiveRepart()
   CFLog(NOTICE, "ParMetis::AdaptiveRepart() took " << MetisTimer << "\n");
 }
 
+//////////////////////////////////////////////////////////////////////////////
+void StdRepart::setVertexWeights(PartitionerData::IndexT* vwgt)
+{
+  const std::string nsp = getMethodData().getNamespace();
+  const CFuint rank = PE::GetPE().GetRank(nsp);
+  
+  // the cost of each cell (normalized by its average) is distributed among its nodes
+  vector<CFreal> nodeCost(m_nodes.size(), 1.);
+  const bool hasCost = socket_cellCost.isConnected() && (socket_cellCost.getDataHandle().size() > 0);
+  if (hasCost)
+  {
+    DataHandle<CFreal> cellCost = socket_cellCost.getDataHandle();
+    nodeCost.assign(m_nodes.size(), 0.);
+    for(CFuint icell=0; icell < m_cells->getLocalNbGeoEnts(); ++icell)
+    {
+      const CFuint nbNodesInCell = m_cells->getNbNodesInGeo(icell);
+      const CFreal cost = cellCost[m_cells->getStateID(icell,0)]/(CFreal)nbNodesInCell;
+      for(CFuint inode=0; inode < nbNodesInCell; ++inode)
+      {
+        nodeCost[m_cells->getNodeID(icell,inode)] += cost;
+      }
+    }
+  }
+  
+  // integer weights with two significant digits, in the same order as the owned nodes in part[]
+  const CFreal costScale = 100.;
+  CFuint i1=0;
+  for(CFuint i=0; i<m_nodes.size(); ++i) if( dataStorage.Part1()[i] == rank )
+  {
+    vwgt[i1] = (hasCost) ? std::max((PartitionerData::IndexT)1, (PartitionerData::IndexT)(costScale*nodeCost[i] + 0.5)) : 1;
+    i1+=1;
+  }
+  
+  CFLog(VERBOSE, "StdRepart::setVertexWeights() => " << ((hasCost) ? "weights from the cell cost\n" : "uniform weights\n"));
+}
+
 //////////////////////////////////////////////////////////////////////////////
 void StdRepart::UpdateInterfacePart2()
 {
@@ -789,6 +818,7 @@ StdRepart::needsSockets()
 
   result.push_back(&socket_nodes);
   result.push_back(&socket_states);
+  result.push_back(&socket_cellCost);
 
   return result;
 }
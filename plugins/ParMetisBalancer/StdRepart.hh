@@ -78,6 +78,12 @@ private: // helper functions
   */
   void callParMetisAdaptiveRepart();
 
+  /**
+  * Computes the weights of the owned nodes from the cost of the cells,
+  * if available in the "cellCost" socket, or sets uniform weights
+  */
+  void setVertexWeights(Framework::PartitionerData::IndexT* vwgt);
+
   /**
   * Processes comunicate their interface part flag
   */
@@ -164,6 +170,9 @@ private: // data
   /// the socket to the data handle of the states
   Framework::DataSocketSink < Framework::State* , Framework::GLOBAL > socket_states;
   
+  /// the socket to the cost of the cells (optional)
+  Framework::DataSocketSink<CFreal> socket_cellCost;
+  
   ///
   Common::SafePtr<Framework::TopologicalRegionSet> m_cells;
 
@@ -0,0 +1,288 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include <boost/filesystem/convenience.hpp>
+
+#include "Common/PE.hh"
+#include "Common/CFLog.hh"
+#include "Common/BadValueException.hh"
+#include "Common/FilesystemException.hh"
+
+#include "ParaViewWriter/AppendedDataWriter.hh"
+
+#ifdef CF_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace IO {
+
+    namespace ParaViewWriter {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// size of the uncompressed blocks (same as the VTK default)
+static const CFuint VTK_BLOCK_SIZE = 32768;
+
+/// type of the block size headers (header_type="UInt64")
+typedef unsigned long long VTKHeaderType;
+
+//////////////////////////////////////////////////////////////////////////////
+
+AppendedDataWriter::Compression AppendedDataWriter::getCompression(const std::string& name)
+{
+  if (name == "None") return NONE;
+  if (name == "ZLIB") {
+#ifdef CF_HAVE_ZLIB
+    return ZLIB;
+#else
+    throw BadValueException (FromHere(), "AppendedDataWriter: ZLIB compression requested but COOLFluiD was compiled without zlib");
+#endif
+  }
+  throw BadValueException (FromHere(), "AppendedDataWriter: unknown compression <" + name + ">, use None or ZLIB");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+AppendedDataWriter::AppendedDataWriter(Compression compression) :
+  m_compression(compression),
+  m_section(),
+  m_pointDataAttributes(),
+  m_arrays(),
+  m_data()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+AppendedDataWriter::~AppendedDataWriter()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void AppendedDataWriter::writeHeader(std::ostream& fout) const
+{
+  fout << "<?xml version=\"1.0\"?>\n";
+  fout << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\""
+       << (isLittleEndian() ? "LittleEndian" : "BigEndian")
+       << "\" header_type=\"UInt64\"";
+  if (m_compression == ZLIB) {
+    fout << " compressor=\"vtkZLibDataCompressor\"";
+  }
+  fout << ">\n";
+  fout << "  <UnstructuredGrid>\n";
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void AppendedDataWriter::openPiece(std::ostream& fout, const CFuint nbPoints,
+                                   const CFuint nbCells) const
+{
+  fout << "    <Piece NumberOfPoints=\"" << nbPoints << "\" NumberOfCells=\"" << nbCells << "\">\n";
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void AppendedDataWriter::openSection(std::ostream& fout, const std::string& section,
+                                     const std::string& attributes)
+{
+  cf_assert(m_section.empty());
+  m_section = section;
+  if (section == "PointData") {
+    m_pointDataAttributes = attributes;
+  }
+
+  fout << "      <" << section;
+  if (!attributes.empty()) {
+    fout << " " << attributes;
+  }
+  fout << ">\n";
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void AppendedDataWriter::closeSection(std::ostream& fout)
+{
+  cf_assert(!m_section.empty());
+  fout << "      </" << m_section << ">\n";
+  m_section.clear();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void AppendedDataWriter::writeFooter(std::ostream& fout)
+{
+  fout << "    </Piece>\n";
+  fout << "  </UnstructuredGrid>\n";
+  fout << "  <AppendedData encoding=\"raw\">\n";
+  fout << "   _";
+  if (m_data.size() > 0) {
+    fout.write(&m_data[0], m_data.size());
+  }
+  fout << "\n  </AppendedData>\n";
+  fout << "</VTKFile>\n";
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void AppendedDataWriter::appendBlock(const char* bytes, const CFuint nbBytes)
+{
+  if (m_compression == NONE) {
+    const VTKHeaderType header = nbBytes;
+    const char* h = reinterpret_cast<const char*>(&header);
+    m_data.insert(m_data.end(), h, h + sizeof(VTKHeaderType));
+    m_data.insert(m_data.end(), bytes, bytes + nbBytes);
+    return;
+  }
+
+#ifdef CF_HAVE_ZLIB
+  // header: [nb blocks, block size, last block size, compressed size of each block]
+  const CFuint nbBlocks = (nbBytes + VTK_BLOCK_SIZE - 1)/VTK_BLOCK_SIZE;
+  const CFuint lastBlockSize = (nbBlocks > 0) ? nbBytes - (nbBlocks-1)*VTK_BLOCK_SIZE : 0;
+  vector<VTKHeaderType> header(3 + nbBlocks);
+  header[0] = nbBlocks;
+  header[1] = VTK_BLOCK_SIZE;
+  header[2] = lastBlockSize;
+
+  const size_t headerStart = m_data.size();
+  m_data.resize(headerStart + header.size()*sizeof(VTKHeaderType));
+
+  vector<Bytef> compressed(compressBound(VTK_BLOCK_SIZE));
+  for (CFuint iBlock = 0; iBlock < nbBlocks; ++iBlock) {
+    const CFuint blockSize = (iBlock + 1 < nbBlocks) ? VTK_BLOCK_SIZE : lastBlockSize;
+    uLongf compressedSize = compressed.size();
+    // the fastest level is used since the goal is to reduce the output time
+    const int err = compress2(&compressed[0], &compressedSize,
+                              reinterpret_cast<const Bytef*>(bytes + iBlock*VTK_BLOCK_SIZE),
+                              blockSize, Z_BEST_SPEED);
+    if (err != Z_OK) {
+      throw BadValueException (FromHere(), "AppendedDataWriter: zlib compression failed");
+    }
+    header[3 + iBlock] = compressedSize;
+    const char* c = reinterpret_cast<const char*>(&compressed[0]);
+    m_data.insert(m_data.end(), c, c + compressedSize);
+  }
+
+  memcpy(&m_data[headerStart], &header[0], header.size()*sizeof(VTKHeaderType));
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void AppendedDataWriter::writeParallelIndex(const boost::filesystem::path& filepath,
+                                            const std::string& nsp) const
+{
+  using namespace boost::filesystem;
+
+  if (!PE::GetPE().IsParallel()) return;
+
+  const string piece = basename(filepath) + extension(filepath);
+  vector<string> pieces(1, piece);
+
+#ifdef CF_HAVE_MPI
+  // gather the names of all the pieces on the first process
+  MPI_Comm comm = PE::GetPE().GetCommunicator(nsp);
+  const CFuint rank = PE::GetPE().GetRank(nsp);
+  const CFuint nbProc = PE::GetPE().GetProcessorCount(nsp);
+
+  int localSize = piece.size();
+  vector<int> sizes(nbProc, 0);
+  MPI_Gather(&localSize, 1, MPI_INT, &sizes[0], 1, MPI_INT, 0, comm);
+
+  vector<int> displs(nbProc, 0);
+  for (CFuint i = 1; i < nbProc; ++i) {
+    displs[i] = displs[i-1] + sizes[i-1];
+  }
+  vector<char> names(displs[nbProc-1] + sizes[nbProc-1] + 1, '\0');
+  MPI_Gatherv(const_cast<char*>(piece.c_str()), localSize, MPI_CHAR,
+              &names[0], &sizes[0], &displs[0], MPI_CHAR, 0, comm);
+
+  if (rank != 0) return;
+
+  pieces.resize(nbProc);
+  for (CFuint i = 0; i < nbProc; ++i) {
+    pieces[i] = string(&names[displs[i]], sizes[i]);
+  }
+
+  // the index takes the name of the first piece without the rank tag
+  string stem = basename(filepath);
+  ostringstream tag;
+  tag << "-P" << PE::GetPE().GetRank("Default");
+  const size_t pos = stem.find(tag.str());
+  if (pos != string::npos) {
+    stem.erase(pos, tag.str().size());
+  }
+  const path indexpath = filepath.branch_path() / (stem + ".pvtu");
+#else
+  const path indexpath = change_extension(filepath, ".pvtu");
+#endif
+
+  ofstream fout(indexpath.string().c_str());
+  if (!fout) {
+    throw FilesystemException (FromHere(), "Could not open file: " + indexpath.string());
+  }
+
+  fout << "<?xml version=\"1.0\"?>\n";
+  fout << "<VTKFile type=\"PUnstructuredGrid\" version=\"1.0\" byte_order=\""
+       << (isLittleEndian() ? "LittleEndian" : "BigEndian")
+       << "\" header_type=\"UInt64\">\n";
+  fout << "  <PUnstructuredGrid GhostLevel=\"0\">\n";
+
+  const string sections[2] = {"PointData", "Points"};
+  for (CFuint iSec = 0; iSec < 2; ++iSec) {
+    fout << "    <P" << sections[iSec];
+    if (iSec == 0 && !m_pointDataAttributes.empty()) {
+      fout << " " << m_pointDataAttributes;
+    }
+    fout << ">\n";
+    for (CFuint i = 0; i < m_arrays.size(); ++i) {
+      const ArrayInfo& a = m_arrays[i];
+      if (a.section == sections[iSec]) {
+        fout << "      <PDataArray type=\"" << a.type << "\"";
+        if (!a.name.empty()) {
+          fout << " Name=\"" << a.name << "\"";
+        }
+        if (a.nbComponents > 1) {
+          fout << " NumberOfComponents=\"" << a.nbComponents << "\"";
+        }
+        fout << "/>\n";
+      }
+    }
+    fout << "    </P" << sections[iSec] << ">\n";
+  }
+
+  for (CFuint i = 0; i < pieces.size(); ++i) {
+    fout << "    <Piece Source=\"" << pieces[i] << "\"/>\n";
+  }
+
+  fout << "  </PUnstructuredGrid>\n";
+  fout << "</VTKFile>\n";
+
+  CFLog(INFO, "Writing parallel index to: " << indexpath.string() << "\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace ParaViewWriter
+
+  } // namespace IO
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,189 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_IO_ParaViewWriter_AppendedDataWriter_hh
+#define COOLFluiD_IO_ParaViewWriter_AppendedDataWriter_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem/path.hpp>
+
+#include "Common/COOLFluiD.hh"
+#include "Common/PtrAlloc.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace IO {
+
+    namespace ParaViewWriter {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class writes the XML skeleton of a VTK unstructured grid file whose
+ * data arrays are stored in binary form in the "appended raw" section at the
+ * end of the file, optionally compressed block by block with zlib.
+ * The arrays are encoded as soon as they are declared, so that the offsets
+ * in the XML header are known without a second pass.
+ * In parallel, every process writes its own piece and a .pvtu index
+ * referencing all the pieces is written by the first process.
+ *
+ * @author Andrea Lani
+ */
+class AppendedDataWriter {
+public:
+
+  /// Compression of the data blocks
+  enum Compression {NONE=0, ZLIB=1};
+
+  /**
+   * Gets the compression corresponding to the given name ("None" or "ZLIB")
+   * @throw Common::BadValueException if the name is unknown or zlib is not available
+   */
+  static Compression getCompression(const std::string& name);
+
+  /**
+   * Constructor
+   */
+  explicit AppendedDataWriter(Compression compression);
+
+  /**
+   * Destructor
+   */
+  ~AppendedDataWriter();
+
+  /**
+   * Writes the opening VTKFile and UnstructuredGrid elements
+   */
+  void writeHeader(std::ostream& fout) const;
+
+  /**
+   * Writes the opening Piece element
+   */
+  void openPiece(std::ostream& fout, const CFuint nbPoints, const CFuint nbCells) const;
+
+  /**
+   * Writes the opening element of a group of data arrays
+   * @param section     name of the element (PointData, Points, Cells)
+   * @param attributes  extra attributes of the element
+   */
+  void openSection(std::ostream& fout, const std::string& section,
+                   const std::string& attributes = std::string());
+
+  /**
+   * Writes the closing element of the current group of data arrays
+   */
+  void closeSection(std::ostream& fout);
+
+  /**
+   * Writes the DataArray element corresponding to the given values and
+   * appends them to the binary data
+   * @param name          name of the array (omitted if empty)
+   * @param nbComponents  number of components per tuple
+   * @param values        values to write
+   */
+  template <typename T>
+  void writeDataArray(std::ostream& fout, const std::string& name,
+                      const CFuint nbComponents, const std::vector<T>& values)
+  {
+    const std::string type = getTypeName(static_cast<const T*>(CFNULL));
+    fout << "        <DataArray type=\"" << type << "\"";
+    if (!name.empty()) {
+      fout << " Name=\"" << name << "\"";
+    }
+    if (nbComponents > 1) {
+      fout << " NumberOfComponents=\"" << nbComponents << "\"";
+    }
+    fout << " format=\"appended\" offset=\"" << m_data.size() << "\"/>\n";
+
+    m_arrays.push_back(ArrayInfo(m_section, name, type, nbComponents));
+    appendBlock(values.empty() ? CFNULL : reinterpret_cast<const char*>(&values[0]),
+                values.size()*sizeof(T));
+  }
+
+  /**
+   * Writes the closing Piece element, the appended data and the closing
+   * UnstructuredGrid and VTKFile elements
+   */
+  void writeFooter(std::ostream& fout);
+
+  /**
+   * Writes the .pvtu index referencing the pieces written by all the
+   * processes of the given namespace (collective call)
+   * @param filepath  path of the piece written by this process
+   */
+  void writeParallelIndex(const boost::filesystem::path& filepath,
+                          const std::string& nsp) const;
+
+private:
+
+  /// Description of a written data array
+  struct ArrayInfo {
+    ArrayInfo(const std::string& s, const std::string& n,
+              const std::string& t, const CFuint nc) :
+      section(s), name(n), type(t), nbComponents(nc) {}
+    std::string section;
+    std::string name;
+    std::string type;
+    CFuint nbComponents;
+  };
+
+  /// Encodes the given bytes (size header, possibly compressed) at the end of the data
+  void appendBlock(const char* bytes, const CFuint nbBytes);
+
+  /// Tells if the machine is little endian
+  static bool isLittleEndian()
+  {
+    short int word = 0x0001;
+    char *byte = (char *) &word;
+    return byte[0];
+  }
+
+  /// VTK type names
+  static std::string getTypeName(const float*)         {return "Float32";}
+  static std::string getTypeName(const double*)        {return "Float64";}
+  static std::string getTypeName(const int*)           {return "Int32";}
+  static std::string getTypeName(const unsigned int*)  {return "UInt32";}
+  static std::string getTypeName(const long*)          {return (sizeof(long) == 8) ? "Int64" : "Int32";}
+  static std::string getTypeName(const long long*)     {return "Int64";}
+  static std::string getTypeName(const unsigned char*) {return "UInt8";}
+
+private:
+
+  /// compression of the data blocks
+  Compression m_compression;
+
+  /// current group of data arrays
+  std::string m_section;
+
+  /// attributes of the PointData element
+  std::string m_pointDataAttributes;
+
+  /// written data arrays
+  std::vector<ArrayInfo> m_arrays;
+
+  /// encoded binary data
+  std::vector<char> m_data;
+
+}; // end of class AppendedDataWriter
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace ParaViewWriter
+
+  } // namespace IO
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_IO_ParaViewWriter_AppendedDataWriter_hh
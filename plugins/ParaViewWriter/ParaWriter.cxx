@@ -7,6 +7,7 @@
 #include "ParaWriter.hh"
 #include "Environment/ObjectProvider.hh"
 #include "ParaViewWriter/ParaViewWriter.hh"
+#include "Framework/Profiler.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -77,7 +78,7 @@ void ParaWriter::setMethodImpl()
 
   setupCommandsAndStrategies();
   cf_assert(m_setup.isNotNull());
-  m_setup->execute();
+  profileExecute(m_setup);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -85,7 +86,7 @@ void ParaWriter::setMethodImpl()
 void ParaWriter::unsetMethodImpl()
 {
   cf_assert(m_unSetup.isNotNull());
-  m_unSetup->execute();
+  profileExecute(m_unSetup);
   unsetupCommandsAndStrategies();
 
   OutputFormatter::unsetMethodImpl();
@@ -129,7 +130,7 @@ void ParaWriter::writeImpl()
   // set the nodal states at first
   m_data->getCollaborator<SpaceMethod>()->extrapolateStatesToNodes();
   // write the solution file
-  m_writeSolution->execute();
+  profileExecute(m_writeSolution);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -413,6 +413,65 @@ vector< vector< CFuint > > ParaWriterData::getOutputCellNodeConn(CFGeoShape::Typ
   return cellsNodesConn;
 }
 
+//////////////////////////////////////////////////////////////////////////////
+
+void ParaWriterData::getVectorAndScalarVarIdxs(const CFuint dim, const CFuint nbEqs,
+                                               vector<CFuint>& vectorComponentIdxs,
+                                               vector<CFuint>& scalarVarIdxs)
+{
+  vectorComponentIdxs.resize(0);
+  /// @note this is a rather ugly piece of code, a check is made on the number of equations
+  /// to avoid that vector components are searched when the physical model is a linear advection for instance
+  /// this piece of code puts the velocity components (or the momentum components) in a vector
+  /// the magnetic inductance vector B in the case of MHD is not put in a vector here like this!
+  if (nbEqs >= 3)
+  {
+    switch (dim)
+    {
+      case DIM_2D:
+      {
+        vectorComponentIdxs.resize(2);
+        vectorComponentIdxs[XX] = 1;
+        vectorComponentIdxs[YY] = 2;
+      } break;
+      case DIM_3D:
+      {
+        vectorComponentIdxs.resize(3);
+        vectorComponentIdxs[XX] = 1;
+        vectorComponentIdxs[YY] = 2;
+        vectorComponentIdxs[ZZ] = 3;
+      } break;
+      default:
+      {
+      }
+    }
+    cf_assert(dim == vectorComponentIdxs.size());
+  }
+
+  // indices of the scalar variables
+  const CFuint nbVecComponents = vectorComponentIdxs.size();
+  const CFuint nbScalars = nbEqs-nbVecComponents;
+  scalarVarIdxs.resize(nbScalars);
+  CFuint iScalar = 0;
+  for  (CFuint iEq = 0; iEq < nbEqs; ++iEq)
+  {
+    bool addIdx = true;
+    for (CFuint iVecComp = 0; iVecComp < nbVecComponents; ++iVecComp)
+    {
+      if (iEq == vectorComponentIdxs[iVecComp])
+      {
+        addIdx = false;
+      }
+    }
+    if (addIdx)
+    {
+      scalarVarIdxs[iScalar] = iEq;
+      ++iScalar;
+    }
+  }
+  cf_assert(iScalar == nbScalars);
+}
+
 //////////////////////////////////////////////////////////////////////////////
 
     } // namespace ParaViewWriter
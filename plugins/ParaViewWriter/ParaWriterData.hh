@@ -145,6 +145,14 @@ public:
    */
   static std::vector< std::vector< CFuint > > getOutputCellNodeConn(CFGeoShape::Type shape,CFuint solOrder);
 
+  /**
+   * returns the indices of the variables to write as vector components
+   * (velocity or momentum) and of the ones to write as scalars
+   */
+  static void getVectorAndScalarVarIdxs(const CFuint dim, const CFuint nbEqs,
+                                        std::vector<CFuint>& vectorComponentIdxs,
+                                        std::vector<CFuint>& scalarVarIdxs);
+
   /// Accessor to the switch to write velocity by components or coupled
   bool writeVectorAsComponents() const
   {
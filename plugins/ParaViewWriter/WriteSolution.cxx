@@ -22,6 +22,7 @@
 
 #include "ParaViewWriter/ParaViewWriter.hh"
 #include "ParaViewWriter/WriteSolution.hh"
+#include "ParaViewWriter/AppendedDataWriter.hh"
 
 #include "Common/OSystem.hh"
 //////////////////////////////////////////////////////////////////////////////
@@ -48,7 +49,8 @@ writeSolutionProvider("WriteSolution");
 
 void WriteSolution::defineConfigOptions(Config::OptionList& options)
 {
-   options.addConfigOption< std::string>("FileFormat","Format to write ParaView file.");
+   options.addConfigOption< std::string>("FileFormat","Format to write ParaView file (ASCII or BINARY).");
+   options.addConfigOption< std::string>("Compression","Compression of the BINARY data blocks (None or ZLIB).");
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -61,6 +63,9 @@ WriteSolution::WriteSolution(const std::string& name) : ParaWriterCom(name),
 
   m_fileFormatStr = "ASCII";
   setParameter("FileFormat",&m_fileFormatStr);
+
+  m_compressionStr = "None";
+  setParameter("Compression",&m_compressionStr);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -93,9 +98,225 @@ const std::string WriteSolution::getWriterName() const
 
 void WriteSolution::writeToBinaryFile()
 {
- CFAUTOTRACE;
+  CFAUTOTRACE;
+
+  if (!getMethodData().onlySurface())
+  {
+
+  // get the nodes datahandle
+  DataHandle < Framework::Node*, Framework::GLOBAL > nodes = socket_nodes.getDataHandle();
+
+  // get iterator for nodal states datahandle
+  DataHandle<ProxyDofIterator<RealVector>*> nstatesProxy = socket_nstatesProxy.getDataHandle();
+  ProxyDofIterator<RealVector>& nodalStates = *nstatesProxy[0];
+
+  // get the cells and the cell-node connectivity
+  SafePtr<TopologicalRegionSet> elements = MeshDataStack::getActive()->getTrs("InnerCells");
+  SafePtr<MeshData::ConnTable> cellNodes = MeshDataStack::getActive()->getConnectivity("cellNodes_InnerCells");
+
+  // number of cells and nodes
+  const CFuint nbrCells = elements->getLocalNbGeoEnts();
+  const CFuint nbrNodes = nodes.size();
+  cf_assert(cellNodes->nbRows() == nbrCells);
+
+  // get the element type data
+  SafePtr<vector<ElementTypeData> > elemType =  MeshDataStack::getActive()->getElementTypeData();
+
+  // get dimensionality, number of variables and reference length
+  const CFuint dim = PhysicalModelStack::getActive()->getDim();
+  const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
+  const CFreal refL = PhysicalModelStack::getActive()->getImplementor()->getRefLength();
+
+  // indices of the variables that are vector components and of the scalar variables
+  vector<CFuint> vectorComponentIdxs;
+  vector<CFuint> scalarVarIdxs;
+  ParaWriterData::getVectorAndScalarVarIdxs(dim, nbEqs, vectorComponentIdxs, scalarVarIdxs);
+  const CFuint nbVecComponents = vectorComponentIdxs.size();
+  const CFuint nbScalars = scalarVarIdxs.size();
+
+  // get ConvectiveVarSet and variable names
+  SafePtr<ConvectiveVarSet> updateVarSet = getMethodData().getUpdateVarSet();
+  const vector<std::string>& varNames = updateVarSet->getVarNames();
+  cf_assert(varNames.size() == nbEqs);
+
+  const bool printExtraValues = getMethodData().printExtraValues();
+  const vector<std::string>& extraVarNames = updateVarSet->getExtraVarNames();
+  const CFuint nbrExtraVars = (printExtraValues) ? extraVarNames.size() : 0;
+
+  // dimensionalize the nodal states (and compute the extra values) once for all
+  vector<CFreal> dimStates(nbrNodes*nbEqs);
+  vector<CFreal> extraStates(nbrNodes*nbrExtraVars);
+  RealVector dimState(nbEqs);
+  RealVector extraValues; // size will be set in the VarSet
+  State tempState;
+  for (CFuint iNode = 0; iNode < nbrNodes; ++iNode)
+  {
+    const RealVector& nodalState = *nodalStates.getState(iNode);
+    for (CFuint iEq = 0; iEq < nbEqs; ++iEq)
+    {
+      tempState[iEq] = nodalState[iEq];
+    }
+    tempState.setLocalID(nodalStates.getStateLocalID(iNode));
+    tempState.setSpaceCoordinates(nodes[iNode]);
+
+    if (printExtraValues)
+    {
+      updateVarSet->setDimensionalValuesPlusExtraValues(tempState, dimState, extraValues);
+      for (CFuint iVar = 0; iVar < nbrExtraVars; ++iVar)
+      {
+        extraStates[iNode*nbrExtraVars + iVar] = extraValues[iVar];
+      }
+    }
+    else
+    {
+      updateVarSet->setDimensionalValues(tempState, dimState);
+    }
+
+    for (CFuint iEq = 0; iEq < nbEqs; ++iEq)
+    {
+      dimStates[iNode*nbEqs + iEq] = dimState[iEq];
+    }
+  }
+
+  AppendedDataWriter writer(AppendedDataWriter::getCompression(m_compressionStr));
+
+  const boost::filesystem::path filepath = getMethodData().getFilename();
+  SelfRegistPtr<Environment::FileHandlerOutput> fhandle =
+    Environment::SingleBehaviorFactory<Environment::FileHandlerOutput>::getInstance().create();
+  ofstream& fout = fhandle->open(filepath, ios_base::out | ios_base::binary);
+
+  writer.writeHeader(fout);
+  writer.openPiece(fout, nbrNodes, nbrCells);
+  writer.openSection(fout, "PointData", "Scalars=\"" + varNames[0] + "\"");
+
+  vector<CFreal> values;
+
+  // write the (velocity or momentum) vectors
+  if ((nbVecComponents > 0) && (!getMethodData().writeVectorAsComponents()))
+  {
+    values.assign(nbrNodes*3, 0.);
+    for (CFuint iNode = 0; iNode < nbrNodes; ++iNode)
+    {
+      for (CFuint iVecComp = 0; iVecComp < nbVecComponents; ++iVecComp)
+      {
+        values[iNode*3 + iVecComp] = dimStates[iNode*nbEqs + vectorComponentIdxs[iVecComp]];
+      }
+    }
+    writer.writeDataArray(fout, varNames[vectorComponentIdxs[1]], 3, values);
+  }
+  else
+  {
+    values.resize(nbrNodes);
+    for (CFuint iVecComp = 0; iVecComp < nbVecComponents; ++iVecComp)
+    {
+      for (CFuint iNode = 0; iNode < nbrNodes; ++iNode)
+      {
+        values[iNode] = dimStates[iNode*nbEqs + vectorComponentIdxs[iVecComp]];
+      }
+      writer.writeDataArray(fout, varNames[vectorComponentIdxs[iVecComp]], 1, values);
+    }
+  }
+
+  // write the scalars
+  values.resize(nbrNodes);
+  for (CFuint iScalar = 0; iScalar < nbScalars; ++iScalar)
+  {
+    const CFuint iVar = scalarVarIdxs[iScalar];
+    for (CFuint iNode = 0; iNode < nbrNodes; ++iNode)
+    {
+      values[iNode] = dimStates[iNode*nbEqs + iVar];
+    }
+    writer.writeDataArray(fout, varNames[iVar], 1, values);
+  }
+
+  // write the extra variables
+  for (CFuint iVar = 0 ;  iVar < nbrExtraVars; ++iVar)
+  {
+    for (CFuint iNode = 0; iNode < nbrNodes; ++iNode)
+    {
+      values[iNode] = extraStates[iNode*nbrExtraVars + iVar];
+    }
+    writer.writeDataArray(fout, extraVarNames[iVar], 1, values);
+  }
+
+  // write datahandles with state based data
+  {
+    SafePtr<DataHandleOutput> datahandle_output = getMethodData().getDataHOutput();
+    datahandle_output->getDataHandles();
+    std::vector< std::string > dh_varnames = datahandle_output->getVarNames();
+    for (CFuint iVar = 0; iVar < dh_varnames.size(); ++iVar)
+    {
+      DataHandleOutput::DataHandleInfo var_info = datahandle_output->getStateData(iVar);
+      CFuint var_var = var_info.first;
+      CFuint var_nbvars = var_info.second;
+      DataHandle<CFreal> var = var_info.third;
+
+      for (CFuint iNode = 0; iNode < nbrNodes; ++iNode)
+      {
+        values[iNode] = var(nodalStates.getStateLocalID(iNode), var_var, var_nbvars);
+      }
+      writer.writeDataArray(fout, dh_varnames[iVar], 1, values);
+    }
+  }
+
+  writer.closeSection(fout);
+
+  // write the node coordinates
+  writer.openSection(fout, "Points");
+  values.assign(nbrNodes*3, 0.);
+  for (CFuint iNode = 0; iNode < nbrNodes; ++iNode)
+  {
+    for (CFuint iCoor = 0; iCoor < dim; ++iCoor)
+    {
+      values[iNode*3 + iCoor] = (*nodes[iNode])[iCoor]*refL;
+    }
+  }
+  writer.writeDataArray(fout, "", 3, values);
+  writer.closeSection(fout);
+
+  // write the cell-node connectivity, the offsets and the cell types
+  writer.openSection(fout, "Cells");
+
+  vector<CFint> connectivity;
+  connectivity.reserve(cellNodes->size());
+  vector<CFint> offsets(nbrCells);
+  for (CFuint iCell = 0; iCell < nbrCells; ++iCell)
+  {
+    const CFuint nbrCellNodes = cellNodes->nbCols(iCell);
+    for (CFuint iNode = 0; iNode < nbrCellNodes; ++iNode)
+    {
+      connectivity.push_back((*cellNodes)(iCell,iNode));
+    }
+    offsets[iCell] = connectivity.size();
+  }
+  writer.writeDataArray(fout, "connectivity", 1, connectivity);
+  writer.writeDataArray(fout, "offsets", 1, offsets);
+
+  /// @warning (element indexes (elemIdx) should increase monotonically here in order for this to be correct!!!)
+  vector<unsigned char> types;
+  types.reserve(nbrCells);
+  const CFuint nbrElemTypes = elemType->size();
+  for (CFuint iElemType = 0; iElemType < nbrElemTypes; ++iElemType)
+  {
+    const CFuint vtkCellType = getMethodData().getVTKCellTypeID
+      ((*elemType)[iElemType].getGeoShape(),(*elemType)[iElemType].getGeoOrder());
+    types.insert(types.end(), (*elemType)[iElemType].getNbElems(), vtkCellType);
+  }
+  cf_assert(types.size() == nbrCells);
+  writer.writeDataArray(fout, "types", 1, types);
+
+  writer.closeSection(fout);
+  writer.writeFooter(fout);
 
-  throw Common::NotImplementedException (FromHere(),"Writing to binary files is not yet implemented in ParaViewWriter...");
+  fhandle->close();
+
+  // parallel index referencing the pieces of all the processes
+  writer.writeParallelIndex(filepath, getMethodData().getNamespace());
+
+  } // if only surface
+
+  // write boundary surface data
+  writeBoundarySurface();
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -141,58 +362,12 @@ void WriteSolution::writeToFileStream(std::ofstream& fout)
   const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
   const CFreal refL = PhysicalModelStack::getActive()->getImplementor()->getRefLength();
 
-  // variable that holds the indices of the variables that are vector components
-  vector<CFuint> vectorComponentIdxs(0);
-  /// @note this is a rather ugly piece of code, a check is made on the number of equations
-  /// to avoid that vector components are searched when the physical model is a linear advection for instance
-  /// this piece of code puts the velocity components (or the momentum components) in a vector
-  /// the magnetic inductance vector B in the case of MHD is not put in a vector here like this!
-  if (nbEqs >= 3)
-  {
-    switch (dim)
-    {
-      case DIM_2D:
-      {
-        vectorComponentIdxs.resize(2);
-        vectorComponentIdxs[XX] = 1;
-        vectorComponentIdxs[YY] = 2;
-      } break;
-      case DIM_3D:
-      {
-        vectorComponentIdxs.resize(3);
-        vectorComponentIdxs[XX] = 1;
-        vectorComponentIdxs[YY] = 2;
-        vectorComponentIdxs[ZZ] = 3;
-      } break;
-      default:
-      {
-      }
-    }
-    cf_assert(dim == vectorComponentIdxs.size());
-  }
-
-  // variable tht holds the indices of the scalar variables
+  // indices of the variables that are vector components and of the scalar variables
+  vector<CFuint> vectorComponentIdxs;
+  vector<CFuint> scalarVarIdxs;
+  ParaWriterData::getVectorAndScalarVarIdxs(dim, nbEqs, vectorComponentIdxs, scalarVarIdxs);
   const CFuint nbVecComponents = vectorComponentIdxs.size();
-  const CFuint nbScalars = nbEqs-nbVecComponents;
-  vector<CFuint> scalarVarIdxs(nbScalars);
-  CFuint iScalar = 0;
-  for  (CFuint iEq = 0; iEq < nbEqs; ++iEq)
-  {
-    bool addIdx = true;
-    for (CFuint iVecComp = 0; iVecComp < nbVecComponents; ++iVecComp)
-    {
-      if (iEq == vectorComponentIdxs[iVecComp])
-      {
-        addIdx = false;
-      }
-    }
-    if (addIdx)
-    {
-      scalarVarIdxs[iScalar] = iEq;
-      ++iScalar;
-    }
-  }
-  cf_assert(iScalar == nbScalars);
+  const CFuint nbScalars = scalarVarIdxs.size();
 
   // get ConvectiveVarSet
   SafePtr<ConvectiveVarSet> updateVarSet = getMethodData().getUpdateVarSet();
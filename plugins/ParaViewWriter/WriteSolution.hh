@@ -82,7 +82,9 @@ public:
 protected:
 
   /**
-   * Write the ParaView file in Binmary format
+   * Write the ParaView file in binary format: the data arrays are written
+   * raw (or zlib compressed) in the appended data section and, in parallel,
+   * a .pvtu index referencing the pieces of all the processes is added
    * @throw Common::FilesystemException
    */
   void writeToBinaryFile();
@@ -128,6 +130,9 @@ private:
   /// File format to write in (ASCII or Binary)
   std::string m_fileFormatStr;
 
+  /// Compression of the binary data blocks (None or ZLIB)
+  std::string m_compressionStr;
+
 }; // class WriteSolution
 
 //////////////////////////////////////////////////////////////////////////////
@@ -21,6 +21,7 @@
 
 #include "ParaViewWriter/ParaViewWriter.hh"
 #include "ParaViewWriter/WriteSolutionHighOrder.hh"
+#include "ParaViewWriter/AppendedDataWriter.hh"
 
 #include "Common/CFMap.hh"
 #include "Environment/FileHandlerOutput.hh"
@@ -48,7 +49,8 @@ writeSolutionHighOrderProvider("WriteSolutionHighOrder");
 
 void WriteSolutionHighOrder::defineConfigOptions(Config::OptionList& options)
 {
-   options.addConfigOption< std::string>("FileFormat","Format to write ParaView file.");
+   options.addConfigOption< std::string>("FileFormat","Format to write ParaView file (ASCII or BINARY).");
+   options.addConfigOption< std::string>("Compression","Compression of the BINARY data blocks (None or ZLIB).");
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -59,6 +61,9 @@ WriteSolutionHighOrder::WriteSolutionHighOrder(const std::string& name) : ParaWr
 
   m_fileFormatStr = "ASCII";
   setParameter("FileFormat",&m_fileFormatStr);
+
+  m_compressionStr = "None";
+  setParameter("Compression",&m_compressionStr);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -90,15 +95,6 @@ const std::string WriteSolutionHighOrder::getWriterName() const
 //////////////////////////////////////////////////////////////////////////////
 
 void WriteSolutionHighOrder::writeToBinaryFile()
-{
- CFAUTOTRACE;
-
-  throw Common::NotImplementedException (FromHere(),"Writing to binary files is not yet implemented in ParaViewWriter...");
-}
-
-//////////////////////////////////////////////////////////////////////////////
-
-void WriteSolutionHighOrder::writeToFileStream(std::ofstream& fout)
 {
   CFAUTOTRACE;
 
@@ -110,58 +106,252 @@ void WriteSolutionHighOrder::writeToFileStream(std::ofstream& fout)
   const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
   const CFreal refL = PhysicalModelStack::getActive()->getImplementor()->getRefLength();
 
-  // variable that holds the indices of the variables that are vector components
-  vector<CFuint> vectorComponentIdxs(0);
-  /// @note this is a rather ugly piece of code, a check is made on the number of equations
-  /// to avoid that vector components are searched when the physical model is a linear advection for instance
-  /// this piece of code puts the velocity components (or the momentum components) in a vector
-  /// the magnetic inductance vector B in the case of MHD is not put in a vector here like this!
-  if (nbEqs >= 3)
+  // indices of the variables that are vector components and of the scalar variables
+  vector<CFuint> vectorComponentIdxs;
+  vector<CFuint> scalarVarIdxs;
+  ParaWriterData::getVectorAndScalarVarIdxs(dim, nbEqs, vectorComponentIdxs, scalarVarIdxs);
+  const CFuint nbVecComponents = vectorComponentIdxs.size();
+  const CFuint nbScalars = scalarVarIdxs.size();
+
+  // get ConvectiveVarSet and variable names
+  SafePtr<ConvectiveVarSet> updateVarSet = getMethodData().getUpdateVarSet();
+  const vector<std::string>& varNames = updateVarSet->getVarNames();
+  cf_assert(varNames.size() == nbEqs);
+
+  const bool printExtraValues = getMethodData().printExtraValues();
+  const vector<std::string>& extraVarNames = updateVarSet->getExtraVarNames();
+  const CFuint nbrExtraVars = (printExtraValues) ? extraVarNames.size() : 0;
+
+  // get the ElementTypeData
+  SafePtr< vector<ElementTypeData> > elemType = MeshDataStack::getActive()->getElementTypeData();
+  const CFuint nbrElemTypes = elemType->size();
+
+  // get inner cells TRS
+  SafePtr<TopologicalRegionSet> trs = MeshDataStack::getActive()->getTrs("InnerCells");
+
+  // prepares to loop over cells by getting the GeometricEntityPool
+  SafePtr< GeometricEntityPool<StdTrsGeoBuilder> > geoBuilder = getMethodData().getStdTrsGeoBuilder();
+  StdTrsGeoBuilder::GeoData& geoData = geoBuilder->getDataGE();
+  geoData.trs = trs;
+
+  // the output points of all the cells are collected in a single piece
+  vector<CFreal> coords;
+  vector<CFreal> dimStates;
+  vector<CFreal> extraStates;
+  vector<CFint> connectivity;
+  vector<CFint> offsets;
+  vector<unsigned char> types;
+
+  // some helper states
+  RealVector dimState(nbEqs);
+  RealVector extraValues; // size will be set in the VarSet
+  State tempState;
+
+  for (CFuint iElemType = 0; iElemType < nbrElemTypes; ++iElemType)
   {
-    switch (dim)
+    const CFGeoShape::Type shape = (*elemType)[iElemType].getGeoShape();
+    const CFuint solOrder = (*elemType)[iElemType].getSolOrder();
+
+    // mapped coordinates of output points and cell-node connectivity
+    const vector< RealVector >       outputPntsMappedCoords = getMethodData().getOutputPntsMappedCoords(shape,solOrder);
+    const vector< vector< CFuint > > outputCellNodeConn     = getMethodData().getOutputCellNodeConn    (shape,solOrder);
+    const CFuint nbrOutPnts = outputPntsMappedCoords.size();
+    const CFuint nbrSubCells = outputCellNodeConn.size();
+
+    const CFuint vtkCellType = getMethodData().getVTKCellTypeID(shape,CFPolyOrder::ORDER1);
+    const CFuint nbrStates = (*elemType)[iElemType].getNbStates();
+    const CFuint nbrNodes = (*elemType)[iElemType].getNbNodes();
+    const CFuint nbrElems = (*elemType)[iElemType].getNbElems();
+    CFuint cellIdx = (*elemType)[iElemType].getStartIdx();
+
+    // evaluate the basis functions in the output points
+    geoData.idx = cellIdx;
+    GeometricEntity *const cell = geoBuilder->buildGE();
+    vector< RealVector > solShapeFuncs;
+    vector< RealVector > geoShapeFuncs;
+    for (CFuint iPnt = 0; iPnt < nbrOutPnts; ++iPnt)
     {
-      case DIM_2D:
-      {
-        vectorComponentIdxs.resize(2);
-        vectorComponentIdxs[XX] = 1;
-        vectorComponentIdxs[YY] = 2;
-      } break;
-      case DIM_3D:
+      solShapeFuncs.push_back(cell->computeShapeFunctionAtMappedCoord   (outputPntsMappedCoords[iPnt]));
+      geoShapeFuncs.push_back(cell->computeGeoShapeFunctionAtMappedCoord(outputPntsMappedCoords[iPnt]));
+    }
+    geoBuilder->releaseGE();
+
+    const CFuint nbrNewPnts = nbrElems*nbrOutPnts;
+    coords.reserve(coords.size() + 3*nbrNewPnts);
+    dimStates.reserve(dimStates.size() + nbEqs*nbrNewPnts);
+    extraStates.reserve(extraStates.size() + nbrExtraVars*nbrNewPnts);
+
+    RealVector outputPntCoords(dim);
+    State outputPntState;
+    for (CFuint iElem = 0; iElem < nbrElems; ++iElem, ++cellIdx)
+    {
+      geoData.idx = cellIdx;
+      GeometricEntity *const cell = geoBuilder->buildGE();
+
+      vector<Node*>* cellNodes = cell->getNodes();
+      cf_assert(cellNodes->size() == nbrNodes);
+      vector<State*>* cellStates = cell->getStates();
+      cf_assert(cellStates->size() == nbrStates);
+
+      // subcells of this cell, numbered after the points already collected
+      const CFuint firstPnt = coords.size()/3;
+      for (CFuint iCell = 0; iCell < nbrSubCells; ++iCell)
       {
-        vectorComponentIdxs.resize(3);
-        vectorComponentIdxs[XX] = 1;
-        vectorComponentIdxs[YY] = 2;
-        vectorComponentIdxs[ZZ] = 3;
-      } break;
-      default:
+        for (CFuint iNode = 0; iNode < outputCellNodeConn[iCell].size(); ++iNode)
+        {
+          connectivity.push_back(firstPnt + outputCellNodeConn[iCell][iNode]);
+        }
+        offsets.push_back(connectivity.size());
+        types.push_back(vtkCellType);
+      }
+
+      // evaluate node coordinates and states at the output points
+      for (CFuint iPnt = 0; iPnt < nbrOutPnts; ++iPnt)
       {
+        outputPntCoords = 0.0;
+        for (CFuint iNode = 0; iNode < nbrNodes; ++iNode)
+        {
+          outputPntCoords += geoShapeFuncs[iPnt][iNode]*(*(*cellNodes)[iNode]);
+        }
+        for (CFuint iCoor = 0; iCoor < dim; ++iCoor)
+        {
+          coords.push_back(outputPntCoords[iCoor]*refL);
+        }
+        for (CFuint iCoor = dim; iCoor < 3; ++iCoor)
+        {
+          coords.push_back(0.);
+        }
+
+        outputPntState = 0.0;
+        for (CFuint iState = 0; iState < nbrStates; ++iState)
+        {
+          outputPntState += solShapeFuncs[iPnt][iState]*(*(*cellStates)[iState]);
+        }
+        for (CFuint iEq = 0; iEq < nbEqs; ++iEq)
+        {
+          tempState[iEq] = outputPntState[iEq];
+        }
+
+        // dimensionalize the state
+        if (printExtraValues)
+        {
+          updateVarSet->setDimensionalValuesPlusExtraValues(tempState, dimState, extraValues);
+          for (CFuint iVar = 0; iVar < nbrExtraVars; ++iVar)
+          {
+            extraStates.push_back(extraValues[iVar]);
+          }
+        }
+        else
+        {
+          updateVarSet->setDimensionalValues(tempState, dimState);
+        }
+        for (CFuint iEq = 0; iEq < nbEqs; ++iEq)
+        {
+          dimStates.push_back(dimState[iEq]);
+        }
       }
+
+      geoBuilder->releaseGE();
     }
-    cf_assert(dim == vectorComponentIdxs.size());
   }
 
-  // variable that holds the indices of the scalar variables
-  const CFuint nbVecComponents = vectorComponentIdxs.size();
-  const CFuint nbScalars = nbEqs-nbVecComponents;
-  vector<CFuint> scalarVarIdxs(nbScalars);
-  CFuint iScalar = 0;
-  for  (CFuint iEq = 0; iEq < nbEqs; ++iEq)
+  const CFuint nbrPnts = coords.size()/3;
+  const CFuint nbrCells = types.size();
+
+  AppendedDataWriter writer(AppendedDataWriter::getCompression(m_compressionStr));
+
+  const boost::filesystem::path filepath = getMethodData().getFilename();
+  SelfRegistPtr<Environment::FileHandlerOutput> fhandle =
+    Environment::SingleBehaviorFactory<Environment::FileHandlerOutput>::getInstance().create();
+  ofstream& fout = fhandle->open(filepath, ios_base::out | ios_base::binary);
+
+  writer.writeHeader(fout);
+  writer.openPiece(fout, nbrPnts, nbrCells);
+  writer.openSection(fout, "PointData", "Scalars=\"" + varNames[0] + "\"");
+
+  vector<CFreal> values;
+
+  // write the (velocity or momentum) vectors
+  if (nbVecComponents > 0)
   {
-    bool addIdx = true;
-    for (CFuint iVecComp = 0; iVecComp < nbVecComponents; ++iVecComp)
+    values.assign(nbrPnts*3, 0.);
+    for (CFuint iPnt = 0; iPnt < nbrPnts; ++iPnt)
     {
-      if (iEq == vectorComponentIdxs[iVecComp])
+      for (CFuint iVecComp = 0; iVecComp < nbVecComponents; ++iVecComp)
       {
-        addIdx = false;
+        values[iPnt*3 + iVecComp] = dimStates[iPnt*nbEqs + vectorComponentIdxs[iVecComp]];
       }
     }
-    if (addIdx)
+    writer.writeDataArray(fout, varNames[vectorComponentIdxs[1]], 3, values);
+  }
+
+  // write the scalars
+  values.resize(nbrPnts);
+  for (CFuint iScalar = 0; iScalar < nbScalars; ++iScalar)
+  {
+    const CFuint iVar = scalarVarIdxs[iScalar];
+    for (CFuint iPnt = 0; iPnt < nbrPnts; ++iPnt)
     {
-      scalarVarIdxs[iScalar] = iEq;
-      ++iScalar;
+      values[iPnt] = dimStates[iPnt*nbEqs + iVar];
     }
+    writer.writeDataArray(fout, varNames[iVar], 1, values);
   }
-  cf_assert(iScalar == nbScalars);
+
+  // write the extra variables
+  for (CFuint iVar = 0 ;  iVar < nbrExtraVars; ++iVar)
+  {
+    for (CFuint iPnt = 0; iPnt < nbrPnts; ++iPnt)
+    {
+      values[iPnt] = extraStates[iPnt*nbrExtraVars + iVar];
+    }
+    writer.writeDataArray(fout, extraVarNames[iVar], 1, values);
+  }
+
+  writer.closeSection(fout);
+
+  writer.openSection(fout, "Points");
+  writer.writeDataArray(fout, "", 3, coords);
+  writer.closeSection(fout);
+
+  writer.openSection(fout, "Cells");
+  writer.writeDataArray(fout, "connectivity", 1, connectivity);
+  writer.writeDataArray(fout, "offsets", 1, offsets);
+  writer.writeDataArray(fout, "types", 1, types);
+  writer.closeSection(fout);
+
+  writer.writeFooter(fout);
+
+  fhandle->close();
+
+  // parallel index referencing the pieces of all the processes
+  writer.writeParallelIndex(filepath, getMethodData().getNamespace());
+
+  } // if only surface
+
+  // write boundary surface data
+  writeBoundarySurface();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void WriteSolutionHighOrder::writeToFileStream(std::ofstream& fout)
+{
+  CFAUTOTRACE;
+
+  if (!getMethodData().onlySurface())
+  {
+
+  // get dimensionality, number of variables and reference length
+  const CFuint dim   = PhysicalModelStack::getActive()->getDim();
+  const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
+  const CFreal refL = PhysicalModelStack::getActive()->getImplementor()->getRefLength();
+
+  // indices of the variables that are vector components and of the scalar variables
+  vector<CFuint> vectorComponentIdxs;
+  vector<CFuint> scalarVarIdxs;
+  ParaWriterData::getVectorAndScalarVarIdxs(dim, nbEqs, vectorComponentIdxs, scalarVarIdxs);
+  const CFuint nbVecComponents = vectorComponentIdxs.size();
+  const CFuint nbScalars = scalarVarIdxs.size();
 
   // get ConvectiveVarSet
   SafePtr<ConvectiveVarSet> updateVarSet = getMethodData().getUpdateVarSet();
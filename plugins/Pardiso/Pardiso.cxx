@@ -7,6 +7,7 @@
 #include "Pardiso/Pardiso.hh"
 #include "Pardiso/PardisoModule.hh"
 #include "Framework/BlockAccumulator.hh"
+#include "Framework/Profiler.hh"
 #include "Environment/ObjectProvider.hh"
 
 using namespace COOLFluiD::Framework;
@@ -75,7 +76,7 @@ void Pardiso::solveSysImpl()
   CFAUTOTRACE;
   cf_assert(isSetup());
   cf_assert(isConfigured());
-  m_solveSys->execute();
+  profileExecute(m_solveSys);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -107,7 +108,7 @@ void Pardiso::setMethodImpl()
   LinearSystemSolver::setMethodImpl();
 
   m_setup->setup();
-  m_setup->execute();
+  profileExecute(m_setup);
 
   m_solveSys->setup();
   m_unSetup->setup();
@@ -119,7 +120,7 @@ void Pardiso::setMethodImpl()
 void Pardiso::unsetMethodImpl()
 {
   CFAUTOTRACE;
-  m_unSetup->execute();
+  profileExecute(m_unSetup);
   unsetupCommandsAndStrategies();
 
   LinearSystemSolver::unsetMethodImpl();
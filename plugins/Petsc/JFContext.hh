@@ -38,7 +38,8 @@ class JFContext {
 public: // functions
 
   /// Constructor
-  JFContext() : states(CFNULL), rhs(CFNULL), rhsVec(CFNULL) {}
+  JFContext() : states(CFNULL), rhs(CFNULL), rhsVec(CFNULL),
+		noAssemblyMatVec(false), autoEpsilon(false), normStates(0.) {}
   
   /// pointer to the Petsc method data 
   Common::SafePtr<PetscLSSData> petscData;
@@ -67,6 +68,18 @@ public: // functions
   /// Enable/Disable usage of different preconditioner matrix
 	bool differentPreconditionerMatrix;
   
+  /// flag telling to write the matrix vector product straight into the
+  /// local array of the result (no VecSetValue and no vector assembly)
+  /// and to skip the null directions
+  bool noAssemblyMatVec;
+  
+  /// flag telling to compute epsilon for each product from the norms of
+  /// the states and of the direction (Pernice and Walker)
+  bool autoEpsilon;
+  
+  /// global L2 norm of the backed up states, computed once per linear solve
+  CFreal normStates;
+  
   /// backup of the states array
   RealVector bkpStates;
   
@@ -51,6 +51,12 @@ BaseSetup(name)
 
   _jfApprox2ndOrder = false;
   setParameter("JFApprox2ndOrder", &_jfApprox2ndOrder);
+
+  _noAssemblyMatVec = false;
+  setParameter("NoAssemblyMatVec", &_noAssemblyMatVec);
+
+  _autoEpsilon = false;
+  setParameter("AutoEpsilon", &_autoEpsilon);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -66,6 +72,10 @@ void ParJFSetup::defineConfigOptions(Config::OptionList& options)
   options.addConfigOption< CFreal >("Epsilon","Epsilon for computing numerical derivative");
 
   options.addConfigOption< bool >("JFApprox2ndOrder", "2nd order of the Jacobian-free matrix vector product approximation (options: true/false)");
+
+  options.addConfigOption< bool >("NoAssemblyMatVec", "Write the Jacobian-free matrix vector product straight into the local array of the result, without VecSetValue calls and vector assemblies, and return zero for a null direction: the residual evaluations are the same as in the default product (default = false)");
+
+  options.addConfigOption< bool >("AutoEpsilon", "Compute epsilon for each product as sqrt((1+|U|)*eps_machine)/|delta_U|, ignoring Epsilon (default = false)");
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -127,6 +137,8 @@ void ParJFSetup::setMatrix(const CFuint localSize,
   ctx->spaceMethod = getMethodData().getCollaborator<SpaceMethod>();
   ctx->eps = _epsilon;
   ctx->jfApprox2ndOrder = _jfApprox2ndOrder;
+  ctx->noAssemblyMatVec = _noAssemblyMatVec || _autoEpsilon;
+  ctx->autoEpsilon = _autoEpsilon;
   ctx->differentPreconditionerMatrix = getMethodData().getDifferentPreconditionerMatrix();
 
   ctx->bkpStates.resize(nbStates*nbEqs);
@@ -73,6 +73,12 @@ private:
   /// Order of the Jacobian-free matrix vector product approximation (1 or 2)
   bool _jfApprox2ndOrder;
 
+  /// flag telling to compute the matrix vector product without vector assembly
+  bool _noAssemblyMatVec;
+
+  /// flag telling to compute epsilon automatically for each product
+  bool _autoEpsilon;
+
 }; // class Setup
 
 //////////////////////////////////////////////////////////////////////////////
@@ -6,6 +6,8 @@
 
 #include "Petsc/PetscHeaders.hh" // must come before any header
 
+#include <cmath>
+
 #include "Framework/MeshData.hh"
 #include "Common/CFLog.hh"
 #include "Framework/MethodCommandProvider.hh"
@@ -19,6 +21,9 @@
 #include "Petsc/DPLURPreconditioner.hh"
 #include "Petsc/TridiagPreconditioner.hh"
 #include "Common/PE.hh"
+#include "Common/MPI/MPIError.hh"
+#include "Common/MPI/MPIStructDef.hh"
+#include "MathTools/MathConsts.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -35,6 +40,7 @@ namespace COOLFluiD {
     namespace Petsc {
 
 extern PetscErrorCode computeJFMat(Mat petscMat, Vec x, Vec y);
+extern PetscErrorCode computeJFMatNoAssembly(Mat petscMat, Vec x, Vec y);
 extern PetscErrorCode LUSGSPcApply(void *ctx, Vec X, Vec Y);
 extern PetscErrorCode DPLURPcApply(void *ctx, Vec X, Vec Y);
 extern PetscErrorCode TridiagPcApply(void *ctx, Vec X, Vec Y);
@@ -76,14 +82,32 @@ void ParJFSolveSys::execute()
   DataHandle<CFreal> rhs = jfc->rhs->getDataHandle();
 
   // loop over states - doing backup of state and rhs vectors
+  CFreal sumSqStates = 0.;
   for(CFuint i = 0; i < nbStates; ++i)
   {
     const CFuint iTimesEq = i*nbEqs;
+    const bool isUpdatable = states[i]->isParUpdatable();
     for(CFuint j = 0; j < nbEqs; ++j)
     {
       const CFuint iTimesj = iTimesEq + j;
       jfc->bkpStates[iTimesj] = (*states[i])[j];
+      if (isUpdatable) {
+	sumSqStates += jfc->bkpStates[iTimesj]*jfc->bkpStates[iTimesj];
+      }
+    }
+  }
+
+  // the norm of the states is needed only to compute epsilon automatically
+  if (jfc->autoEpsilon) {
+    CFreal globalSumSqStates = sumSqStates;
+    if (PE::GetPE().IsParallel()) {
+      const std::string nsp = getMethodData().getNamespace();
+      MPIError::getInstance().check
+	("MPI_Allreduce", "ParJFSolveSys::execute()",
+	 MPI_Allreduce(&sumSqStates, &globalSumSqStates, 1, MPIStructDef::getMPIType(&sumSqStates), MPI_SUM,
+		       PE::GetPE().GetCommunicator(nsp)));
     }
+    jfc->normStates = std::sqrt(globalSumSqStates);
   }
 
   cf_assert(_upLocalIDs.size() == _upStatesGlobalIDs.size());
@@ -92,7 +116,12 @@ void ParJFSolveSys::execute()
   PetscMatrix& mat = getMethodData().getMatrix();
   PetscMatrix& precondMat = getMethodData().getPreconditionerMatrix();
 
-  mat.setJFFunction((void (*)(void))computeJFMat);
+  if (jfc->noAssemblyMatVec) {
+    mat.setJFFunction((void (*)(void))computeJFMatNoAssembly);
+  }
+  else {
+    mat.setJFFunction((void (*)(void))computeJFMat);
+  }
 
   PetscVector& rhsVec = getMethodData().getRhsVector();
   PetscVector& solVec = getMethodData().getSolVector();
@@ -170,6 +199,7 @@ void ParJFSolveSys::execute()
   CF_CHKERRCONTINUE(KSPSolve(ksp, rhsVec.getVec(), solVec.getVec()));
   CFint iter = 0;
   CF_CHKERRCONTINUE(KSPGetIterationNumber(ksp, &iter));
+  getMethodData().setNbIterations(iter);
 
   CFLog(INFO, "KSP convergence reached at iteration: " << iter << "\n");
 
@@ -345,6 +375,131 @@ PetscErrorCode computeJFMat(Mat petscMat, Vec x, Vec y)
 
 //////////////////////////////////////////////////////////////////////////////
 
+// Same product as computeJFMat, with the residuals evaluated in the shared
+// states and rhs, but written straight into the local array of y
+PetscErrorCode computeJFMatNoAssembly(Mat petscMat, Vec x, Vec y)
+{
+  void* ctx;
+
+  CF_CHKERRCONTINUE(MatShellGetContext(petscMat, &ctx));
+
+  JFContext* jfc = (JFContext*)(ctx);
+
+  // J*0 = 0: no need to evaluate any residual
+  PetscReal normDeltaU = 0.;
+  CF_CHKERRCONTINUE(VecNorm(x, NORM_2, &normDeltaU));
+  if (normDeltaU <= 0.) {
+    CF_CHKERRCONTINUE(VecSet(y, 0.));
+    PetscFunctionReturn(0);
+  }
+
+  DataHandle<State*, GLOBAL> states = jfc->states->getDataHandle();
+
+  const CFuint nbEqs = states[0]->size();
+  const CFuint nbStates = states.size();
+
+  DataHandle<CFreal> rhs = jfc->rhs->getDataHandle();
+  DataHandle<CFreal> updateCoeff = jfc->updateCoeff->getDataHandle();
+  SafePtr<PetscVector> rhsVec = jfc->rhsVec;
+  RealVector& bkpStates = jfc->bkpStates;
+  RealVector& bkpUpdateCoeff = jfc->bkpUpdateCoeff;
+
+  // Pernice and Walker: eps = sqrt((1+|U|)*eps_machine)/|delta_U|
+  const CFreal eps = (jfc->autoEpsilon) ?
+    std::sqrt((1. + jfc->normStates)*MathConsts::CFrealEps())/normDeltaU : jfc->eps;
+
+  CFreal* statesArray;
+  CF_CHKERRCONTINUE(VecGetArray(x, &statesArray));
+
+  // states = U + eps*delta_U, U = bkpStates, delta_U = statesArray
+  CFuint idx = 0;
+  for(CFuint i = 0; i < nbStates; ++i) {
+    if (states[i]->isParUpdatable()) {
+      const CFreal *const U = &bkpStates[i*nbEqs];
+      const CFreal *const deltaU = &statesArray[idx*nbEqs];
+      State& currState = *states[i];
+      for(CFuint j = 0; j < nbEqs; ++j) {
+	currState[j] = U[j] + eps*deltaU[j];
+      }
+      idx++;
+    }
+    bkpUpdateCoeff[i] = updateCoeff[i];
+  }
+
+  states.beginSync();
+  states.endSync();
+
+  jfc->spaceMethod->setComputeJacobianFlag(false);
+  updateCoeff = 0.0;
+  jfc->spaceMethod->computeSpaceResidual(1.0);
+  jfc->spaceMethod->computeTimeResidual(1.0);
+
+  // the local entries of y follow the same ordering as upLocalIDs,
+  // therefore they are written directly, without any vector assembly
+  const CFuint vecSize = jfc->upLocalIDs.size();
+  const CFint *const upLocalIDs = &jfc->upLocalIDs[0];
+  CFreal* yArray;
+  CF_CHKERRCONTINUE(VecGetArray(y, &yArray));
+
+  if (!jfc->jfApprox2ndOrder) {
+    CFreal* rhsArray;
+    CF_CHKERRCONTINUE(VecGetArray(rhsVec->getVec(), &rhsArray));
+    const CFreal invEps = 1.0/eps;
+    for(CFuint i = 0; i < vecSize; ++i) {
+      yArray[i] = (rhsArray[i] - rhs[upLocalIDs[i]])*invEps;
+    }
+    CF_CHKERRCONTINUE(VecRestoreArray(rhsVec->getVec(), &rhsArray));
+  }
+  else {
+    // RHS(U + eps*deltaU) is kept in y while RHS(U - eps*deltaU) is computed
+    for(CFuint i = 0; i < vecSize; ++i) {
+      yArray[i] = -rhs[upLocalIDs[i]];
+    }
+
+    idx = 0;
+    for(CFuint i = 0; i < nbStates; ++i) {
+      if (states[i]->isParUpdatable()) {
+	const CFreal *const U = &bkpStates[i*nbEqs];
+	const CFreal *const deltaU = &statesArray[idx*nbEqs];
+	State& currState = *states[i];
+	for(CFuint j = 0; j < nbEqs; ++j) {
+	  currState[j] = U[j] - eps*deltaU[j];
+	}
+	idx++;
+      }
+    }
+
+    states.beginSync();
+    states.endSync();
+
+    updateCoeff = 0.0;
+    jfc->spaceMethod->computeSpaceResidual(1.0);
+    jfc->spaceMethod->computeTimeResidual(1.0);
+
+    const CFreal inv2Eps = 0.5/eps;
+    for(CFuint i = 0; i < vecSize; ++i) {
+      yArray[i] = (yArray[i] + rhs[upLocalIDs[i]])*inv2Eps;
+    }
+  }
+
+  CF_CHKERRCONTINUE(VecRestoreArray(y, &yArray));
+  CF_CHKERRCONTINUE(VecRestoreArray(x, &statesArray));
+
+  // the states must be restored here for the preconditioner
+  for(CFuint i = 0; i < nbStates; ++i) {
+    const CFreal *const U = &bkpStates[i*nbEqs];
+    State& currState = *states[i];
+    for(CFuint j = 0; j < nbEqs; ++j) {
+      currState[j] = U[j];
+    }
+    updateCoeff[i] = bkpUpdateCoeff[i];
+  }
+
+  PetscFunctionReturn(0);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 vector<SafePtr<BaseDataSocketSink> > ParJFSolveSys::needsSockets()
 {
   vector<SafePtr<BaseDataSocketSink> > result = StdParSolveSys::needsSockets();
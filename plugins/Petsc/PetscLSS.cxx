@@ -10,6 +10,7 @@
 #include "Common/Stopwatch.hh"
 #include "Environment/ObjectProvider.hh"
 #include "Framework/BlockAccumulator.hh"
+#include "Framework/Profiler.hh"
 
 #include "Petsc/Petsc.hh"
 #include "Petsc/PetscLSS.hh"
@@ -126,7 +127,7 @@ void PetscLSS::solveSysImpl()
   stopTimer.start();
 
   CFLog(DEBUG_MAX, "Solving LSS: " << getName() << CFendl);
-  m_solveSys->execute();
+  profileExecute(m_solveSys);
 
   stopTimer.stop ();
 
@@ -179,7 +180,7 @@ void PetscLSS::setMethodImpl()
 //  setupCommandsAndStrategies();
 
   m_setup->setup();
-  m_setup->execute();
+  profileExecute(m_setup);
 
   m_solveSys->setup();
   m_unSetup->setup();
@@ -189,7 +190,7 @@ void PetscLSS::setMethodImpl()
 
 void PetscLSS::unsetMethodImpl()
 {
-  m_unSetup->execute();
+  profileExecute(m_unSetup);
   unsetupCommandsAndStrategies();
 
   LinearSystemSolver::unsetMethodImpl();
@@ -105,11 +105,16 @@ void StdParSolveSys::execute()
     }
   }
   
+  // the preconditioner is kept if the convergence method asks for it,
+  // e.g. while the jacobian is frozen
+  const bool reusePC = getMethodData().isReusePreconditioner();
 #if PETSC_VERSION_MINOR==6
-  CFuint ierr = KSPSetOperators(ksp, mat.getMat(), mat.getMat());
+  CFuint ierr = KSPSetReusePreconditioner(ksp, (reusePC) ? PETSC_TRUE : PETSC_FALSE);
+  CHKERRCONTINUE(ierr);
+  ierr = KSPSetOperators(ksp, mat.getMat(), mat.getMat());
 #else
   CFuint ierr = KSPSetOperators
-    (ksp, mat.getMat(), mat.getMat(),DIFFERENT_NONZERO_PATTERN);
+    (ksp, mat.getMat(), mat.getMat(), (reusePC) ? SAME_PRECONDITIONER : DIFFERENT_NONZERO_PATTERN);
 #endif
   
   //This is to allow viewing the matrix structure in X windows
@@ -129,6 +134,7 @@ void StdParSolveSys::execute()
   CFint iter = 0;
   ierr = KSPGetIterationNumber(ksp, &iter);
   CHKERRCONTINUE(ierr);
+  getMethodData().setNbIterations(iter);
   
   if (nbIter%getMethodData().getKSPConvergenceShowRate() == 0) {
     CFLog(INFO, "KSP convergence reached at iteration: " << iter << "\n");
@@ -5,6 +5,7 @@
 #include "Framework/SpaceMethod.hh"
 #include "Framework/SubSystemStatus.hh"
 #include "Framework/CFL.hh"
+#include "Framework/Profiler.hh"
 
 #include "RKRD/RKRD.hh"
 #include "RKRD/RungeKuttaRD.hh"
@@ -111,7 +112,7 @@ void RKRD::setMethodImpl()
   ConvergenceMethod::setMethodImpl();
 
   setupCommandsAndStrategies();
-  m_setup->execute();
+  profileExecute(m_setup);
 
   Common::SafePtr<SubSystemStatus> subsys_status = SubSystemStatusStack::getActive();
   CFuint * kstep = new CFuint();
@@ -126,7 +127,7 @@ void RKRD::unsetMethodImpl()
   CFuint * kstep = subsys_status->getVarRegistry()->unregistVar<CFuint>("kstep");
   deletePtr(kstep);
 
-  m_unSetup->execute();
+  profileExecute(m_unSetup);
   unsetupCommandsAndStrategies();
 
   ConvergenceMethod::unsetMethodImpl();
@@ -153,7 +154,7 @@ void RKRD::takeStepImpl()
   const CFuint order = m_data->getOrder() ;
 
   // copy the states U_n to all U_k
-  m_backup->execute();
+  profileExecute(m_backup);
 
   // loop over the R-K stages
   CFuint& k = m_data->K();
@@ -169,7 +170,7 @@ void RKRD::takeStepImpl()
     rd->computeTimeResidual(1.0);
 
     // intermidiate update and shift
-    m_shift->execute();
+    profileExecute(m_shift);
 
     // synchronize parallel data and compute residual
     ConvergenceMethod::syncGlobalDataComputeResidual(true);
@@ -179,7 +180,7 @@ void RKRD::takeStepImpl()
   }
 
   // final update of the states
-  m_update->execute();
+  profileExecute(m_update);
 
   // update time to time at end of iteration
   if (dt > 0.)
@@ -250,7 +250,7 @@ void ArcJetRadiator::getRandomEmission(CFreal &lambda, RealVector &s_o)
   //}
   //cout<<endl;
   
-  CFreal rand = m_rand.uniformRand();
+  CFreal rand = getRand().uniformRand();
   CFreal* it_start = &m_cpdEms[ stateIdx*nbCpdPoints ];
   CFreal* it_end = &m_cpdEms[ (stateIdx+1)*nbCpdPoints-1 ];
   CFreal* it_upp = std::upper_bound(it_start, it_end, rand);
@@ -262,7 +262,7 @@ void ArcJetRadiator::getRandomEmission(CFreal &lambda, RealVector &s_o)
 
   //cout<<x0<<' '<<x1<<' '<<y0<<' '<<y1<<' '<<rand<<' '<<lambda<<endl;
 
-  m_rand.sphereDirections(dim2, s_o);
+  getRand().sphereDirections(dim2, s_o);
 }
 
 void ArcJetRadiator::getData()
@@ -167,7 +167,7 @@ void GreyRadiator::getRandomEmission(CFreal &lambda, RealVector &s_o){
       CFreal maxComulativePlank =computeComulativePlankFraction(b,T);
 
       CFreal c = (m_minWav+m_maxWav)/2.;
-      CFreal target = m_rand.uniformRand();
+      CFreal target = getRand().uniformRand();
       CFreal m_tol=1e-10;
       CFreal f_c;
       do{
@@ -65,12 +65,12 @@ protected:
      }
      //normals.normalize();
 
-     m_rand.hemiDirections(dim, normals, s_o);
+     getRand().hemiDirections(dim, normals, s_o);
      //std::cout<< "outDir= ["<<s_o<<" ]; \n";
   }
 
   void getSphericalDirections(CFuint dim, RealVector &s_o){
-    m_rand.sphereDirections(dim, s_o);
+    getRand().sphereDirections(dim, s_o);
   }
 
   CFreal computeComulativePlankFraction(CFreal lambda, CFreal T);
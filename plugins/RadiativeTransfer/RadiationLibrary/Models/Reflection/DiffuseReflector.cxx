@@ -29,7 +29,7 @@ void DiffuseReflector::getRandomDirection(CFreal &lambda, RealVector &s_o, RealV
 {
   cf_assert(s_o.size() == s_i.size());
   //diffuse: just an emmission
-  m_rand.hemiDirections(s_i.size(), normal, s_o );
+  getRand().hemiDirections(s_i.size(), normal, s_o );
 }
 
 
@@ -114,24 +114,36 @@ void RadiationPhysicsHandler::setupWavStride(CFuint loop){
 
 
 Common::SharedPtr< RadiationPhysics > RadiationPhysicsHandler::getCellDistPtr(CFuint stateID){
+  getCellDist(stateID);
+  return m_radiationPhysics[ m_statesOwner[stateID][0] ];
+}
+
+Common::SharedPtr< RadiationPhysics > RadiationPhysicsHandler::getWallDistPtr(CFuint GhostStateID){
+  getWallDist(GhostStateID);
+  return m_radiationPhysics[ m_ghostStatesOwner[GhostStateID][0] ];
+}
+
+RadiationPhysics* RadiationPhysicsHandler::getCellDist(CFuint stateID){
   //CFLog(INFO,"Cell; stateID: "<<stateID<<"\n");
   cf_assert(stateID<m_statesOwner.size() );
   cf_assert(m_statesOwner[stateID][0] != -1 );
-  m_cellStateID = stateID;
-  m_cellStateOwnerIdx = m_statesOwner[stateID][1];
+  CurrentEntities& current = getCurrent();
+  current.cellStateID = stateID;
+  current.cellStateOwnerIdx = m_statesOwner[stateID][1];
 
-  return m_radiationPhysics[ m_statesOwner[stateID][0] ];
+  return m_radiationPhysics[ m_statesOwner[stateID][0] ].getPtr();
 }
 
-Common::SharedPtr< RadiationPhysics > RadiationPhysicsHandler::getWallDistPtr(CFuint GhostStateID){
+RadiationPhysics* RadiationPhysicsHandler::getWallDist(CFuint GhostStateID){
   //CFLog(INFO,"Wall; stateID: "<<GhostStateID<<"\n");
   cf_assert(GhostStateID<m_ghostStatesOwner.size() );
   cf_assert(m_ghostStatesOwner[GhostStateID][0] != -1 );
-  m_ghostStateID = GhostStateID;
-  m_ghostStateOwnerIdx  = m_ghostStatesOwner[GhostStateID][1];
-  m_ghostStateWallGeoID = m_ghostStatesOwner[GhostStateID][2];
+  CurrentEntities& current = getCurrent();
+  current.ghostStateID = GhostStateID;
+  current.ghostStateOwnerIdx  = m_ghostStatesOwner[GhostStateID][1];
+  current.ghostStateWallGeoID = m_ghostStatesOwner[GhostStateID][2];
 
-  return m_radiationPhysics[ m_ghostStatesOwner[GhostStateID][0] ];
+  return m_radiationPhysics[ m_ghostStatesOwner[GhostStateID][0] ].getPtr();
 }
 
 
@@ -10,6 +10,7 @@
 #include "RadiationPhysics.hh"
 #include "Framework/MethodCommand.hh"
 #include "Framework/PhysicalModel.hh"
+#include <boost/thread/tss.hpp>
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -41,6 +42,14 @@ public:
   Common::SharedPtr< RadiationPhysics > getCellDistPtr(CFuint stateID);
   Common::SharedPtr< RadiationPhysics > getWallDistPtr(CFuint GhostStateID);
 
+  /// same as getCellDistPtr() without touching the reference counter,
+  /// to be used by concurrent threads
+  RadiationPhysics* getCellDist(CFuint stateID);
+
+  /// same as getWallDistPtr() without touching the reference counter,
+  /// to be used by concurrent threads
+  RadiationPhysics* getWallDist(CFuint GhostStateID);
+
 
   CFuint getNumberLoops() const {return m_nbLoops;}
 
@@ -73,12 +82,12 @@ public:
   }
 
 
-  inline CFuint getCurrentCellStateID(){return m_cellStateID;}
-  inline CFuint getCurrentCellTrsIdx(){return m_cellStateOwnerIdx;}
+  inline CFuint getCurrentCellStateID(){return getCurrent().cellStateID;}
+  inline CFuint getCurrentCellTrsIdx(){return getCurrent().cellStateOwnerIdx;}
 
-  inline CFuint getCurrentWallGhostStateID(){return m_ghostStateID;}
-  inline CFuint getCurrentWallTrsIdx(){return m_ghostStateOwnerIdx;}
-  inline CFuint getCurrentWallGeoID(){return m_ghostStateWallGeoID;}
+  inline CFuint getCurrentWallGhostStateID(){return getCurrent().ghostStateID;}
+  inline CFuint getCurrentWallTrsIdx(){return getCurrent().ghostStateOwnerIdx;}
+  inline CFuint getCurrentWallGeoID(){return getCurrent().ghostStateWallGeoID;}
 
   inline CFuint getTempID(){return m_TempID;}
   inline CFuint getNbTemps(){return m_nbTemps;}
@@ -86,6 +95,25 @@ public:
 
   CFuint getNbGhostStates();
 private:
+
+  /// cell and wall entities last selected by one thread
+  struct CurrentEntities {
+    CFuint cellStateID;
+    CFuint cellStateOwnerIdx;
+    CFuint ghostStateID;
+    CFuint ghostStateOwnerIdx;
+    CFuint ghostStateWallGeoID;
+  };
+
+  /// get the entities last selected by the calling thread
+  CurrentEntities& getCurrent()
+  {
+    if (m_current.get() == CFNULL) {
+      m_current.reset(new CurrentEntities());
+    }
+    return *m_current;
+  }
+
   Framework::SocketBundle m_sockets;
   std::vector< std::string > m_radiationPhysicsNames;
   std::vector<Common::SharedPtr< RadiationPhysics > > m_radiationPhysics;
@@ -101,12 +129,8 @@ private:
   CFint m_TempID;
   CFuint m_nbTemps;
 
-  CFuint m_cellStateID;
-  CFuint m_cellStateOwnerIdx;
-
-  CFuint m_ghostStateID;
-  CFuint m_ghostStateOwnerIdx;
-  CFuint m_ghostStateWallGeoID;
+  /// current entities, one set per thread
+  boost::thread_specific_ptr<CurrentEntities> m_current;
 
   bool m_isAxi;
 
@@ -58,6 +58,14 @@ public:
   }
 
 protected:
+
+  /// random number generator bound to the calling thread, if any, otherwise the own one
+  RandomNumberGenerator& getRand()
+  {
+    RandomNumberGenerator* rand = RandomNumberGenerator::getThreadGenerator();
+    return (rand != CFNULL) ? *rand : m_rand;
+  }
+
   RadiationPhysics *m_radPhysicsPtr;
   RadiationPhysicsHandler *m_radPhysicsHandlerPtr;
   RandomNumberGenerator m_rand;
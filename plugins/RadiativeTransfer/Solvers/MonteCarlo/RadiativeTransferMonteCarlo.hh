@@ -5,7 +5,9 @@
 
 #include <numeric>
 #include <boost/random.hpp>
+#include <boost/bind.hpp>
 
+#include "Common/ChunkedThreads.hh"
 #include "Framework/DataProcessingData.hh"
 #include "Framework/FaceTrsGeoBuilder.hh"
 #include "Config/ConfigObject.hh"
@@ -95,6 +97,22 @@ public:
 
 private:
 
+  typedef LagrangianSolver::LagrangianSolver<PhotonData, PARTICLE_TRACKING> PhotonSolver;
+
+  /// data owned by each thread tracing photons
+  struct PhotonTracer {
+    /// particle tracking (the master solver for the first thread, a replica for the others)
+    PhotonSolver* solver;
+    /// generator positioned on the stream of the photon being traced
+    RandomNumberGenerator rand;
+    /// radiative power absorbed by each cell
+    std::vector<CFreal> stateInRadPowers;
+    /// radiative power absorbed by each wall ghost state
+    std::vector<CFreal> ghostStateInRadPowers;
+    /// photons leaving the partition and ranks of their destination processes
+    std::vector<Photon> leavingPhotons;
+    std::vector<CFuint> leavingRanks;
+  };
 
   //RealMatrix m_wavReduced,m_emReduced,m_amReduced;
 
@@ -106,7 +124,17 @@ private:
   /**
    * ray tracing
    */
-  CFuint rayTracing(Photon& photon);
+  CFuint rayTracing(Photon& photon, PhotonTracer& tracer);
+  
+  /**
+   * Trace all the photons of the current cycle, distributed among the threads
+   */
+  void tracePhotons();
+  
+  /**
+   * Trace the photons in [start, end) with the data of the given thread
+   */
+  void tracePhotonRange(const CFuint iThread, const CFuint start, const CFuint end);
   
 
 //  inline CFreal linearInterpol(CFreal x0,CFreal y0, CFreal x1, CFreal y1, CFreal x){
@@ -261,6 +289,30 @@ private:
   CFreal m_relaxationFactor;
 
   bool getFacePhotonData(Photon &ray);
+
+  /// number of threads tracing the photons
+  CFuint m_nbThreads;
+
+  /// seed of the random numbers (0 to take it from the clock)
+  CFuint m_seed;
+
+  /// number of executions of this command
+  CFuint m_nbExecutions;
+
+  /// seed of the photon streams in the current spectral loop
+  boost::uint64_t m_streamSeed;
+
+  /// counter of the photons (emitted or received) in the current spectral loop
+  boost::uint64_t m_photonCounter;
+
+  /// per-thread tracing data
+  std::vector<PhotonTracer> m_tracers;
+
+  /// photons to trace in the current cycle
+  std::vector<Photon> m_photons;
+
+  /// random stream of each photon to trace in the current cycle
+  std::vector<boost::uint64_t> m_photonStreams;
 }; // end of class RadiativeTransferMonteCarlo
 
  }
@@ -319,6 +371,8 @@ void RadiativeTransferMonteCarlo<PARTICLE_TRACKING>::defineConfigOptions(Config:
   options.addConfigOption< CFuint >("sendBufferSize","Size of the buffer for communication");
   options.addConfigOption< CFuint >("nbRaysCycle","Number of rays to emit before communication step");
   options.addConfigOption< CFreal >("relaxationFactor","Relaxation Factor");
+  options.addConfigOption< CFuint >("NbThreads","Number of threads tracing the photons.");
+  options.addConfigOption< CFuint >("Seed","Seed of the random numbers (0 to take it from the clock): results are reproducible for a given seed and number of threads.");
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -339,7 +393,13 @@ RadiativeTransferMonteCarlo<PARTICLE_TRACKING>::RadiativeTransferMonteCarlo(cons
   socket_rankPartitionFaces("rankPartitionFaces"),
   socket_isOutward("isOutward"),
   socket_faceCenters("faceCenters"),
-  m_radiation(new RadiationPhysicsHandler("RadiationPhysicsHandler"))
+  m_radiation(new RadiationPhysicsHandler("RadiationPhysicsHandler")),
+  m_nbExecutions(0),
+  m_streamSeed(0),
+  m_photonCounter(0),
+  m_tracers(),
+  m_photons(),
+  m_photonStreams()
 {
   addConfigOptionsTo(this);
 
@@ -363,12 +423,22 @@ RadiativeTransferMonteCarlo<PARTICLE_TRACKING>::RadiativeTransferMonteCarlo(cons
 
   m_relaxationFactor = 1.;
   setParameter("relaxationFactor", &m_relaxationFactor);
+
+  m_nbThreads = 1;
+  setParameter("NbThreads", &m_nbThreads);
+
+  m_seed = 0;
+  setParameter("Seed", &m_seed);
 }
 
 /////////////////////////////////////////////////////////////////////////////
 template<class PARTICLE_TRACKING>
 RadiativeTransferMonteCarlo<PARTICLE_TRACKING>::~RadiativeTransferMonteCarlo()
 {
+  // the first tracer uses the master solver
+  for (CFuint i = 1; i < m_tracers.size(); ++i) {
+    deletePtr(m_tracers[i].solver);
+  }
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -511,6 +581,25 @@ void RadiativeTransferMonteCarlo<PARTICLE_TRACKING>::setup()
 
   m_lagrangianSolver.setFaceTypes(wallTrsNames, boundaryTrsNames );
 
+  // per-thread tracing data: the replicas share the face types of the master solver
+  for (CFuint i = 1; i < m_tracers.size(); ++i) {
+    deletePtr(m_tracers[i].solver);
+  }
+  m_tracers.resize(std::max<CFuint>(m_nbThreads, 1));
+  for (CFuint i = 0; i < m_tracers.size(); ++i) {
+    PhotonTracer& tracer = m_tracers[i];
+    if (i == 0) {
+      tracer.solver = &m_lagrangianSolver;
+    }
+    else {
+      tracer.solver = new PhotonSolver(getName());
+      tracer.solver->setupReplica(m_lagrangianSolver, sockets);
+    }
+    tracer.stateInRadPowers.assign(nCells, 0.);
+    tracer.ghostStateInRadPowers.assign(socket_gstates.getDataHandle().size(), 0.);
+  }
+  CFLog(VERBOSE, "RadiativeTransferMonteCarlo::setup() => " << m_tracers.size() << " threads\n");
+
   // preallocation of memory for qradFluxWall
   CFuint nbFaces = 0;
   FaceTrsGeoBuilder::GeoData& WallFacesData = m_wallFaceBuilder.getDataGE();
@@ -824,9 +913,6 @@ void RadiativeTransferMonteCarlo<PARTICLE_TRACKING>::computePhotons()
   CFLog(DEBUG_MAX, "RadiativeTransferMonteCarlo::computeCellRays()\n");
 
 
-  m_rand.seed(time(NULL)*(m_myProcessRank+1));
-
-
   // CFuint totalnbPhotons =  (m_nbRaysElem )* m_radiation->getNbStates();
 
   CFuint toGenerateCellPhotons = 0;
@@ -868,33 +954,51 @@ void RadiativeTransferMonteCarlo<PARTICLE_TRACKING>::computePhotons()
     CFuint nbWallPhotons =
         std::min(std::max(CFint(m_nbRaysCycle) - CFint(recvSize) - CFint(nbCellPhotons),(CFint)0), CFint(toGenerateWallPhotons ));
 
-    for(CFuint i=0; i < nbCellPhotons ; ++i ){
-       
+    // emit the photons: each one has its own random stream, its emission and
+    // its tracing are therefore independent from the number of threads
+    m_photons.clear();
+    m_photonStreams.clear();
+    RandomNumberGenerator::setThreadGenerator(&m_rand);
+    for(CFuint i=0; i < nbCellPhotons ; ++i, ++m_photonCounter ){
+      m_rand.seed(m_streamSeed, 2*m_photonCounter);
       if(getCellPhotonData( photon )){
         //CFLog(INFO,"PHOTON: " << photon.cellID<<' '<<photon.userData.KS<<'\n' );
         //printPhoton(photon);
-        rayTracing(photon);
+        m_photons.push_back(photon);
+        m_photonStreams.push_back(2*m_photonCounter+1);
       }
       --toGenerateCellPhotons;
       if (m_myProcessRank == 0)  ++*(progressBar);
     }
 
-    for(CFuint i=0; i < nbWallPhotons ; ++i ){
+    for(CFuint i=0; i < nbWallPhotons ; ++i, ++m_photonCounter ){
+      m_rand.seed(m_streamSeed, 2*m_photonCounter);
       if(getFacePhotonData( photon )){
-        //CFLog(INFO, "****************************************/nNEW PHOTON! /n*******************************\n");
         //printPhoton(photon);
-        rayTracing(photon);
+        m_photons.push_back(photon);
+        m_photonStreams.push_back(2*m_photonCounter+1);
       }
       -- toGenerateWallPhotons;
       if (m_myProcessRank == 0)  ++*(progressBar);
     }
+    RandomNumberGenerator::setThreadGenerator(CFNULL);
 
 //    CFLog(INFO, "raytrace the outer photons \n");
-    for(CFuint i = 0; i< photonStack.size(); ++i ){
-      //photon=photonStack[i];
-      //CFLog(INFO,"PHOTON: " << photon.cellID<<' '<<photon.userData.KS<<'\n' );
-      //printPhoton(photonStack[i]);
-      rayTracing( photonStack[i] );
+    for(CFuint i = 0; i< photonStack.size(); ++i, ++m_photonCounter ){
+      m_photons.push_back(photonStack[i]);
+      m_photonStreams.push_back(2*m_photonCounter+1);
+    }
+
+    tracePhotons();
+
+    // the photons leaving the partition are sent in the same order as in a serial run
+    for(CFuint t = 0; t < m_tracers.size(); ++t){
+      PhotonTracer& tracer = m_tracers[t];
+      for(CFuint i = 0; i < tracer.leavingPhotons.size(); ++i){
+        m_lagrangianSolver.bufferCommitParticle(tracer.leavingPhotons[i], tracer.leavingRanks[i]);
+      }
+      tracer.leavingPhotons.clear();
+      tracer.leavingRanks.clear();
     }
 
     //sincronize
@@ -907,11 +1011,54 @@ void RadiativeTransferMonteCarlo<PARTICLE_TRACKING>::computePhotons()
   }
   delete progressBar;
 
+  // reduce the absorbed powers of all the threads
+  for(CFuint t = 0; t < m_tracers.size(); ++t){
+    PhotonTracer& tracer = m_tracers[t];
+    for(CFuint i = 0; i < tracer.stateInRadPowers.size(); ++i){
+      m_stateInRadPowers[i] += tracer.stateInRadPowers[i];
+      tracer.stateInRadPowers[i] = 0.;
+    }
+    for(CFuint i = 0; i < tracer.ghostStateInRadPowers.size(); ++i){
+      m_ghostStateInRadPowers[i] += tracer.ghostStateInRadPowers[i];
+      tracer.ghostStateInRadPowers[i] = 0.;
+    }
+  }
+
   //CFLog(INFO,"Raytracing took "<<s.readTimeHMS().str()<<'\n');
 }
 
 /////////////////////////////////////////////////////////////////////////////
 
+template<class PARTICLE_TRACKING>
+void RadiativeTransferMonteCarlo<PARTICLE_TRACKING>::tracePhotons()
+{
+  // contiguous ranges of photons, one per thread: there are never more
+  // chunks than tracers, so the chunk index selects the tracer
+  runChunked(m_photons.size(), m_tracers.size(),
+             boost::bind(&RadiativeTransferMonteCarlo<PARTICLE_TRACKING>::tracePhotonRange,
+                         this, _3, _1, _2));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
+template<class PARTICLE_TRACKING>
+void RadiativeTransferMonteCarlo<PARTICLE_TRACKING>::tracePhotonRange(const CFuint iThread,
+                                                                       const CFuint start,
+                                                                       const CFuint end)
+{
+  PhotonTracer& tracer = m_tracers[iThread];
+
+  // the reflectors draw their random numbers from the photon stream
+  RandomNumberGenerator::setThreadGenerator(&tracer.rand);
+  for (CFuint i = start; i < end; ++i) {
+    tracer.rand.seed(m_streamSeed, m_photonStreams[i]);
+    rayTracing(m_photons[i], tracer);
+  }
+  RandomNumberGenerator::setThreadGenerator(CFNULL);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
 template<class PARTICLE_TRACKING>
 void RadiativeTransferMonteCarlo<PARTICLE_TRACKING>::printPhoton(Photon photon){
  CFLog(INFO,
@@ -939,10 +1086,21 @@ void RadiativeTransferMonteCarlo<PARTICLE_TRACKING>::MonteCarlo()
     m_iphoton_cell_fix=0, m_istate_cell_fix=0;
     m_iphoton_face_fix=0, m_igState_face_fix=0;
 
+    // with a fixed seed, each process, execution and spectral loop
+    // still gets different photon streams
+    const boost::uint64_t seed = (m_seed > 0) ? m_seed : static_cast<boost::uint64_t>(time(NULL));
+    ++m_nbExecutions;
+
     for(CFuint i=0; i< nbLoops; ++i){
       m_radiation->setupWavStride(i);
       getTotalEnergy();
 
+      m_streamSeed = CounterBasedEngine::mix(seed);
+      m_streamSeed = CounterBasedEngine::mix(m_streamSeed ^ m_myProcessRank);
+      m_streamSeed = CounterBasedEngine::mix(m_streamSeed ^ m_nbExecutions);
+      m_streamSeed = CounterBasedEngine::mix(m_streamSeed ^ i);
+      m_photonCounter = 0;
+
       computePhotons();
     }
 
@@ -950,8 +1108,9 @@ void RadiativeTransferMonteCarlo<PARTICLE_TRACKING>::MonteCarlo()
 
 /////////////////////////////////////////////////////////////////////////////
 template<class PARTICLE_TRACKING>
-CFuint RadiativeTransferMonteCarlo<PARTICLE_TRACKING>::rayTracing(Photon& beam)
+CFuint RadiativeTransferMonteCarlo<PARTICLE_TRACKING>::rayTracing(Photon& beam, PhotonTracer& tracer)
 {
+  PhotonSolver& solver = *tracer.solver;
   CFuint nbCrossedCells = 0;
   CFuint nbIter = 0;
   CFint exitCellID, exitFaceID, currentCellID;
@@ -960,10 +1119,10 @@ CFuint RadiativeTransferMonteCarlo<PARTICLE_TRACKING>::rayTracing(Photon& beam)
   //CFLog(DEBUG_MAX, "RadiativeTransferMonteCarlo::rayTracing() => actualCellID = " << actualCellID << "\n");
 
   //CFLog(INFO,"NEW particle!\n");
-  m_lagrangianSolver.newParticle(beam);
+  solver.newParticle(beam);
   //cout<<"particle ID: "<<beam.commonData.cellID<<endl;
-  PhotonData &beamData = m_lagrangianSolver.getUserDataPtr();
-  exitCellID=m_lagrangianSolver.getExitCellID();
+  PhotonData &beamData = solver.getUserDataPtr();
+  exitCellID=solver.getExitCellID();
 
   //bool foundEntity = false;
   //cout<<"Start K= "<<previousK<<endl;
@@ -979,17 +1138,17 @@ CFuint RadiativeTransferMonteCarlo<PARTICLE_TRACKING>::rayTracing(Photon& beam)
 
     currentCellID = exitCellID;
 
-    m_lagrangianSolver.trackingStep();
-    exitFaceID=m_lagrangianSolver.getExitFaceID();
-    exitCellID=m_lagrangianSolver.getExitCellID();
+    solver.trackingStep();
+    exitFaceID=solver.getExitFaceID();
+    exitCellID=solver.getExitCellID();
 
     if(exitFaceID>=0){
 
-      const CFreal stepDistance=m_lagrangianSolver.getStepDistance();
+      const CFreal stepDistance=solver.getStepDistance();
       RealVector null;
 
       //CFLog(INFO, "Absorption IN!\n");
-      const CFreal cellK= m_radiation->getCellDistPtr(currentCellID)
+      const CFreal cellK= m_radiation->getCellDist(currentCellID)
           ->getRadiatorPtr()->getAbsorption(beamData.wavelength, null);
 
       //CFLog(INFO, "Absorption OUT!\n");
@@ -1010,43 +1169,43 @@ CFuint RadiativeTransferMonteCarlo<PARTICLE_TRACKING>::rayTracing(Photon& beam)
         //        cout<<"sizeBuffer: "<< m_gInRadPowers.size()<<endl;
         //add directly to the in Rad Heat Power vector
         //cout<<"energy added : "<<energyFraction<<endl;
-        cf_assert(gEndId < m_stateInRadPowers.size());
-        m_stateInRadPowers[gEndId]+=energyFraction;
+        cf_assert(gEndId < tracer.stateInRadPowers.size());
+        tracer.stateInRadPowers[gEndId]+=energyFraction;
         //cout<<"new energy: "<<m_gInRadPowers[gEndId]<<endl;
         //foundEntity = true;
         return currentCellID;
       }
 
-      CFuint faceType = m_lagrangianSolver.getFaceType(exitFaceID);
+      CFuint faceType = solver.getFaceType(exitFaceID);
 
       if ( faceType == ParticleTracking::WALL_FACE){
         //CFLog(INFO,"HERE WALL !!\n");
         CommonData beam2;
-        m_lagrangianSolver.getCommonData(beam2);
+        solver.getCommonData(beam2);
         RealVector entryDirection(m_dim2), position(m_dim2);
         for(CFuint i=0; i < m_dim2; ++i){
           entryDirection[i]= beam2.direction[i];
         }
 
-        m_lagrangianSolver.getExitPoint(position);
+        solver.getExitPoint(position);
 
 
         RealVector normal(m_dim2);
-        //CFuint stateID = m_lagrangianSolver.getWallGhotsStateId(exitFaceID);
-        CFuint ghostStateID = m_lagrangianSolver.getWallGhotsStateId(exitFaceID);
+        //CFuint stateID = solver.getWallGhotsStateId(exitFaceID);
+        CFuint ghostStateID = solver.getWallGhotsStateId(exitFaceID);
 
-        const CFreal wallK = m_radiation->getWallDistPtr(ghostStateID)
+        const CFreal wallK = m_radiation->getWallDist(ghostStateID)
             ->getRadiatorPtr()->getAbsorption( beamData.wavelength, entryDirection );
 
-        m_lagrangianSolver.getNormals(exitFaceID,position,normal);
+        solver.getNormals(exitFaceID,position,normal);
 
-        const CFreal reflectionProbability =  m_rand.uniformRand();
+        const CFreal reflectionProbability =  tracer.rand.uniformRand();
 
         if(reflectionProbability <= wallK){ // the photon is absorved by the wall
           //cout<<"ABSORVED!"<<endl;
           //entity = WALL_FACE;
-          const CFuint ghostStateID = m_lagrangianSolver.getWallGhotsStateId(exitFaceID);
-          m_ghostStateInRadPowers[ghostStateID] += beamData.energyFraction;
+          const CFuint ghostStateID = solver.getWallGhotsStateId(exitFaceID);
+          tracer.ghostStateInRadPowers[ghostStateID] += beamData.energyFraction;
           //foundEntity = true;
           return exitFaceID;
         }
@@ -1054,9 +1213,9 @@ CFuint RadiativeTransferMonteCarlo<PARTICLE_TRACKING>::rayTracing(Photon& beam)
           //CFLog(INFO,"Reflected !!\n");
 
           RealVector exitDirection(m_dim2);
-          m_radiation->getWallDistPtr(ghostStateID)->getReflectorPtr()->getRandomDirection(
+          m_radiation->getWallDist(ghostStateID)->getReflectorPtr()->getRandomDirection(
                 beamData.wavelength, exitDirection, entryDirection, normal);
-          m_lagrangianSolver.newDirection( exitDirection );
+          solver.newDirection( exitDirection );
 
           //cout<<"Entry Direction: "
           //    <<entryDirection[0] <<' '<<entryDirection[1] <<' '<<entryDirection[2] <<endl;
@@ -1076,7 +1235,9 @@ CFuint RadiativeTransferMonteCarlo<PARTICLE_TRACKING>::rayTracing(Photon& beam)
 
       if(faceType == ParticleTracking::COMP_DOMAIN_FACE){
       //CFLog(INFO,"HERE DOMAIN FACE!!\n");
-          m_lagrangianSolver.bufferCommitParticle(exitFaceID);
+          tracer.leavingPhotons.push_back(Photon());
+          tracer.leavingRanks.push_back(0);
+          solver.getLeavingParticle(exitFaceID, tracer.leavingPhotons.back(), tracer.leavingRanks.back());
         return 0;
       }
 
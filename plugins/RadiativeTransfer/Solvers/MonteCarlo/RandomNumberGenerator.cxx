@@ -1,4 +1,5 @@
 #include <boost/random.hpp>
+#include <boost/thread/tss.hpp>
 #include "RandomNumberGenerator.hh"
 #include "Common/COOLFluiD.hh"
 namespace COOLFluiD {
@@ -16,5 +17,21 @@ namespace RadiativeTransfer {
   void RandomNumberGenerator::seed(CFuint seedNumber){
     m_generator.seed(seedNumber);
   }
+
+  void RandomNumberGenerator::seed(boost::uint64_t seedNumber, boost::uint64_t streamID){
+    m_generator.seed(seedNumber, streamID);
+  }
+
+  // the bound generators are owned by the callers
+  static void noCleanup(RandomNumberGenerator*){}
+  static boost::thread_specific_ptr<RandomNumberGenerator> threadGenerator(&noCleanup);
+
+  RandomNumberGenerator* RandomNumberGenerator::getThreadGenerator(){
+    return threadGenerator.get();
+  }
+
+  void RandomNumberGenerator::setThreadGenerator(RandomNumberGenerator* generator){
+    threadGenerator.reset(generator);
+  }
 }
 }
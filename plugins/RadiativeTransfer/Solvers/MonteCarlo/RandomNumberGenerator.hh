@@ -3,6 +3,7 @@
 
 #include "MathTools/MathFunctions.hh"
 #include <boost/random.hpp>
+#include <boost/cstdint.hpp>
 #include "Common/COOLFluiD.hh"
 #include <vector>
 #include "RadiativeTransfer/RadiativeTransferModule.hh"
@@ -16,7 +17,54 @@ namespace COOLFluiD {
 
 namespace RadiativeTransfer {
 
-typedef boost::mt19937 typeGenerator; //Marsenne Twister generator
+/*  Counter-based engine: the n-th number of a stream is a hash (SplitMix64
+*   finalizer) of the stream key and of n, therefore any number of independent
+*   streams can be created and positioned at no cost. It models the Boost
+*   UniformRandomNumberGenerator concept.
+*/
+class CounterBasedEngine{
+
+public:
+
+  typedef boost::uint32_t result_type;
+  BOOST_STATIC_CONSTANT(bool, has_fixed_range = false);
+
+  CounterBasedEngine() : m_key(mix(5489u)), m_counter(0) {}
+
+  /// start the stream identified by the given seed
+  void seed(boost::uint64_t seedNumber) {m_key = mix(seedNumber); m_counter = 0;}
+
+  /// start the sub-stream streamID of the stream identified by the given seed
+  void seed(boost::uint64_t seedNumber, boost::uint64_t streamID)
+  {
+    m_key = mix(mix(seedNumber) ^ streamID);
+    m_counter = 0;
+  }
+
+  static result_type (min)() {return 0;}
+  static result_type (max)() {return 0xffffffffu;}
+
+  result_type operator()()
+  {
+    ++m_counter;
+    return static_cast<result_type>(mix(m_key + m_counter*0x9E3779B97F4A7C15ULL) >> 32);
+  }
+
+  /// SplitMix64 finalizer
+  static boost::uint64_t mix(boost::uint64_t z)
+  {
+    z = (z ^ (z >> 30))*0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27))*0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+  }
+
+private:
+
+  boost::uint64_t m_key;
+  boost::uint64_t m_counter;
+};
+
+typedef CounterBasedEngine typeGenerator;
 
 class RandomNumberGenerator{
 
@@ -32,6 +80,16 @@ public:
 
   void seed(CFuint seedNumber);
 
+  /// select the independent stream streamID of the given seed
+  void seed(boost::uint64_t seedNumber, boost::uint64_t streamID);
+
+  /// generator used by the radiators and reflectors called by the current
+  /// thread (CFNULL if none has been bound)
+  static RandomNumberGenerator* getThreadGenerator();
+
+  /// bind a generator to the current thread (CFNULL to unbind it)
+  static void setThreadGenerator(RandomNumberGenerator* generator);
+
 private:
 
   typeGenerator m_generator;
@@ -1,6 +1,7 @@
 #include "RMeshMe.hh"
 #include "Environment/ObjectProvider.hh"
 #include "Framework/SubSystemStatus.hh"
+#include "Framework/Profiler.hh"
 #include "RemeshMeandr/RemeshMeandr.hh"
 
 //////////////////////////////////////////////////////////////////////////////
@@ -107,14 +108,14 @@ void RMeshMe::setMethodImpl()
   MeshAdapterMethod::setMethodImpl();
 
   setupCommandsAndStrategies();
-  _setup->execute();
+  profileExecute(_setup);
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
 void RMeshMe::unsetMethodImpl()
 {
-  _unSetup->execute();
+  profileExecute(_unSetup);
   unsetupCommandsAndStrategies();
 
   MeshAdapterMethod::unsetMethodImpl();
@@ -130,18 +131,18 @@ void RMeshMe::adaptMeshImpl()
   {
     CFLog( ERROR,"HELLO " << " FUNCT: " <<  __FUNCTION__ << " LINE: " << __LINE__ << "\n" );
 
-    _writeControlSpcCom->execute();
+    profileExecute(_writeControlSpcCom);
 
-    _meandrosCallCom->execute();
+    profileExecute(_meandrosCallCom);
 
-    _interpolCom->execute();
+    profileExecute(_interpolCom);
 
     //if ( _data->isHessianSmooth() )
-    //    _smoother->execute();
+    //    profileExecute(_smoother);
 
-    //_computeMetric->execute();
+    //profileExecute(_computeMetric);
 
-    /// @todo Add this later: _smoother->execute();
+    /// @todo Add this later: profileExecute(_smoother);
   }
 }
 
@@ -7,6 +7,7 @@
 #include "Environment/ObjectProvider.hh"
 #include "Framework/SpaceMethod.hh"
 #include "Framework/CFL.hh"
+#include "Framework/Profiler.hh"
 
 #include "RungeKutta/RungeKutta.hh"
 #include "RungeKutta/RK.hh"
@@ -109,14 +110,14 @@ void RK::setMethodImpl()
   ConvergenceMethod::setMethodImpl();
 
   setupCommandsAndStrategies();
-  m_setup->execute();
+  profileExecute(m_setup);
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
 void RK::unsetMethodImpl()
 {
-  m_unSetup->execute();
+  profileExecute(m_unSetup);
   unsetupCommandsAndStrategies();
 
   ConvergenceMethod::unsetMethodImpl();
@@ -145,7 +146,7 @@ void RK::takeStepImpl()
   // Initialize U0 and tempu
   m_data->setIsLastStep(false);
   m_data->setIsFirstStep(true);
-  m_backupSol->execute();
+  profileExecute(m_backupSol);
   m_data->setIsFirstStep(false);
 
   // loop over the R-K stages
@@ -166,7 +167,7 @@ void RK::takeStepImpl()
     m_data->getCollaborator<SpaceMethod>()->computeTimeResidual(1.0);
 
     // Compute Ui and Un+1(i)
-    m_rungeKuttaStep->execute();
+    profileExecute(m_rungeKuttaStep);
     ConvergenceMethod::syncGlobalDataComputeResidual(true);
 
     m_data->getCollaborator<SpaceMethod>()->postProcessSolution();
@@ -174,7 +175,7 @@ void RK::takeStepImpl()
 
   // Update the states
   m_data->setIsLastStep(true);
-  m_backupSol->execute();
+  profileExecute(m_backupSol);
 
   // update time to time at end of iteration
   if (dt > 0.)
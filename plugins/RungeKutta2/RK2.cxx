@@ -9,6 +9,7 @@
 #include "Framework/SpaceMethod.hh"
 #include "RungeKutta2/RungeKutta2.hh"
 #include "Framework/CFL.hh"
+#include "Framework/Profiler.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -124,14 +125,14 @@ void RK2::setMethodImpl()
   ConvergenceMethod::setMethodImpl();
 
   setupCommandsAndStrategies();
-  m_setup->execute();
+  profileExecute(m_setup);
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
 void RK2::unsetMethodImpl()
 {
-  m_unSetup->execute();
+  profileExecute(m_unSetup);
   unsetupCommandsAndStrategies();
 
   ConvergenceMethod::unsetMethodImpl();
@@ -149,13 +150,13 @@ void RK2::takeStepImpl()
 
   const CFreal dt = SubSystemStatusStack::getActive()->getDT();
 
-  m_backupSol->execute();
+  profileExecute(m_backupSol);
 
   m_data->getCollaborator<SpaceMethod>()->prepareComputation();
   m_data->getCollaborator<SpaceMethod>()->computeSpaceResidual(1.0);
   m_data->getCollaborator<SpaceMethod>()->computeTimeResidual(1.0);
 
-  m_predictorStep->execute();
+  profileExecute(m_predictorStep);
 
   ConvergenceMethod::syncGlobalDataComputeResidual(false);
 
@@ -171,7 +172,7 @@ void RK2::takeStepImpl()
   m_data->getCollaborator<SpaceMethod>()->computeSpaceResidual(1.0);
   m_data->getCollaborator<SpaceMethod>()->computeTimeResidual(1.0);
 
-  m_correctorStep->execute();
+  profileExecute(m_correctorStep);
 
   ConvergenceMethod::syncGlobalDataComputeResidual(true);
 
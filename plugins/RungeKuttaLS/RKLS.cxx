@@ -7,6 +7,7 @@
 #include "Environment/ObjectProvider.hh"
 #include "Framework/SpaceMethod.hh"
 #include "Framework/CFL.hh"
+#include "Framework/Profiler.hh"
 
 #include "RungeKuttaLS/RungeKuttaLS.hh"
 #include "RungeKuttaLS/RKLS.hh"
@@ -109,14 +110,14 @@ void RKLS::setMethodImpl()
   ConvergenceMethod::setMethodImpl();
 
   setupCommandsAndStrategies();
-  m_setup->execute();
+  profileExecute(m_setup);
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
 void RKLS::unsetMethodImpl()
 {
-  m_unSetup->execute();
+  profileExecute(m_unSetup);
   unsetupCommandsAndStrategies();
 
   ConvergenceMethod::unsetMethodImpl();
@@ -143,7 +144,7 @@ void RKLS::takeStepImpl()
   const CFuint order = m_data->getOrder() ;
 
   // Initialize u0
-  m_backupSol->execute();
+  profileExecute(m_backupSol);
 
   // loop over the R-K stages
   for (CFuint i = 0; i < order ; ++i)
@@ -163,7 +164,7 @@ void RKLS::takeStepImpl()
     m_data->getCollaborator<SpaceMethod>()->computeTimeResidual(1.0);
 
     // Compute solution of this R-K stage
-    m_rungeKuttaStep->execute();
+    profileExecute(m_rungeKuttaStep);
 
 
     if (i != order-1)
@@ -7,6 +7,7 @@
 #include "SAMGLSS/SAMGLSS.hh"
 #include "SAMGLSS/SAMGLSSModule.hh"
 #include "Framework/BlockAccumulator.hh"
+#include "Framework/Profiler.hh"
 #include "Environment/ObjectProvider.hh"
 
 using namespace COOLFluiD::Framework;
@@ -81,7 +82,7 @@ void SAMGLSS::solveSysImpl()
   CFAUTOTRACE;
   cf_assert(isSetup());
   cf_assert(isConfigured());
-  m_solveSys->execute();
+  profileExecute(m_solveSys);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -113,7 +114,7 @@ void SAMGLSS::setMethodImpl()
   LinearSystemSolver::setMethodImpl();
 
   m_setup->setup();
-  m_setup->execute();
+  profileExecute(m_setup);
 
   m_solveSys->setup();
   m_unSetup->setup();
@@ -125,7 +126,7 @@ void SAMGLSS::setMethodImpl()
 void SAMGLSS::unsetMethodImpl()
 {
   CFAUTOTRACE;
-  m_unSetup->execute();
+  profileExecute(m_unSetup);
   unsetupCommandsAndStrategies();
 
   LinearSystemSolver::unsetMethodImpl();
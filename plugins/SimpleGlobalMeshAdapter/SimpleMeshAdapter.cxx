@@ -10,6 +10,7 @@
 #include "Framework/MeshAdapterMethod.hh"
 #include "Framework/SubSystemStatus.hh"
 #include "Framework/NamespaceSwitcher.hh"
+#include "Framework/Profiler.hh"
 
 #include "SimpleGlobalMeshAdapter/SimpleMeshAdapter.hh"
 #include "SimpleGlobalMeshAdapter/SimpleGlobalMeshAdapter.hh"
@@ -150,14 +151,14 @@ void SimpleMeshAdapter::setMethodImpl()
   _data->setOutputFormatter(getOutputFormatter());
 
   setupCommandsAndStrategies();
-  _setup->execute();
+  profileExecute(_setup);
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
 void SimpleMeshAdapter::unsetMethodImpl()
 {
-  _unSetup->execute();
+  profileExecute(_unSetup);
   unsetupCommandsAndStrategies();
 
   MeshAdapterMethod::unsetMethodImpl();
@@ -182,7 +183,7 @@ void SimpleMeshAdapter::remeshImpl()
     (SubSystemStatusStack::getCurrentName()).getNamespace(otherNameSpace);
   Common::SafePtr<SubSystemStatus> subsystemStatus = SubSystemStatusStack::getInstance().getEntryByNamespace(nsp);
   
-  _remeshCondition->execute();
+  profileExecute(_remeshCondition);
   CFout <<" Need remeshing ?? : "<< _data->isNeedRemeshing() <<"\n";
 
   Common::SafePtr<EventHandler> event_handler = Environment::CFEnv::getInstance().getEventHandler();
@@ -194,11 +195,11 @@ void SimpleMeshAdapter::remeshImpl()
     // Raise the event for the backup of data prior to change
     //    event_handler->call_signal (event_handler->key(ssname,"CF_ON_MESHADAPTER_BEFOREGLOBALREMESHING"), msg );
 
-    _prepare->execute();
-    _runMeshGenerator->execute();
-    _readNewMesh->execute();
-    _interpolateSol->execute();
-    _writeInterpolatedMesh->execute();
+    profileExecute(_prepare);
+    profileExecute(_runMeshGenerator);
+    profileExecute(_readNewMesh);
+    profileExecute(_interpolateSol);
+    profileExecute(_writeInterpolatedMesh);
     
    //   PE::GetPE().setBarrier();
    //   PE::GetPE().setBarrier();
@@ -34,6 +34,7 @@ BaseBndFaceTermComputer::BaseBndFaceTermComputer(const std::string& name) :
   m_updateVarSet(CFNULL),
   m_diffusiveVarSet(CFNULL),
   m_statesReconstr(CFNULL),
+  m_tpReconstructors(),
   m_bcStateComputer(CFNULL),
   m_riemannFluxComputer(CFNULL),
   m_faceDiffFluxComputer(CFNULL),
@@ -247,10 +248,17 @@ void BaseBndFaceTermComputer::reconstructFluxPntsStates(const vector< State* >&
   // compute internal states
   if (!onlyExtraVars)
   {
-    m_statesReconstr->reconstructStates(cellIntStates,m_flxPntIntSol,*m_flxPntsRecCoefs,
-                                        (*m_faceFlxPntConn)[m_orient],
-                                        *m_flxPntMatrixIdxForReconstruction,
-                                        *m_solPntIdxsForReconstruction);
+    if (m_orient < m_tpReconstructors.size() && m_tpReconstructors[m_orient].isSetup())
+    {
+      m_tpReconstructors[m_orient].reconstructStates(cellIntStates,m_flxPntIntSol);
+    }
+    else
+    {
+      m_statesReconstr->reconstructStates(cellIntStates,m_flxPntIntSol,*m_flxPntsRecCoefs,
+                                          (*m_faceFlxPntConn)[m_orient],
+                                          *m_flxPntMatrixIdxForReconstruction,
+                                          *m_solPntIdxsForReconstruction);
+    }
   }
 
   // if needed, reconstruct the extra variables
@@ -293,10 +301,17 @@ void BaseBndFaceTermComputer::reconstructFluxPntsStates(const vector< State* >&
 void BaseBndFaceTermComputer::reconstructFluxPntsGradients(const vector< vector< RealVector >* >& cellIntGrads)
 {
   // reconstruct internal gradients
-  m_statesReconstr->reconstructGradients(cellIntGrads,m_flxPntIntGrads,*m_flxPntsRecCoefs,
-                                         (*m_faceFlxPntConn)[m_orient],
-                                         *m_flxPntMatrixIdxForReconstruction,
-                                         *m_solPntIdxsForReconstruction);
+  if (m_orient < m_tpReconstructors.size() && m_tpReconstructors[m_orient].isSetup())
+  {
+    m_tpReconstructors[m_orient].reconstructGradients(cellIntGrads,m_flxPntIntGrads);
+  }
+  else
+  {
+    m_statesReconstr->reconstructGradients(cellIntGrads,m_flxPntIntGrads,*m_flxPntsRecCoefs,
+                                           (*m_faceFlxPntConn)[m_orient],
+                                           *m_flxPntMatrixIdxForReconstruction,
+                                           *m_solPntIdxsForReconstruction);
+  }
 
   // compute the ghost gradients
   computeGhostGradients();
@@ -840,6 +855,27 @@ void BaseBndFaceTermComputer::setup()
   vector< SpectralFDElementData* >& sdLocalData = getMethodData().getSDLocalData();
   cf_assert(sdLocalData.size() > 0);
 
+  // set up the line by line reconstructors for the tensor product elements
+  m_tpReconstructors.resize(0);
+  const CFGeoShape::Type shape = sdLocalData[0]->getShape();
+  if (shape == CFGeoShape::QUAD || shape == CFGeoShape::HEXA)
+  {
+    const std::string interpolationType = getMethodData().getInterpolationType();
+    const bool isOptim = (interpolationType == "optimized");
+    SafePtr< vector< vector< CFuint > > > faceFlxPntConn = sdLocalData[0]->getFaceFlxPntConn();
+    const CFuint nbrOrients = faceFlxPntConn->size();
+    m_tpReconstructors.resize(nbrOrients);
+    for (CFuint iOrient = 0; iOrient < nbrOrients; ++iOrient)
+    {
+      m_tpReconstructors[iOrient].setup(isOptim ? *sdLocalData[0]->getRecCoefsFlxPnts1DOptim() :
+                                                  *sdLocalData[0]->getRecCoefsFlxPnts1D(),
+                                        (*faceFlxPntConn)[iOrient],
+                                        *sdLocalData[0]->getFlxPntMatrixIdxForReconstruction(),
+                                        isOptim ? *sdLocalData[0]->getSolPntIdxsForRecOptim() :
+                                                  *sdLocalData[0]->getSolPntIdxsForReconstruction());
+    }
+  }
+
   // number of solution points
   const CFuint nbrSolPnts = sdLocalData[0]->getNbrOfSolPnts();
 
@@ -12,6 +12,7 @@
 #include "SpectralFD/ReconstructStatesSpectralFD.hh"
 #include "SpectralFD/RiemannFlux.hh"
 #include "SpectralFD/SpectralFDMethodData.hh"
+#include "SpectralFD/TensorProductReconstructor.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -277,6 +278,9 @@ protected: // data
   /// Strategy that reconstructs the states in a given number of nodes
   Common::SafePtr< ReconstructStatesSpectralFD > m_statesReconstr;
 
+  /// line by line reconstructors for each face orientation (not set up if not tensor product elements)
+  std::vector< TensorProductReconstructor > m_tpReconstructors;
+
   /// Strategy that sets the ghost states corresponding to the boundary condition
   Common::SafePtr< BCStateComputer> m_bcStateComputer;
 
@@ -34,6 +34,7 @@ BaseFaceTermComputer::BaseFaceTermComputer(const std::string& name) :
   m_updateVarSet(CFNULL),
   m_diffusiveVarSet(CFNULL),
   m_statesReconstr(CFNULL),
+  m_tpReconstructors(),
   m_riemannFluxComputer(CFNULL),
   m_faceDiffFluxComputer(CFNULL),
   m_cflConvDiffRatio(),
@@ -223,10 +224,17 @@ void BaseFaceTermComputer::reconstructFluxPntsStates(const vector< vector< State
   {
     for (CFuint iSide = 0; iSide < 2; ++iSide)
     {
-      m_statesReconstr->reconstructStates(*cellStates[iSide],m_flxPntSol[iSide],*m_flxPntsRecCoefs,
-                                          (*m_faceFlxPntConn)[m_orient][iSide],
-                                          *m_flxPntMatrixIdxForReconstruction,
-                                          *m_solPntIdxsForReconstruction);
+      if (m_orient < m_tpReconstructors.size() && m_tpReconstructors[m_orient][iSide].isSetup())
+      {
+        m_tpReconstructors[m_orient][iSide].reconstructStates(*cellStates[iSide],m_flxPntSol[iSide]);
+      }
+      else
+      {
+        m_statesReconstr->reconstructStates(*cellStates[iSide],m_flxPntSol[iSide],*m_flxPntsRecCoefs,
+                                            (*m_faceFlxPntConn)[m_orient][iSide],
+                                            *m_flxPntMatrixIdxForReconstruction,
+                                            *m_solPntIdxsForReconstruction);
+      }
     }
   }
 
@@ -262,10 +270,7 @@ void BaseFaceTermComputer::reconstructFluxPntsGradients(const vector< vector< ve
   cf_assert(cellGrads.size() == 2);
   for (CFuint iSide = 0; iSide < 2; ++iSide)
   {
-    m_statesReconstr->reconstructGradients(cellGrads[iSide],m_flxPntGrads[iSide],*m_flxPntsRecCoefs,
-                                           (*m_faceFlxPntConn)[m_orient][iSide],
-                                           *m_flxPntMatrixIdxForReconstruction,
-                                           *m_solPntIdxsForReconstruction);
+    reconstructFluxPntsGradients(iSide,cellGrads[iSide]);
   }
 }
 
@@ -274,10 +279,17 @@ void BaseFaceTermComputer::reconstructFluxPntsGradients(const vector< vector< ve
 void BaseFaceTermComputer::reconstructFluxPntsGradients(const CFuint side,
                                                         const vector< vector< RealVector >* >& cellGrads)
 {
-  m_statesReconstr->reconstructGradients(cellGrads,m_flxPntGrads[side],*m_flxPntsRecCoefs,
-                                         (*m_faceFlxPntConn)[m_orient][side],
-                                         *m_flxPntMatrixIdxForReconstruction,
-                                         *m_solPntIdxsForReconstruction);
+  if (m_orient < m_tpReconstructors.size() && m_tpReconstructors[m_orient][side].isSetup())
+  {
+    m_tpReconstructors[m_orient][side].reconstructGradients(cellGrads,m_flxPntGrads[side]);
+  }
+  else
+  {
+    m_statesReconstr->reconstructGradients(cellGrads,m_flxPntGrads[side],*m_flxPntsRecCoefs,
+                                           (*m_faceFlxPntConn)[m_orient][side],
+                                           *m_flxPntMatrixIdxForReconstruction,
+                                           *m_solPntIdxsForReconstruction);
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -569,6 +581,30 @@ void BaseFaceTermComputer::setup()
   vector< SpectralFDElementData* >& sdLocalData = getMethodData().getSDLocalData();
   cf_assert(sdLocalData.size() > 0);
 
+  // set up the line by line reconstructors for the tensor product elements
+  m_tpReconstructors.resize(0);
+  const CFGeoShape::Type shape = sdLocalData[0]->getShape();
+  if (shape == CFGeoShape::QUAD || shape == CFGeoShape::HEXA)
+  {
+    const std::string interpolationType = getMethodData().getInterpolationType();
+    const bool isOptim = (interpolationType == "optimized");
+    SafePtr< vector< vector< vector< CFuint > > > > faceFlxPntConn = sdLocalData[0]->getFaceFlxPntConnPerOrient();
+    const CFuint nbrOrients = faceFlxPntConn->size();
+    m_tpReconstructors.resize(nbrOrients,vector< TensorProductReconstructor >(2));
+    for (CFuint iOrient = 0; iOrient < nbrOrients; ++iOrient)
+    {
+      for (CFuint iSide = 0; iSide < 2; ++iSide)
+      {
+        m_tpReconstructors[iOrient][iSide].setup(isOptim ? *sdLocalData[0]->getRecCoefsFlxPnts1DOptim() :
+                                                           *sdLocalData[0]->getRecCoefsFlxPnts1D(),
+                                                 (*faceFlxPntConn)[iOrient][iSide],
+                                                 *sdLocalData[0]->getFlxPntMatrixIdxForReconstruction(),
+                                                 isOptim ? *sdLocalData[0]->getSolPntIdxsForRecOptim() :
+                                                           *sdLocalData[0]->getSolPntIdxsForReconstruction());
+      }
+    }
+  }
+
   // number of solution points
   const CFuint nbrSolPnts = sdLocalData[0]->getNbrOfSolPnts();
 
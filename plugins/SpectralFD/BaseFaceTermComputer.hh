@@ -9,6 +9,7 @@
 #include "SpectralFD/ReconstructStatesSpectralFD.hh"
 #include "SpectralFD/RiemannFlux.hh"
 #include "SpectralFD/SpectralFDMethodData.hh"
+#include "SpectralFD/TensorProductReconstructor.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -206,6 +207,9 @@ protected: // data
   /// Strategy that reconstructs the states in a given number of nodes
   Common::SafePtr< ReconstructStatesSpectralFD > m_statesReconstr;
 
+  /// line by line reconstructors for each face orientation and side (not set up if not tensor product elements)
+  std::vector< std::vector< TensorProductReconstructor > > m_tpReconstructors;
+
   /// Riemann flux
   Common::SafePtr< RiemannFlux > m_riemannFluxComputer;
 
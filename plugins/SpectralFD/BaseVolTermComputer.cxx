@@ -34,6 +34,8 @@ BaseVolTermComputer::BaseVolTermComputer(const std::string& name) :
   m_updateVarSet(CFNULL),
   m_diffusiveVarSet(CFNULL),
   m_statesReconstr(CFNULL),
+  m_tpReconstructors(),
+  m_tpReconstructor(CFNULL),
   m_flxPntsRecCoefs(CFNULL),
   m_solPntsDerivCoefs(CFNULL),
   m_intFlxPntIdxs(CFNULL),
@@ -58,7 +60,13 @@ BaseVolTermComputer::BaseVolTermComputer(const std::string& name) :
   m_nbrEqs(),
   m_dim(),
   m_gradTerm(),
-  m_nbrExtraVars()
+  m_nbrExtraVars(),
+  m_batchCellBlock(),
+  m_batchSolInFlxPnts(),
+  m_batchGradInFlxPnts(),
+  m_nbrBatchCells(0),
+  m_nbrBatchGradCells(0),
+  m_nbrBatchGradComps(0)
 {
   CFAUTOTRACE;
 }
@@ -142,6 +150,13 @@ void BaseVolTermComputer::setVolumeTermData(CFuint iElemType)
   {
     throw BadValueException (FromHere(),"BaseVolTermComputer::setVolumeTermData --> Interpolation type should be standard or optimized");
   }
+
+  // set the line by line reconstructor for this element type
+  m_tpReconstructor = CFNULL;
+  if (iElemType < m_tpReconstructors.size() && m_tpReconstructors[iElemType].isSetup())
+  {
+    m_tpReconstructor = &m_tpReconstructors[iElemType];
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -158,10 +173,17 @@ void BaseVolTermComputer::reconstructStates(const vector< State* >& cellStates,
 {
   if (!onlyExtraVars)
   {
-    m_statesReconstr->reconstructStates(cellStates,m_solInFlxPnts,
-                                        *m_flxPntsRecCoefs,*m_intFlxPntIdxs,
-                                        *m_flxPntMatrixIdxForReconstruction,
-                                        *m_solPntIdxsForReconstruction);
+    if (m_tpReconstructor.isNotNull())
+    {
+      m_tpReconstructor->reconstructStates(cellStates,m_solInFlxPnts);
+    }
+    else
+    {
+      m_statesReconstr->reconstructStates(cellStates,m_solInFlxPnts,
+                                          *m_flxPntsRecCoefs,*m_intFlxPntIdxs,
+                                          *m_flxPntMatrixIdxForReconstruction,
+                                          *m_solPntIdxsForReconstruction);
+    }
   }
 
   // if needed, reconstruct the extra variables
@@ -190,10 +212,132 @@ void BaseVolTermComputer::reconstructStates(const vector< State* >& cellStates,
 
 void BaseVolTermComputer::reconstructGradients(const vector< vector< RealVector >* >& cellGradients)
 {
-  m_statesReconstr->reconstructGradients(cellGradients,m_gradInFlxPnts,
-                                         *m_flxPntsRecCoefs,*m_intFlxPntIdxs,
-                                         *m_flxPntMatrixIdxForReconstruction,
-                                         *m_solPntIdxsForReconstruction);
+  if (m_tpReconstructor.isNotNull())
+  {
+    m_tpReconstructor->reconstructGradients(cellGradients,m_gradInFlxPnts);
+  }
+  else
+  {
+    m_statesReconstr->reconstructGradients(cellGradients,m_gradInFlxPnts,
+                                           *m_flxPntsRecCoefs,*m_intFlxPntIdxs,
+                                           *m_flxPntMatrixIdxForReconstruction,
+                                           *m_solPntIdxsForReconstruction);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BaseVolTermComputer::reconstructStatesBatch(const vector< State* >& batchStates, const CFuint nbrCells)
+{
+  cf_assert(nbrCells > 0);
+  cf_assert(batchStates.size() % nbrCells == 0);
+  const CFuint nbrSolPnts = batchStates.size()/nbrCells;
+  const CFuint nbrCols = nbrCells*m_nbrEqs;
+
+  // gather the states, one row per solution point
+  m_batchCellBlock.resize(nbrSolPnts*nbrCols);
+  for (CFuint iCell = 0; iCell < nbrCells; ++iCell)
+  {
+    for (CFuint iSol = 0; iSol < nbrSolPnts; ++iSol)
+    {
+      const State& cellState = *batchStates[iCell*nbrSolPnts + iSol];
+      CFreal *const cellData = &m_batchCellBlock[iSol*nbrCols + iCell*m_nbrEqs];
+      for (CFuint iEq = 0; iEq < m_nbrEqs; ++iEq)
+      {
+        cellData[iEq] = cellState[iEq];
+      }
+    }
+  }
+
+  // reconstruct
+  m_statesReconstr->reconstructBlock(m_batchCellBlock,m_batchSolInFlxPnts,nbrCols,
+                                     *m_flxPntsRecCoefs,*m_intFlxPntIdxs,
+                                     *m_flxPntMatrixIdxForReconstruction,
+                                     *m_solPntIdxsForReconstruction);
+  m_nbrBatchCells = nbrCells;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BaseVolTermComputer::reconstructGradientsBatch(const vector< vector< RealVector >* >& batchGradients,
+                                                    const CFuint nbrCells)
+{
+  cf_assert(nbrCells > 0);
+  cf_assert(batchGradients.size() % nbrCells == 0);
+  const CFuint nbrSolPnts = batchGradients.size()/nbrCells;
+  const CFuint nbrGradVars = batchGradients[0]->size();
+  const CFuint dim = (*batchGradients[0])[0].size();
+  const CFuint nbrComps = nbrGradVars*dim;
+  const CFuint nbrCols = nbrCells*nbrComps;
+
+  // gather the gradients, one row per solution point
+  m_batchCellBlock.resize(nbrSolPnts*nbrCols);
+  for (CFuint iCell = 0; iCell < nbrCells; ++iCell)
+  {
+    for (CFuint iSol = 0; iSol < nbrSolPnts; ++iSol)
+    {
+      const vector< RealVector >& cellGrad = *batchGradients[iCell*nbrSolPnts + iSol];
+      CFreal* cellData = &m_batchCellBlock[iSol*nbrCols + iCell*nbrComps];
+      for (CFuint iVar = 0; iVar < nbrGradVars; ++iVar)
+      {
+        for (CFuint iDim = 0; iDim < dim; ++iDim, ++cellData)
+        {
+          *cellData = cellGrad[iVar][iDim];
+        }
+      }
+    }
+  }
+
+  // reconstruct
+  m_statesReconstr->reconstructBlock(m_batchCellBlock,m_batchGradInFlxPnts,nbrCols,
+                                     *m_flxPntsRecCoefs,*m_intFlxPntIdxs,
+                                     *m_flxPntMatrixIdxForReconstruction,
+                                     *m_solPntIdxsForReconstruction);
+  m_nbrBatchGradCells = nbrCells;
+  m_nbrBatchGradComps = nbrComps;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BaseVolTermComputer::setBatchCellStates(const CFuint iCell)
+{
+  cf_assert(iCell < m_nbrBatchCells);
+  const CFuint nbrCols = m_nbrBatchCells*m_nbrEqs;
+  const CFuint nbrRecStates = m_batchSolInFlxPnts.size()/nbrCols;
+  cf_assert(nbrRecStates <= m_solInFlxPnts.size());
+  for (CFuint iFlx = 0; iFlx < nbrRecStates; ++iFlx)
+  {
+    State& recState = *m_solInFlxPnts[iFlx];
+    const CFreal *const recData = &m_batchSolInFlxPnts[iFlx*nbrCols + iCell*m_nbrEqs];
+    for (CFuint iEq = 0; iEq < m_nbrEqs; ++iEq)
+    {
+      recState[iEq] = recData[iEq];
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BaseVolTermComputer::setBatchCellGradients(const CFuint iCell)
+{
+  cf_assert(iCell < m_nbrBatchGradCells);
+  const CFuint nbrCols = m_nbrBatchGradCells*m_nbrBatchGradComps;
+  const CFuint nbrRecGrads = m_batchGradInFlxPnts.size()/nbrCols;
+  cf_assert(nbrRecGrads <= m_gradInFlxPnts.size());
+  for (CFuint iFlx = 0; iFlx < nbrRecGrads; ++iFlx)
+  {
+    const CFreal* recData = &m_batchGradInFlxPnts[iFlx*nbrCols + iCell*m_nbrBatchGradComps];
+    const CFuint nbrGradVars = m_gradInFlxPnts[iFlx].size();
+    for (CFuint iVar = 0; iVar < nbrGradVars; ++iVar)
+    {
+      RealVector& recGrad = *m_gradInFlxPnts[iFlx][iVar];
+      const CFuint dim = recGrad.size();
+      for (CFuint iDim = 0; iDim < dim; ++iDim, ++recData)
+      {
+        recGrad[iDim] = *recData;
+      }
+    }
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -451,6 +595,31 @@ void BaseVolTermComputer::setup()
     maxNbrFlxPnts = maxNbrFlxPnts > nbrFlxPnts ? maxNbrFlxPnts : nbrFlxPnts;
   }
 
+  // set up the line by line reconstructors for the tensor product elements
+  const std::string interpolationType = getMethodData().getInterpolationType();
+  m_tpReconstructors.resize(nbrElemTypes);
+  for (CFuint iElemType = 0; iElemType < nbrElemTypes; ++iElemType)
+  {
+    const CFGeoShape::Type shape = sdLocalData[iElemType]->getShape();
+    if (shape == CFGeoShape::QUAD || shape == CFGeoShape::HEXA)
+    {
+      if (interpolationType == "standard")
+      {
+        m_tpReconstructors[iElemType].setup(*sdLocalData[iElemType]->getRecCoefsFlxPnts1D(),
+                                            *sdLocalData[iElemType]->getIntFlxPntIdxs(),
+                                            *sdLocalData[iElemType]->getFlxPntMatrixIdxForReconstruction(),
+                                            *sdLocalData[iElemType]->getSolPntIdxsForReconstruction());
+      }
+      else if (interpolationType == "optimized")
+      {
+        m_tpReconstructors[iElemType].setup(*sdLocalData[iElemType]->getRecCoefsFlxPnts1DOptim(),
+                                            *sdLocalData[iElemType]->getIntFlxPntIdxs(),
+                                            *sdLocalData[iElemType]->getFlxPntMatrixIdxForReconstruction(),
+                                            *sdLocalData[iElemType]->getSolPntIdxsForRecOptim());
+      }
+    }
+  }
+
   // resize m_cellExtraVars
   m_cellExtraVars.resize(maxNbrSolPnts);
 
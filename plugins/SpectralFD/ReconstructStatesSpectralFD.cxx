@@ -199,6 +199,59 @@ void ReconstructStatesSpectralFD::reconstructGradients(const vector< vector< Rea
 
 //////////////////////////////////////////////////////////////////////////////
 
+void ReconstructStatesSpectralFD::reconstructBlock(const vector< CFreal >& cellBlock,
+                                                   vector< CFreal >& recBlock,
+                                                   const CFuint nbrCols,
+                                                   const RealMatrix& recCoefs,
+                                                   const vector< CFuint >& recStateIdxs,
+                                                   const vector< CFuint >& recStateMatrixIdxs,
+                                                   const vector< vector< CFuint > >& cellStateIdxs)
+{
+  // number of states to be reconstructed
+  const CFuint nbrRecStates = recStateIdxs.size();
+
+  recBlock.resize(nbrRecStates*nbrCols);
+
+  // the columns are processed in panels, so that the panel of the cell block
+  // stays in cache while all the reconstructed states are computed
+  const CFuint panelSize = 256;
+  for (CFuint startCol = 0; startCol < nbrCols; startCol += panelSize)
+  {
+    const CFuint endCol = startCol + panelSize < nbrCols ? startCol + panelSize : nbrCols;
+    for (CFuint iRecState = 0; iRecState < nbrRecStates; ++iRecState)
+    {
+      // index of the state that has to be reconstructed
+      const CFuint recStateIdx = recStateIdxs[iRecState];
+
+      // index in the matrix corresponding to this reconstructed state
+      const CFuint recStateMatrixIdx = recStateMatrixIdxs[recStateIdx];
+
+      // indexes of cell states involved in reconstruction
+      const vector< CFuint >& cellStateIdxsForRec = cellStateIdxs[recStateIdx];
+      const CFuint nbrCellStatesInRec = cellStateIdxsForRec.size();
+
+      CFreal *const recRow = &recBlock[iRecState*nbrCols];
+      for (CFuint iCol = startCol; iCol < endCol; ++iCol)
+      {
+        recRow[iCol] = 0.0;
+      }
+
+      for (CFuint iCellState = 0; iCellState < nbrCellStatesInRec; ++iCellState)
+      {
+        const CFreal coef = recCoefs(recStateMatrixIdx,iCellState);
+        cf_assert((cellStateIdxsForRec[iCellState]+1)*nbrCols <= cellBlock.size());
+        const CFreal *const cellRow = &cellBlock[cellStateIdxsForRec[iCellState]*nbrCols];
+        for (CFuint iCol = startCol; iCol < endCol; ++iCol)
+        {
+          recRow[iCol] += coef*cellRow[iCol];
+        }
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 void ReconstructStatesSpectralFD::reconstructPhysVar(const CFuint iVar,
                                                      const vector< State* >& cellStates,
                                                      vector< State* >& recStates,
@@ -72,6 +72,22 @@ public:  // methods
                             const std::vector< CFuint >& recGradMatrixIdxs,
                             const std::vector< std::vector< CFuint > >& cellGradIdxs);
 
+  /**
+   * reconstruct the data of a batch of cells of the same type, with one pass
+   * over the cell block per reconstructed point
+   * @param cellBlock data in the cell states, cellBlock[iCellState*nbrCols + iCol],
+   *                  where the columns run over the variables of all the cells in the batch
+   * @param recBlock  reconstructed data, recBlock[iRecState*nbrCols + iCol]
+   * @param nbrCols   number of columns in the blocks
+   */
+  void reconstructBlock(const std::vector< CFreal >& cellBlock,
+                        std::vector< CFreal >& recBlock,
+                        const CFuint nbrCols,
+                        const RealMatrix& recCoefs,
+                        const std::vector< CFuint >& recStateIdxs,
+                        const std::vector< CFuint >& recStateMatrixIdxs,
+                        const std::vector< std::vector< CFuint > >& cellStateIdxs);
+
   /// reconstruct one physical variable in the given points
   void reconstructPhysVar(const CFuint iVar,
                           const std::vector< Framework::State* >& cellStates,
@@ -12,6 +12,7 @@
 #include "SpectralFD/RiemannFlux.hh"
 #include "SpectralFD/SpectralFDMethod.hh"
 #include "SpectralFD/SpectralFD.hh"
+#include "Framework/Profiler.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -495,13 +496,13 @@ void SpectralFDMethod::initializeSolutionImpl(bool isRestart)
     for(CFuint i = 0; i < m_inits.size(); ++i)
     {
       cf_assert(m_inits[i].isNotNull());
-      m_inits[i]->execute();
+      profileExecute(m_inits[i]);
     }
   }
 
   // apply a limiter to the solution
   cf_assert(m_limiter.isNotNull());
-  m_limiter->execute();
+  profileExecute(m_limiter);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -521,13 +522,13 @@ void SpectralFDMethod::computeSpaceResidualImpl(CFreal factor)
 
   // compute the face terms of the SV discretization of the convective terms
   cf_assert(m_convFaceTerm.isNotNull());
-  m_convFaceTerm->execute();
+  profileExecute(m_convFaceTerm);
 
   // compute the volume terms of the SV discretization of the convective terms
   // should be placed after the computation of the convective boundary conditions and the convective face terms
   // for proper computation of the gradients
   cf_assert(m_convVolTerm.isNotNull());
-  m_convVolTerm->execute();
+  profileExecute(m_convVolTerm);
 
   // if there is a diffusive term, compute the diffusive contributions to the residual
   if (m_data->hasDiffTerm() && m_data->separateConvDiffComs())
@@ -537,18 +538,18 @@ void SpectralFDMethod::computeSpaceResidualImpl(CFreal factor)
 
     // compute the face terms of the SV discretization of the diffusive terms
     cf_assert(m_diffFaceTerm.isNotNull());
-    m_diffFaceTerm->execute();
+    profileExecute(m_diffFaceTerm);
 
     // compute the volume terms of the SV discretization of the diffusive terms
     cf_assert(m_diffVolTerm.isNotNull());
-    m_diffVolTerm->execute();
+    profileExecute(m_diffVolTerm);
   }
 
   // add source terms
   addSourceTermsImpl();
 
   // divide by volume/Jacobian determinant
-  m_divideRHSByCellVol->execute();
+  profileExecute(m_divideRHSByCellVol);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -564,7 +565,7 @@ void SpectralFDMethod::computeTimeResidualImpl(CFreal factor)
   m_data->setResFactor(factor);
 
   // compute the time contribution to the jacobian
-  m_timeRHSJacob->execute();
+  profileExecute(m_timeRHSJacob);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -615,7 +616,7 @@ void SpectralFDMethod::extrapolateStatesToNodesImpl()
   CFAUTOTRACE;
 
   cf_assert(m_extrapolate.isNotNull());
-  m_extrapolate->execute();
+  profileExecute(m_extrapolate);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -628,7 +629,7 @@ void SpectralFDMethod::applyBCImpl()
   for(CFuint iBc = 0; iBc < nbrBcs; ++iBc)
   {
     cf_assert(m_bcsComs[iBc].isNotNull());
-    m_bcsComs[iBc]->execute();
+    profileExecute(m_bcsComs[iBc]);
   }
 }
 
@@ -642,7 +643,7 @@ void SpectralFDMethod::applyBCDiffImpl()
   for(CFuint iBc = 0; iBc < nbrBcs; ++iBc)
   {
     cf_assert(m_bcsDiffComs[iBc].isNotNull());
-    m_bcsDiffComs[iBc]->execute();
+    profileExecute(m_bcsDiffComs[iBc]);
   }
 }
 
@@ -656,7 +657,7 @@ void SpectralFDMethod::addSourceTermsImpl()
   for(CFuint iSrc = 0; iSrc < nbrSrcTerms; ++iSrc)
   {
     cf_assert(m_srcTerms[iSrc].isNotNull());
-    m_srcTerms[iSrc]->execute();
+    profileExecute(m_srcTerms[iSrc]);
   }
 }
 
@@ -667,7 +668,7 @@ void SpectralFDMethod::prepareComputationImpl()
   CFAUTOTRACE;
 
   cf_assert(m_prepare.isNotNull());
-  m_prepare->execute();
+  profileExecute(m_prepare);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -677,7 +678,7 @@ void SpectralFDMethod::postProcessSolutionImpl()
   CFAUTOTRACE;
 
   cf_assert(m_limiter.isNotNull());
-  m_limiter->execute();
+  profileExecute(m_limiter);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -688,7 +689,7 @@ void SpectralFDMethod::computeSpaceRhsForStatesSetImpl(CFreal factor)
   m_data->setResFactor(factor);
 
   cf_assert(m_spaceRHSForGivenCell.isNotNull());
-  m_spaceRHSForGivenCell->execute();
+  profileExecute(m_spaceRHSForGivenCell);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -699,7 +700,7 @@ void SpectralFDMethod::computeTimeRhsForStatesSetImpl(CFreal factor)
   m_data->setResFactor(factor);
 
   cf_assert(m_timeRHSForGivenCell.isNotNull());
-  m_timeRHSForGivenCell->execute();
+  profileExecute(m_timeRHSForGivenCell);
 }
 
 //////////////////////////////////////////////////////////////////////////////
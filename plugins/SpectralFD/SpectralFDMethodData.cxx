@@ -45,6 +45,7 @@ void SpectralFDMethodData::defineConfigOptions(Config::OptionList& options)
   options.addConfigOption< std::vector<std::string> >("BcTypes","Types of the boundary condition commands.");
   options.addConfigOption< std::vector<std::string> >("BcNames","Names of the boundary condition commands.");
   options.addConfigOption< bool >("ComputeVolumeForEachState" ,"Boolean telling whether to create a socket with the volume for each state, needed for some unsteady algorithms.");
+  options.addConfigOption< CFuint >("CellBatchSize","Number of cells of the same type for which the volume term reconstructions are computed together as matrix-matrix products (0 or 1 means cell by cell).");
   options.addConfigOption< std::string >("InterpolationType","string defining the interpolation type to use (standard or optimized)");
 }
 
@@ -88,6 +89,7 @@ SpectralFDMethodData::SpectralFDMethodData(Common::SafePtr<Framework::Method> ow
   m_hasDiffTerm(),
   m_resFactor(),
   m_createVolumesSocketBool(),
+  m_cellBatchSize(),
   m_interpolationType(),
   m_3StepsTMSparams(),
   m_updateToSolutionVecTrans()
@@ -116,6 +118,9 @@ SpectralFDMethodData::SpectralFDMethodData(Common::SafePtr<Framework::Method> ow
   m_createVolumesSocketBool = false;
   setParameter("ComputeVolumeForEachState", &m_createVolumesSocketBool);
 
+  m_cellBatchSize = 0;
+  setParameter("CellBatchSize", &m_cellBatchSize);
+
   m_interpolationType = "standard";
   setParameter("InterpolationType", &m_interpolationType);
 
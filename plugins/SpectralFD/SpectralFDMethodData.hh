@@ -250,6 +250,12 @@ public: // functions
     return m_createVolumesSocketBool;
   }
 
+  /// @return m_cellBatchSize
+  CFuint getCellBatchSize()
+  {
+    return m_cellBatchSize;
+  }
+
   std::string getInterpolationType()
   {
     return m_interpolationType;
@@ -434,6 +440,9 @@ private:  // data
   /// boolean telling wheter the socket containing the volume for each state (!= cell) has to be created
   bool m_createVolumesSocketBool;
 
+  /// number of cells for which the volume term reconstructions are computed together
+  CFuint m_cellBatchSize;
+
   /// string defining the interpolation type to use ("standard" or "optimized")
   std::string m_interpolationType;
 
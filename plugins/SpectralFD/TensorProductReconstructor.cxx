@@ -0,0 +1,240 @@
+#include <map>
+
+#include "Framework/State.hh"
+
+#include "SpectralFD/TensorProductReconstructor.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace SpectralFD {
+
+//////////////////////////////////////////////////////////////////////////////
+
+TensorProductReconstructor::TensorProductReconstructor() :
+  m_nbrSolPnts1D(0),
+  m_nbrLines(0),
+  m_lineSolIdxs(),
+  m_linePtr(),
+  m_recIdxs(),
+  m_recCoefs(),
+  m_cellBlock(),
+  m_lineBlock(),
+  m_recBlock()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+TensorProductReconstructor::~TensorProductReconstructor()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void TensorProductReconstructor::setup(const RealMatrix& recCoefs,
+                                       const vector< CFuint >& recStateIdxs,
+                                       const vector< CFuint >& recStateMatrixIdxs,
+                                       const vector< vector< CFuint > >& cellStateIdxs)
+{
+  m_nbrSolPnts1D = 0;
+  m_nbrLines = 0;
+  m_lineSolIdxs.resize(0);
+  m_linePtr.resize(0);
+  m_recIdxs.resize(0);
+  m_recCoefs.resize(0);
+
+  const CFuint nbrRecPnts = recStateIdxs.size();
+  if (nbrRecPnts == 0)
+  {
+    return;
+  }
+
+  // group the reconstructed points by line of solution points
+  const CFuint nbrSolPnts1D = cellStateIdxs[recStateIdxs[0]].size();
+  map< vector< CFuint >, CFuint > lineIdxs;
+  vector< vector< CFuint > > lineRecPnts;
+  for (CFuint iRec = 0; iRec < nbrRecPnts; ++iRec)
+  {
+    const vector< CFuint >& solIdxs = cellStateIdxs[recStateIdxs[iRec]];
+    if (solIdxs.size() != nbrSolPnts1D || recCoefs.nbCols() < nbrSolPnts1D)
+    {
+      // not a tensor product reconstruction
+      return;
+    }
+
+    map< vector< CFuint >, CFuint >::iterator it = lineIdxs.find(solIdxs);
+    if (it == lineIdxs.end())
+    {
+      it = lineIdxs.insert(make_pair(solIdxs,static_cast<CFuint>(lineRecPnts.size()))).first;
+      lineRecPnts.push_back(vector< CFuint >());
+    }
+    lineRecPnts[it->second].push_back(iRec);
+  }
+
+  // store the lines contiguously
+  m_nbrSolPnts1D = nbrSolPnts1D;
+  m_nbrLines = lineRecPnts.size();
+  m_lineSolIdxs.resize(m_nbrLines*m_nbrSolPnts1D);
+  m_linePtr.resize(m_nbrLines+1);
+  m_linePtr[0] = 0;
+  for (map< vector< CFuint >, CFuint >::const_iterator it = lineIdxs.begin(); it != lineIdxs.end(); ++it)
+  {
+    for (CFuint iPnt = 0; iPnt < m_nbrSolPnts1D; ++iPnt)
+    {
+      m_lineSolIdxs[it->second*m_nbrSolPnts1D + iPnt] = it->first[iPnt];
+    }
+  }
+  for (CFuint iLine = 0; iLine < m_nbrLines; ++iLine)
+  {
+    const vector< CFuint >& recPnts = lineRecPnts[iLine];
+    for (CFuint iPnt = 0; iPnt < recPnts.size(); ++iPnt)
+    {
+      const CFuint iRec = recPnts[iPnt];
+      const CFuint matrixIdx = recStateMatrixIdxs[recStateIdxs[iRec]];
+      m_recIdxs.push_back(iRec);
+      for (CFuint iSol = 0; iSol < m_nbrSolPnts1D; ++iSol)
+      {
+        m_recCoefs.push_back(recCoefs(matrixIdx,iSol));
+      }
+    }
+    m_linePtr[iLine+1] = m_recIdxs.size();
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void TensorProductReconstructor::reconstructStates(const vector< State* >& cellStates,
+                                                   vector< State* >& recStates)
+{
+  cf_assert(isSetup());
+  cf_assert(cellStates.size() > 0);
+
+  const CFuint nbrCellPnts = cellStates.size();
+  const CFuint nbrVars = cellStates[0]->size();
+
+  // gather the cell states
+  m_cellBlock.resize(nbrVars*nbrCellPnts);
+  for (CFuint iSol = 0; iSol < nbrCellPnts; ++iSol)
+  {
+    const State& cellState = *cellStates[iSol];
+    for (CFuint iVar = 0; iVar < nbrVars; ++iVar)
+    {
+      m_cellBlock[iVar*nbrCellPnts + iSol] = cellState[iVar];
+    }
+  }
+
+  applyLineOperators(nbrVars,nbrCellPnts);
+
+  // scatter the reconstructed states
+  const CFuint nbrRecPnts = m_recIdxs.size();
+  cf_assert(nbrRecPnts <= recStates.size());
+  for (CFuint iRec = 0; iRec < nbrRecPnts; ++iRec)
+  {
+    State& recState = *recStates[iRec];
+    const CFreal *const recData = &m_recBlock[iRec*nbrVars];
+    for (CFuint iVar = 0; iVar < nbrVars; ++iVar)
+    {
+      recState[iVar] = recData[iVar];
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void TensorProductReconstructor::reconstructGradients(const vector< vector< RealVector >* >& cellGradients,
+                                                      vector< vector< RealVector* > >& recGradients)
+{
+  cf_assert(isSetup());
+  cf_assert(cellGradients.size() > 0);
+  cf_assert(cellGradients[0]->size() > 0);
+
+  const CFuint nbrCellPnts = cellGradients.size();
+  const CFuint nbrVars = cellGradients[0]->size();
+  const CFuint dim = (*cellGradients[0])[0].size();
+  const CFuint nbrComps = nbrVars*dim;
+
+  // gather the cell gradients
+  m_cellBlock.resize(nbrComps*nbrCellPnts);
+  for (CFuint iSol = 0; iSol < nbrCellPnts; ++iSol)
+  {
+    const vector< RealVector >& cellGrad = *cellGradients[iSol];
+    for (CFuint iVar = 0; iVar < nbrVars; ++iVar)
+    {
+      for (CFuint iDim = 0; iDim < dim; ++iDim)
+      {
+        m_cellBlock[(iVar*dim + iDim)*nbrCellPnts + iSol] = cellGrad[iVar][iDim];
+      }
+    }
+  }
+
+  applyLineOperators(nbrComps,nbrCellPnts);
+
+  // scatter the reconstructed gradients
+  const CFuint nbrRecPnts = m_recIdxs.size();
+  cf_assert(nbrRecPnts <= recGradients.size());
+  for (CFuint iRec = 0; iRec < nbrRecPnts; ++iRec)
+  {
+    const CFreal* recData = &m_recBlock[iRec*nbrComps];
+    for (CFuint iVar = 0; iVar < nbrVars; ++iVar)
+    {
+      RealVector& recGrad = *recGradients[iRec][iVar];
+      for (CFuint iDim = 0; iDim < dim; ++iDim, ++recData)
+      {
+        recGrad[iDim] = *recData;
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void TensorProductReconstructor::applyLineOperators(const CFuint nbrComps, const CFuint nbrCellPnts)
+{
+  m_lineBlock.resize(nbrComps*m_nbrSolPnts1D);
+  m_recBlock.resize(m_recIdxs.size()*nbrComps);
+
+  for (CFuint iLine = 0; iLine < m_nbrLines; ++iLine)
+  {
+    // gather the data of the solution points on this line
+    const CFuint *const solIdxs = &m_lineSolIdxs[iLine*m_nbrSolPnts1D];
+    for (CFuint iComp = 0; iComp < nbrComps; ++iComp)
+    {
+      const CFreal *const cellData = &m_cellBlock[iComp*nbrCellPnts];
+      CFreal *const lineData = &m_lineBlock[iComp*m_nbrSolPnts1D];
+      for (CFuint iSol = 0; iSol < m_nbrSolPnts1D; ++iSol)
+      {
+        lineData[iSol] = cellData[solIdxs[iSol]];
+      }
+    }
+
+    // apply the 1D operator
+    for (CFuint iPnt = m_linePtr[iLine]; iPnt < m_linePtr[iLine+1]; ++iPnt)
+    {
+      const CFreal *const coefs = &m_recCoefs[iPnt*m_nbrSolPnts1D];
+      CFreal *const recData = &m_recBlock[m_recIdxs[iPnt]*nbrComps];
+      for (CFuint iComp = 0; iComp < nbrComps; ++iComp)
+      {
+        const CFreal *const lineData = &m_lineBlock[iComp*m_nbrSolPnts1D];
+        CFreal sum = 0.0;
+        for (CFuint iSol = 0; iSol < m_nbrSolPnts1D; ++iSol)
+        {
+          sum += coefs[iSol]*lineData[iSol];
+        }
+        recData[iComp] = sum;
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  }  // namespace SpectralFD
+
+}  // namespace COOLFluiD
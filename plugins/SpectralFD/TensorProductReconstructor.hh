@@ -0,0 +1,112 @@
+#ifndef COOLFluiD_Numerics_SpectralFD_TensorProductReconstructor_hh
+#define COOLFluiD_Numerics_SpectralFD_TensorProductReconstructor_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "Common/COOLFluiD.hh"
+
+#include "MathTools/RealMatrix.hh"
+#include "MathTools/RealVector.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Framework {
+    class State;
+  }
+
+  namespace SpectralFD {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class reconstructs the solution and its gradients in the flux points of
+/// a tensor product cell (quadrangle, hexahedron) by applying the 1D reconstruction
+/// operator line by line, direction by direction.
+/// The flux points that share the same line of solution points are grouped, the
+/// cell data are gathered once per cell in a structure of arrays (one contiguous
+/// block per variable) and the 1D coefficients are stored contiguously, so that
+/// the innermost loops run over unit-stride data.
+class TensorProductReconstructor {
+
+public: // functions
+
+  /// Constructor
+  TensorProductReconstructor();
+
+  /// Destructor
+  ~TensorProductReconstructor();
+
+  /**
+   * Set up the lines of solution points from the data used by the
+   * ReconstructStatesSpectralFD for the same points
+   * @param recCoefs           1D reconstruction coefficients
+   * @param recStateIdxs       indexes of the points to be reconstructed
+   * @param recStateMatrixIdxs row in recCoefs of each point
+   * @param cellStateIdxs      solution points used for each point
+   */
+  void setup(const RealMatrix& recCoefs,
+             const std::vector< CFuint >& recStateIdxs,
+             const std::vector< CFuint >& recStateMatrixIdxs,
+             const std::vector< std::vector< CFuint > >& cellStateIdxs);
+
+  /// @return true if the lines have been set up
+  bool isSetup() const
+  {
+    return m_nbrLines > 0;
+  }
+
+  /// reconstruct the states in the points
+  void reconstructStates(const std::vector< Framework::State* >& cellStates,
+                         std::vector< Framework::State* >& recStates);
+
+  /// reconstruct the gradients in the points
+  void reconstructGradients(const std::vector< std::vector< RealVector >* >& cellGradients,
+                            std::vector< std::vector< RealVector* > >& recGradients);
+
+private: // functions
+
+  /// apply the 1D operators to the cell data block with nbrComps components
+  /// per solution point, stored as m_cellBlock[iComp*nbrCellPnts + iSol]
+  void applyLineOperators(const CFuint nbrComps, const CFuint nbrCellPnts);
+
+private: // data
+
+  /// number of solution points in a line
+  CFuint m_nbrSolPnts1D;
+
+  /// number of lines
+  CFuint m_nbrLines;
+
+  /// solution point indexes of each line, m_lineSolIdxs[iLine*m_nbrSolPnts1D + iPnt]
+  std::vector< CFuint > m_lineSolIdxs;
+
+  /// first reconstructed point of each line in m_recIdxs
+  std::vector< CFuint > m_linePtr;
+
+  /// index (in the vector of reconstructed states) of each reconstructed point
+  std::vector< CFuint > m_recIdxs;
+
+  /// 1D coefficients of each reconstructed point, m_recCoefs[iRec*m_nbrSolPnts1D + iPnt]
+  std::vector< CFreal > m_recCoefs;
+
+  /// cell data, one contiguous block per component
+  std::vector< CFreal > m_cellBlock;
+
+  /// data of the current line, one contiguous block per component
+  std::vector< CFreal > m_lineBlock;
+
+  /// reconstructed data, m_recBlock[iRec*nbrComps + iComp]
+  std::vector< CFreal > m_recBlock;
+
+}; // class TensorProductReconstructor
+
+//////////////////////////////////////////////////////////////////////////////
+
+  }  // namespace SpectralFD
+
+}  // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif  // COOLFluiD_Numerics_SpectralFD_TensorProductReconstructor_hh
@@ -33,7 +33,13 @@ BaseVolTermComputer::BaseVolTermComputer(const std::string& name) :
   m_backupPhysVar(),
   m_nbrFlxPnts(),
   m_nbrEqs(),
-  m_nbrExtraVars()
+  m_nbrExtraVars(),
+  m_batchCellBlock(),
+  m_batchSolInFlxPnts(),
+  m_batchGradInFlxPnts(),
+  m_nbrBatchCells(0),
+  m_nbrBatchGradCells(0),
+  m_nbrBatchGradComps(0)
 {
   CFAUTOTRACE;
 }
@@ -79,6 +85,117 @@ void BaseVolTermComputer::reconstructGradients(const vector< vector< RealVector
 
 //////////////////////////////////////////////////////////////////////////////
 
+void BaseVolTermComputer::reconstructStatesBatch(const vector< State* >& batchStates, const CFuint nbrCells)
+{
+  cf_assert(nbrCells > 0);
+  cf_assert(batchStates.size() % nbrCells == 0);
+  const CFuint nbrSolPnts = batchStates.size()/nbrCells;
+  const CFuint nbrCols = nbrCells*m_nbrEqs;
+
+  // gather the states, one row per solution point
+  m_batchCellBlock.resize(nbrSolPnts*nbrCols);
+  for (CFuint iCell = 0; iCell < nbrCells; ++iCell)
+  {
+    for (CFuint iSol = 0; iSol < nbrSolPnts; ++iSol)
+    {
+      const State& cellState = *batchStates[iCell*nbrSolPnts + iSol];
+      CFreal *const cellData = &m_batchCellBlock[iSol*nbrCols + iCell*m_nbrEqs];
+      for (CFuint iEq = 0; iEq < m_nbrEqs; ++iEq)
+      {
+        cellData[iEq] = cellState[iEq];
+      }
+    }
+  }
+
+  // reconstruct
+  m_statesReconstr->reconstructBlock(m_batchCellBlock,m_batchSolInFlxPnts,
+                                     *m_flxPntsRecCoefs,nbrSolPnts,nbrCols);
+  m_nbrBatchCells = nbrCells;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BaseVolTermComputer::reconstructGradientsBatch(const vector< vector< RealVector >* >& batchGradients,
+                                                    const CFuint nbrCells)
+{
+  cf_assert(nbrCells > 0);
+  cf_assert(batchGradients.size() % nbrCells == 0);
+  const CFuint nbrSolPnts = batchGradients.size()/nbrCells;
+  const CFuint nbrGradVars = batchGradients[0]->size();
+  const CFuint dim = (*batchGradients[0])[0].size();
+  const CFuint nbrComps = nbrGradVars*dim;
+  const CFuint nbrCols = nbrCells*nbrComps;
+
+  // gather the gradients, one row per solution point
+  m_batchCellBlock.resize(nbrSolPnts*nbrCols);
+  for (CFuint iCell = 0; iCell < nbrCells; ++iCell)
+  {
+    for (CFuint iSol = 0; iSol < nbrSolPnts; ++iSol)
+    {
+      const vector< RealVector >& cellGrad = *batchGradients[iCell*nbrSolPnts + iSol];
+      CFreal* cellData = &m_batchCellBlock[iSol*nbrCols + iCell*nbrComps];
+      for (CFuint iVar = 0; iVar < nbrGradVars; ++iVar)
+      {
+        for (CFuint iDim = 0; iDim < dim; ++iDim, ++cellData)
+        {
+          *cellData = cellGrad[iVar][iDim];
+        }
+      }
+    }
+  }
+
+  // reconstruct
+  m_statesReconstr->reconstructBlock(m_batchCellBlock,m_batchGradInFlxPnts,
+                                     *m_flxPntsRecCoefs,nbrSolPnts,nbrCols);
+  m_nbrBatchGradCells = nbrCells;
+  m_nbrBatchGradComps = nbrComps;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BaseVolTermComputer::setBatchCellStates(const CFuint iCell)
+{
+  cf_assert(iCell < m_nbrBatchCells);
+  const CFuint nbrCols = m_nbrBatchCells*m_nbrEqs;
+  const CFuint nbrRecStates = m_batchSolInFlxPnts.size()/nbrCols;
+  cf_assert(nbrRecStates <= m_solInFlxPnts.size());
+  for (CFuint iFlx = 0; iFlx < nbrRecStates; ++iFlx)
+  {
+    State& recState = *m_solInFlxPnts[iFlx];
+    const CFreal *const recData = &m_batchSolInFlxPnts[iFlx*nbrCols + iCell*m_nbrEqs];
+    for (CFuint iEq = 0; iEq < m_nbrEqs; ++iEq)
+    {
+      recState[iEq] = recData[iEq];
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BaseVolTermComputer::setBatchCellGradients(const CFuint iCell)
+{
+  cf_assert(iCell < m_nbrBatchGradCells);
+  const CFuint nbrCols = m_nbrBatchGradCells*m_nbrBatchGradComps;
+  const CFuint nbrRecGrads = m_batchGradInFlxPnts.size()/nbrCols;
+  cf_assert(nbrRecGrads <= m_gradInFlxPnts.size());
+  for (CFuint iFlx = 0; iFlx < nbrRecGrads; ++iFlx)
+  {
+    const CFreal* recData = &m_batchGradInFlxPnts[iFlx*nbrCols + iCell*m_nbrBatchGradComps];
+    const CFuint nbrGradVars = m_gradInFlxPnts[iFlx].size();
+    for (CFuint iVar = 0; iVar < nbrGradVars; ++iVar)
+    {
+      RealVector& recGrad = *m_gradInFlxPnts[iFlx][iVar];
+      const CFuint dim = recGrad.size();
+      for (CFuint iDim = 0; iDim < dim; ++iDim, ++recData)
+      {
+        recGrad[iDim] = *recData;
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 void BaseVolTermComputer::backupAndReconstructPhysVar(const CFuint iVar, const vector< State* >& cellStates)
 {
   // backup
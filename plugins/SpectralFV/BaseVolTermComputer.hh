@@ -81,6 +81,37 @@ public:  // methods
   void reconstructGradients(const std::vector< std::vector< RealVector >* >& cellGradients,
                                     const CFuint nbrCellGrads);
 
+  /**
+   * reconstruct solution in the required points for a batch of cells of the current
+   * element type, as matrix-matrix products on a block gathering all the states
+   * @param batchStates states of the cells, those of cell iCell start at iCell*nbrSolPnts
+   * @param nbrCells    number of cells in the batch
+   * @pre setVolumeTermData()
+   */
+  void reconstructStatesBatch(const std::vector< Framework::State* >& batchStates, const CFuint nbrCells);
+
+  /**
+   * reconstruct gradients in the required points for a batch of cells of the current
+   * element type, as matrix-matrix products on a block gathering all the gradients
+   * @param batchGradients gradients of the cells, those of cell iCell start at iCell*nbrSolPnts
+   * @param nbrCells       number of cells in the batch
+   * @pre setVolumeTermData()
+   */
+  void reconstructGradientsBatch(const std::vector< std::vector< RealVector >* >& batchGradients,
+                                 const CFuint nbrCells);
+
+  /**
+   * set the solution in the required points to the one reconstructed for a cell of the batch
+   * @pre reconstructStatesBatch()
+   */
+  void setBatchCellStates(const CFuint iCell);
+
+  /**
+   * set the gradients in the required points to the ones reconstructed for a cell of the batch
+   * @pre reconstructGradientsBatch()
+   */
+  void setBatchCellGradients(const CFuint iCell);
+
   /**
    * backup and reconstruct physical variable in the required points
    * @pre setVolumeTermData()
@@ -186,6 +217,24 @@ protected: // data
   /// number of extra variables in the physical model
   CFuint m_nbrExtraVars;
 
+  /// data in the solution points of the current batch of cells, one row per solution point
+  std::vector< CFreal > m_batchCellBlock;
+
+  /// solution in the flux points of the current batch of cells, one row per flux point
+  std::vector< CFreal > m_batchSolInFlxPnts;
+
+  /// gradients in the flux points of the current batch of cells, one row per flux point
+  std::vector< CFreal > m_batchGradInFlxPnts;
+
+  /// number of cells in the current batch of states
+  CFuint m_nbrBatchCells;
+
+  /// number of cells in the current batch of gradients
+  CFuint m_nbrBatchGradCells;
+
+  /// number of gradient components per cell in the current batch of gradients
+  CFuint m_nbrBatchGradComps;
+
 }; // class BaseVolTermComputer
 
 //////////////////////////////////////////////////////////////////////////////
@@ -32,6 +32,7 @@ ConvVolTermRHSSpectralFV::ConvVolTermRHSSpectralFV(const std::string& name) :
   SpectralFVMethodCom(name),
   socket_rhs("rhs"),
   socket_gradients("gradients"),
+  socket_states("states"),
   m_cellBuilder(CFNULL),
   m_volTermComputer(CFNULL),
   m_invVolFracCVs(CFNULL),
@@ -41,6 +42,9 @@ ConvVolTermRHSSpectralFV::ConvVolTermRHSSpectralFV(const std::string& name) :
   m_resUpdates(),
   m_gradUpdates(),
   m_nbrEqs(),
+  m_cellBatchSize(),
+  m_batchStartIdx(),
+  m_batchStates(),
   m_dim()
 {
   addConfigOptionsTo(this);
@@ -101,6 +105,13 @@ void ConvVolTermRHSSpectralFV::execute()
     // loop over cells
     for (CFuint elemIdx = startIdx; elemIdx < endIdx; ++elemIdx)
     {
+      // reconstruct in the flux points of the next batch of cells
+      if (m_cellBatchSize > 1 && (elemIdx - startIdx) % m_cellBatchSize == 0)
+      {
+        const CFuint batchEndIdx = elemIdx + m_cellBatchSize < endIdx ? elemIdx + m_cellBatchSize : endIdx;
+        reconstructBatch(cells,elemIdx,batchEndIdx);
+      }
+
       // build the GeometricEntity
       geoData.idx = elemIdx;
       m_cell = m_cellBuilder->buildGE();
@@ -117,7 +128,14 @@ void ConvVolTermRHSSpectralFV::execute()
         m_volTermComputer->computeCellData();
 
         // reconstruct the solution in the flux points
-        m_volTermComputer->reconstructStates(*m_cellStates);
+        if (m_cellBatchSize > 1)
+        {
+          m_volTermComputer->setBatchCellStates(elemIdx - m_batchStartIdx);
+        }
+        else
+        {
+          m_volTermComputer->reconstructStates(*m_cellStates);
+        }
       }
 
       // if cell is parallel updatable, compute the volume term
@@ -300,6 +318,30 @@ void ConvVolTermRHSSpectralFV::execute()
 
 //////////////////////////////////////////////////////////////////////////////
 
+void ConvVolTermRHSSpectralFV::reconstructBatch(SafePtr< TopologicalRegionSet > cells,
+                                                const CFuint startIdx, const CFuint endIdx)
+{
+  DataHandle< State*, GLOBAL > states = socket_states.getDataHandle();
+
+  // gather the states of the cells in the batch
+  m_batchStates.resize(0);
+  for (CFuint elemIdx = startIdx; elemIdx < endIdx; ++elemIdx)
+  {
+    const CFuint nbrSolPnts = cells->getNbStatesInGeo(elemIdx);
+    for (CFuint iSol = 0; iSol < nbrSolPnts; ++iSol)
+    {
+      const CFuint stateID = cells->getStateID(elemIdx,iSol);
+      m_batchStates.push_back(states[stateID]);
+    }
+  }
+
+  // reconstruct in the flux points of all the cells in the batch
+  m_volTermComputer->reconstructStatesBatch(m_batchStates,endIdx - startIdx);
+  m_batchStartIdx = startIdx;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 void ConvVolTermRHSSpectralFV::setVolumeTermData()
 {
   // get the local spectral FV data
@@ -411,6 +453,9 @@ void ConvVolTermRHSSpectralFV::setup()
 
   // get the volume term computer
   m_volTermComputer = getMethodData().getVolTermComputer();
+
+  // number of cells for which the reconstructions are computed together
+  m_cellBatchSize = getMethodData().getCellBatchSize();
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -429,6 +474,7 @@ ConvVolTermRHSSpectralFV::needsSockets()
 
   result.push_back(&socket_rhs);
   result.push_back(&socket_gradients);
+  result.push_back(&socket_states);
 
   return result;
 }
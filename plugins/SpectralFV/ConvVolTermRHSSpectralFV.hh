@@ -4,6 +4,7 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "Framework/DataSocketSink.hh"
+#include "Framework/TopologicalRegionSet.hh"
 
 #include "SpectralFV/BaseVolTermComputer.hh"
 #include "SpectralFV/SpectralFVMethodData.hh"
@@ -86,6 +87,10 @@ protected: // functions
   /// add updates to gradients
   void addGradVolTermsAndDivideByCellVolume();
 
+  /// reconstruct the solution in the flux points of the cells in a batch
+  void reconstructBatch(Common::SafePtr< Framework::TopologicalRegionSet > cells,
+                        const CFuint startIdx, const CFuint endIdx);
+
 protected: // data
 
   /// storage of the rhs
@@ -94,6 +99,9 @@ protected: // data
   /// socket for gradients
   Framework::DataSocketSink< std::vector< RealVector > > socket_gradients;
 
+  /// storage of the states
+  Framework::DataSocketSink< Framework::State*, Framework::GLOBAL > socket_states;
+
   /// builder of cells
   Common::SafePtr<Framework::GeometricEntityPool<Framework::StdTrsGeoBuilder> > m_cellBuilder;
 
@@ -121,6 +129,15 @@ protected: // data
   /// number of equations in the physical model
   CFuint m_nbrEqs;
 
+  /// number of cells for which the reconstructions are computed together
+  CFuint m_cellBatchSize;
+
+  /// index of the first cell in the current batch
+  CFuint m_batchStartIdx;
+
+  /// states of the cells in the current batch
+  std::vector< Framework::State* > m_batchStates;
+
   /// number of dimensions in the physical model
   CFuint m_dim;
 
@@ -30,6 +30,7 @@ DiffVolTermRHSSpectralFV::DiffVolTermRHSSpectralFV(const std::string& name) :
   SpectralFVMethodCom(name),
   socket_rhs("rhs"),
   socket_gradients("gradients"),
+  socket_states("states"),
   m_cellBuilder(CFNULL),
   m_volTermComputer(CFNULL),
   m_iElemType(),
@@ -37,7 +38,11 @@ DiffVolTermRHSSpectralFV::DiffVolTermRHSSpectralFV(const std::string& name) :
   m_cellStates(),
   m_cellGrads(CFNULL),
   m_resUpdates(),
-  m_nbrEqs()
+  m_nbrEqs(),
+  m_cellBatchSize(),
+  m_batchStartIdx(),
+  m_batchStates(),
+  m_batchGrads()
 {
   addConfigOptionsTo(this);
 }
@@ -94,6 +99,13 @@ void DiffVolTermRHSSpectralFV::execute()
     // loop over cells
     for (CFuint elemIdx = startIdx; elemIdx < endIdx; ++elemIdx)
     {
+      // reconstruct in the flux points of the next batch of cells
+      if (m_cellBatchSize > 1 && (elemIdx - startIdx) % m_cellBatchSize == 0)
+      {
+        const CFuint batchEndIdx = elemIdx + m_cellBatchSize < endIdx ? elemIdx + m_cellBatchSize : endIdx;
+        reconstructBatch(cells,elemIdx,batchEndIdx);
+      }
+
       // build the GeometricEntity
       geoData.idx = elemIdx;
       m_cell = m_cellBuilder->buildGE();
@@ -112,10 +124,24 @@ void DiffVolTermRHSSpectralFV::execute()
         m_volTermComputer->computeCellData();
 
         // reconstruct the solution in the flux points
-        m_volTermComputer->reconstructStates(*m_cellStates);
+        if (m_cellBatchSize > 1)
+        {
+          m_volTermComputer->setBatchCellStates(elemIdx - m_batchStartIdx);
+        }
+        else
+        {
+          m_volTermComputer->reconstructStates(*m_cellStates);
+        }
 
         // reconstruct the gradients in the flux points
-        m_volTermComputer->reconstructGradients(m_cellGrads,m_cellGrads.size());
+        if (m_cellBatchSize > 1)
+        {
+          m_volTermComputer->setBatchCellGradients(elemIdx - m_batchStartIdx);
+        }
+        else
+        {
+          m_volTermComputer->reconstructGradients(m_cellGrads,m_cellGrads.size());
+        }
 
         // compute the volume term
         m_volTermComputer->computeCellDiffVolumeTerm(m_resUpdates);
@@ -289,6 +315,34 @@ void DiffVolTermRHSSpectralFV::execute()
 
 //////////////////////////////////////////////////////////////////////////////
 
+void DiffVolTermRHSSpectralFV::reconstructBatch(SafePtr< TopologicalRegionSet > cells,
+                                                const CFuint startIdx, const CFuint endIdx)
+{
+  DataHandle< State*, GLOBAL > states = socket_states.getDataHandle();
+  DataHandle< vector< RealVector > > gradients = socket_gradients.getDataHandle();
+
+  // gather the states and the gradients of the cells in the batch
+  m_batchStates.resize(0);
+  m_batchGrads.resize(0);
+  for (CFuint elemIdx = startIdx; elemIdx < endIdx; ++elemIdx)
+  {
+    const CFuint nbrSolPnts = cells->getNbStatesInGeo(elemIdx);
+    for (CFuint iSol = 0; iSol < nbrSolPnts; ++iSol)
+    {
+      const CFuint stateID = cells->getStateID(elemIdx,iSol);
+      m_batchStates.push_back(states[stateID]);
+      m_batchGrads.push_back(&gradients[stateID]);
+    }
+  }
+
+  // reconstruct in the flux points of all the cells in the batch
+  m_volTermComputer->reconstructStatesBatch(m_batchStates,endIdx - startIdx);
+  m_volTermComputer->reconstructGradientsBatch(m_batchGrads,endIdx - startIdx);
+  m_batchStartIdx = startIdx;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 void DiffVolTermRHSSpectralFV::setVolumeTermData()
 {
   // set the volume term data in the volume term computer
@@ -363,6 +417,9 @@ void DiffVolTermRHSSpectralFV::setup()
 
   // get the volume term computer
   m_volTermComputer = getMethodData().getVolTermComputer();
+
+  // number of cells for which the reconstructions are computed together
+  m_cellBatchSize = getMethodData().getCellBatchSize();
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -381,6 +438,7 @@ DiffVolTermRHSSpectralFV::needsSockets()
 
   result.push_back(&socket_rhs);
   result.push_back(&socket_gradients);
+  result.push_back(&socket_states);
 
   return result;
 }
@@ -149,6 +149,49 @@ void ReconstructStatesSpectralFV::reconstructGradients(const vector< vector< Rea
 
 //////////////////////////////////////////////////////////////////////////////
 
+void ReconstructStatesSpectralFV::reconstructBlock(const vector< CFreal >& cellBlock,
+                                                   vector< CFreal >& recBlock,
+                                                   const vector< vector< CFreal > >& recCoefs,
+                                                   const CFuint nbrCellStates,
+                                                   const CFuint nbrCols)
+{
+  // number of states to be reconstructed
+  const CFuint nbrRecStates = recCoefs.size();
+  cf_assert(nbrCellStates*nbrCols <= cellBlock.size());
+
+  recBlock.resize(nbrRecStates*nbrCols);
+
+  // the columns are processed in panels, so that the panel of the cell block
+  // stays in cache while all the reconstructed states are computed
+  const CFuint panelSize = 256;
+  for (CFuint startCol = 0; startCol < nbrCols; startCol += panelSize)
+  {
+    const CFuint endCol = startCol + panelSize < nbrCols ? startCol + panelSize : nbrCols;
+    for (CFuint iRecState = 0; iRecState < nbrRecStates; ++iRecState)
+    {
+      cf_assert(nbrCellStates <= recCoefs[iRecState].size());
+      const vector< CFreal >& coefs = recCoefs[iRecState];
+      CFreal *const recRow = &recBlock[iRecState*nbrCols];
+      for (CFuint iCol = startCol; iCol < endCol; ++iCol)
+      {
+        recRow[iCol] = 0.0;
+      }
+
+      for (CFuint iCellState = 0; iCellState < nbrCellStates; ++iCellState)
+      {
+        const CFreal coef = coefs[iCellState];
+        const CFreal *const cellRow = &cellBlock[iCellState*nbrCols];
+        for (CFuint iCol = startCol; iCol < endCol; ++iCol)
+        {
+          recRow[iCol] += coef*cellRow[iCol];
+        }
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 void ReconstructStatesSpectralFV::reconstructPhysVar
                                               (const CFuint iVar,
                                                const std::vector< Framework::State* >& cellStates,
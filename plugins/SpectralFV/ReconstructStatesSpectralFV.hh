@@ -66,6 +66,21 @@ public:  // methods
                             const std::vector< std::vector< CFreal > >& recCoefs,
                             const CFuint nbrCellGrads);
 
+  /**
+   * reconstruct the data of a batch of cells of the same type as one matrix-matrix product
+   * @param cellBlock     data in the cell states, cellBlock[iCellState*nbrCols + iCol],
+   *                      where the columns run over the variables of all the cells in the batch
+   * @param recBlock      reconstructed data, recBlock[iRecState*nbrCols + iCol]
+   * @param recCoefs      reconstruction coefficients
+   * @param nbrCellStates number of states in a cell
+   * @param nbrCols       number of columns in the blocks
+   */
+  void reconstructBlock(const std::vector< CFreal >& cellBlock,
+                        std::vector< CFreal >& recBlock,
+                        const std::vector< std::vector< CFreal > >& recCoefs,
+                        const CFuint nbrCellStates,
+                        const CFuint nbrCols);
+
   /// reconstruct one physical variable in the given points
   void reconstructPhysVar(const CFuint iVar,
                           const std::vector< Framework::State* >& cellStates,
@@ -5,6 +5,7 @@
 #include "SpectralFV/SpectralFVMethod.hh"
 #include "SpectralFV/SpectralFV.hh"
 #include "Environment/ObjectProvider.hh"
+#include "Framework/Profiler.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -337,7 +338,7 @@ void SpectralFVMethod::initializeSolutionImpl(bool isRestart)
     for(CFuint i = 0; i < m_inits.size(); ++i)
     {
       cf_assert(m_inits[i].isNotNull());
-      m_inits[i]->execute();
+      profileExecute(m_inits[i]);
     }
   }
 }
@@ -359,13 +360,13 @@ void SpectralFVMethod::computeSpaceResidualImpl(CFreal factor)
 
   // compute the face terms of the SV discretization of the convective terms
   cf_assert(m_convFaceTerm.isNotNull());
-  m_convFaceTerm->execute();
+  profileExecute(m_convFaceTerm);
 
   // compute the volume terms of the SV discretization of the convective terms
   // should be placed after the computation of the convective boundary conditions and the convective face terms
   // for proper computation of the gradients
   cf_assert(m_convVolTerm.isNotNull());
-  m_convVolTerm->execute();
+  profileExecute(m_convVolTerm);
 
   // if there is a diffusive term, compute the diffusive contributions to the residual
   if (m_data->hasDiffTerm())
@@ -375,15 +376,15 @@ void SpectralFVMethod::computeSpaceResidualImpl(CFreal factor)
 
     // compute the face terms of the SV discretization of the diffusive terms
     cf_assert(m_diffFaceTerm.isNotNull());
-    m_diffFaceTerm->execute();
+    profileExecute(m_diffFaceTerm);
 
     // compute the volume terms of the SV discretization of the diffusive terms
     cf_assert(m_diffVolTerm.isNotNull());
-    m_diffVolTerm->execute();
+    profileExecute(m_diffVolTerm);
   }
 
   // divide residual by volumes
-  m_divideRHSByCellVol->execute();
+  profileExecute(m_divideRHSByCellVol);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -399,7 +400,7 @@ void SpectralFVMethod::computeTimeResidualImpl(CFreal factor)
   m_data->setResFactor(factor);
 
   // compute the time contribution to the jacobian
-  m_timeRHSJacob->execute();
+  profileExecute(m_timeRHSJacob);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -450,7 +451,7 @@ void SpectralFVMethod::extrapolateStatesToNodesImpl()
   CFAUTOTRACE;
 
   cf_assert(m_extrapolate.isNotNull());
-  m_extrapolate->execute();
+  profileExecute(m_extrapolate);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -463,7 +464,7 @@ void SpectralFVMethod::applyBCImpl()
   for(CFuint iBc = 0; iBc < nbrBcs; ++iBc)
   {
     cf_assert(m_bcs[iBc].isNotNull());
-    m_bcs[iBc]->execute();
+    profileExecute(m_bcs[iBc]);
   }
 }
 
@@ -477,7 +478,7 @@ void SpectralFVMethod::applyBCDiffImpl()
   for(CFuint iBc = 0; iBc < nbrBcs; ++iBc)
   {
     cf_assert(m_bcsDiff[iBc].isNotNull());
-    m_bcsDiff[iBc]->execute();
+    profileExecute(m_bcsDiff[iBc]);
   }
 }
 
@@ -488,7 +489,7 @@ void SpectralFVMethod::prepareComputationImpl()
   CFAUTOTRACE;
 
   cf_assert(m_prepare.isNotNull());
-  m_prepare->execute();
+  profileExecute(m_prepare);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -45,6 +45,7 @@ void SpectralFVMethodData::defineConfigOptions(Config::OptionList& options)
   options.addConfigOption< std::vector<std::string> >("BcTypes","Types of the boundary condition commands.");
   options.addConfigOption< std::vector<std::string> >("BcNames","Names of the boundary condition commands.");
   options.addConfigOption< bool >("ComputeVolumeForEachState" ,"Boolean telling whether to create a socket with the volume for each state, needed for some unsteady algorithms.");
+  options.addConfigOption< CFuint >("CellBatchSize","Number of cells of the same type for which the volume term reconstructions are computed together as matrix-matrix products (0 or 1 means cell by cell).");
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -86,7 +87,8 @@ SpectralFVMethodData::SpectralFVMethodData(Common::SafePtr<Framework::Method> ow
   m_maxNbrRFluxPnts(),
   m_hasDiffTerm(),
   m_resFactor(),
-  m_createVolumesSocketBool()
+  m_createVolumesSocketBool(),
+  m_cellBatchSize()
 {
   CFAUTOTRACE;
   addConfigOptionsTo(this);
@@ -112,6 +114,9 @@ SpectralFVMethodData::SpectralFVMethodData(Common::SafePtr<Framework::Method> ow
   m_createVolumesSocketBool = false;
   setParameter("ComputeVolumeForEachState", &m_createVolumesSocketBool);
 
+  m_cellBatchSize = 0;
+  setParameter("CellBatchSize", &m_cellBatchSize);
+
   // options for bc commands
   m_bcTypeStr = vector<std::string>();
   setParameter("BcTypes",&m_bcTypeStr);
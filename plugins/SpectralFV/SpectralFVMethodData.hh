@@ -240,6 +240,12 @@ public: // functions
     return m_createVolumesSocketBool;
   }
 
+  /// @return m_cellBatchSize
+  CFuint getCellBatchSize()
+  {
+    return m_cellBatchSize;
+  }
+
   /// @return m_bcNameStr
   std::vector< std::string >& getBCNameStr()
   {
@@ -408,6 +414,9 @@ private:  // data
   /// boolean telling wheter the socket containing the volume for each state (!= cell) has to be created
   bool m_createVolumesSocketBool;
 
+  /// number of cells for which the volume term reconstructions are computed together
+  CFuint m_cellBatchSize;
+
 };  // end of class SpectralFVMethodData
 
 //////////////////////////////////////////////////////////////////////////////
@@ -10,6 +10,7 @@
 #include "Framework/CommandGroup.hh"
 #include "Framework/PhysicalModel.hh"
 #include "Framework/NamespaceSwitcher.hh"
+#include "Framework/Profiler.hh"
 #include "SubSystemCoupler/Coupler.hh"
 #include "SubSystemCoupler/SubSystemCoupler.hh"
 
@@ -464,7 +465,7 @@ void Coupler::setMethodImpl()
   cf_assert(m_fullConfigure == 4);
 
   cf_assert(m_setup.isNotNull());
-  m_setup->execute();
+  profileExecute(m_setup);
 
   setupCommandsAndStrategies();
 }
@@ -483,7 +484,7 @@ void Coupler::preProcessReadImpl()
   // preprocess interfaces
   for(CFuint i = 0; i < m_preProcessRead.size(); ++i) {
     cf_assert(m_preProcessRead[i].isNotNull());
-    m_preProcessRead[i]->execute();
+    profileExecute(m_preProcessRead[i]);
   }
 
 }
@@ -498,7 +499,7 @@ void Coupler::preProcessWriteImpl()
   // preprocess interfaces
   for(CFuint i = 0; i < m_preProcessWrite.size(); ++i) {
     cf_assert(m_preProcessWrite[i].isNotNull());
-    m_preProcessWrite[i]->execute();
+    profileExecute(m_preProcessWrite[i]);
   }
 
 }
@@ -519,7 +520,7 @@ void Coupler::meshMatchingReadImpl()
   // match interface meshes
   for(CFuint i = 0; i < m_matchMeshesRead.size(); ++i) {
     cf_assert(m_matchMeshesRead[i].isNotNull());
-    m_matchMeshesRead[i]->execute();
+    profileExecute(m_matchMeshesRead[i]);
   }
 
 }
@@ -534,7 +535,7 @@ void Coupler::meshMatchingWriteImpl()
   // match interface meshes
   for(CFuint i = 0; i < m_matchMeshesWrite.size(); ++i) {
     cf_assert(m_matchMeshesWrite[i].isNotNull());
-    m_matchMeshesWrite[i]->execute();
+    profileExecute(m_matchMeshesWrite[i]);
   }
 }
 
@@ -560,7 +561,7 @@ void Coupler::dataTransferReadImpl()
 
     // Execute and save file if needed...
     if((!(iter % m_transferRates[i])) || (iter ==0) ) {
-      m_interfacesRead[i]->execute();
+      profileExecute(m_interfacesRead[i]);
     }
 
   }
@@ -585,7 +586,7 @@ void Coupler::dataTransferWriteImpl()
 
     // Execute and save file if needed...
     if((!(iter % m_transferRates[i])) || (iter ==0) ) {
-      m_interfacesWrite[i]->execute();
+      profileExecute(m_interfacesWrite[i]);
     }
   }
 }
@@ -597,7 +598,7 @@ void Coupler::unsetMethodImpl()
   for(CFuint i = 0; i < m_postProcess.size(); ++i)
   {
     cf_assert(m_postProcess[i].isNotNull());
-    m_postProcess[i]->execute();
+    profileExecute(m_postProcess[i]);
   }
 
   unsetupCommandsAndStrategies();
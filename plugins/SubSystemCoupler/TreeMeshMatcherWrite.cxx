@@ -0,0 +1,292 @@
+#include <cmath>
+#include <boost/bind.hpp>
+
+#include "Common/ChunkedThreads.hh"
+#include "Framework/MethodCommandProvider.hh"
+#include "Framework/DataHandle.hh"
+#include "Framework/MeshData.hh"
+#include "MathTools/MathConsts.hh"
+#include "SubSystemCoupler/TreeMeshMatcherWrite.hh"
+#include "SubSystemCoupler/SubSystemCoupler.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace COOLFluiD::Common;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::MeshTools;
+using namespace std;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace SubSystemCoupler {
+
+//////////////////////////////////////////////////////////////////////////////
+
+MethodCommandProvider<TreeMeshMatcherWrite, SubSysCouplerData, SubSystemCouplerModule> TreeMeshMatcherWriteProvider("TreeMeshMatcherWrite");
+
+//////////////////////////////////////////////////////////////////////////////
+
+void TreeMeshMatcherWrite::defineConfigOptions(Config::OptionList& options)
+{
+   options.addConfigOption< CFreal >("RematchTolerance","Displacement below which a point keeps the face it was matched with (0 means that all the points are matched again).");
+   options.addConfigOption< CFuint >("MaxFacesInLeaf","Maximum number of faces in each leaf of the search tree.");
+   options.addConfigOption< CFuint >("NbThreads","Number of threads searching the points in the tree.");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+TreeMeshMatcherWrite::TreeMeshMatcherWrite(const std::string& name) :
+  StdMeshMatcherWrite(name),
+  _tree(),
+  _treeFaces(),
+  _matchCache()
+{
+   addConfigOptionsTo(this);
+
+  _rematchTolerance = 0.;
+   setParameter("RematchTolerance",&_rematchTolerance);
+
+  _maxFacesInLeaf = 4;
+   setParameter("MaxFacesInLeaf",&_maxFacesInLeaf);
+
+  _nbThreads = 1;
+   setParameter("NbThreads",&_nbThreads);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+TreeMeshMatcherWrite::~TreeMeshMatcherWrite()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void TreeMeshMatcherWrite::execute()
+{
+  CFAUTOTRACE;
+
+  // the faces of this subsystem may have moved since the last call
+  buildTree();
+
+  StdMeshMatcherWrite::execute();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void TreeMeshMatcherWrite::buildTree()
+{
+  CFAUTOTRACE;
+
+  const CFuint dim = PhysicalModelStack::getActive()->getDim();
+  if (_tree.get() == CFNULL) {
+    _tree.reset(new WallDistanceTree(dim, _maxFacesInLeaf));
+  }
+  _tree->clear();
+  const CFuint nbOldFaces = _treeFaces.size();
+  _treeFaces.clear();
+
+  Common::SafePtr<GeometricEntityPool<StdTrsGeoBuilder> >
+    geoBuilder = getMethodData().getStdTrsGeoBuilder();
+  StdTrsGeoBuilder::GeoData& geoData = geoBuilder->getDataGE();
+
+  vector<CFreal> coord;
+  vector< SafePtr<TopologicalRegionSet> > trs = getTrsList();
+  for (CFuint iTRS = 0; iTRS < trs.size(); ++iTRS) {
+    const CFuint nbGeos = trs[iTRS]->getLocalNbGeoEnts();
+    geoData.trs = trs[iTRS];
+
+    for (CFuint iGeoEnt = 0; iGeoEnt < nbGeos; ++iGeoEnt) {
+      geoData.idx = iGeoEnt;
+      GeometricEntity& currFace = *geoBuilder->buildGE();
+
+      const CFuint nbNodes = currFace.nbNodes();
+      coord.resize(nbNodes*dim);
+      for (CFuint iNode = 0; iNode < nbNodes; ++iNode) {
+        const Node& node = *currFace.getNode(iNode);
+        for (CFuint iDim = 0; iDim < dim; ++iDim) {
+          coord[iNode*dim + iDim] = node[iDim];
+        }
+      }
+      _tree->addFace(nbNodes, &coord[0]);
+      _treeFaces.push_back(SubSysCouplerData::GeoEntityIdx(trs[iTRS], iGeoEnt));
+
+      geoBuilder->releaseGE();
+    }
+  }
+
+  _tree->build();
+  cf_assert(_tree->getNbFaces() == _treeFaces.size());
+
+  // the previous matches refer to faces which do not exist anymore
+  if (_treeFaces.size() != nbOldFaces) {
+    _matchCache.clear();
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void TreeMeshMatcherWrite::executeWrite(const CFuint iProc)
+{
+  CFAUTOTRACE;
+
+  // Get the names of the interfaces, subsystems
+  const std::string interfaceName = getCommandGroupName();
+  vector<std::string> otherTrsNames = getMethodData().getCoupledSubSystemsTRSNames(interfaceName);
+
+  // If the geometry is non matching, then get the threshold for acceptance
+  // else set the threshold to a very high value
+  const bool isNonMatchingGeometry = getMethodData().isInterfaceGeometryNonMatching(interfaceName);
+  CFreal nonMatchingGeometryThreshold = MathTools::MathConsts::CFrealMax();
+  if(isNonMatchingGeometry) nonMatchingGeometryThreshold = getMethodData().getNonMatchingGeometryThreshold(interfaceName);
+
+  const CFuint dim = PhysicalModelStack::getActive()->getDim();
+
+  Common::SafePtr<GeometricEntityPool<StdTrsGeoBuilder> >
+    geoBuilder = getMethodData().getStdTrsGeoBuilder();
+  StdTrsGeoBuilder::GeoData& geoData = geoBuilder->getDataGE();
+
+  // Loop over the TRSs of the Interface
+  for (CFuint iTRS=0; iTRS < otherTrsNames.size(); iTRS++)
+  {
+    CFLogInfo ("Matching for TRS [" << otherTrsNames[iTRS] << "]\n");
+
+    const vector<std::string> socketCoordNames =
+      getMethodData().getOtherCoupledCoordName(interfaceName,otherTrsNames[iTRS],iProc);
+    const vector<std::string> socketAcceptNames =
+      getMethodData().getOtherCoupledAcceptedName(interfaceName,otherTrsNames[iTRS],iProc);
+    const vector<std::string> socketDataNames =
+      getMethodData().getOtherCoupledDataName(interfaceName,otherTrsNames[iTRS],iProc);
+
+    for(CFuint iType=0; iType < socketCoordNames.size();iType++)
+    {
+      DataHandle< RealVector> interfaceCoords =
+        _sockets.getSocketSink<RealVector>(socketCoordNames[iType])->getDataHandle();
+      DataHandle< CFreal> isAccepted =
+        _sockets.getSocketSink<CFreal>(socketAcceptNames[iType])->getDataHandle();
+      DataHandle< RealVector> interfaceData =
+        _sockets.getSocketSink<RealVector>(socketDataNames[iType])->getDataHandle();
+
+      const CFuint otherNbStates = interfaceCoords.size();
+      MatchCache& cache = _matchCache[socketCoordNames[iType]];
+      if (cache.faceIDs.size() != otherNbStates) {
+        cache.faceIDs.assign(otherNbStates, -1);
+        cache.coords.assign(otherNbStates*dim, 0.);
+        cache.projections.assign(otherNbStates*dim, 0.);
+        cache.distances.assign(otherNbStates, MathTools::MathConsts::CFrealMax());
+      }
+
+      // the points are split in contiguous chunks, each matched by one thread
+      vector<CFuint> nbRematchedInChunk(getNbChunks(otherNbStates, _nbThreads), 0);
+      runChunked(otherNbStates, _nbThreads,
+                 boost::bind(&TreeMeshMatcherWrite::matchPoints, this, &cache,
+                             &interfaceCoords, &nbRematchedInChunk, _1, _2, _3));
+
+      CFuint nbRematched = 0;
+      for (CFuint iChunk = 0; iChunk < nbRematchedInChunk.size(); ++iChunk) {
+        nbRematched += nbRematchedInChunk[iChunk];
+      }
+
+      CFLogInfo("Matching [" << socketCoordNames[iType] << "]: "
+                << nbRematched << " of " << otherNbStates << " points searched in the tree\n");
+
+      // Get the coupledGeoEntities and resize
+      SubSysCouplerData::CoupledGeoEntities* coupledGeoEntities =
+        getMethodData().getCoupledInterfaces(interfaceName,iTRS, iType, iProc);
+      (*coupledGeoEntities).resize(otherNbStates);
+
+      // the shape functions are computed serially, as the geometric
+      // entities are built by a single builder
+      CFuint rejectedStates = 0;
+      RealVector coordProj(dim);
+      for (CFuint iState = 0; iState < otherNbStates; ++iState) {
+        const CFint faceID = cache.faceIDs[iState];
+        const CFreal distance = cache.distances[iState];
+        if (faceID < 0 || !(nonMatchingGeometryThreshold > distance)) {
+          isAccepted[iState] = -1.;
+          rejectedStates++;
+          CFout << "Node is rejected because distance is: " << distance << "\n";
+          continue;
+        }
+
+        isAccepted[iState] = distance;
+        for (CFuint iDim = 0; iDim < dim; ++iDim) {
+          coordProj[iDim] = cache.projections[iState*dim + iDim];
+        }
+
+        const SubSysCouplerData::GeoEntityIdx& face = _treeFaces[faceID];
+        geoData.trs = face.first;
+        geoData.idx = face.second;
+        GeometricEntity& currFace = *geoBuilder->buildGE();
+
+        const CFuint idx = iState-rejectedStates;
+        (*coupledGeoEntities)[idx].third.resize(currFace.nbNodes());
+        (*coupledGeoEntities)[idx].fourth.resize(dim);
+        (*coupledGeoEntities)[idx].first = face.first;
+        (*coupledGeoEntities)[idx].second = face.second;
+        (*coupledGeoEntities)[idx].third = currFace.computeShapeFunctionAtCoord(coordProj);
+        (*coupledGeoEntities)[idx].fourth = coordProj;
+
+        geoBuilder->releaseGE();
+      }
+
+      ///We know the number of accepted states -> can now resize the datahandle
+      interfaceData.resize(otherNbStates - rejectedStates);
+
+      ///Write the file with the info isAccepted
+      writeIsAcceptedFile(socketAcceptNames[iType]);
+    } //end of loop over data transfer coord type
+  } // end loop over the OtherTRS
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void TreeMeshMatcherWrite::matchPoints(MatchCache* cache,
+                                       DataHandle<RealVector>* interfaceCoords,
+                                       vector<CFuint>* nbRematchedInChunk,
+                                       const CFuint start, const CFuint end,
+                                       const CFuint iChunk)
+{
+  const CFuint dim = PhysicalModelStack::getActive()->getDim();
+  const CFreal toleranceSq = _rematchTolerance*_rematchTolerance;
+
+  // the points which moved less than the tolerance keep their face and
+  // are only projected on it again, the others are searched in the tree
+  // starting from their previous face
+  for (CFuint iState = start; iState < end; ++iState) {
+    const RealVector& coord = (*interfaceCoords)[iState];
+    CFreal *const lastCoord = &cache->coords[iState*dim];
+    CFreal *const projection = &cache->projections[iState*dim];
+    CFint& faceID = cache->faceIDs[iState];
+
+    CFreal point[3];
+    CFreal displacementSq = 0.;
+    for (CFuint iDim = 0; iDim < dim; ++iDim) {
+      point[iDim] = coord[iDim];
+      const CFreal d = point[iDim] - lastCoord[iDim];
+      displacementSq += d*d;
+    }
+
+    if (faceID < 0 || _rematchTolerance <= 0. || displacementSq > toleranceSq) {
+      _tree->computeDistance(point, faceID);
+      for (CFuint iDim = 0; iDim < dim; ++iDim) {lastCoord[iDim] = point[iDim];}
+      ++(*nbRematchedInChunk)[iChunk];
+    }
+
+    cache->distances[iState] = (faceID < 0) ? MathTools::MathConsts::CFrealMax() :
+      _tree->computeClosestPoint(faceID, point, projection);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace SubSystemCoupler
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,138 @@
+#ifndef COOLFluiD_Numerics_SubSystemCoupler_TreeMeshMatcherWrite_hh
+#define COOLFluiD_Numerics_SubSystemCoupler_TreeMeshMatcherWrite_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <map>
+#include <memory>
+
+#include "SubSystemCoupler/StdMeshMatcherWrite.hh"
+#include "MeshTools/WallDistanceTree.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace SubSystemCoupler {
+
+//////////////////////////////////////////////////////////////////////////////
+
+  /**
+   * This class represents a NumericalCommand action to be
+   * sent to Domain to be executed in order to set the
+   * match between meshes.
+   * The points of the other subsystem are matched with the closest face of
+   * the interface by means of a bounding volume tree, instead of looping
+   * over all the faces for each point. The match of each point is kept
+   * between calls: the points which moved less than a given tolerance
+   * keep their face and are only projected again, the others are matched
+   * again starting from their previous face. The searches are split among
+   * concurrent threads, since they do not modify the tree.
+   *
+   * @author Andrea Lani
+   *
+   */
+
+class TreeMeshMatcherWrite : public StdMeshMatcherWrite {
+public:
+
+  /**
+   * Defines the Config Option's of this class
+   * @param options a OptionList where to add the Option's
+   */
+  static void defineConfigOptions(Config::OptionList& options);
+
+  /**
+   * Constructor.
+   */
+  explicit TreeMeshMatcherWrite(const std::string& name);
+
+  /**
+   * Destructor.
+   */
+  ~TreeMeshMatcherWrite();
+
+  /**
+   * Executes the command.
+   */
+  virtual void execute();
+
+protected: // functions
+
+  /**
+   * Concrete execution of the command.
+   */
+  virtual void executeWrite(const CFuint iProc);
+
+  /**
+   * Builds the tree over the local faces of the TRSs of this command
+   */
+  void buildTree();
+
+private: // helper classes
+
+  /**
+   * Match of the points of one coordinates socket, kept between calls
+   */
+  class MatchCache {
+  public:
+    /// closest face of each point, -1 if not matched yet
+    std::vector<CFint> faceIDs;
+
+    /// coordinates of each point when it was last matched
+    std::vector<CFreal> coords;
+
+    /// closest point on the face for each point
+    std::vector<CFreal> projections;
+
+    /// distance to the closest face for each point
+    std::vector<CFreal> distances;
+  };
+
+private: // helper functions
+
+  /**
+   * Match the points in the chunk [start, end) of the given coordinates socket
+   * @param nbRematchedInChunk entry iChunk is incremented for each point searched in the tree
+   */
+  void matchPoints(MatchCache* cache,
+                   Framework::DataHandle<RealVector>* interfaceCoords,
+                   std::vector<CFuint>* nbRematchedInChunk,
+                   const CFuint start, const CFuint end,
+                   const CFuint iChunk);
+
+private: // data
+
+  /// tree over the local faces of the interface
+  std::auto_ptr<MeshTools::WallDistanceTree> _tree;
+
+  /// TRS and index of each face in the tree
+  std::vector<SubSysCouplerData::GeoEntityIdx> _treeFaces;
+
+  /// match of the points for each coordinates socket
+  std::map<std::string, MatchCache> _matchCache;
+
+  /// displacement below which a point keeps its face
+  CFreal _rematchTolerance;
+
+  /// maximum number of faces in each leaf of the tree
+  CFuint _maxFacesInLeaf;
+
+  /// number of threads searching the points in the tree
+  CFuint _nbThreads;
+
+}; // class TreeMeshMatcherWrite
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace SubSystemCoupler
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Numerics_SubSystemCoupler_TreeMeshMatcherWrite_hh
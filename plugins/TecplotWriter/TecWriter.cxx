@@ -6,6 +6,7 @@
 
 #include "Environment/ObjectProvider.hh"
 #include "Framework/DataHandleOutput.hh"
+#include "Framework/Profiler.hh"
 #include "TecplotWriter/TecplotWriter.hh"
 #include "TecplotWriter/TecWriter.hh"
 
@@ -78,7 +79,7 @@ void TecWriter::setMethodImpl()
 
   setupCommandsAndStrategies();
   cf_assert(m_setup.isNotNull());
-  m_setup->execute();
+  profileExecute(m_setup);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -86,7 +87,7 @@ void TecWriter::setMethodImpl()
 void TecWriter::unsetMethodImpl()
 {
   cf_assert(m_unSetup.isNotNull());
-  m_unSetup->execute();
+  profileExecute(m_unSetup);
   unsetupCommandsAndStrategies();
 
   OutputFormatter::unsetMethodImpl();
@@ -137,7 +138,7 @@ void TecWriter::writeImpl()
   // set the nodal states at first
   getMethodData()->getCollaborator<SpaceMethod>()->extrapolateStatesToNodes();
   // write the solution file
-  m_writeSolution->execute();
+  profileExecute(m_writeSolution);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -8,6 +8,7 @@
 #include "Environment/ObjectProvider.hh"
 #include "Common/PE.hh"
 #include "Trilinos/Trilinos.hh"
+#include "Framework/Profiler.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -101,7 +102,7 @@ void TrilinosLSS::configure ( Config::ConfigArgs& args )
 
 void TrilinosLSS::solveSysImpl()
 {
-  m_solveSys->execute();
+  profileExecute(m_solveSys);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -131,7 +132,7 @@ void TrilinosLSS::setMethodImpl()
   LinearSystemSolver::setMethodImpl();
 
   m_setup->setup();
-  m_setup->execute();
+  profileExecute(m_setup);
 
   m_solveSys->setup();
   m_unSetup->setup();
@@ -141,7 +142,7 @@ void TrilinosLSS::setMethodImpl()
 
 void TrilinosLSS::unsetMethodImpl()
 {
-  m_unSetup->execute();
+  profileExecute(m_unSetup);
   unsetupCommandsAndStrategies();
 
   LinearSystemSolver::unsetMethodImpl();
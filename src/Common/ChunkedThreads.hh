@@ -0,0 +1,72 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_Common_ChunkedThreads_hh
+#define COOLFluiD_Common_ChunkedThreads_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <boost/thread.hpp>
+#include <boost/bind.hpp>
+
+#include "Common/COOLFluiD.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+    namespace Common {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// Number of chunks in which runChunked() splits nbItems items
+/// when it is given nbThreads threads
+inline CFuint getNbChunks(const CFuint nbItems, const CFuint nbThreads)
+{
+  return std::max(std::min(nbThreads, nbItems), (CFuint)1);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// Split the items [0, nbItems) in contiguous chunks and call
+/// f(start, end, iChunk) on each of them, one thread per chunk.
+/// With less than two chunks f is called directly, without spawning threads.
+/// f must only write to data owned by its own chunk.
+/// @param nbItems   number of items to process
+/// @param nbThreads maximum number of threads
+/// @param f         functor (e.g. boost::bind of a member function), a bound
+///                  functor can ignore the chunk index
+template <typename FUNCTOR>
+void runChunked(const CFuint nbItems, const CFuint nbThreads, FUNCTOR f)
+{
+  const CFuint nbChunks = getNbChunks(nbItems, nbThreads);
+  if (nbChunks == 1) {
+    const CFuint start = 0;
+    const CFuint iChunk = 0;
+    f(start, nbItems, iChunk);
+    return;
+  }
+
+  const CFuint chunk = nbItems/nbChunks + ((nbItems%nbChunks > 0) ? 1 : 0);
+  boost::thread_group threads;
+  for (CFuint iChunk = 0; iChunk*chunk < nbItems; ++iChunk) {
+    const CFuint start = iChunk*chunk;
+    const CFuint end = std::min(start + chunk, nbItems);
+    threads.create_thread(boost::bind<void>(f, start, end, iChunk));
+  }
+  threads.join_all();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace Common
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Common_ChunkedThreads_hh
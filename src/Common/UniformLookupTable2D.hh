@@ -0,0 +1,192 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_Common_UniformLookupTable2D_hh
+#define COOLFluiD_Common_UniformLookupTable2D_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include <cmath>
+
+#include "Common/COOLFluiD.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Common {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class represents a table of values given on a structured grid of
+/// two keys, each one uniformly spaced either in linear or in logarithmic
+/// scale. Unlike LookupTable2D, the cell containing a pair of keys is found
+/// in constant time and all the values of one grid point are contiguous in
+/// memory, so that interpolating all of them at once is cheap.
+/// @author Andrea Lani
+template <class VALUE>
+class UniformLookupTable2D {
+
+public:
+
+  /// Spacing of the keys
+  enum SpacingType {LINEAR=0, LOGARITHMIC=1};
+
+  /// Constructor
+  UniformLookupTable2D();
+
+  /// Default destructor
+  ~UniformLookupTable2D();
+
+  /// Initialize the table by reserving memory
+  /// @param min1     minimum value of the first key
+  /// @param max1     maximum value of the first key
+  /// @param nb1      number of points for the first key (>= 2)
+  /// @param spacing1 spacing of the first key
+  /// @param min2     minimum value of the second key
+  /// @param max2     maximum value of the second key
+  /// @param nb2      number of points for the second key (>= 2)
+  /// @param spacing2 spacing of the second key
+  /// @param valueStride number of values stored in each point
+  void initialize(const CFreal min1, const CFreal max1, const CFuint nb1,
+		  const SpacingType spacing1,
+		  const CFreal min2, const CFreal max2, const CFuint nb2,
+		  const SpacingType spacing2,
+		  const CFuint valueStride);
+
+  /// Tell if the table has been initialized
+  bool isInitialized() const {return _values.size() > 0;}
+
+  /// Get the number of points for the first key
+  CFuint getNbKeys1() const {return _nb1;}
+
+  /// Get the number of points for the second key
+  CFuint getNbKeys2() const {return _nb2;}
+
+  /// Get the number of values stored in each point
+  CFuint getValueStride() const {return _valueStride;}
+
+  /// Get the i-th value of the first key
+  CFreal getKey1(const CFuint i) const {return toKey(_min1 + i*_delta1, _spacing1);}
+
+  /// Get the j-th value of the second key
+  CFreal getKey2(const CFuint j) const {return toKey(_min2 + j*_delta2, _spacing2);}
+
+  /// Tell if the given keys lie inside the table
+  bool isInside(const CFreal key1, const CFreal key2) const
+  {
+    return (key1 >= _key1Min && key1 <= _key1Max &&
+	    key2 >= _key2Min && key2 <= _key2Max);
+  }
+
+  /// Get the array of values of the point (i,j)
+  VALUE* getValues(const CFuint i, const CFuint j)
+  {
+    cf_assert(i < _nb1);
+    cf_assert(j < _nb2);
+    return &_values[(j*_nb1 + i)*_valueStride];
+  }
+
+  /// Get the array of values of the point (i,j)
+  const VALUE* getValues(const CFuint i, const CFuint j) const
+  {
+    cf_assert(i < _nb1);
+    cf_assert(j < _nb2);
+    return &_values[(j*_nb1 + i)*_valueStride];
+  }
+
+  /// Interpolate all the values with the bilinear shape functions
+  /// @param key1   first key
+  /// @param key2   second key
+  /// @param result array of size getValueStride() to fill in
+  /// @pre isInside(key1, key2)
+  void interpolate(const CFreal key1, const CFreal key2, VALUE* result) const;
+
+  /// Interpolate the given value with the bilinear shape functions
+  /// @param key1   first key
+  /// @param key2   second key
+  /// @param iValue index of the value
+  /// @pre isInside(key1, key2)
+  VALUE get(const CFreal key1, const CFreal key2, const CFuint iValue) const;
+
+  /// Get all the stored values (to read or write the table)
+  std::vector<VALUE>& getData() {return _values;}
+
+private:
+
+  /// Transform a key into the coordinate in which it is uniformly spaced
+  static CFreal toCoord(const CFreal key, const SpacingType spacing)
+  {
+    return (spacing == LOGARITHMIC) ? std::log(key) : key;
+  }
+
+  /// Transform a uniformly spaced coordinate back into a key
+  static CFreal toKey(const CFreal coord, const SpacingType spacing)
+  {
+    return (spacing == LOGARITHMIC) ? std::exp(coord) : coord;
+  }
+
+  /// Locate the cell containing the given keys and the local coordinates
+  /// (in [0,1]) inside it
+  void locate(const CFreal key1, const CFreal key2,
+	      CFuint& i, CFuint& j, CFreal& w1, CFreal& w2) const;
+
+private:
+
+  /// number of points for the first key
+  CFuint _nb1;
+
+  /// number of points for the second key
+  CFuint _nb2;
+
+  /// stride of the value array
+  CFuint _valueStride;
+
+  /// spacing of the first key
+  SpacingType _spacing1;
+
+  /// spacing of the second key
+  SpacingType _spacing2;
+
+  /// minimum of the first key coordinate
+  CFreal _min1;
+
+  /// minimum of the second key coordinate
+  CFreal _min2;
+
+  /// step of the first key coordinate
+  CFreal _delta1;
+
+  /// step of the second key coordinate
+  CFreal _delta2;
+
+  /// bounds of the first key
+  CFreal _key1Min;
+  CFreal _key1Max;
+
+  /// bounds of the second key
+  CFreal _key2Min;
+  CFreal _key2Max;
+
+  /// storage of the values, point by point
+  std::vector<VALUE> _values;
+
+}; // end of class UniformLookupTable2D
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace Common
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "UniformLookupTable2D.ci"
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Common_UniformLookupTable2D_hh
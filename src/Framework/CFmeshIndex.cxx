@@ -0,0 +1,198 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <fstream>
+
+#include "Common/CFLog.hh"
+#include "Common/NoSuchValueException.hh"
+#include "Environment/FileHandlerInput.hh"
+#include "Environment/FileHandlerOutput.hh"
+#include "Environment/SingleBehaviorFactory.hh"
+#include "Framework/BadFormatException.hh"
+#include "Framework/CFmeshIndex.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Framework {
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFmeshIndex::CFmeshIndex() :
+  m_lists(),
+  m_trsPositions(),
+  m_endPosition(0),
+  m_fileSize(0)
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFmeshIndex::~CFmeshIndex()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+boost::filesystem::path CFmeshIndex::getIndexFilePath(const boost::filesystem::path& meshFile)
+{
+  return boost::filesystem::path(meshFile.string() + ".idx");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void CFmeshIndex::clear()
+{
+  m_lists.clear();
+  m_trsPositions.clear();
+  m_endPosition = 0;
+  m_fileSize = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFmeshIndex::List& CFmeshIndex::beginList(const std::string& key, const CFuint blockSize)
+{
+  List& list = m_lists[key];
+  list.reset(blockSize);
+  return list;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+const CFmeshIndex::List& CFmeshIndex::getList(const std::string& key) const
+{
+  map<string, List>::const_iterator it = m_lists.find(key);
+  if (it == m_lists.end()) {
+    throw NoSuchValueException (FromHere(), "CFmeshIndex::getList() => list not found: " + key);
+  }
+  return it->second;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void CFmeshIndex::writeToFile(const boost::filesystem::path& filepath) const
+{
+  SelfRegistPtr<Environment::FileHandlerOutput> fhandle =
+    Environment::SingleBehaviorFactory<Environment::FileHandlerOutput>::getInstance().create();
+  ofstream& fout = fhandle->open(filepath);
+
+  fout << "!CFMESH_INDEX_VERSION 2\n";
+  fout << "!END_POSITION " << m_endPosition << "\n";
+  fout << "!FILE_SIZE " << m_fileSize << "\n";
+
+  fout << "!NB_TRSs " << m_trsPositions.size() << "\n";
+  for (CFuint iTRS = 0; iTRS < m_trsPositions.size(); ++iTRS) {
+    fout << m_trsPositions[iTRS] << "\n";
+  }
+
+  fout << "!NB_LISTS " << m_lists.size() << "\n";
+  for (map<string, List>::const_iterator it = m_lists.begin(); it != m_lists.end(); ++it) {
+    const List& list = it->second;
+    fout << it->first << " " << list.m_nbEntries << " " << list.m_blockSize << " "
+	 << list.m_blockPositions.size() << " " << list.m_endPosition << "\n";
+    for (CFuint iBlock = 0; iBlock < list.m_blockPositions.size(); ++iBlock) {
+      fout << list.m_blockPositions[iBlock] << "\n";
+    }
+  }
+
+  fout << "!END\n";
+  fhandle->close();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void CFmeshIndex::readFromFile(const boost::filesystem::path& filepath)
+{
+  clear();
+
+  SelfRegistPtr<Environment::FileHandlerInput> fhandle =
+    Environment::SingleBehaviorFactory<Environment::FileHandlerInput>::getInstance().create();
+  ifstream& fin = fhandle->open(filepath);
+
+  string key = "";
+  CFuint version = 0;
+  fin >> key >> version;
+  if (key != "!CFMESH_INDEX_VERSION" || version != 2) {
+    throw BadFormatException (FromHere(), "CFmeshIndex::readFromFile() => bad index file " + filepath.string());
+  }
+
+  fin >> key >> m_endPosition;
+  if (key != "!END_POSITION") {
+    throw BadFormatException (FromHere(), "CFmeshIndex::readFromFile() => !END_POSITION missing in " + filepath.string());
+  }
+
+  fin >> key >> m_fileSize;
+  if (key != "!FILE_SIZE") {
+    throw BadFormatException (FromHere(), "CFmeshIndex::readFromFile() => !FILE_SIZE missing in " + filepath.string());
+  }
+
+  CFuint nbTRSs = 0;
+  fin >> key >> nbTRSs;
+  if (key != "!NB_TRSs") {
+    throw BadFormatException (FromHere(), "CFmeshIndex::readFromFile() => !NB_TRSs missing in " + filepath.string());
+  }
+  m_trsPositions.resize(nbTRSs);
+  for (CFuint iTRS = 0; iTRS < nbTRSs; ++iTRS) {
+    fin >> m_trsPositions[iTRS];
+  }
+
+  CFuint nbLists = 0;
+  fin >> key >> nbLists;
+  if (key != "!NB_LISTS") {
+    throw BadFormatException (FromHere(), "CFmeshIndex::readFromFile() => !NB_LISTS missing in " + filepath.string());
+  }
+  for (CFuint iList = 0; iList < nbLists; ++iList) {
+    CFuint nbBlocks = 0;
+    fin >> key;
+    List& list = m_lists[key];
+    fin >> list.m_nbEntries >> list.m_blockSize >> nbBlocks >> list.m_endPosition;
+    if (list.m_blockSize == 0 || nbBlocks != (list.m_nbEntries + list.m_blockSize - 1)/list.m_blockSize) {
+      throw BadFormatException (FromHere(), "CFmeshIndex::readFromFile() => bad blocks for " + key);
+    }
+    list.m_blockPositions.resize(nbBlocks);
+    for (CFuint iBlock = 0; iBlock < nbBlocks; ++iBlock) {
+      fin >> list.m_blockPositions[iBlock];
+    }
+  }
+
+  fin >> key;
+  if (!fin || key != "!END") {
+    throw BadFormatException (FromHere(), "CFmeshIndex::readFromFile() => truncated index file " + filepath.string());
+  }
+
+  fhandle->close();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bool CFmeshIndex::isConsistentWith(const boost::filesystem::path& meshFile) const
+{
+  ifstream fin(meshFile.string().c_str(), ios_base::in | ios_base::binary);
+  if (!fin || m_endPosition == 0 || m_fileSize <= m_endPosition) return false;
+
+  // the numbers of entries of the lists are checked by the reader,
+  // against the ones in the header of the file
+  fin.seekg(0, ios_base::end);
+  if (static_cast<long unsigned int>(fin.tellg()) != m_fileSize) return false;
+
+  fin.seekg(static_cast<streamoff>(m_endPosition));
+  string key = "";
+  fin >> key;
+  return (key == "!END");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace Framework
+
+} // namespace COOLFluiD
@@ -0,0 +1,203 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_Framework_CFmeshIndex_hh
+#define COOLFluiD_Framework_CFmeshIndex_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <map>
+#include <ostream>
+
+#include <boost/filesystem/path.hpp>
+
+#include "Framework/Framework.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Framework {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class holds the index of an ASCII CFmesh file, stored in a sidecar
+/// file next to it (same name with ".idx" appended).
+/// For each list of entries (elements, nodes, states) it records the number
+/// of entries, the byte position of every block of entries and the byte
+/// position right after the list. It also records the position of every
+/// TRS, the position of the final "!END" key and the size of the file,
+/// which are used to check that the index is still consistent with the file.
+/// @author Andrea Lani
+class Framework_API CFmeshIndex {
+public:
+
+  /// Positions of the entries of a list in the CFmesh file
+  class Framework_API List {
+  public:
+
+    /// Constructor
+    List() : m_blockSize(1), m_nbEntries(0), m_blockPositions(), m_endPosition(0) {}
+
+    /// Reset the list
+    void reset(const CFuint blockSize)
+    {
+      cf_assert(blockSize > 0);
+      m_blockSize = blockSize;
+      m_nbEntries = 0;
+      m_blockPositions.clear();
+      m_endPosition = 0;
+    }
+
+    /// Record an entry, to be called right before the entry is written
+    void addEntry(std::ostream& out)
+    {
+      if (m_nbEntries%m_blockSize == 0) {
+	m_blockPositions.push_back(static_cast<long unsigned int>(out.tellp()));
+      }
+      ++m_nbEntries;
+    }
+
+    /// Record the end of the list, to be called right after the last entry
+    void end(std::ostream& out)
+    {
+      m_endPosition = static_cast<long unsigned int>(out.tellp());
+    }
+
+    /// @return the number of entries in the list
+    CFuint getNbEntries() const {return m_nbEntries;}
+
+    /// @return the number of entries in each block
+    CFuint getBlockSize() const {return m_blockSize;}
+
+    /// @return the number of blocks
+    CFuint getNbBlocks() const {return m_blockPositions.size();}
+
+    /// @return the position of the first entry of the given block
+    long unsigned int getBlockPosition(const CFuint iBlock) const
+    {
+      cf_assert(iBlock < m_blockPositions.size());
+      return m_blockPositions[iBlock];
+    }
+
+    /// @return the position right after the last entry
+    long unsigned int getEndPosition() const {return m_endPosition;}
+
+  private:
+
+    friend class CFmeshIndex;
+
+    /// number of entries in each block
+    CFuint m_blockSize;
+
+    /// number of entries
+    CFuint m_nbEntries;
+
+    /// position of the first entry of each block
+    std::vector<long unsigned int> m_blockPositions;
+
+    /// position right after the last entry
+    long unsigned int m_endPosition;
+  };
+
+  /// Constructor
+  CFmeshIndex();
+
+  /// Destructor
+  ~CFmeshIndex();
+
+  /// @return the path of the index file for the given CFmesh file
+  static boost::filesystem::path getIndexFilePath(const boost::filesystem::path& meshFile);
+
+  /// Clear all the stored positions
+  void clear();
+
+  /// Start recording the given list, erasing the previous positions
+  /// @param key       key of the list in the CFmesh file (e.g. "!LIST_NODE")
+  /// @param blockSize number of entries in each block
+  List& beginList(const std::string& key, const CFuint blockSize);
+
+  /// @return true if the given list is recorded in the index
+  bool hasList(const std::string& key) const
+  {
+    return (m_lists.count(key) > 0);
+  }
+
+  /// @return true if the given list is recorded in the index with the
+  ///         given number of entries
+  bool hasList(const std::string& key, const CFuint nbEntries) const
+  {
+    return (hasList(key) && getList(key).getNbEntries() == nbEntries);
+  }
+
+  /// @return the given list
+  const List& getList(const std::string& key) const;
+
+  /// Record the position of the next TRS
+  void addTRS(const long unsigned int position)
+  {
+    m_trsPositions.push_back(position);
+  }
+
+  /// @return the number of TRSs
+  CFuint getNbTRSs() const {return m_trsPositions.size();}
+
+  /// @return the position of the given TRS
+  long unsigned int getTRSPosition(const CFuint iTRS) const
+  {
+    cf_assert(iTRS < m_trsPositions.size());
+    return m_trsPositions[iTRS];
+  }
+
+  /// Set the position of the final "!END" key
+  void setEndPosition(const long unsigned int position) {m_endPosition = position;}
+
+  /// @return the position of the final "!END" key
+  long unsigned int getEndPosition() const {return m_endPosition;}
+
+  /// Set the size of the CFmesh file, once it is complete
+  void setFileSize(const long unsigned int size) {m_fileSize = size;}
+
+  /// @return the size of the CFmesh file
+  long unsigned int getFileSize() const {return m_fileSize;}
+
+  /// Write the index to the given file
+  /// @throw Common::FilesystemException
+  void writeToFile(const boost::filesystem::path& filepath) const;
+
+  /// Read the index from the given file
+  /// @throw BadFormatException if the file is not a valid index
+  void readFromFile(const boost::filesystem::path& filepath);
+
+  /// Check that the index matches the given CFmesh file, i.e. that the
+  /// file has the recorded size and the "!END" key is found where expected
+  bool isConsistentWith(const boost::filesystem::path& meshFile) const;
+
+private: // data
+
+  /// lists of entries
+  std::map<std::string, List> m_lists;
+
+  /// position of each TRS
+  std::vector<long unsigned int> m_trsPositions;
+
+  /// position of the final "!END" key
+  long unsigned int m_endPosition;
+
+  /// size of the CFmesh file
+  long unsigned int m_fileSize;
+
+}; // end of class CFmeshIndex
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace Framework
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Framework_CFmeshIndex_hh
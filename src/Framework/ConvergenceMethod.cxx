@@ -22,6 +22,7 @@
 #include "Framework/ConvergenceMethodData.hh"
 #include "Framework/SubSystemStatus.hh"
 #include "Framework/NamespaceSwitcher.hh"
+#include "Framework/Profiler.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -150,6 +151,7 @@ void ConvergenceMethod::takeStep()
   cf_assert(isSetup());
 
   pushNamespace();
+  ProfileScope profile(*this, "takeStep");
 
   if (m_stopwatch.isNotRunning()) { m_stopwatch.start(); }
 
@@ -303,6 +305,7 @@ void ConvergenceMethod::syncGlobalDataComputeResidual(const bool computeResidual
   cf_assert(isSetup());
 
   pushNamespace();
+  ProfileScope profile(*this, "syncGlobalDataComputeResidual");
 
   const bool isParallel = Common::PE::GetPE().IsParallel();
   Common::Stopwatch<Common::WallTime> syncTimer;
@@ -314,10 +317,13 @@ void ConvergenceMethod::syncGlobalDataComputeResidual(const bool computeResidual
   DataHandle<Node*, GLOBAL> nodedata = 
     MeshDataStack::getInstance().getEntryByNamespace(nsp)->getNodeDataSocketSink().getDataHandle();
   
+  Common::SafePtr<MeshData> meshData = MeshDataStack::getInstance().getEntryByNamespace(nsp);
+  
   // after each update the states have to be syncronized
   if (isParallel)
   {
     syncTimer.start();
+    meshData->completeStateSync();
     statedata.beginSync ();
   }
   
@@ -328,7 +334,13 @@ void ConvergenceMethod::syncGlobalDataComputeResidual(const bool computeResidual
 
   if (isParallel)
   {
-    statedata.endSync();
+    // the SpaceMethod can complete the sync while computing the residual
+    if (meshData->isStateSyncDeferred()) {
+      meshData->setStateSyncPending(true);
+    }
+    else {
+      statedata.endSync();
+    }
     syncTimer.stop();
   }
 
@@ -345,6 +357,7 @@ void ConvergenceMethod::syncAllAndComputeResidual(const bool computeResidual)
   cf_assert(isSetup());
 
   pushNamespace();
+  ProfileScope profile(*this, "syncAllAndComputeResidual");
 
   const bool isParallel = Common::PE::GetPE().IsParallel();
   Common::Stopwatch<Common::WallTime> syncTimer;
@@ -356,10 +369,13 @@ void ConvergenceMethod::syncAllAndComputeResidual(const bool computeResidual)
   DataHandle<Node*, GLOBAL> nodedata = 
     MeshDataStack::getInstance().getEntryByNamespace(nsp)->getNodeDataSocketSink().getDataHandle();
   
+  Common::SafePtr<MeshData> meshData = MeshDataStack::getInstance().getEntryByNamespace(nsp);
+  
   // after each update the states have to be syncronized
   if (isParallel)
   {
     syncTimer.start();
+    meshData->completeStateSync();
     statedata.beginSync ();
     nodedata.beginSync ();
   }
@@ -371,8 +387,14 @@ void ConvergenceMethod::syncAllAndComputeResidual(const bool computeResidual)
 
   if (isParallel)
   {
-    statedata.endSync();
     nodedata.endSync();
+    // the SpaceMethod can complete the sync while computing the residual
+    if (meshData->isStateSyncDeferred()) {
+      meshData->setStateSyncPending(true);
+    }
+    else {
+      statedata.endSync();
+    }
     syncTimer.stop();
   }
 
@@ -389,6 +411,7 @@ void ConvergenceMethod::writeOnScreen()
   cf_assert(isSetup());
 
   pushNamespace();
+  ProfileScope profile(*this, "writeOnScreen");
 
   Common::SafePtr<SubSystemStatus> subSysStatus = SubSystemStatusStack::getActive();
 
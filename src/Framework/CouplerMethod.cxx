@@ -5,6 +5,7 @@
 // See doc/lgpl.txt and doc/gpl.txt for the license text.
 
 #include "CouplerMethod.hh"
+#include "Profiler.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -104,6 +105,7 @@ void CouplerMethod::preProcessWrite()
   cf_assert(isSetup());
   
   pushNamespace();
+  ProfileScope profile(*this, "preProcessWrite");
   
   preProcessWriteImpl();
   
@@ -123,6 +125,7 @@ void CouplerMethod::preProcessRead()
   cf_assert(isSetup());
 
   pushNamespace();
+  ProfileScope profile(*this, "preProcessRead");
 
   preProcessReadImpl();
 
@@ -142,6 +145,7 @@ void CouplerMethod::meshMatchingWrite()
   cf_assert(isSetup());
 
   pushNamespace();
+  ProfileScope profile(*this, "meshMatchingWrite");
 
   meshMatchingWriteImpl();
 
@@ -161,6 +165,7 @@ void CouplerMethod::meshMatchingRead()
   cf_assert(isSetup());
 
   pushNamespace();
+  ProfileScope profile(*this, "meshMatchingRead");
 
   meshMatchingReadImpl();
 
@@ -178,6 +183,7 @@ void CouplerMethod::dataTransferRead()
   cf_assert(isSetup());
 
   pushNamespace();
+  ProfileScope profile(*this, "dataTransferRead");
 
   dataTransferReadImpl();
 
@@ -194,6 +200,7 @@ void CouplerMethod::dataTransferWrite()
   cf_assert(isSetup());
 
   pushNamespace();
+  ProfileScope profile(*this, "dataTransferWrite");
 
   dataTransferWriteImpl();
 
@@ -210,6 +217,7 @@ void CouplerMethod::finalize()
   cf_assert(isSetup());
 
   pushNamespace();
+  ProfileScope profile(*this, "finalize");
   
   finalizeImpl();
   
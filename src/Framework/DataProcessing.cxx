@@ -9,6 +9,7 @@
 #include "Framework/SubSystemStatus.hh"
 #include "Framework/Framework.hh"
 #include "Framework/DataProcessing.hh"
+#include "Framework/Profiler.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -111,7 +112,7 @@ void DataProcessing::processDataImpl()
     for(CFuint i = 0; i < m_dataprocessing.size(); ++i) {
       cf_assert(m_dataprocessing[i].isNotNull()); 
       CFLog(VERBOSE, "DataProcessing " << m_dataprocessing[i]->getClassName() << "->execute() during setup()\n");
-      m_dataprocessing[i]->execute();
+      profileExecute(m_dataprocessing[i]);
     }
   }
   else {
@@ -132,7 +133,7 @@ void DataProcessing::processDataImpl()
 	for(CFuint i = 0; i < m_dataprocessing.size(); ++i) {
 	  cf_assert(m_dataprocessing[i].isNotNull()); 
 	  CFLog(VERBOSE, "DataProcessing " << m_dataprocessing[i]->getClassName() << "->execute()\n");
-	  m_dataprocessing[i]->execute();
+	  profileExecute(m_dataprocessing[i]);
 	}
       }
     } 
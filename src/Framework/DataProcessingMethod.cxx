@@ -7,6 +7,7 @@
 #include "Framework/DataProcessingMethod.hh"
 #include "Framework/SubSystemStatus.hh"
 #include "Environment/CFEnv.hh"
+#include "Profiler.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -100,6 +101,7 @@ void DataProcessingMethod::processData()
   cf_assert(isSetup());
 
   pushNamespace();
+  ProfileScope profile(*this, "processData");
   
   if (SubSystemStatusStack::getActive()->getNbIter() < m_stopIter 
       && SubSystemStatusStack::getActive()->getNbIter() >= m_startIter ) {
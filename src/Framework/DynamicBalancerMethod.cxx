@@ -20,6 +20,7 @@
 #include "Framework/DynamicBalancerMethod.hh"
 //#include "Framework/DynamicBalancerMethodData.hh"
 #include "Framework/SubSystemStatus.hh"
+#include "Framework/Profiler.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -94,6 +95,7 @@ void DynamicBalancerMethod::doDynamicBalance()
   cf_assert(isSetup());
 
   pushNamespace();
+  ProfileScope profile(*this, "doDynamicBalance");
 
   doDynamicBalanceImpl();
 
@@ -5,6 +5,7 @@
 // See doc/lgpl.txt and doc/gpl.txt for the license text.
 
 #include "Framework/ErrorEstimatorMethod.hh"
+#include "Framework/Profiler.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -77,6 +78,7 @@ void ErrorEstimatorMethod::estimate()
   //cf_assert(isSpaceMethodSet());
 
   pushNamespace();
+  ProfileScope profile(*this, "estimate");
 
   estimateImpl();
 
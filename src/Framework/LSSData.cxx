@@ -39,7 +39,9 @@ LSSData::LSSData(SafePtr<std::valarray<bool> > maskArray,
     m_localToGlobal(),
     m_localToLocallyUpdateble(),
     m_maskArray(maskArray),
-    m_nbSysEquations(nbSysEquations)
+    m_nbSysEquations(nbSysEquations),
+    m_nbIterations(0),
+    m_reusePreconditioner(false)
 {
   addConfigOptionsTo(this);
   cf_assert(maskArray.isNotNull());
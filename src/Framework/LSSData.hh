@@ -115,6 +115,18 @@ public: // functions
   /// Flag telling to use node-based sparsity an assembly (instead of state-based)
   bool useNodeBased() const {return m_useNodeBased;}
   
+  /// Gets the number of iterations taken by the last solve
+  CFuint getNbIterations() const {return m_nbIterations;}
+  
+  /// Sets the number of iterations taken by the last solve
+  void setNbIterations(const CFuint nbIterations) {m_nbIterations = nbIterations;}
+  
+  /// Flag telling to reuse the current preconditioner in the next solve
+  bool isReusePreconditioner() const {return m_reusePreconditioner;}
+  
+  /// Sets the flag telling to reuse the current preconditioner in the next solve
+  void setReusePreconditioner(const bool reuse) {m_reusePreconditioner = reuse;}
+  
  private: // data
   
   /// mapping local to global indices numbering
@@ -153,6 +165,12 @@ public: // functions
   /// use node-based sparsity and assembly (instead of state-based)
   bool m_useNodeBased;
   
+  /// number of iterations taken by the last solve
+  CFuint m_nbIterations;
+  
+  /// reuse the current preconditioner in the next solve
+  bool m_reusePreconditioner;
+  
 }; // end of class LSSData
 
 //////////////////////////////////////////////////////////////////////////////
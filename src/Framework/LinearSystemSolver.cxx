@@ -9,6 +9,7 @@
 #include "Framework/NamespaceSwitcher.hh"
 #include "Framework/LSSData.hh"
 #include "Framework/SubSystemStatus.hh"
+#include "Framework/Profiler.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -134,6 +135,7 @@ void LinearSystemSolver::solveSys()
   cf_assert(isSetup());
 
   pushNamespace();
+  ProfileScope profile(*this, "solveSys");
 
   solveSysImpl();
 
@@ -154,6 +156,20 @@ Framework::LSSIdxMapping& LinearSystemSolver::getLocalToLocallyUpdatableMapping(
   return m_lssData->getLocalToLocallyUpdatableMapping();
 }
 
+//////////////////////////////////////////////////////////////////////////////
+
+CFuint LinearSystemSolver::getNbIterations() const
+{
+  return m_lssData->getNbIterations();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void LinearSystemSolver::setReusePreconditioner(const bool reuse)
+{
+  m_lssData->setReusePreconditioner(reuse);
+}
+
 //////////////////////////////////////////////////////////////////////////////
 
   } // namespace Framework
@@ -91,6 +91,14 @@ public: // methods
   /// Gets the size of the system of equations to solve
   CFuint getNbSysEqs() const {   return m_nbSysEquations;  }
 
+  /// Gets the number of iterations taken by the last solve,
+  /// 0 if the solver does not report it
+  CFuint getNbIterations() const;
+
+  /// Tells the solver to reuse (or not) its current preconditioner
+  /// in the next solve, if it is able to
+  void setReusePreconditioner(const bool reuse);
+
   /// Get the Preconditioner system matrix
   virtual Common::SafePtr<LSSMatrix> getPreconditionerMatrix() const
   {
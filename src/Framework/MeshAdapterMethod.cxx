@@ -5,6 +5,7 @@
 // See doc/lgpl.txt and doc/gpl.txt for the license text.
 
 #include "MeshAdapterMethod.hh"
+#include "Profiler.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -79,6 +80,7 @@ void MeshAdapterMethod::adaptMesh()
   cf_assert(isSetup());
 
   pushNamespace();
+  ProfileScope profile(*this, "adaptMesh");
 
   adaptMeshImpl();
 
@@ -95,6 +97,7 @@ void MeshAdapterMethod::remesh()
   cf_assert(isSetup());
 
   pushNamespace();
+  ProfileScope profile(*this, "remesh");
 
   remeshImpl();
 
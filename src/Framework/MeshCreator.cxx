@@ -11,6 +11,7 @@
 #include "Framework/MeshCreator.hh"
 #include "Framework/SpaceMethod.hh"
 #include "Framework/MethodData.hh"
+#include "Framework/Profiler.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -83,6 +84,7 @@ void MeshCreator::generateMeshData()
   cf_assert(isSetup());
 
   pushNamespace();
+  ProfileScope profile(*this, "generateMeshData");
 
   CFLog(NOTICE,"-------------------------------------------------------------\n");
   CFLog(NOTICE,"MeshCreator [" << getName() << "] Generate or Read Mesh\n");
@@ -106,6 +108,7 @@ void MeshCreator::processMeshData()
   cf_assert(isSetup());
 
   pushNamespace();
+  ProfileScope profile(*this, "processMeshData");
 
   /// @todo this could be a post generation hook not directly accessible from
   ///       the interface, maybe controled by commands
@@ -124,6 +127,7 @@ void MeshCreator::buildMeshData()
   cf_assert(isSetup());
 
   pushNamespace();
+  ProfileScope profile(*this, "buildMeshData");
 
   CFLog(NOTICE,"-------------------------------------------------------------\n");
   CFLog(NOTICE,"MeshCreator [" << getName() << "] Building Mesh Data\n");
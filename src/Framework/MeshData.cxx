@@ -49,6 +49,8 @@ MeshData::MeshData(const std::string& name) :
   m_nbOverLayers(1),
   m_allocated(true),
   m_sameNodeStateConnectivity(false),
+  m_deferStateSync(false),
+  m_stateSyncPending(false),
   m_totalStates(0),
   m_totalNodes(0),
   m_totalElements(),
@@ -499,6 +501,18 @@ DataSocketSink<Framework::State*, Framework::GLOBAL> MeshData::getStateDataSocke
   return socket_states;
 }
 
+//////////////////////////////////////////////////////////////////////////////
+
+void MeshData::completeStateSync()
+{
+  if (m_stateSyncPending) {
+    CFLog(DEBUG_MIN, "MeshData::completeStateSync() => ending pending sync\n");
+    DataHandle<State*, GLOBAL> states = socket_states.getDataHandle();
+    states.endSync();
+    m_stateSyncPending = false;
+  }
+}
+
 //////////////////////////////////////////////////////////////////////////////
 
   } // namespace Framework
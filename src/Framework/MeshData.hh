@@ -282,6 +282,23 @@ public: // methods
     return m_trsList;
   }
 
+  /// Tell the ConvergenceMethod to leave the synchronization of the states pending
+  /// after the update: the SpaceMethod will complete it while computing the residual
+  void setDeferStateSync(const bool flag) {m_deferStateSync = flag;}
+
+  /// Tell if the synchronization of the states can be left pending
+  bool isStateSyncDeferred() const {return m_deferStateSync;}
+
+  /// Set the flag telling that a synchronization of the states has been started
+  /// but not completed yet
+  void setStateSyncPending(const bool flag) {m_stateSyncPending = flag;}
+
+  /// Tell if a synchronization of the states has been started but not completed yet
+  bool isStateSyncPending() const {return m_stateSyncPending;}
+
+  /// Complete the pending synchronization of the states, if there is one
+  void completeStateSync();
+
   /// Default destructor
   ~MeshData();
 
@@ -324,6 +341,12 @@ private: // member data
 
   /// flag indicating if nodes and states have same connectivity
   bool m_sameNodeStateConnectivity;
+
+  /// flag telling if the synchronization of the states can be left pending
+  bool m_deferStateSync;
+
+  /// flag telling if a synchronization of the states is pending
+  bool m_stateSyncPending;
   
   // Global info
   
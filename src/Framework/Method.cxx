@@ -13,6 +13,7 @@
 #include "Framework/NamespaceSwitcher.hh"
 #include "Framework/MethodData.hh"
 #include "Framework/SubSystemStatus.hh"
+#include "Framework/Profiler.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -148,6 +149,7 @@ void Method::setMethod()
   cf_assert(!isSetup());
 
   pushNamespace();
+  ProfileScope profile(*this, "setMethod");
   
 
   // setup parent class
@@ -181,6 +183,7 @@ void Method::unsetMethod()
   cf_assert(isSetup());
 
   pushNamespace();
+  ProfileScope profile(*this, "unsetMethod");
   
   // unsetup derived classes
   this->unsetMethodImpl();
@@ -608,6 +611,7 @@ Method::getStrategyList() const
 void Method::executeCommands(const vector<std::string>& comNames)
 {
   pushNamespace();
+  ProfileScope profile(*this, "executeCommands");
 
   vector< Common::SafePtr<NumericalCommand> > comList = getCommandList();
   for (CFuint i = 0; i < comNames.size(); ++i)
@@ -12,6 +12,7 @@
 #include "Framework/SimulationStatus.hh"
 #include "Framework/PathAppender.hh"
 #include "Framework/NamespaceSwitcher.hh"
+#include "Framework/Profiler.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -151,6 +152,7 @@ void OutputFormatter::open()
   cf_assert(isSetup());
 
   pushNamespace();
+  ProfileScope profile(*this, "open");
 
   openImpl();
 
@@ -167,6 +169,7 @@ void OutputFormatter::write()
   cf_assert(isSetup());
 
   pushNamespace();
+  ProfileScope profile(*this, "write");
 
   writeImpl();
 
@@ -183,6 +186,7 @@ void OutputFormatter::close()
   cf_assert(isSetup());
 
   pushNamespace();
+  ProfileScope profile(*this, "close");
 
   closeImpl();
 
@@ -36,6 +36,9 @@ public:
   /// Gets the file extension to append to the file name
   virtual const std::string getWriterFileExtension() const = 0;
   
+  /// Completes all the writes that are still pending, if any
+  virtual void flush() {}
+  
  protected:
   
   /// Get the name of the writer
@@ -5,11 +5,14 @@
 // See doc/lgpl.txt and doc/gpl.txt for the license text.
 
 #include <sstream>
+#include <fstream>
+#include <algorithm>
 
 #include "Common/Stopwatch.hh"
 #include "Common/SwapEmpty.hh"
 #include "Common/CFLog.hh"
 #include "Environment/ObjectProvider.hh"
+#include "Environment/DirPaths.hh"
 #include "Framework/Framework.hh"
 #include "Framework/ParMetis.hh"
 #include "Framework/MeshData.hh"
@@ -37,6 +40,7 @@ void ParMetis::defineConfigOptions(Config::OptionList& options)
   options.addConfigOption< int >("NCommonNodes", "Parmetis parameter for mesh to graph conversion");
   options.addConfigOption< int >("RND","Random seed to use");
   options.addConfigOption< int >("Options","Parmetis options parameter");
+  options.addConfigOption< std::string >("CellCostFile","File with the cost of each element, used to weight the partitioning (relative to the results directory)");
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -58,6 +62,9 @@ ParMetis::ParMetis (const std::string & S)
 
   IN_RND_ = 15;
   setParameter("RND",&IN_RND_);
+  
+  m_cellCostFile = "";
+  setParameter("CellCostFile",&m_cellCostFile);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -105,7 +112,17 @@ void ParMetis::doPartition(PartitionerData& pData)
   PartitionerData::IndexT numflag = 0;
   PartitionerData::IndexT ncommonnodes = IN_NCommonNodes_;
   PartitionerData::IndexT edgecut = 0;
-  PartitionerData::IndexT* idxdummy = NULL;
+  PartitionerData::IndexT* elmwgt = NULL;
+  
+  bool useWeights = !pData.elemWeight.empty();
+  if (!useWeights && m_cellCostFile != "") {
+    useWeights = readElementWeights(pData, CommRank);
+  }
+  if (useWeights) {
+    cf_assert(pData.elemWeight.size() == (size_t)(pData.elmdist[CommRank+1] - pData.elmdist[CommRank]));
+    weightflag = 2;
+    elmwgt = (pData.elemWeight.size() > 0) ? &pData.elemWeight[0] : NULL;
+  }
   
   CFLogDebugMin( "Calling ParMetis::doPartition()\n");
   Common::Stopwatch<Common::WallTime> MetisTimer;
@@ -146,8 +163,8 @@ void ParMetis::doPartition(PartitionerData& pData)
   ParMETIS_V3_PartMeshKway (&pData.elmdist[0], // distribution of the elements (= for every cpu)
 			    &pData.eptrn[0],  // contains for each element index of the element nodes
 			    &pData.elemNode[0],    // element nodes
-			    idxdummy,     // weight of the elements // note here a big difference with ParMETIS 3.1
-			    &weightflag,  // 0 -> no weights
+			    elmwgt,       // weight of the elements // note here a big difference with ParMETIS 3.1
+			    &weightflag,  // 0 -> no weights, 2 -> element weights
 			    &numflag,     // numbering starts at index 0
 			    &ncon,       // number of weights on each vertex
 			    &ncommonnodes,// connectivity degree
@@ -180,6 +197,55 @@ void ParMetis::doPartition(PartitionerData& pData)
   CFLog(NOTICE, "ParMetis::doPartition() took " << MetisTimer << "\n");
 }
 
+/////////////////////////////////////////////////////////////////////////////
+
+bool ParMetis::readElementWeights(PartitionerData& pData, const int rank)
+{
+  CFAUTOTRACE;
+  
+  // the costs are normalized by their average: they are scaled by this
+  // factor before being truncated, to keep two significant digits
+  const CFreal costScale = 100.;
+  
+  const PartitionerData::IndexT start = pData.elmdist[rank];
+  const PartitionerData::IndexT end   = pData.elmdist[rank+1];
+  
+  // the cost file is written in the results directory by the cost monitors
+  boost::filesystem::path file =
+    Environment::DirPaths::getInstance().getResultsDir() / boost::filesystem::path(m_cellCostFile);
+  std::ifstream fin(file.string().c_str());
+  
+  int isValid = 0;
+  if (fin) {
+    PartitionerData::IndexT nbElems = 0;
+    fin >> nbElems;
+    if (nbElems == pData.elmdist.back()) {
+      pData.elemWeight.resize(end - start);
+      CFreal cost = 0.;
+      for (PartitionerData::IndexT i = 0; i < end && fin >> cost; ++i) {
+	if (i >= start) {
+	  pData.elemWeight[i - start] = 
+	    std::max((PartitionerData::IndexT)1, (PartitionerData::IndexT)(cost*costScale + 0.5));
+	}
+      }
+      isValid = (fin) ? 1 : 0;
+    }
+  }
+  
+  // all the ranks have to agree on the use of the weights
+  int allValid = 0;
+  MPI_Allreduce(&isValid, &allValid, 1, MPI_INT, MPI_MIN, Communicator_);
+  if (allValid == 0) {
+    CFLog(WARN, "ParMetis::readElementWeights() => " << file.string() 
+	  << " missing or not matching the mesh, elements are not weighted\n");
+    std::vector<PartitionerData::IndexT>().swap(pData.elemWeight);
+    return false;
+  }
+  
+  CFLog(NOTICE, "ParMetis: elements weighted by the costs in " << file.string() << "\n");
+  return true;
+}
+
 /////////////////////////////////////////////////////////////////////////////
 
     }
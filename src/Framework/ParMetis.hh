@@ -22,7 +22,11 @@ namespace COOLFluiD {
 ///   * Other partition methods (geom, ...) -> needs node information
 ///       -> will need method to interrogate MeshPartitioner if node data
 ///           should be present
-///   * weight array? (hybrid meshes!)
+/// The elements can be weighted by their computational cost, either given
+/// by the mesh reader in PartitionerData::elemWeight or read from the file
+/// given by the "CellCostFile" option (one cost per element, in global
+/// element order, as written in the results directory by a cell cost
+/// monitor in a previous run or before a restart).
 class Framework_API ParMetis : public MeshPartitioner
 {
 public:
@@ -43,6 +47,11 @@ public:
   
 protected:
   
+  /// Read the costs of the local elements from the cell cost file and
+  /// convert them into integer element weights
+  /// @return true if the weights have been read on all the ranks
+  bool readElementWeights(PartitionerData& pData, const int rank);
+  
   std::vector<PartitionerData::IndexT> eptr;
   std::vector<PartitionerData::IndexT> eidx;
   std::vector<PartitionerData::IndexT> elmdist;
@@ -52,6 +61,9 @@ protected:
   int IN_NCommonNodes_;
   int IN_Options_;
   int IN_RND_;
+  
+  /// name of the file with the cost of each element
+  std::string m_cellCostFile;
 };
 
 //////////////////////////////////////////////////////////////////////////////
@@ -65,6 +65,10 @@ struct Framework_API PartitionerData : public Common::NonCopyable<PartitionerDat
   /// array to store the element state pointers
   std::vector<IndexT> eptrs;
   
+  /// array to store the weights of the locally stored elements
+  /// (left empty if all the elements have the same weight)
+  std::vector<IndexT> elemWeight;
+  
   /// array to store the processor IDs of the locally stored
   /// nodes after the call to the MeshPartitioner
   std::vector<IndexT>* part;
@@ -138,6 +138,13 @@ protected: // helper functions
     return _isBoundaryFace;
   }
   
+  /// Set the flag telling if the face is on the boundary, for
+  /// extrapolations that are not done through extrapolate()
+  void setIsBoundaryFace(bool isBoundaryFace)
+  {
+    _isBoundaryFace = isBoundaryFace;
+  }
+  
   /// Extrapolate the solution in the quadrature points of
   /// the given face
   virtual void extrapolateImpl(GeometricEntity* const face) = 0;
@@ -0,0 +1,431 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+#include "Common/PE.hh"
+#include "Common/MPI/MPIStructDef.hh"
+#include "Common/CFLog.hh"
+#include "Environment/DirPaths.hh"
+#include "Framework/Profiler.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Framework {
+
+//////////////////////////////////////////////////////////////////////////////
+
+bool Profiler::m_active = false;
+
+//////////////////////////////////////////////////////////////////////////////
+
+Profiler& Profiler::getInstance()
+{
+  static Profiler singleton;
+  return singleton;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+Profiler::Profiler() :
+  m_prefix("profile"),
+  m_clock(),
+  m_nodes(),
+  m_stack(),
+  m_paths(),
+  m_pathNodes(),
+  m_nbSyncedNodes(0),
+  m_iterFile()
+{
+  // root of the call tree
+  addNode(0, "", "");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+Profiler::~Profiler()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void Profiler::activate(const std::string& prefix)
+{
+  if (m_active) return;
+
+  m_prefix = prefix;
+  m_active = true;
+  m_clock.start();
+
+  if (PE::GetPE().GetRank("Default") == 0) {
+    const boost::filesystem::path fpath =
+      Environment::DirPaths::getInstance().getResultsDir() / (m_prefix + "-iter.csv");
+    m_iterFile.open(fpath.string().c_str());
+    m_iterFile << "Iter,Path,Calls,Incl.min,Incl.avg,Incl.max,Excl.min,Excl.avg,Excl.max\n";
+  }
+
+  CFLog(INFO, "Profiler::activate() => profiling the Methods and the NumericalCommands\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFuint Profiler::addNode(const CFuint parent, const std::string& owner, const char* action)
+{
+  Node node;
+  node.owner = owner;
+  node.action = action;
+  node.parent = parent;
+  node.calls = 0;
+  node.time = 0.;
+  node.childTime = 0.;
+  node.iterCalls = 0;
+  node.iterTime = 0.;
+  node.iterChildTime = 0.;
+
+  const CFuint iNode = m_nodes.size();
+  m_nodes.push_back(node);
+  if (iNode > 0) {
+    m_nodes[parent].children.push_back(iNode);
+  }
+  return iNode;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void Profiler::start(const std::string& owner, const char* action)
+{
+  const CFuint parent = (m_stack.size() > 0) ? m_stack.back().first : 0;
+
+  // look for this action among the ones already called by the parent
+  CFuint iNode = 0;
+  const vector<CFuint>& children = m_nodes[parent].children;
+  for (CFuint i = 0; i < children.size(); ++i) {
+    const Node& child = m_nodes[children[i]];
+    if (std::strcmp(child.action, action) == 0 && child.owner == owner) {
+      iNode = children[i];
+      break;
+    }
+  }
+  if (iNode == 0) {
+    iNode = addNode(parent, owner, action);
+  }
+
+  m_stack.push_back(make_pair(iNode, static_cast<CFdouble>(m_clock.read())));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void Profiler::stop()
+{
+  cf_assert(m_stack.size() > 0);
+
+  const CFuint iNode = m_stack.back().first;
+  const CFdouble elapsed = m_clock.read() - m_stack.back().second;
+  m_stack.pop_back();
+
+  Node& node = m_nodes[iNode];
+  node.calls++;
+  node.time += elapsed;
+  node.iterCalls++;
+  node.iterTime += elapsed;
+
+  Node& parent = m_nodes[node.parent];
+  parent.childTime += elapsed;
+  parent.iterChildTime += elapsed;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+std::string Profiler::getPath(const CFuint iNode) const
+{
+  if (iNode == 0) return "";
+
+  const Node& node = m_nodes[iNode];
+  const std::string name = node.owner + "::" + node.action;
+  return (node.parent == 0) ? name : getPath(node.parent) + "/" + name;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// @return the given string as a JSON string, with quotes
+static string toJSON(const string& str)
+{
+  ostringstream out;
+  out << '"';
+  for (CFuint i = 0; i < str.size(); ++i) {
+    const unsigned char c = str[i];
+    switch (c) {
+    case '"':  out << "\\\""; break;
+    case '\\': out << "\\\\"; break;
+    case '\n': out << "\\n"; break;
+    case '\t': out << "\\t"; break;
+    case '\r': out << "\\r"; break;
+    default:
+      if (c < 0x20) {
+	out << "\\u" << hex << setw(4) << setfill('0') << static_cast<int>(c)
+	    << dec << setfill(' ');
+      }
+      else {
+	out << str[i];
+      }
+    }
+  }
+  out << '"';
+  return out.str();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// @return the given string as a CSV field, quoted if needed
+static string toCSV(const string& str)
+{
+  if (str.find_first_of(",\"\n") == string::npos) return str;
+
+  string field = "\"";
+  for (CFuint i = 0; i < str.size(); ++i) {
+    if (str[i] == '"') field += '"';
+    field += str[i];
+  }
+  return field + "\"";
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void Profiler::syncPaths(const std::string& nsp)
+{
+  CFuint changed = (m_nodes.size() != m_nbSyncedNodes) ? 1 : 0;
+#ifdef CF_HAVE_MPI
+  MPI_Comm comm = PE::GetPE().GetCommunicator(nsp);
+  CFuint anyChanged = 0;
+  MPI_Allreduce(&changed, &anyChanged, 1, MPIStructDef::getMPIType(&changed), MPI_MAX, comm);
+  changed = anyChanged;
+#endif
+  if (changed == 0) return;
+  m_nbSyncedNodes = m_nodes.size();
+
+  map<string, CFuint> pathToNode;
+  for (CFuint i = 1; i < m_nodes.size(); ++i) {
+    pathToNode[getPath(i)] = i;
+  }
+
+  // the call trees can differ among the processes: gather the union of all the paths
+  m_paths.clear();
+#ifdef CF_HAVE_MPI
+  int rank = 0;
+  int nbRanks = 1;
+  MPI_Comm_rank(comm, &rank);
+  MPI_Comm_size(comm, &nbRanks);
+
+  string localPaths;
+  for (map<string, CFuint>::const_iterator it = pathToNode.begin(); it != pathToNode.end(); ++it) {
+    localPaths += it->first + "\n";
+  }
+  int localSize = localPaths.size();
+  vector<int> sizes(nbRanks, 0);
+  MPI_Gather(&localSize, 1, MPI_INT, &sizes[0], 1, MPI_INT, 0, comm);
+
+  vector<int> displs(nbRanks, 0);
+  for (int r = 1; r < nbRanks; ++r) {
+    displs[r] = displs[r-1] + sizes[r-1];
+  }
+  vector<char> allPaths(displs[nbRanks-1] + sizes[nbRanks-1] + 1, '\0');
+  MPI_Gatherv(const_cast<char*>(localPaths.c_str()), localSize, MPI_CHAR,
+	      &allPaths[0], &sizes[0], &displs[0], MPI_CHAR, 0, comm);
+
+  string joined;
+  if (rank == 0) {
+    set<string> pathSet;
+    istringstream in(string(allPaths.begin(), allPaths.end() - 1));
+    for (string line; getline(in, line); ) {
+      if (!line.empty()) pathSet.insert(line);
+    }
+    for (set<string>::const_iterator it = pathSet.begin(); it != pathSet.end(); ++it) {
+      joined += *it + "\n";
+    }
+  }
+  int joinedSize = joined.size();
+  MPI_Bcast(&joinedSize, 1, MPI_INT, 0, comm);
+  vector<char> joinedBuf(joinedSize + 1, '\0');
+  if (rank == 0) {
+    std::copy(joined.begin(), joined.end(), joinedBuf.begin());
+  }
+  MPI_Bcast(&joinedBuf[0], joinedSize, MPI_CHAR, 0, comm);
+
+  istringstream in(string(joinedBuf.begin(), joinedBuf.end() - 1));
+  for (string line; getline(in, line); ) {
+    if (!line.empty()) m_paths.push_back(line);
+  }
+#else
+  for (map<string, CFuint>::const_iterator it = pathToNode.begin(); it != pathToNode.end(); ++it) {
+    m_paths.push_back(it->first);
+  }
+#endif
+
+  m_pathNodes.assign(m_paths.size(), 0);
+  for (CFuint p = 0; p < m_paths.size(); ++p) {
+    map<string, CFuint>::const_iterator it = pathToNode.find(m_paths[p]);
+    if (it != pathToNode.end()) {
+      m_pathNodes[p] = it->second;
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void Profiler::reduce(const std::string& nsp, vector<CFdouble>& values,
+		      vector<CFdouble>& minV, vector<CFdouble>& maxV,
+		      vector<CFdouble>& sumV) const
+{
+  minV = values;
+  maxV = values;
+  sumV = values;
+#ifdef CF_HAVE_MPI
+  if (values.size() > 0) {
+    MPI_Comm comm = PE::GetPE().GetCommunicator(nsp);
+    const int count = values.size();
+    MPI_Reduce(&values[0], &minV[0], count, MPI_DOUBLE, MPI_MIN, 0, comm);
+    MPI_Reduce(&values[0], &maxV[0], count, MPI_DOUBLE, MPI_MAX, 0, comm);
+    MPI_Reduce(&values[0], &sumV[0], count, MPI_DOUBLE, MPI_SUM, 0, comm);
+  }
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void Profiler::endIteration(const CFuint iter, const std::string& nsp)
+{
+  if (!m_active) return;
+
+  syncPaths(nsp);
+
+  // inclusive time, exclusive time and number of calls of each path in this iteration
+  const CFuint nbPaths = m_paths.size();
+  vector<CFdouble> local(3*nbPaths, 0.);
+  for (CFuint p = 0; p < nbPaths; ++p) {
+    if (m_pathNodes[p] > 0) {
+      const Node& node = m_nodes[m_pathNodes[p]];
+      local[3*p]   = node.iterTime;
+      local[3*p+1] = node.iterTime - node.iterChildTime;
+      local[3*p+2] = node.iterCalls;
+    }
+  }
+
+  vector<CFdouble> minV;
+  vector<CFdouble> maxV;
+  vector<CFdouble> sumV;
+  reduce(nsp, local, minV, maxV, sumV);
+
+  if (m_iterFile.is_open()) {
+    const CFdouble invNbRanks = 1./static_cast<CFdouble>(PE::GetPE().GetProcessorCount(nsp));
+    for (CFuint p = 0; p < nbPaths; ++p) {
+      if (sumV[3*p+2] > 0.) {
+	m_iterFile << iter << "," << toCSV(m_paths[p]) << "," << sumV[3*p+2]*invNbRanks
+		   << "," << minV[3*p] << "," << sumV[3*p]*invNbRanks << "," << maxV[3*p]
+		   << "," << minV[3*p+1] << "," << sumV[3*p+1]*invNbRanks << "," << maxV[3*p+1]
+		   << "\n";
+      }
+    }
+    m_iterFile.flush();
+  }
+
+  for (CFuint i = 1; i < m_nodes.size(); ++i) {
+    Node& node = m_nodes[i];
+    node.iterCalls = 0;
+    node.iterTime = 0.;
+    node.iterChildTime = 0.;
+  }
+  m_nodes[0].iterChildTime = 0.;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void Profiler::report(const std::string& nsp)
+{
+  if (!m_active) return;
+
+  syncPaths(nsp);
+
+  // inclusive time, exclusive time and number of calls of each path
+  const CFuint nbPaths = m_paths.size();
+  vector<CFdouble> local(3*nbPaths, 0.);
+  for (CFuint p = 0; p < nbPaths; ++p) {
+    if (m_pathNodes[p] > 0) {
+      const Node& node = m_nodes[m_pathNodes[p]];
+      local[3*p]   = node.time;
+      local[3*p+1] = node.time - node.childTime;
+      local[3*p+2] = node.calls;
+    }
+  }
+
+  vector<CFdouble> minV;
+  vector<CFdouble> maxV;
+  vector<CFdouble> sumV;
+  reduce(nsp, local, minV, maxV, sumV);
+
+  if (PE::GetPE().GetRank(nsp) == 0) {
+    const CFuint nbRanks = PE::GetPE().GetProcessorCount(nsp);
+    const CFdouble invNbRanks = 1./static_cast<CFdouble>(nbRanks);
+
+    // table on screen, indented according to the depth in the call tree
+    ostringstream table;
+    table << "\n" << setw(60) << left << "Profile (min/avg/max over "
+	  << nbRanks << " processes)" << right
+	  << setw(12) << "Calls" << setw(12) << "Incl.min" << setw(12) << "Incl.avg"
+	  << setw(12) << "Incl.max" << setw(12) << "Excl.avg" << "\n";
+    table << fixed << setprecision(3);
+    for (CFuint p = 0; p < nbPaths; ++p) {
+      const string& path = m_paths[p];
+      const size_t depth = std::count(path.begin(), path.end(), '/');
+      const size_t last = path.rfind('/');
+      const string name = string(2*depth, ' ') +
+	((last == string::npos) ? path : path.substr(last + 1));
+      table << setw(60) << left << name.substr(0, 59) << right
+	    << setw(12) << static_cast<CFuint>(sumV[3*p+2]*invNbRanks)
+	    << setw(12) << minV[3*p] << setw(12) << sumV[3*p]*invNbRanks
+	    << setw(12) << maxV[3*p] << setw(12) << sumV[3*p+1]*invNbRanks << "\n";
+    }
+    CFLog(INFO, table.str());
+
+    const boost::filesystem::path fpath =
+      Environment::DirPaths::getInstance().getResultsDir() / (m_prefix + ".json");
+    ofstream fout(fpath.string().c_str());
+    fout << "{\n  \"processes\": " << nbRanks << ",\n  \"entries\": [\n";
+    for (CFuint p = 0; p < nbPaths; ++p) {
+      fout << "    {\"path\": " << toJSON(m_paths[p])
+	   << ", \"calls\": " << sumV[3*p+2]*invNbRanks
+	   << ", \"inclusive\": {\"min\": " << minV[3*p] << ", \"avg\": "
+	   << sumV[3*p]*invNbRanks << ", \"max\": " << maxV[3*p] << "}"
+	   << ", \"exclusive\": {\"min\": " << minV[3*p+1] << ", \"avg\": "
+	   << sumV[3*p+1]*invNbRanks << ", \"max\": " << maxV[3*p+1] << "}}"
+	   << ((p + 1 < nbPaths) ? ",\n" : "\n");
+    }
+    fout << "  ]\n}\n";
+  }
+
+  if (m_iterFile.is_open()) {
+    m_iterFile.close();
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace Framework
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,205 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_Framework_Profiler_hh
+#define COOLFluiD_Framework_Profiler_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <fstream>
+
+#include "Common/NonCopyable.hh"
+#include "Common/Stopwatch.hh"
+#include "Framework/Framework.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Framework {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class collects the wall time spent inside the actions of the Method's
+/// and inside the NumericalCommand's, organized as a call tree, so that the
+/// time of one iteration can be split hierarchically (e.g. takeStep, inside it
+/// computeSpaceResidual, solveSys, the update command, etc.).
+/// For each node of the tree, it keeps the number of calls, the inclusive time
+/// and the exclusive time (inclusive minus the time of the children).
+/// The profiler is enabled by the environment variable CF_PROFILE or by the
+/// SubSystem option "Profile"; when disabled, each ProfileScope costs a
+/// single test of a static flag.
+/// At the end of each iteration, the times of that iteration are reduced over
+/// all the ranks (min/max/avg) and appended by rank 0 to <prefix>-iter.csv.
+/// At the end of the run, the total times are reduced in the same way,
+/// printed as a table and written to <prefix>.json.
+/// The commands are timed where the Method's execute them (profileExecute()).
+/// @author Andrea Lani
+class Framework_API Profiler : public Common::NonCopyable<Profiler> {
+public:
+
+  /// @return the instance of this singleton
+  static Profiler& getInstance();
+
+  /// Tell if profiling is active
+  static bool isActive() {return m_active;}
+
+  /// Activate the profiling
+  /// @param prefix prefix of the output files
+  void activate(const std::string& prefix);
+
+  /// Start timing the given action of the given owner, nested in the
+  /// action being currently timed
+  /// @param owner  name of the owner (Method, NumericalCommand, ...)
+  /// @param action name of the action (must be a string literal)
+  void start(const std::string& owner, const char* action);
+
+  /// Stop timing the current action
+  void stop();
+
+  /// Reduce the times of the iteration which just ended over all the
+  /// processes and write them
+  /// @param iter number of the iteration
+  /// @param nsp  namespace whose communicator is used for the reduction
+  /// @post this is a collective call
+  void endIteration(const CFuint iter, const std::string& nsp);
+
+  /// Reduce the times over all the processes and write the final report
+  /// @param nsp namespace whose communicator is used for the reduction
+  /// @post this is a collective call
+  void report(const std::string& nsp);
+
+private:
+
+  /// node of the call tree
+  struct Node {
+    /// name of the owner
+    std::string owner;
+    /// name of the action
+    const char* action;
+    /// parent node
+    CFuint parent;
+    /// children nodes
+    std::vector<CFuint> children;
+    /// total number of calls
+    CFuint calls;
+    /// total inclusive time
+    CFdouble time;
+    /// total inclusive time of the children
+    CFdouble childTime;
+    /// number of calls in the current iteration
+    CFuint iterCalls;
+    /// inclusive time in the current iteration
+    CFdouble iterTime;
+    /// inclusive time of the children in the current iteration
+    CFdouble iterChildTime;
+  };
+
+  /// Constructor
+  Profiler();
+
+  /// Destructor
+  ~Profiler();
+
+  /// Get the path of the given node in the call tree
+  std::string getPath(const CFuint iNode) const;
+
+  /// Add a node to the call tree
+  CFuint addNode(const CFuint parent, const std::string& owner, const char* action);
+
+  /// Update the union of the call paths of all the processes, if the call
+  /// tree of any process has changed since the last update
+  /// @post this is a collective call
+  void syncPaths(const std::string& nsp);
+
+  /// Reduce the given values, three per path, over all the processes
+  /// @post this is a collective call
+  void reduce(const std::string& nsp, std::vector<CFdouble>& values,
+	      std::vector<CFdouble>& minV, std::vector<CFdouble>& maxV,
+	      std::vector<CFdouble>& sumV) const;
+
+private:
+
+  /// flag telling if the profiling is active
+  static bool m_active;
+
+  /// prefix of the output files
+  std::string m_prefix;
+
+  /// clock common to all the timers
+  Common::Stopwatch<Common::WallTime> m_clock;
+
+  /// nodes of the call tree (the first one is the root)
+  std::vector<Node> m_nodes;
+
+  /// stack of the timed nodes with their starting times
+  std::vector<std::pair<CFuint, CFdouble> > m_stack;
+
+  /// union of the call paths of all the processes, sorted
+  std::vector<std::string> m_paths;
+
+  /// local node of each path (0 if the path was never called here)
+  std::vector<CFuint> m_pathNodes;
+
+  /// number of local nodes when the paths were last updated
+  CFuint m_nbSyncedNodes;
+
+  /// file with the times of each iteration
+  std::ofstream m_iterFile;
+
+}; // end of class Profiler
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class times the enclosing scope with the Profiler
+/// @author Andrea Lani
+class ProfileScope : public Common::NonCopyable<ProfileScope> {
+public:
+
+  /// Constructor
+  /// @param owner  owner of the action (Method, NumericalCommand, ...),
+  ///               whose name is only asked if the profiler is active
+  /// @param action name of the action (must be a string literal)
+  template <typename OWNER>
+  ProfileScope(const OWNER& owner, const char* action) :
+    m_active(Profiler::isActive())
+  {
+    if (m_active) {Profiler::getInstance().start(owner.getName(), action);}
+  }
+
+  /// Destructor
+  ~ProfileScope()
+  {
+    if (m_active) {Profiler::getInstance().stop();}
+  }
+
+private:
+
+  /// flag telling if the profiler was active when this scope started
+  bool m_active;
+
+}; // end of class ProfileScope
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// Execute the given NumericalCommand, timing it with the Profiler
+/// @param com (smart) pointer to the command
+template <typename COMMAND_PTR>
+inline void profileExecute(const COMMAND_PTR& com)
+{
+  ProfileScope profile(*com, "execute");
+  com->execute();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace Framework
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Framework_Profiler_hh
@@ -15,6 +15,7 @@
 #include "Framework/MeshDataBuilder.hh"
 #include "Framework/GlobalJacobianSparsity.hh"
 #include "Framework/SubSystemStatus.hh"
+#include "Framework/Profiler.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -132,6 +133,7 @@ void SpaceMethod::initializeSolution()
   cf_assert(isSetup());
   
   pushNamespace();
+  ProfileScope profile(*this, "initializeSolution");
   
   getSpaceMethodData()->setIsRestart(m_restart); 
   initializeSolutionImpl(m_restart);
@@ -151,6 +153,7 @@ void SpaceMethod::prepareComputation()
   cf_assert(isSetup());
 
   pushNamespace();
+  ProfileScope profile(*this, "prepareComputation");
 
   prepareComputationImpl();
 
@@ -167,6 +170,7 @@ void SpaceMethod::computeSpaceResidual(CFreal factor)
   cf_assert(isSetup());
 
   pushNamespace();
+  ProfileScope profile(*this, "computeSpaceResidual");
 
   computeSpaceResidualImpl(factor);
 
@@ -183,6 +187,7 @@ void SpaceMethod::computeTimeResidual(CFreal factor)
   cf_assert(isSetup());
 
   pushNamespace();
+  ProfileScope profile(*this, "computeTimeResidual");
 
   computeTimeResidualImpl(factor);
 
@@ -199,6 +204,7 @@ void SpaceMethod::applyBC()
   cf_assert(isSetup());
 
   pushNamespace();
+  ProfileScope profile(*this, "applyBC");
 
   applyBCImpl();
 
@@ -215,6 +221,7 @@ void SpaceMethod::postProcessSolution()
   cf_assert(isSetup());
 
   pushNamespace();
+  ProfileScope profile(*this, "postProcessSolution");
 
   postProcessSolutionImpl();
 
@@ -263,6 +270,7 @@ void SpaceMethod::computeSpaceRhsForStatesSet(CFreal factor)
   cf_assert(isSetup());
 
   pushNamespace();
+  ProfileScope profile(*this, "computeSpaceRhsForStatesSet");
 
   computeSpaceRhsForStatesSetImpl(factor);
 
@@ -279,6 +287,7 @@ void SpaceMethod::computeTimeRhsForStatesSet(CFreal factor)
   cf_assert(isSetup());
 
   pushNamespace();
+  ProfileScope profile(*this, "computeTimeRhsForStatesSet");
 
   computeTimeRhsForStatesSetImpl(factor);
 
@@ -295,6 +304,7 @@ void SpaceMethod::extrapolateStatesToNodes()
   cf_assert(isSetup());
 
   pushNamespace();
+  ProfileScope profile(*this, "extrapolateStatesToNodes");
 
   extrapolateStatesToNodesImpl();
 
@@ -373,6 +383,7 @@ Common::Signal::return_t SpaceMethod::beforeMeshUpdateAction(Common::Signal::arg
   cf_assert(isSetup());
 
   pushNamespace();
+  ProfileScope profile(*this, "beforeMeshUpdateAction");
 
   Common::Signal::return_t ret = beforeMeshUpdateActionImpl(eBefore);
 
@@ -391,6 +402,7 @@ Common::Signal::return_t SpaceMethod::afterMeshUpdateAction(Common::Signal::arg_
   cf_assert(isSetup());
 
   pushNamespace();
+  ProfileScope profile(*this, "afterMeshUpdateAction");
 
   Common::Signal::return_t ret = afterMeshUpdateActionImpl(eAfter);
 
@@ -42,6 +42,7 @@
 #include "Framework/Namespace.hh"
 #include "Framework/Framework.hh"
 #include "Framework/SimulationStatus.hh"
+#include "Framework/Profiler.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -91,6 +92,8 @@ void StandardSubSystem::defineConfigOptions(Config::OptionList& options)
    options.addConfigOption< CFuint >("InitialIter","Initial Iteration Number.");
    options.addConfigOption< CFreal >("InitialTime","Initial Physical Time of the SubSystem.");
    options.addConfigOption< int, Config::DynamicOption<> >("StopSimulation","Flag to force an immediate stop of the simulation.");
+   options.addConfigOption< bool >("Profile","Profile the Methods and the NumericalCommands (also enabled by the environment variable CF_PROFILE).");
+   options.addConfigOption< std::string >("ProfileFile","Prefix of the profiling files.");
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -155,6 +158,12 @@ StandardSubSystem::StandardSubSystem(const std::string& name)
 
   m_forcedStop = 0;
   setParameter("StopSimulation",&m_forcedStop);
+
+  m_profile = false;
+  setParameter("Profile",&m_profile);
+
+  m_profileFile = "profile";
+  setParameter("ProfileFile",&m_profileFile);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -609,6 +618,11 @@ void StandardSubSystem::run()
   Stopwatch<WallTime> stopTimer;
   stopTimer.start();
   
+  const char* profileEnv = std::getenv("CF_PROFILE");
+  if (m_profile || (profileEnv != CFNULL && std::string(profileEnv) != "0")) {
+    Profiler::getInstance().activate(m_profileFile);
+  }
+  
   // each processor has all the methods and sockets allocated,
   // but data have size > 0 only in ranks corresponding to the right namespace
   /*const int rank = Common::PE::GetPE().GetRank("Default");
@@ -654,6 +668,12 @@ void StandardSubSystem::run()
     runSerial<void, InteractiveParamReader, &InteractiveParamReader::readFile>
       (&*getInteractiveParamReader(), ssGroupName, false);
     
+    // methods other than the SpaceMethod need fully synchronized states
+    if (m_dataPreProcessing.size() > 0 || m_couplerMethod.size() > 0 || 
+	m_meshAdapterMethod.size() > 0) {
+      completeStateSync();
+    }
+    
     CFLog(VERBOSE, "StandardSubSystem::run() => m_dataPreProcessing.apply()\n");
     // pre-process the data
     m_dataPreProcessing.apply(mem_fun<void,DataProcessingMethod>
@@ -675,6 +695,11 @@ void StandardSubSystem::run()
     m_convergenceMethod.apply(root_mem_fun<void,ConvergenceMethod>
                               (&ConvergenceMethod::takeStep));
     
+    if (m_errorEstimatorMethod.size() > 0 || m_dataPostProcessing.size() > 0 || 
+	m_couplerMethod.size() > 0 || m_meshAdapterMethod.size() > 0) {
+      completeStateSync();
+    }
+    
     CFLog(VERBOSE, "StandardSubSystem::run() => m_errorEstimatorMethod.apply()\n");
     // estimate errors
     m_errorEstimatorMethod.apply(mem_fun<void,ErrorEstimatorMethod>
@@ -704,8 +729,12 @@ void StandardSubSystem::run()
     bool dontforce = false;
     writeSolution(dontforce);
     
+    Profiler::getInstance().endIteration(currSSS->getNbIter(), "Default");
+    
   } // end for convergence loop
   
+  completeStateSync();
+  
   // finalize the coupling
   m_couplerMethod.apply(mem_fun<void,CouplerMethod>(&CouplerMethod::finalize));
   
@@ -718,6 +747,8 @@ void StandardSubSystem::run()
   
   stopTimer.stop();
   
+  Profiler::getInstance().report("Default");
+  
   CFLog(NOTICE, "SubSystem WallTime: " << stopTimer << "s\n");
   m_duration = subSysStatusVec[0]->readWatchHMS();
  
@@ -952,6 +983,8 @@ void StandardSubSystem::writeSolution(const bool force_write )
     {
       if(m_outputFormat[i]->isSaveNow( force_write ) )
       {
+        completeStateSync();
+        
         Stopwatch<WallTime> stopTimer;
         stopTimer.start();
         CFLog(VERBOSE, "StandardSubSystem::writeSolution() => output from [" << m_outputFormat[i]->getName() << "] START\n");
@@ -968,6 +1001,16 @@ void StandardSubSystem::writeSolution(const bool force_write )
 
 //////////////////////////////////////////////////////////////////////////////
 
+void StandardSubSystem::completeStateSync()
+{
+  vector<Common::SafePtr<MeshData> > meshDataVec = MeshDataStack::getInstance().getAllEntries();
+  for (CFuint i = 0; i < meshDataVec.size(); ++i) {
+    meshDataVec[i]->completeStateSync();
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 void StandardSubSystem::configurePhysicalModel ( Config::ConfigArgs& args )
 {
 
@@ -136,6 +136,10 @@ protected: // functions
   /// tell if to keep on iterating
   bool iterate(Common::SafePtr<Framework::SubSystemStatus> currSSS);
   
+  /// complete the synchronizations of the states left pending by the
+  /// ConvergenceMethod, before running methods that could need the ghost states
+  void completeStateSync();
+  
  protected: // data
     
   /// Duration of the simulation of this SubSystem
@@ -201,6 +205,12 @@ protected: // functions
   ///flag to force stopping the run()
   int m_forcedStop;
 
+  /// flag telling to profile the Methods and the NumericalCommands
+  bool m_profile;
+
+  /// prefix of the profiling files
+  std::string m_profileFile;
+
 }; // class StandardSubSystem
 
 //////////////////////////////////////////////////////////////////////////////
@@ -8,6 +8,7 @@
 
 #include "VectorialFunction.hh"
 #include "MathTools/FunctionParser.hh"
+#include "MathTools/ByteCodeFunction.hh"
 #include <math.h>
 //////////////////////////////////////////////////////////////////////////////
 
@@ -25,18 +26,56 @@ namespace COOLFluiD {
 VectorialFunction::VectorialFunction()
   : m_isParsed(false),
     m_vars(""),
+    m_varNames(),
     m_nbVars(0),
     m_functions(0),
     m_parsers(),
+    m_byteCode(CFNULL),
     m_result()
 {
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
+VectorialFunction::VectorialFunction(const VectorialFunction& other)
+  : m_isParsed(false),
+    m_vars(other.m_vars),
+    m_varNames(other.m_varNames),
+    m_nbVars(other.m_nbVars),
+    m_functions(other.m_functions),
+    m_parsers(),
+    m_byteCode(CFNULL),
+    m_result()
+{
+  // the parsers and the bytecode are owned by each object
+  if (other.m_isParsed) {
+    parse();
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 VectorialFunction::~VectorialFunction()
 {
   clear();
+  deletePtr(m_byteCode);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+const VectorialFunction& VectorialFunction::operator=(const VectorialFunction& other)
+{
+  if (&other != this) {
+    clear();
+    m_vars      = other.m_vars;
+    m_varNames  = other.m_varNames;
+    m_nbVars    = other.m_nbVars;
+    m_functions = other.m_functions;
+    if (other.m_isParsed) {
+      parse();
+    }
+  }
+  return *this;
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -49,6 +88,9 @@ void VectorialFunction::clear()
       deletePtr(m_parsers[i]);
   }
   vector<FunctionParser*>().swap(m_parsers);
+  if (m_byteCode != CFNULL) {
+    m_byteCode->clear();
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -56,6 +98,7 @@ void VectorialFunction::clear()
 void VectorialFunction::setVariables(const vector<std::string>& vars)
 {
   m_nbVars = vars.size();
+  m_varNames = vars;
   m_vars = "";
   if(vars.size() > 0) {
     m_vars = vars[0];
@@ -101,6 +144,19 @@ void VectorialFunction::parse()
     }
   }
   
+  // the parsers check the syntax, the bytecode is used for the evaluation
+  // if all the functions can be compiled
+  if (m_byteCode == CFNULL) {
+    m_byteCode = new ByteCodeFunction();
+  }
+  if (m_byteCode->compile(m_functions, m_varNames)) {
+    CFLog(VERBOSE, "VectorialFunction::parse() => " << m_functions.size()
+	  << " functions compiled into " << m_byteCode->getNbInstructions() << " instructions\n");
+  }
+  else {
+    CFLog(VERBOSE, "VectorialFunction::parse() => functions evaluated by the FunctionParser\n");
+  }
+  
   m_result.resize(m_functions.size());
   m_isParsed = true;
 }
@@ -116,6 +172,11 @@ void VectorialFunction::evaluate(const RealVector& varValue,
     cf_assert(varValue.size() == m_nbVars);
   }
 
+  if (m_byteCode != CFNULL && m_byteCode->isCompiled()) {
+    m_byteCode->evaluate(&const_cast<RealVector&>(varValue)[0], &value[0]);
+    return;
+  }
+  
   // evaluate and store the functions line by line in the vector
   for(CFuint i = 0; i < m_parsers.size(); i++) {
     value[i] = m_parsers[i]->Eval(&const_cast<RealVector&>(varValue)[0]);
@@ -141,6 +202,11 @@ RealVector& VectorialFunction::operator()(const RealVector& varValue)
   cf_assert(m_isParsed);
   cf_assert(varValue.size() == m_nbVars);
 
+  if (m_byteCode != CFNULL && m_byteCode->isCompiled()) {
+    m_byteCode->evaluate(&const_cast<RealVector&>(varValue)[0], &m_result[0]);
+    return m_result;
+  }
+  
   // evaluate and store the functions line by line in the vector
   for(CFuint i = 0; i < m_parsers.size(); i++) {
     m_result[i] = m_parsers[i]->Eval(&const_cast<RealVector&>(varValue)[0]);
@@ -149,6 +215,31 @@ RealVector& VectorialFunction::operator()(const RealVector& varValue)
   return m_result;
 }
 
+//////////////////////////////////////////////////////////////////////////////
+
+void VectorialFunction::evaluateBatch(const CFuint nbPoints,
+				      const CFreal *const varValues,
+				      CFreal *const values) const
+{
+  cf_assert(m_isParsed);
+  
+  if (m_byteCode != CFNULL && m_byteCode->isCompiled()) {
+    m_byteCode->evaluateBatch(nbPoints, varValues, values);
+    return;
+  }
+  
+  // evaluate the functions point by point
+  vector<CFreal> point(m_nbVars);
+  for (CFuint iPoint = 0; iPoint < nbPoints; ++iPoint) {
+    for (CFuint iVar = 0; iVar < m_nbVars; ++iVar) {
+      point[iVar] = varValues[iVar*nbPoints + iPoint];
+    }
+    for(CFuint i = 0; i < m_parsers.size(); i++) {
+      values[i*nbPoints + iPoint] = m_parsers[i]->Eval((m_nbVars > 0) ? &point[0] : CFNULL);
+    }
+  }
+}
+
 //////////////////////////////////////////////////////////////////////////////
 
   } // namespace Framework
@@ -18,7 +18,7 @@
 
 namespace COOLFluiD {
 
-  namespace MathTools { class FunctionParser; }
+  namespace MathTools { class FunctionParser; class ByteCodeFunction; }
 
   namespace Framework {
 
@@ -26,6 +26,9 @@ namespace COOLFluiD {
 
 /// This class represents a Function that defines the values
 /// for a vector field.
+/// The functions are compiled together into a bytecode when they are
+/// parsed, if they only use the predefined functions and constants of the
+/// FunctionParser; otherwise each one is evaluated by its own FunctionParser.
 /// @author Tiago Quintino
 class Framework_API VectorialFunction {
 
@@ -34,9 +37,15 @@ public: // functions
   /// Default constructor without arguments
   VectorialFunction();
 
+  /// Copy constructor, parsing again the functions if the given one is parsed
+  VectorialFunction(const VectorialFunction& other);
+
   /// Default destructor
   ~VectorialFunction();
 
+  /// Assignment operator, parsing again the functions if the given one is parsed
+  const VectorialFunction& operator=(const VectorialFunction& other);
+
   /// Evaluate the Vectorial Function given the values of the variables.
   /// @param vars values of the variables to substitute in the function.
   /// @param value the placeholder vector for the result
@@ -54,6 +63,13 @@ public: // functions
   /// @param vars values of the variables to substitute in the function.
   RealVector& operator()(const RealVector& varValue);
 
+  /// Evaluate the Vectorial Function in a batch of points, stored by variable.
+  /// @param nbPoints number of points
+  /// @param varValues values of the variables, varValues[iVar*nbPoints + iPoint]
+  /// @param values the values of the functions, values[iFun*nbPoints + iPoint]
+  void evaluateBatch(const CFuint nbPoints, const CFreal *const varValues,
+		     CFreal *const values) const;
+
   /// @return if the VectorialFunctionParser has been parsed yet.
   bool isParsed() const
   {
@@ -100,9 +116,12 @@ private: // data
   /// flag to indicate if the functions have been parsed
   bool m_isParsed;
 
-  /// vector holding the names of the variables
+  /// string holding the names of the variables
   std::string m_vars;
 
+  /// vector holding the names of the variables
+  std::vector<std::string> m_varNames;
+
   /// number of variables
   CFuint m_nbVars;
 
@@ -112,6 +131,9 @@ private: // data
   /// vector holding the parsers, one for each entry in the vector
   std::vector<MathTools::FunctionParser*> m_parsers;
 
+  /// functions compiled into a bytecode, allocated when they are parsed
+  MathTools::ByteCodeFunction* m_byteCode;
+
   /// storage of the result for using the class as functor
   RealVector m_result;
 
@@ -0,0 +1,762 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+#include "MathTools/ByteCodeFunction.hh"
+#include "MathTools/FParser/fpconfig.hh"
+#include "MathTools/FParser/fparser.hh"
+#include "MathTools/FParser/extrasrc/fpaux.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace FUNCTIONPARSERTYPES;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace MathTools {
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// operations of the graph and of the bytecode
+enum OpCode {
+  // leaves
+  OP_VAR, OP_CONST,
+  // unary operations
+  OP_NEG, OP_NOT, OP_ABS, OP_ACOS, OP_ACOSH, OP_ASIN, OP_ASINH, OP_ATAN, OP_ATANH,
+  OP_CBRT, OP_CEIL, OP_COS, OP_COSH, OP_COT, OP_CSC, OP_EXP, OP_EXP2, OP_FLOOR,
+  OP_INT, OP_LOG, OP_LOG10, OP_LOG2, OP_SEC, OP_SIN, OP_SINH, OP_SQRT, OP_TAN,
+  OP_TANH, OP_TRUNC,
+  // binary operations
+  OP_ADD, OP_SUB, OP_MUL, OP_DIV, OP_MOD, OP_POW, OP_ATAN2, OP_HYPOT, OP_MIN, OP_MAX,
+  OP_EQUAL, OP_NEQUAL, OP_LESS, OP_LESSEQ, OP_GREATER, OP_GREATEREQ, OP_AND, OP_OR,
+  // ternary operations
+  OP_IF,
+  // functions which are expanded when parsed
+  OP_R2, OP_R3
+};
+
+/// function which can be called in the expressions
+struct FunctionDef {
+  const char* name;
+  CFuint op;
+  CFuint nbArgs;
+};
+
+/// functions supported by the FunctionParser, apart from "rand"
+const FunctionDef functionDefs[] = {
+  {"abs", OP_ABS, 1}, {"acos", OP_ACOS, 1}, {"acosh", OP_ACOSH, 1},
+  {"asin", OP_ASIN, 1}, {"asinh", OP_ASINH, 1}, {"atan", OP_ATAN, 1},
+  {"atan2", OP_ATAN2, 2}, {"atanh", OP_ATANH, 1}, {"cbrt", OP_CBRT, 1},
+  {"ceil", OP_CEIL, 1}, {"cos", OP_COS, 1}, {"cosh", OP_COSH, 1},
+  {"cot", OP_COT, 1}, {"csc", OP_CSC, 1}, {"exp", OP_EXP, 1},
+  {"exp2", OP_EXP2, 1}, {"floor", OP_FLOOR, 1}, {"hypot", OP_HYPOT, 2},
+  {"if", OP_IF, 3}, {"int", OP_INT, 1}, {"log", OP_LOG, 1},
+  {"log10", OP_LOG10, 1}, {"log2", OP_LOG2, 1}, {"max", OP_MAX, 2},
+  {"min", OP_MIN, 2}, {"pow", OP_POW, 2}, {"sec", OP_SEC, 1},
+  {"sin", OP_SIN, 1}, {"sinh", OP_SINH, 1}, {"sqrt", OP_SQRT, 1},
+  {"tan", OP_TAN, 1}, {"tanh", OP_TANH, 1}, {"trunc", OP_TRUNC, 1},
+  {"R2", OP_R2, 2}, {"R3", OP_R3, 3}
+};
+
+/// constants added by the FunctionParser
+struct ConstantDef {
+  const char* name;
+  CFreal value;
+};
+
+const ConstantDef constantDefs[] = {
+  {"pi", 3.14159265358979323846},
+  {"e", 2.71828182845904523536},
+  {"Rair", 287.046}
+};
+
+/// number of points of each block in the batch evaluation
+const CFuint BLOCK_SIZE = 64;
+
+/// largest integer exponent expanded into multiplications
+const CFreal MAX_INTEGER_POWER = 1024.;
+
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bool ByteCodeFunction::Node::operator<(const Node& other) const
+{
+  if (op != other.op) return op < other.op;
+  for (CFuint i = 0; i < 3; ++i) {
+    if (args[i] != other.args[i]) return args[i] < other.args[i];
+  }
+  if (value < other.value) return true;
+  if (other.value < value) return false;
+  // distinguish -0 from 0
+  return (value == 0.) && (1./value < 1./other.value);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ByteCodeFunction::ByteCodeFunction() :
+  m_isCompiled(false),
+  m_nbVars(0),
+  m_nbFuncs(0),
+  m_varNames(),
+  m_nodes(),
+  m_nodeIDs(),
+  m_expr(CFNULL),
+  m_program(),
+  m_outputs(),
+  m_constants(),
+  m_nbRegisters(0),
+  m_registers()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ByteCodeFunction::~ByteCodeFunction()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ByteCodeFunction::clear()
+{
+  m_isCompiled = false;
+  m_nbVars = 0;
+  m_nbFuncs = 0;
+  m_varNames.clear();
+  m_nodes.clear();
+  m_nodeIDs.clear();
+  m_expr = CFNULL;
+  m_program.clear();
+  m_outputs.clear();
+  m_constants.clear();
+  m_nbRegisters = 0;
+  vector<CFreal>().swap(m_registers);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bool ByteCodeFunction::compile(const vector<string>& functions,
+			       const vector<string>& vars)
+{
+  clear();
+
+  m_nbVars = vars.size();
+  m_nbFuncs = functions.size();
+  m_varNames = vars;
+
+  // the first nodes are the variables
+  for (CFuint iVar = 0; iVar < m_nbVars; ++iVar) {
+    m_nodes.push_back(Node(OP_VAR, iVar));
+  }
+
+  // all the functions share the same graph
+  vector<CFuint> roots(m_nbFuncs);
+  for (CFuint iFun = 0; iFun < m_nbFuncs; ++iFun) {
+    m_expr = functions[iFun].c_str();
+    skipSpaces();
+    const CFint root = parseOr();
+    if (root < 0 || *m_expr != '\0') {
+      clear();
+      return false;
+    }
+    roots[iFun] = root;
+  }
+
+  buildProgram(roots);
+
+  // the graph is not needed anymore
+  vector<Node>().swap(m_nodes);
+  m_nodeIDs.clear();
+  m_expr = CFNULL;
+
+  m_isCompiled = true;
+  return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ByteCodeFunction::skipSpaces()
+{
+  while (isspace(static_cast<unsigned char>(*m_expr))) {++m_expr;}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFint ByteCodeFunction::parseOr()
+{
+  CFint a = parseAnd();
+  while (a >= 0 && *m_expr == '|') {
+    ++m_expr;
+    skipSpaces();
+    const CFint b = parseAnd();
+    if (b < 0) return -1;
+    a = addNode(OP_OR, a, b);
+  }
+  return a;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFint ByteCodeFunction::parseAnd()
+{
+  CFint a = parseComparison();
+  while (a >= 0 && *m_expr == '&') {
+    ++m_expr;
+    skipSpaces();
+    const CFint b = parseComparison();
+    if (b < 0) return -1;
+    a = addNode(OP_AND, a, b);
+  }
+  return a;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFint ByteCodeFunction::parseComparison()
+{
+  CFint a = parseAddition();
+  while (a >= 0) {
+    CFuint op = OP_EQUAL;
+    if (m_expr[0] == '=') {
+      m_expr += 1; op = OP_EQUAL;
+    }
+    else if (m_expr[0] == '!' && m_expr[1] == '=') {
+      m_expr += 2; op = OP_NEQUAL;
+    }
+    else if (m_expr[0] == '<') {
+      const bool orEqual = (m_expr[1] == '=');
+      m_expr += orEqual ? 2 : 1; op = orEqual ? OP_LESSEQ : OP_LESS;
+    }
+    else if (m_expr[0] == '>') {
+      const bool orEqual = (m_expr[1] == '=');
+      m_expr += orEqual ? 2 : 1; op = orEqual ? OP_GREATEREQ : OP_GREATER;
+    }
+    else {
+      break;
+    }
+    skipSpaces();
+    const CFint b = parseAddition();
+    if (b < 0) return -1;
+    a = addNode(op, a, b);
+  }
+  return a;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFint ByteCodeFunction::parseAddition()
+{
+  CFint a = parseMultiplication();
+  while (a >= 0 && (*m_expr == '+' || *m_expr == '-')) {
+    const CFuint op = (*m_expr == '+') ? OP_ADD : OP_SUB;
+    ++m_expr;
+    skipSpaces();
+    const CFint b = parseMultiplication();
+    if (b < 0) return -1;
+    a = addNode(op, a, b);
+  }
+  return a;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFint ByteCodeFunction::parseMultiplication()
+{
+  CFint a = parseUnary();
+  while (a >= 0 && (*m_expr == '*' || *m_expr == '/' || *m_expr == '%')) {
+    const CFuint op = (*m_expr == '*') ? OP_MUL : (*m_expr == '/') ? OP_DIV : OP_MOD;
+    ++m_expr;
+    skipSpaces();
+    const CFint b = parseUnary();
+    if (b < 0) return -1;
+    a = addNode(op, a, b);
+  }
+  return a;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFint ByteCodeFunction::parseUnary()
+{
+  if (*m_expr == '-' || *m_expr == '!') {
+    const CFuint op = (*m_expr == '-') ? OP_NEG : OP_NOT;
+    ++m_expr;
+    skipSpaces();
+    const CFint a = parseUnary();
+    if (a < 0) return -1;
+    return addNode(op, a);
+  }
+  return parsePower();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFint ByteCodeFunction::parsePower()
+{
+  const CFint base = parseElement();
+  if (base < 0 || *m_expr != '^') return base;
+
+  ++m_expr;
+  skipSpaces();
+  // the exponent can have a sign, as in x^-2
+  const CFint exponent = parseUnary();
+  if (exponent < 0) return -1;
+
+  if (m_nodes[base].op == OP_CONST && m_nodes[base].value == constantDefs[1].value) {
+    return addNode(OP_EXP, exponent);
+  }
+
+  // integer powers are computed as the FunctionParser does, by repeated
+  // multiplications, which are shared with the other subexpressions
+  const bool isConstantExponent = (m_nodes[exponent].op == OP_CONST);
+  const CFreal e = m_nodes[exponent].value;
+  if (isConstantExponent && e == std::floor(e) && std::abs(e) <= MAX_INTEGER_POWER) {
+    const CFuint power = addIntegerPower(base, static_cast<unsigned long>(std::abs(e)));
+    return (e >= 0.) ? power : addNode(OP_DIV, addConstant(1.), power);
+  }
+
+  return addNode(OP_POW, base, exponent);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFint ByteCodeFunction::parseElement()
+{
+  const char c = *m_expr;
+
+  // number
+  if (isdigit(static_cast<unsigned char>(c)) || c == '.') {
+    if (c == '0' && (m_expr[1] == 'x' || m_expr[1] == 'X')) return -1;
+    char* end = CFNULL;
+    const CFreal value = strtod(m_expr, &end);
+    if (end == m_expr) return -1;
+    m_expr = end;
+    skipSpaces();
+    return addConstant(value);
+  }
+
+  // parenthesis
+  if (c == '(') {
+    ++m_expr;
+    skipSpaces();
+    const CFint a = parseOr();
+    if (a < 0 || *m_expr != ')') return -1;
+    ++m_expr;
+    skipSpaces();
+    return a;
+  }
+
+  // function, variable or constant
+  const char* end = m_expr;
+  while (isalnum(static_cast<unsigned char>(*end)) || *end == '_' ||
+	 static_cast<unsigned char>(*end) >= 0x80) {
+    ++end;
+  }
+  if (end == m_expr) return -1;
+  const string name(m_expr, end);
+  m_expr = end;
+  skipSpaces();
+
+  if (*m_expr == '(') {
+    const CFuint nbFunctions = sizeof(functionDefs)/sizeof(FunctionDef);
+    for (CFuint i = 0; i < nbFunctions; ++i) {
+      if (name == functionDefs[i].name) {
+	CFint args[3] = {0, 0, 0};
+	if (!parseArguments(functionDefs[i].nbArgs, args)) return -1;
+
+	const CFuint op = functionDefs[i].op;
+	if (op == OP_R2 || op == OP_R3) {
+	  // same operations as Radius2D() and Radius3D()
+	  CFuint sum = addNode(OP_ADD, addNode(OP_MUL, args[0], args[0]),
+			       addNode(OP_MUL, args[1], args[1]));
+	  if (op == OP_R3) {
+	    sum = addNode(OP_ADD, sum, addNode(OP_MUL, args[2], args[2]));
+	  }
+	  return addNode(OP_SQRT, sum);
+	}
+	return addNode(op, args[0], args[1], args[2]);
+      }
+    }
+    // user defined or random functions
+    return -1;
+  }
+
+  for (CFuint iVar = 0; iVar < m_nbVars; ++iVar) {
+    if (name == m_varNames[iVar]) return iVar;
+  }
+
+  const CFuint nbConstants = sizeof(constantDefs)/sizeof(ConstantDef);
+  for (CFuint i = 0; i < nbConstants; ++i) {
+    if (name == constantDefs[i].name) return addConstant(constantDefs[i].value);
+  }
+
+  return -1;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bool ByteCodeFunction::parseArguments(const CFuint nbArgs, CFint *const args)
+{
+  for (CFuint i = 0; i < nbArgs; ++i) {
+    // skip the opening parenthesis or the comma
+    ++m_expr;
+    skipSpaces();
+    args[i] = parseOr();
+    if (args[i] < 0) return false;
+    if (*m_expr != ((i+1 < nbArgs) ? ',' : ')')) return false;
+  }
+  ++m_expr;
+  skipSpaces();
+  return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFuint ByteCodeFunction::addNode(const CFuint op, const CFuint a0,
+				 const CFuint a1, const CFuint a2)
+{
+  const CFuint nbArgs = getNbArgs(op);
+  const CFuint args[3] = {a0, (nbArgs > 1) ? a1 : 0, (nbArgs > 2) ? a2 : 0};
+
+  // constant folding
+  bool isConstant = true;
+  for (CFuint i = 0; i < nbArgs; ++i) {
+    isConstant = isConstant && (m_nodes[args[i]].op == OP_CONST);
+  }
+  if (isConstant) {
+    return addConstant(apply(op, m_nodes[args[0]].value,
+			     m_nodes[args[1]].value, m_nodes[args[2]].value));
+  }
+  if (op == OP_IF && m_nodes[a0].op == OP_CONST) {
+    return fp_truth(m_nodes[a0].value) ? a1 : a2;
+  }
+
+  Node node(op, args[0], args[1], args[2]);
+  switch (op) {
+  case OP_ADD: case OP_MUL: case OP_HYPOT: case OP_EQUAL: case OP_NEQUAL:
+  case OP_AND: case OP_OR:
+    // the order of the arguments does not change the result
+    if (node.args[0] > node.args[1]) std::swap(node.args[0], node.args[1]);
+    break;
+  default:
+    break;
+  }
+
+  // common subexpressions
+  map<Node, CFuint>::const_iterator it = m_nodeIDs.find(node);
+  if (it != m_nodeIDs.end()) return it->second;
+
+  const CFuint id = m_nodes.size();
+  m_nodes.push_back(node);
+  m_nodeIDs.insert(make_pair(node, id));
+  return id;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFuint ByteCodeFunction::addConstant(const CFreal value)
+{
+  const Node node(OP_CONST, 0, 0, 0, value);
+  if (value == value) {
+    map<Node, CFuint>::const_iterator it = m_nodeIDs.find(node);
+    if (it != m_nodeIDs.end()) return it->second;
+  }
+
+  const CFuint id = m_nodes.size();
+  m_nodes.push_back(node);
+  if (value == value) {m_nodeIDs.insert(make_pair(node, id));}
+  return id;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFuint ByteCodeFunction::addIntegerPower(CFuint x, unsigned long n)
+{
+  // same sequence of multiplications as fp_powi()
+  CFint result = -1;
+  while (n != 0) {
+    if (n & 1) {
+      result = (result < 0) ? x : addNode(OP_MUL, result, x);
+      n -= 1;
+    }
+    else {
+      x = addNode(OP_MUL, x, x);
+      n /= 2;
+    }
+  }
+  return (result < 0) ? addConstant(1.) : result;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ByteCodeFunction::buildProgram(const vector<CFuint>& roots)
+{
+  const CFuint nbNodes = m_nodes.size();
+
+  // only the nodes needed by the functions are computed
+  vector<bool> isUsed(nbNodes, false);
+  for (CFuint iFun = 0; iFun < m_nbFuncs; ++iFun) {
+    isUsed[roots[iFun]] = true;
+  }
+  for (CFuint i = nbNodes; i > 0; --i) {
+    const Node& node = m_nodes[i-1];
+    if (isUsed[i-1]) {
+      for (CFuint a = 0; a < getNbArgs(node.op); ++a) {
+	isUsed[node.args[a]] = true;
+      }
+    }
+  }
+
+  // the variables are stored in the first registers, followed by the
+  // constants and by the temporaries
+  vector<CFuint> reg(nbNodes, 0);
+  m_nbRegisters = m_nbVars;
+  for (CFuint i = 0; i < nbNodes; ++i) {
+    if (m_nodes[i].op == OP_VAR) {
+      reg[i] = m_nodes[i].args[0];
+    }
+    else if (isUsed[i] && m_nodes[i].op == OP_CONST) {
+      reg[i] = m_nbRegisters++;
+      m_constants.push_back(make_pair(reg[i], m_nodes[i].value));
+    }
+  }
+
+  // last node using each node, the results are never released
+  vector<CFuint> lastUse(nbNodes, 0);
+  for (CFuint i = 0; i < nbNodes; ++i) {
+    if (isUsed[i]) {
+      for (CFuint a = 0; a < getNbArgs(m_nodes[i].op); ++a) {
+	lastUse[m_nodes[i].args[a]] = i;
+      }
+    }
+  }
+  for (CFuint iFun = 0; iFun < m_nbFuncs; ++iFun) {
+    lastUse[roots[iFun]] = nbNodes;
+  }
+
+  // the registers of the temporaries are reused as soon as they are released
+  vector<CFuint> freeRegisters;
+  for (CFuint i = 0; i < nbNodes; ++i) {
+    const Node& node = m_nodes[i];
+    if (!isUsed[i] || node.op == OP_VAR || node.op == OP_CONST) continue;
+
+    const CFuint nbArgs = getNbArgs(node.op);
+    Instruction instruction;
+    instruction.op = node.op;
+    for (CFuint a = 0; a < 3; ++a) {
+      instruction.args[a] = reg[node.args[(a < nbArgs) ? a : 0]];
+    }
+
+    for (CFuint a = 0; a < nbArgs; ++a) {
+      const CFuint arg = node.args[a];
+      const bool isTemporary = (m_nodes[arg].op != OP_VAR && m_nodes[arg].op != OP_CONST);
+      const bool isRepeated = (a > 0 && arg == node.args[0]) || (a > 1 && arg == node.args[1]);
+      if (isTemporary && !isRepeated && lastUse[arg] == i) {
+	freeRegisters.push_back(reg[arg]);
+      }
+    }
+
+    if (freeRegisters.empty()) {
+      reg[i] = m_nbRegisters++;
+    }
+    else {
+      reg[i] = freeRegisters.back();
+      freeRegisters.pop_back();
+    }
+    instruction.dest = reg[i];
+    m_program.push_back(instruction);
+  }
+
+  m_outputs.resize(m_nbFuncs);
+  for (CFuint iFun = 0; iFun < m_nbFuncs; ++iFun) {
+    m_outputs[iFun] = reg[roots[iFun]];
+  }
+
+  // the constants are set once for all the points of a block
+  m_registers.assign(std::max<CFuint>(m_nbRegisters, 1)*BLOCK_SIZE, 0.);
+  for (CFuint c = 0; c < m_constants.size(); ++c) {
+    CFreal *const r = &m_registers[m_constants[c].first*BLOCK_SIZE];
+    for (CFuint k = 0; k < BLOCK_SIZE; ++k) {
+      r[k] = m_constants[c].second;
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ByteCodeFunction::evaluate(const CFreal *const vars, CFreal *const values) const
+{
+  cf_assert(m_isCompiled);
+
+  for (CFuint iVar = 0; iVar < m_nbVars; ++iVar) {
+    m_registers[iVar*BLOCK_SIZE] = vars[iVar];
+  }
+
+  run(1);
+
+  for (CFuint iFun = 0; iFun < m_nbFuncs; ++iFun) {
+    values[iFun] = m_registers[m_outputs[iFun]*BLOCK_SIZE];
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ByteCodeFunction::evaluateBatch(const CFuint nbPoints,
+				     const CFreal *const vars,
+				     CFreal *const values) const
+{
+  cf_assert(m_isCompiled);
+
+  for (CFuint start = 0; start < nbPoints; start += BLOCK_SIZE) {
+    const CFuint n = std::min(BLOCK_SIZE, nbPoints - start);
+
+    for (CFuint iVar = 0; iVar < m_nbVars; ++iVar) {
+      const CFreal *const v = &vars[iVar*nbPoints + start];
+      CFreal *const r = &m_registers[iVar*BLOCK_SIZE];
+      for (CFuint k = 0; k < n; ++k) {r[k] = v[k];}
+    }
+
+    run(n);
+
+    for (CFuint iFun = 0; iFun < m_nbFuncs; ++iFun) {
+      const CFreal *const r = &m_registers[m_outputs[iFun]*BLOCK_SIZE];
+      CFreal *const v = &values[iFun*nbPoints + start];
+      for (CFuint k = 0; k < n; ++k) {v[k] = r[k];}
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ByteCodeFunction::run(const CFuint nbPoints) const
+{
+  CFreal *const registers = &m_registers[0];
+  const CFuint nbInstructions = m_program.size();
+  for (CFuint i = 0; i < nbInstructions; ++i) {
+    const Instruction& instruction = m_program[i];
+    CFreal *const d = registers + instruction.dest*BLOCK_SIZE;
+    const CFreal *const a = registers + instruction.args[0]*BLOCK_SIZE;
+    const CFreal *const b = registers + instruction.args[1]*BLOCK_SIZE;
+    const CFreal *const c = registers + instruction.args[2]*BLOCK_SIZE;
+
+    // the arithmetic operations have their own loops, which the compiler
+    // can vectorize, the others call apply() on each point
+    switch (instruction.op) {
+    case OP_ADD:
+      for (CFuint k = 0; k < nbPoints; ++k) {d[k] = a[k] + b[k];}
+      break;
+    case OP_SUB:
+      for (CFuint k = 0; k < nbPoints; ++k) {d[k] = a[k] - b[k];}
+      break;
+    case OP_MUL:
+      for (CFuint k = 0; k < nbPoints; ++k) {d[k] = a[k] * b[k];}
+      break;
+    case OP_DIV:
+      for (CFuint k = 0; k < nbPoints; ++k) {d[k] = a[k] / b[k];}
+      break;
+    case OP_NEG:
+      for (CFuint k = 0; k < nbPoints; ++k) {d[k] = -a[k];}
+      break;
+    case OP_IF:
+      for (CFuint k = 0; k < nbPoints; ++k) {d[k] = fp_truth(a[k]) ? b[k] : c[k];}
+      break;
+    default:
+      for (CFuint k = 0; k < nbPoints; ++k) {
+	d[k] = apply(instruction.op, a[k], b[k], c[k]);
+      }
+      break;
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFuint ByteCodeFunction::getNbArgs(const CFuint op)
+{
+  if (op < OP_NEG) return 0;
+  if (op < OP_ADD) return 1;
+  if (op < OP_IF)  return 2;
+  return 3;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFreal ByteCodeFunction::apply(const CFuint op, const CFreal x,
+			       const CFreal y, const CFreal z)
+{
+  // same functions as in FunctionParser::Eval()
+  switch (op) {
+  case OP_NEG:       return -x;
+  case OP_NOT:       return CFreal(!fp_truth(x));
+  case OP_ABS:       return fp_abs(x);
+  case OP_ACOS:      return fp_acos(x);
+  case OP_ACOSH:     return fp_acosh(x);
+  case OP_ASIN:      return fp_asin(x);
+  case OP_ASINH:     return fp_asinh(x);
+  case OP_ATAN:      return fp_atan(x);
+  case OP_ATANH:     return fp_atanh(x);
+  case OP_CBRT:      return fp_cbrt(x);
+  case OP_CEIL:      return fp_ceil(x);
+  case OP_COS:       return fp_cos(x);
+  case OP_COSH:      return fp_cosh(x);
+  case OP_COT:       return CFreal(1)/fp_tan(x);
+  case OP_CSC:       return CFreal(1)/fp_sin(x);
+  case OP_EXP:       return fp_exp(x);
+  case OP_EXP2:      return fp_exp2(x);
+  case OP_FLOOR:     return fp_floor(x);
+  case OP_INT:       return fp_int(x);
+  case OP_LOG:       return fp_log(x);
+  case OP_LOG10:     return fp_log10(x);
+  case OP_LOG2:      return fp_log2(x);
+  case OP_SEC:       return CFreal(1)/fp_cos(x);
+  case OP_SIN:       return fp_sin(x);
+  case OP_SINH:      return fp_sinh(x);
+  case OP_SQRT:      return fp_sqrt(x);
+  case OP_TAN:       return fp_tan(x);
+  case OP_TANH:      return fp_tanh(x);
+  case OP_TRUNC:     return fp_trunc(x);
+  case OP_ADD:       return x + y;
+  case OP_SUB:       return x - y;
+  case OP_MUL:       return x * y;
+  case OP_DIV:       return x / y;
+  case OP_MOD:       return fp_mod(x, y);
+  case OP_POW:       return fp_pow(x, y);
+  case OP_ATAN2:     return fp_atan2(x, y);
+  case OP_HYPOT:     return fp_hypot(x, y);
+  case OP_MIN:       return fp_min(x, y);
+  case OP_MAX:       return fp_max(x, y);
+  case OP_EQUAL:     return CFreal(fp_equal(x, y));
+  case OP_NEQUAL:    return CFreal(fp_nequal(x, y));
+  case OP_LESS:      return CFreal(fp_less(x, y));
+  case OP_LESSEQ:    return CFreal(fp_lessOrEq(x, y));
+  case OP_GREATER:   return CFreal(fp_greater(x, y));
+  case OP_GREATEREQ: return CFreal(fp_greaterOrEq(x, y));
+  case OP_AND:       return CFreal(fp_truth(x) && fp_truth(y));
+  case OP_OR:        return CFreal(fp_truth(x) || fp_truth(y));
+  case OP_IF:        return fp_truth(x) ? y : z;
+  }
+  cf_assert(false);
+  return 0.;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace MathTools
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
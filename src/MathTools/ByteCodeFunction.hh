@@ -0,0 +1,210 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_MathTools_ByteCodeFunction_hh
+#define COOLFluiD_MathTools_ByteCodeFunction_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Common/COOLFluiD.hh"
+#include "MathTools/MathTools.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace MathTools {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class compiles a set of functions of the same variables, written
+/// with the syntax of the FunctionParser, into a register bytecode.
+/// The functions are compiled together into a single graph, so that the
+/// constant subexpressions are folded and the subexpressions which are
+/// common to several functions are computed only once.
+/// The bytecode can be evaluated for a single point or for a batch of points,
+/// in which case each instruction is applied to a block of points at a time.
+/// Only the functions and constants predefined by the FunctionParser are
+/// supported, apart from "rand": compile() fails for the other functions,
+/// which must then be evaluated by the FunctionParser.
+/// As for the FunctionParser, the evaluation is not thread-safe.
+/// @author Andrea Lani
+class MathTools_API ByteCodeFunction {
+public:
+
+  /// Constructor
+  ByteCodeFunction();
+
+  /// Destructor
+  ~ByteCodeFunction();
+
+  /// Compile the given functions, which must already be known to be valid
+  /// for the FunctionParser
+  /// @param functions expressions of the functions
+  /// @param vars      names of the variables
+  /// @return false if some function cannot be compiled, in which case
+  ///         nothing is compiled
+  bool compile(const std::vector<std::string>& functions,
+	       const std::vector<std::string>& vars);
+
+  /// Remove the compiled functions
+  void clear();
+
+  /// @return true if the functions have been compiled
+  bool isCompiled() const {return m_isCompiled;}
+
+  /// @return the number of instructions of the bytecode
+  CFuint getNbInstructions() const {return m_program.size();}
+
+  /// Evaluate the functions in one point
+  /// @param vars   values of the variables
+  /// @param values values of the functions
+  void evaluate(const CFreal *const vars, CFreal *const values) const;
+
+  /// Evaluate the functions in a batch of points, stored by variable
+  /// @param nbPoints number of points
+  /// @param vars     values of the variables, vars[iVar*nbPoints + iPoint]
+  /// @param values   values of the functions, values[iFun*nbPoints + iPoint]
+  void evaluateBatch(const CFuint nbPoints, const CFreal *const vars,
+		     CFreal *const values) const;
+
+private: // helper classes
+
+  /// Node of the expression graph, either a variable, a constant or an
+  /// operation with up to three arguments
+  class Node {
+  public:
+    /// Constructor
+    Node(const CFuint op, const CFuint a0 = 0, const CFuint a1 = 0,
+	 const CFuint a2 = 0, const CFreal value = 0.)
+      : op(op), value(value)
+    {
+      args[0] = a0; args[1] = a1; args[2] = a2;
+    }
+
+    /// @return true if this node comes before the given one in the
+    ///         ordering used to find the common subexpressions
+    bool operator<(const Node& other) const;
+
+    /// operation
+    CFuint op;
+
+    /// arguments (or index of the variable)
+    CFuint args[3];
+
+    /// value of the constant
+    CFreal value;
+  };
+
+  /// Instruction of the bytecode
+  class Instruction {
+  public:
+    /// operation
+    CFuint op;
+
+    /// register of the result
+    CFuint dest;
+
+    /// registers of the arguments
+    CFuint args[3];
+  };
+
+private: // helper functions
+
+  /// Parse the expressions at the given levels of precedence,
+  /// returning the node of the expression or -1 if it cannot be compiled
+  CFint parseOr();
+  CFint parseAnd();
+  CFint parseComparison();
+  CFint parseAddition();
+  CFint parseMultiplication();
+  CFint parseUnary();
+  CFint parsePower();
+  CFint parseElement();
+
+  /// Parse the comma separated arguments of a function, including the parentheses
+  /// @return false if the arguments cannot be compiled
+  bool parseArguments(const CFuint nbArgs, CFint *const args);
+
+  /// Skip the white spaces in the expression
+  void skipSpaces();
+
+  /// Add a node, folding it if all its arguments are constant and reusing
+  /// an identical existing node if any
+  /// @return the index of the node
+  CFuint addNode(const CFuint op, const CFuint a0, const CFuint a1 = 0, const CFuint a2 = 0);
+
+  /// Add a constant node
+  CFuint addConstant(const CFreal value);
+
+  /// Add the nodes computing x^n, for a non negative integer n
+  CFuint addIntegerPower(CFuint x, unsigned long n);
+
+  /// Build the bytecode computing the roots of the graph
+  void buildProgram(const std::vector<CFuint>& roots);
+
+  /// Run the bytecode on the points whose variables are already set in the registers
+  void run(const CFuint nbPoints) const;
+
+  /// @return the number of arguments of the given operation
+  static CFuint getNbArgs(const CFuint op);
+
+  /// @return the result of the given operation on scalar arguments
+  static CFreal apply(const CFuint op, const CFreal x, const CFreal y, const CFreal z);
+
+private: // data
+
+  /// flag telling if the functions have been compiled
+  bool m_isCompiled;
+
+  /// number of variables
+  CFuint m_nbVars;
+
+  /// number of functions
+  CFuint m_nbFuncs;
+
+  /// names of the variables
+  std::vector<std::string> m_varNames;
+
+  /// nodes of the expression graph, each one after its arguments
+  std::vector<Node> m_nodes;
+
+  /// nodes already in the graph
+  std::map<Node, CFuint> m_nodeIDs;
+
+  /// expression being parsed
+  const char* m_expr;
+
+  /// bytecode, in order of execution
+  std::vector<Instruction> m_program;
+
+  /// register of each function
+  std::vector<CFuint> m_outputs;
+
+  /// constants and register where each one is stored
+  std::vector<std::pair<CFuint, CFreal> > m_constants;
+
+  /// number of registers
+  CFuint m_nbRegisters;
+
+  /// registers, each one storing the values of a block of points
+  mutable std::vector<CFreal> m_registers;
+
+}; // end of class ByteCodeFunction
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace MathTools
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_MathTools_ByteCodeFunction_hh
@@ -0,0 +1,132 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE "Test uniform lookup table 2D"
+
+#ifdef CF_HAVE_BOOST_1_59
+#include <boost/test/tools/floating_point_comparison.hpp>
+#else
+#include <boost/test/floating_point_comparison.hpp>
+#endif
+
+#include <boost/test/unit_test.hpp>
+
+#include "Common/UniformLookupTable2D.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD;
+using namespace COOLFluiD::Common;
+
+using namespace boost::unit_test;
+
+//////////////////////////////////////////////////////////////////////////////
+
+struct UniformLookupTable2D_Fixture
+{
+  typedef UniformLookupTable2D<CFreal> Table;
+
+  /// common setup for each test case
+  UniformLookupTable2D_Fixture()
+  {
+    // first key in [200,1000] (linear), second key in [10,1e5] (logarithmic)
+    m_table.initialize(200., 1000., 9, Table::LINEAR,
+		       10., 1e5, 5, Table::LOGARITHMIC, 3);
+
+    for (CFuint j = 0; j < m_table.getNbKeys2(); ++j) {
+      for (CFuint i = 0; i < m_table.getNbKeys1(); ++i) {
+	CFreal* v = m_table.getValues(i,j);
+	f(m_table.getKey1(i), m_table.getKey2(j), v);
+      }
+    }
+  }
+
+  /// common tear-down for each test case
+  ~UniformLookupTable2D_Fixture()
+  {
+  }
+
+  /// functions stored in the table, all bilinear in (key1, log(key2)),
+  /// so that they are interpolated exactly
+  static void f(const CFreal x, const CFreal y, CFreal* v)
+  {
+    const CFreal ly = std::log(y);
+    v[0] = 1.;
+    v[1] = 2.*x - 3.*ly + 0.5;
+    v[2] = x*ly;
+  }
+
+  /// table under test
+  Table m_table;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+BOOST_FIXTURE_TEST_SUITE( UniformLookupTable2D_TestSuite, UniformLookupTable2D_Fixture )
+
+////////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_CASE( test_keys )
+{
+  BOOST_CHECK_EQUAL( m_table.getNbKeys1(), 9u );
+  BOOST_CHECK_EQUAL( m_table.getNbKeys2(), 5u );
+  BOOST_CHECK_EQUAL( m_table.getValueStride(), 3u );
+  BOOST_CHECK_CLOSE( m_table.getKey1(1), 300., 1E-10 );
+  BOOST_CHECK_CLOSE( m_table.getKey2(1), 100., 1E-10 );
+  BOOST_CHECK_CLOSE( m_table.getKey2(4), 1e5, 1E-10 );
+
+  BOOST_CHECK( m_table.isInside(200., 10.) );
+  BOOST_CHECK( m_table.isInside(1000., 1e5) );
+  BOOST_CHECK( !m_table.isInside(199., 100.) );
+  BOOST_CHECK( !m_table.isInside(500., 1.1e5) );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_CASE( test_interpolation )
+{
+  CFreal exact[3];
+  CFreal interp[3];
+
+  // inside the cells, on the bounds and on the last point of the table
+  const CFreal x[] = {200., 237.5, 512.3, 999.9, 1000.};
+  const CFreal y[] = {10., 42.7, 3333., 99999., 1e5};
+  for (CFuint i = 0; i < 5; ++i) {
+    for (CFuint j = 0; j < 5; ++j) {
+      f(x[i], y[j], exact);
+      m_table.interpolate(x[i], y[j], interp);
+      for (CFuint iv = 0; iv < 3; ++iv) {
+	BOOST_CHECK_SMALL( interp[iv] - exact[iv], 1e-9*(1. + std::abs(exact[iv])) );
+	BOOST_CHECK_SMALL( m_table.get(x[i], y[j], iv) - interp[iv], 1e-12*(1. + std::abs(interp[iv])) );
+      }
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_CASE( test_cell_center )
+{
+  // a function which is not bilinear is averaged at the cell centers
+  Table table;
+  table.initialize(0., 1., 2, Table::LINEAR, 0., 1., 2, Table::LINEAR, 1);
+  table.getValues(0,0)[0] = 0.;
+  table.getValues(1,0)[0] = 1.;
+  table.getValues(0,1)[0] = 1.;
+  table.getValues(1,1)[0] = 4.;
+
+  BOOST_CHECK_CLOSE( table.get(0.5, 0.5, 0), 1.5, 1E-12 );
+  BOOST_CHECK_CLOSE( table.get(0.25, 0., 0), 0.25, 1E-12 );
+  BOOST_CHECK_CLOSE( table.get(1., 0.5, 0), 2.5, 1E-12 );
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_SUITE_END()
+
+//////////////////////////////////////////////////////////////////////////////
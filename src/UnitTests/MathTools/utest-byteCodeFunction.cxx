@@ -0,0 +1,162 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE "Test bytecode function"
+
+#ifdef CF_HAVE_BOOST_1_59
+#include <boost/test/tools/floating_point_comparison.hpp>
+#else
+#include <boost/test/floating_point_comparison.hpp>
+#endif
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdlib>
+
+#include "MathTools/FunctionParser.hh"
+#include "MathTools/ByteCodeFunction.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD;
+using namespace COOLFluiD::MathTools;
+
+using namespace boost::unit_test;
+#ifdef CF_HAVE_BOOST_1_59
+using boost::math::fpc::close_at_tolerance;
+using boost::math::fpc::percent_tolerance;
+#else
+using boost::test_tools::close_at_tolerance;
+using boost::test_tools::percent_tolerance;
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+
+struct ByteCodeFunction_Fixture
+{
+  /// common setup for each test case
+  ByteCodeFunction_Fixture()
+  {
+    const char* functions[] = {
+      "x+y*z", "-x^2", "2^-x", "x^3-2*x^2+1", "x^-3", "e^x", "sin(x)*cos(y)+sin(x)",
+      "if(x>0.5, sqrt(x), -y)", "x<y & y<=z | !(x=z)", "R2(x,y)", "R3(x,y,z)",
+      "min(x,y)+max(y,z)+atan2(x,y)+hypot(x,z)", "x%0.3 + int(y*3) + trunc(-z*2.7)",
+      "pow(x,2.5)+pow(y,3)", "pi*Rair*e", "1.5e-3*x + .5 - 2.", "cot(x)+csc(y)+sec(z)",
+      "log(x+2)+log10(y+2)+log2(z+2)+exp2(x)+cbrt(y)", "floor(x*10)/ceil(y*10+1)",
+      "abs(-x)*acos(y/4)+asin(z/4)+atan(x)+tanh(y)+sinh(z)+cosh(x)",
+      "(x+y)*(x+y)-(y+x)", "3*4+x*0", "x != y", "if(1, x, 1/0)", " ( x  + 1 ) ^ 2 ",
+      "x >= y", "2^x + 2^3"
+    };
+    m_functions.assign(functions, functions + sizeof(functions)/sizeof(char*));
+
+    m_vars.push_back("x");
+    m_vars.push_back("y");
+    m_vars.push_back("z");
+  }
+
+  /// common tear-down for each test case
+  ~ByteCodeFunction_Fixture()
+  {
+  }
+
+  /// functions of the tests
+  vector<string> m_functions;
+
+  /// names of the variables
+  vector<string> m_vars;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+BOOST_FIXTURE_TEST_SUITE( ByteCodeFunction_TestSuite, ByteCodeFunction_Fixture )
+
+////////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_CASE( test_against_function_parser )
+{
+  ByteCodeFunction byteCode;
+  BOOST_REQUIRE( byteCode.compile(m_functions, m_vars) );
+
+  const CFuint nbFuncs = m_functions.size();
+  vector<FunctionParser*> parsers(nbFuncs);
+  for (CFuint i = 0; i < nbFuncs; ++i) {
+    parsers[i] = new FunctionParser();
+    BOOST_REQUIRE( parsers[i]->Parse(m_functions[i], "x,y,z") < 0 );
+  }
+
+  // the number of points is not a multiple of the size of the blocks
+  const CFuint nbPoints = 1000;
+  vector<CFreal> vars(3*nbPoints);
+  std::srand(3);
+  for (CFuint i = 0; i < vars.size(); ++i) {
+    vars[i] = 2.*std::rand()/RAND_MAX - 0.5;
+  }
+
+  vector<CFreal> values(nbFuncs*nbPoints);
+  byteCode.evaluateBatch(nbPoints, &vars[0], &values[0]);
+
+  vector<CFreal> pointValues(nbFuncs);
+  CFreal point[3];
+  for (CFuint iPoint = 0; iPoint < nbPoints; ++iPoint) {
+    for (CFuint iVar = 0; iVar < 3; ++iVar) {
+      point[iVar] = vars[iVar*nbPoints + iPoint];
+    }
+    byteCode.evaluate(point, &pointValues[0]);
+
+    for (CFuint i = 0; i < nbFuncs; ++i) {
+      const CFreal expected = parsers[i]->Eval(point);
+      if (parsers[i]->EvalError() != 0) continue;
+
+      // the batch and the single point evaluations run the same instructions
+      BOOST_CHECK_EQUAL( values[i*nbPoints + iPoint], pointValues[i] );
+      BOOST_CHECK_SMALL( (pointValues[i] - expected)/(1. + std::abs(expected)), 1e-12 );
+    }
+  }
+
+  for (CFuint i = 0; i < nbFuncs; ++i) {
+    delete parsers[i];
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_CASE( test_folding )
+{
+  vector<string> functions(2);
+  functions[0] = "(x+y)*(x+y)";
+  functions[1] = "3*4 + (y+x)";
+
+  ByteCodeFunction byteCode;
+  BOOST_REQUIRE( byteCode.compile(functions, m_vars) );
+
+  // x+y is computed once, 3*4 is folded
+  BOOST_CHECK_EQUAL( byteCode.getNbInstructions(), 3u );
+
+  const CFreal point[3] = {1., 2., 5.};
+  CFreal values[2];
+  byteCode.evaluate(point, values);
+  BOOST_CHECK_CLOSE( values[0], 9., 1E-12 );
+  BOOST_CHECK_CLOSE( values[1], 15., 1E-12 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_CASE( test_not_compiled )
+{
+  ByteCodeFunction byteCode;
+  BOOST_CHECK( !byteCode.compile(vector<string>(1, "rand()+x"), m_vars) );
+  BOOST_CHECK( !byteCode.isCompiled() );
+  BOOST_CHECK( !byteCode.compile(vector<string>(1, "foo(x)"), m_vars) );
+  BOOST_CHECK( !byteCode.isCompiled() );
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_SUITE_END()
+
+//////////////////////////////////////////////////////////////////////////////